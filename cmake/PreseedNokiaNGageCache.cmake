@@ -182,6 +182,9 @@ if(NGAGESDK)
     set(HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCHDIR           ""    CACHE INTERNAL "Have symbol addchdir")
     set(HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCHDIR_NP        ""    CACHE INTERNAL "Have symbol addchdir_np")
     set(HAVE_FDATASYNC                                   ""    CACHE INTERNAL "Have symbol fdatasync")
+    set(HAVE_PREAD                                       ""    CACHE INTERNAL "Have symbol pread")
+    set(HAVE_PWRITE                                      ""    CACHE INTERNAL "Have symbol pwrite")
+    set(HAVE_MMAP                                        ""    CACHE INTERNAL "Have symbol mmap")
 
     set(HAVE_SDL_FSOPS                                   "1"   CACHE INTERNAL "Enable SDL_FSOPS")
     set(HAVE_SDL_LOCALE                                  "1"   CACHE INTERNAL "Enable SDL_LOCALE")
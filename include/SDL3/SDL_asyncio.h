@@ -164,6 +164,20 @@ typedef struct SDL_AsyncIOOutcome
     void *userdata;    /**< pointer provided by the app when starting the task */
 } SDL_AsyncIOOutcome;
 
+/**
+ * One region of a data source for SDL_ReadAsyncIORanges().
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_ReadAsyncIORanges
+ */
+typedef struct SDL_AsyncIORange
+{
+    void *ptr;      /**< buffer to read this region into. */
+    Uint64 offset;  /**< position of this region in the data source. */
+    Uint64 size;    /**< number of bytes to read. */
+} SDL_AsyncIORange;
+
 /**
  * A queue of completed asynchronous I/O tasks.
  *
@@ -276,6 +290,48 @@ extern SDL_DECLSPEC Sint64 SDLCALL SDL_GetAsyncIOSize(SDL_AsyncIO *asyncio);
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_ReadAsyncIO(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata);
 
+/**
+ * Start an async read of several regions of a data source as one task.
+ *
+ * This reads each of the `num_ranges` regions in `ranges` into its own
+ * buffer. The regions don't have to be contiguous or in any particular
+ * order, which is useful for loading, say, the mip levels of a texture or the
+ * vertex and index data of a mesh with a single request. Where regions do
+ * happen to be adjacent in the data source, the system may read them with a
+ * single vectored (scatter) read.
+ *
+ * All the regions are reported together as one completed task, with a `type`
+ * of SDL_ASYNCIO_TASK_READ. The outcome's `buffer` and `offset` are those of
+ * the first range, `bytes_requested` is the total size of all the ranges and
+ * `bytes_transferred` is the total that was read. Unlike SDL_ReadAsyncIO(),
+ * reading less than was requested from any range, for example by reaching the
+ * end of the file, makes the result SDL_ASYNCIO_FAILURE.
+ *
+ * The `ranges` array itself is copied and may be freed as soon as this
+ * function returns, but every range's `ptr` must remain available until the
+ * work is done, just like with SDL_ReadAsyncIO().
+ *
+ * An SDL_AsyncIOQueue must be specified. The newly-created task will be added
+ * to it when it completes its work.
+ *
+ * \param asyncio a pointer to an SDL_AsyncIO structure.
+ * \param ranges an array of regions to read.
+ * \param num_ranges the number of elements in `ranges`.
+ * \param queue a queue to add the new SDL_AsyncIO to.
+ * \param userdata an app-defined pointer that will be provided with the task
+ *                 results.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_ReadAsyncIO
+ * \sa SDL_CreateAsyncIOQueue
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_ReadAsyncIORanges(SDL_AsyncIO *asyncio, const SDL_AsyncIORange *ranges, int num_ranges, SDL_AsyncIOQueue *queue, void *userdata);
+
 /**
  * Start an async write.
  *
@@ -402,6 +402,15 @@ extern SDL_DECLSPEC SDL_CameraID SDLCALL SDL_GetCameraID(SDL_Camera *camera);
 /**
  * Get the properties associated with an opened camera.
  *
+ * The following read-only properties are provided by SDL:
+ *
+ * - `SDL_PROP_CAMERA_DROPPED_FRAMES_NUMBER`: the number of frames SDL threw
+ *   away since the camera was opened, either because the frame queue was full
+ *   or because a newer frame replaced them (see
+ *   SDL_HINT_CAMERA_FRAME_QUEUE_POLICY).
+ * - `SDL_PROP_CAMERA_LATE_FRAMES_NUMBER`: the number of frames that were
+ *   acquired by the app more than one frame interval after their timestamp.
+ *
  * \param camera the SDL_Camera obtained from SDL_OpenCamera().
  * \returns a valid property ID on success or 0 on failure; call
  *          SDL_GetError() for more information.
@@ -412,6 +421,9 @@ extern SDL_DECLSPEC SDL_CameraID SDLCALL SDL_GetCameraID(SDL_Camera *camera);
  */
 extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetCameraProperties(SDL_Camera *camera);
 
+#define SDL_PROP_CAMERA_DROPPED_FRAMES_NUMBER   "SDL.camera.dropped_frames"
+#define SDL_PROP_CAMERA_LATE_FRAMES_NUMBER      "SDL.camera.late_frames"
+
 /**
  * Get the spec that a camera is using when generating images.
  *
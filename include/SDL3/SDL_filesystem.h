@@ -451,6 +451,56 @@ extern SDL_DECLSPEC bool SDLCALL SDL_RenamePath(const char *oldpath, const char
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_CopyFile(const char *oldpath, const char *newpath);
 
+/**
+ * A callback that reports the progress of SDL_CopyFileWithProgress().
+ *
+ * This is called from the thread that called SDL_CopyFileWithProgress(), at
+ * least once when the copy finishes, and periodically while a large file is
+ * being copied. If the platform clones the file without moving any data, it
+ * may only be called once, with `copied` equal to `total`.
+ *
+ * \param userdata an app-controlled pointer that is passed to the callback.
+ * \param copied the number of bytes that have been copied so far.
+ * \param total the total number of bytes to copy.
+ * \returns true to continue the copy, false to cancel it.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_CopyFileWithProgress
+ */
+typedef bool (SDLCALL *SDL_CopyFileProgressCallback)(void *userdata, Uint64 copied, Uint64 total);
+
+/**
+ * Copy a file, reporting progress as it goes.
+ *
+ * This behaves exactly like SDL_CopyFile(), but calls `callback` as data is
+ * copied. If the callback returns false, the copy stops and this function
+ * fails; the state of `newpath` is then undefined, just like any other failed
+ * copy.
+ *
+ * Where the platform allows it, the copy is done by the OS without passing
+ * the data through the app: on Linux, SDL first tries to share the data with
+ * a reflink (on filesystems like Btrfs and XFS), then copy_file_range() and
+ * sendfile(), and only reads and writes the data itself if none of those
+ * are available.
+ *
+ * \param oldpath the old path.
+ * \param newpath the new path.
+ * \param callback a function to call with progress updates, may be NULL.
+ * \param userdata a pointer that is passed to `callback`.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but this
+ *               operation is not atomic, so the app might need to protect
+ *               access to specific paths from other threads if appropriate.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CopyFile
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_CopyFileWithProgress(const char *oldpath, const char *newpath, SDL_CopyFileProgressCallback callback, void *userdata);
+
 /**
  * Get information about a filesystem path.
  *
@@ -483,6 +533,9 @@ extern SDL_DECLSPEC bool SDLCALL SDL_GetPathInfo(const char *path, SDL_PathInfo
  * convenience, but if `count` is non-NULL, on return it will contain the
  * number of items in the array, not counting the NULL terminator.
  *
+ * Large directory trees may be walked by several threads at once, so the
+ * order of the returned paths is unspecified.
+ *
  * \param path the path of the directory to enumerate.
  * \param pattern the pattern that files in the directory must match. Can be
  *                NULL.
@@ -522,6 +575,113 @@ extern SDL_DECLSPEC char ** SDLCALL SDL_GlobDirectory(const char *path, const ch
  */
 extern SDL_DECLSPEC char * SDLCALL SDL_GetCurrentDirectory(void);
 
+/**
+ * An opaque handle for a directory being watched for changes.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_WatchDirectory
+ * \sa SDL_UnwatchDirectory
+ */
+typedef struct SDL_FileWatch SDL_FileWatch;
+
+/**
+ * Flags for directory watches.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_WatchDirectory
+ */
+typedef Uint32 SDL_FileWatchFlags;
+
+#define SDL_FILEWATCH_RECURSIVE (1u << 0)  /**< Also watch everything in subdirectories, including ones created later. */
+
+/**
+ * The kinds of change reported to an SDL_FileWatchCallback.
+ *
+ * \since This enum is available since SDL 3.4.0.
+ */
+typedef enum SDL_FileWatchAction
+{
+    SDL_FILEWATCH_CREATED,   /**< a file or directory appeared at `path`. */
+    SDL_FILEWATCH_MODIFIED,  /**< the contents or attributes of the file at `path` changed, or it was replaced. */
+    SDL_FILEWATCH_REMOVED,   /**< the file or directory at `path` is gone. */
+    SDL_FILEWATCH_RENAMED    /**< the file or directory at `oldpath` is now at `path`. */
+} SDL_FileWatchAction;
+
+/**
+ * A callback that receives changes to a watched directory.
+ *
+ * Paths are relative to the watched directory and use `/` as the separator,
+ * like the results of SDL_GlobDirectory().
+ *
+ * If events were lost because the system couldn't keep up, this is called
+ * with SDL_FILEWATCH_MODIFIED and an empty `path`; anything in the watched
+ * directory might have changed, so rescan whatever you care about.
+ *
+ * \param userdata an app-controlled pointer that is passed to the callback.
+ * \param action the kind of change.
+ * \param path the path that changed, relative to the watched directory. Only
+ *             valid until the callback returns.
+ * \param oldpath the previous path for SDL_FILEWATCH_RENAMED, NULL otherwise.
+ *
+ * \threadsafety This is called from a thread that SDL creates for the watch,
+ *               never more than one call at a time for each watch.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_WatchDirectory
+ */
+typedef void (SDLCALL *SDL_FileWatchCallback)(void *userdata, SDL_FileWatchAction action, const char *path, const char *oldpath);
+
+/**
+ * Start watching a directory for changes.
+ *
+ * Changes are coalesced per path before they are delivered, so a burst of
+ * writes to a file arrives as one SDL_FILEWATCH_MODIFIED, a file that is
+ * created and removed again before delivery isn't reported at all, and a
+ * file that is saved by writing a temporary file and renaming it over the
+ * original arrives as one SDL_FILEWATCH_CREATED for the original's path, as
+ * a new file took its place. Changes are delivered once the directory has
+ * been quiet for a short moment.
+ *
+ * On Linux this uses inotify. Elsewhere, or if inotify is unavailable, the
+ * directory is polled a few times a second; renames are then reported as a
+ * removal and a creation.
+ *
+ * \param path the path of the directory to watch.
+ * \param flags `SDL_FILEWATCH_*` bitflags that affect the watch.
+ * \param callback a function to call with each change.
+ * \param userdata a pointer that is passed to `callback`.
+ * \returns the new watch on success or NULL on failure; call SDL_GetError()
+ *          for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_UnwatchDirectory
+ */
+extern SDL_DECLSPEC SDL_FileWatch * SDLCALL SDL_WatchDirectory(const char *path, SDL_FileWatchFlags flags, SDL_FileWatchCallback callback, void *userdata);
+
+/**
+ * Stop watching a directory.
+ *
+ * Changes that haven't been delivered yet are dropped. Once this returns,
+ * the watch's callback will not be called again, unless this is called from
+ * that callback, in which case the current call is the last.
+ *
+ * \param watch the watch to stop. Can be NULL.
+ *
+ * \threadsafety It is safe to call this function from any thread, including
+ *               from the watch's own callback.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_WatchDirectory
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_UnwatchDirectory(SDL_FileWatch *watch);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
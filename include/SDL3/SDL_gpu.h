@@ -506,6 +506,20 @@ typedef struct SDL_GPUComputePipeline SDL_GPUComputePipeline;
  */
 typedef struct SDL_GPUGraphicsPipeline SDL_GPUGraphicsPipeline;
 
+/**
+ * An opaque handle representing a pipeline being compiled in the background.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateGPUGraphicsPipelineAsync
+ * \sa SDL_CreateGPUComputePipelineAsync
+ * \sa SDL_QueryGPUPipelineJob
+ * \sa SDL_WaitForGPUGraphicsPipeline
+ * \sa SDL_WaitForGPUComputePipeline
+ * \sa SDL_ReleaseGPUPipelineJob
+ */
+typedef struct SDL_GPUPipelineJob SDL_GPUPipelineJob;
+
 /**
  * An opaque handle representing a command buffer.
  *
@@ -582,6 +596,23 @@ typedef struct SDL_GPUCopyPass SDL_GPUCopyPass;
  */
 typedef struct SDL_GPUFence SDL_GPUFence;
 
+/**
+ * An opaque handle representing a persistent texture readback.
+ *
+ * A readback owns a small ring of download transfer buffers and the fences
+ * that guard them, so texture contents can be streamed back to the CPU every
+ * frame without stalling on the most recent submission.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateGPUTextureReadback
+ * \sa SDL_DownloadToGPUTextureReadback
+ * \sa SDL_MapGPUTextureReadback
+ * \sa SDL_UnmapGPUTextureReadback
+ * \sa SDL_ReleaseGPUTextureReadback
+ */
+typedef struct SDL_GPUTextureReadback SDL_GPUTextureReadback;
+
 /**
  * Specifies the primitive topology of a graphics pipeline.
  *
@@ -1355,6 +1386,20 @@ typedef enum SDL_GPUSwapchainComposition
     SDL_GPU_SWAPCHAINCOMPOSITION_HDR10_ST2084
 } SDL_GPUSwapchainComposition;
 
+/**
+ * Specifies the kind of pass that a GPU timing was recorded for.
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGPUPassTimings
+ */
+typedef enum SDL_GPUPassType
+{
+    SDL_GPU_PASSTYPE_RENDER,
+    SDL_GPU_PASSTYPE_COMPUTE,
+    SDL_GPU_PASSTYPE_COPY
+} SDL_GPUPassType;
+
 /* Structures */
 
 /**
@@ -1570,6 +1615,42 @@ typedef struct SDL_GPUIndirectDispatchCommand
     Uint32 groupcount_z;  /**< The number of local workgroups to dispatch in the Z dimension. */
 } SDL_GPUIndirectDispatchCommand;
 
+/**
+ * A structure containing the GPU execution time of a single pass.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGPUPassTimings
+ */
+typedef struct SDL_GPUPassTiming
+{
+    SDL_GPUPassType type;  /**< The kind of pass that was timed. */
+    Uint64 start_ns;       /**< When the pass started executing, in nanoseconds since the first timed pass in the command buffer started. */
+    Uint64 duration_ns;    /**< How long the pass took to execute on the GPU, in nanoseconds. */
+} SDL_GPUPassTiming;
+
+/**
+ * A structure containing memory usage statistics for one kind of GPU memory.
+ *
+ * Resources are suballocated from larger blocks of device memory. Many free
+ * regions relative to the number of blocks, or a large gap between
+ * `allocated_bytes` and `used_bytes`, indicates fragmentation.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGPUMemoryStats
+ */
+typedef struct SDL_GPUMemoryStats
+{
+    Uint32 memory_type;           /**< The backend-specific index of this kind of memory. */
+    Uint32 block_count;           /**< The number of device memory blocks allocated. */
+    Uint32 free_region_count;     /**< The number of free ranges across all blocks. */
+    Uint32 defrag_pending_count;  /**< The number of blocks waiting to be defragmented. */
+    Uint64 allocated_bytes;       /**< The total size of all blocks, in bytes. */
+    Uint64 used_bytes;            /**< The number of bytes occupied by resources. */
+    Uint64 largest_free_region;   /**< The size of the largest free range, in bytes. */
+} SDL_GPUMemoryStats;
+
 /* State structures */
 
 /**
@@ -2242,6 +2323,26 @@ extern SDL_DECLSPEC SDL_GPUDevice * SDLCALL SDL_CreateGPUDevice(
  *   useful debug information on device creation, defaults to true.
  * - `SDL_PROP_GPU_DEVICE_CREATE_NAME_STRING`: the name of the GPU driver to
  *   use, if a specific one is desired.
+ * - `SDL_PROP_GPU_DEVICE_CREATE_HEADLESS_BOOLEAN`: create a device that
+ *   renders only to textures and never presents to a window. Headless
+ *   devices don't require the video subsystem to be initialized, and the
+ *   Vulkan backend accepts devices without swapchain support, such as the
+ *   lavapipe and SwiftShader software implementations. The Vulkan ICD can be
+ *   chosen with the usual `VK_ICD_FILENAMES` / `VK_DRIVER_FILES` environment
+ *   variables. SDL_ClaimWindowForGPUDevice() fails on headless devices.
+ *   Defaults to false.
+ * - `SDL_PROP_GPU_DEVICE_CREATE_PIPELINE_THREADS_NUMBER`: the number of worker
+ *   threads compiling pipelines created with
+ *   SDL_CreateGPUGraphicsPipelineAsync() and
+ *   SDL_CreateGPUComputePipelineAsync(). The threads are started on first
+ *   use. Defaults to 0, which picks one less than the number of logical CPU
+ *   cores, at most 4.
+ * - `SDL_PROP_GPU_DEVICE_CREATE_BINDLESS_BOOLEAN`: request a global table of
+ *   textures and storage buffers that shaders index directly, see
+ *   SDL_RegisterGPUBindlessTexture(). If the driver can't provide one the
+ *   device is still created; check `SDL_PROP_GPU_DEVICE_BINDLESS_TEXTURES_NUMBER`
+ *   to find out. Only supported by the Vulkan renderer with
+ *   VK_EXT_descriptor_indexing. Defaults to false.
  *
  * These are the current shader format properties:
  *
@@ -2289,6 +2390,13 @@ extern SDL_DECLSPEC SDL_GPUDevice * SDLCALL SDL_CreateGPUDevice(
  * - `SDL_PROP_GPU_DEVICE_CREATE_VULKAN_SAMPLERANISOTROPY_BOOLEAN`: Enable
  *   device feature samplerAnisotropy. If disabled, enable_anisotropy of
  *   SDL_GPUSamplerCreateInfo must be set to false. Defaults to true.
+ * - `SDL_PROP_GPU_DEVICE_CREATE_VULKAN_DEFRAG_BUDGET_BYTES_NUMBER`: the
+ *   maximum number of bytes moved by memory defragmentation per command
+ *   buffer submission, or 0 for no limit. At least one resource is always
+ *   moved. Defaults to 16 MiB.
+ * - `SDL_PROP_GPU_DEVICE_CREATE_VULKAN_DEFRAG_BUDGET_NS_NUMBER`: the maximum
+ *   CPU time spent recording memory defragmentation per command buffer
+ *   submission, in nanoseconds, or 0 for no limit. Defaults to 1 millisecond.
  *
  * \param props the properties to use.
  * \returns a GPU context on success or NULL on failure; call SDL_GetError()
@@ -2308,6 +2416,9 @@ extern SDL_DECLSPEC SDL_GPUDevice * SDLCALL SDL_CreateGPUDeviceWithProperties(
 #define SDL_PROP_GPU_DEVICE_CREATE_PREFERLOWPOWER_BOOLEAN                   "SDL.gpu.device.create.preferlowpower"
 #define SDL_PROP_GPU_DEVICE_CREATE_VERBOSE_BOOLEAN                          "SDL.gpu.device.create.verbose"
 #define SDL_PROP_GPU_DEVICE_CREATE_NAME_STRING                              "SDL.gpu.device.create.name"
+#define SDL_PROP_GPU_DEVICE_CREATE_HEADLESS_BOOLEAN                         "SDL.gpu.device.create.headless"
+#define SDL_PROP_GPU_DEVICE_CREATE_PIPELINE_THREADS_NUMBER                  "SDL.gpu.device.create.pipelinethreads"
+#define SDL_PROP_GPU_DEVICE_CREATE_BINDLESS_BOOLEAN                         "SDL.gpu.device.create.bindless"
 #define SDL_PROP_GPU_DEVICE_CREATE_SHADERS_PRIVATE_BOOLEAN                  "SDL.gpu.device.create.shaders.private"
 #define SDL_PROP_GPU_DEVICE_CREATE_SHADERS_SPIRV_BOOLEAN                    "SDL.gpu.device.create.shaders.spirv"
 #define SDL_PROP_GPU_DEVICE_CREATE_SHADERS_DXBC_BOOLEAN                     "SDL.gpu.device.create.shaders.dxbc"
@@ -2320,6 +2431,8 @@ extern SDL_DECLSPEC SDL_GPUDevice * SDLCALL SDL_CreateGPUDeviceWithProperties(
 #define SDL_PROP_GPU_DEVICE_CREATE_VULKAN_DEPTHCLAMP_BOOLEAN                "SDL.gpu.device.create.vulkan.depthclamp"
 #define SDL_PROP_GPU_DEVICE_CREATE_VULKAN_DRAWINDIRECTFIRST_BOOLEAN         "SDL.gpu.device.create.vulkan.drawindirectfirstinstance"
 #define SDL_PROP_GPU_DEVICE_CREATE_VULKAN_SAMPLERANISOTROPY_BOOLEAN         "SDL.gpu.device.create.vulkan.sampleranisotropy"
+#define SDL_PROP_GPU_DEVICE_CREATE_VULKAN_DEFRAG_BUDGET_BYTES_NUMBER        "SDL.gpu.device.create.vulkan.defragbudget.bytes"
+#define SDL_PROP_GPU_DEVICE_CREATE_VULKAN_DEFRAG_BUDGET_NS_NUMBER           "SDL.gpu.device.create.vulkan.defragbudget.ns"
 
 /**
  * Destroys a GPU context previously returned by SDL_CreateGPUDevice.
@@ -2477,6 +2590,17 @@ extern SDL_DECLSPEC SDL_GPUShaderFormat SDLCALL SDL_GetGPUShaderFormats(SDL_GPUD
  * Driver Branch: promo490_3_Google
  * ```
  *
+ * `SDL_PROP_GPU_DEVICE_BINDLESS_TEXTURES_NUMBER`: The number of slots in the
+ * bindless texture table, or 0 if the device was not created with
+ * SDL_PROP_GPU_DEVICE_CREATE_BINDLESS_BOOLEAN or the driver can't provide a
+ * bindless table.
+ *
+ * `SDL_PROP_GPU_DEVICE_BINDLESS_BUFFERS_NUMBER`: The number of slots in the
+ * bindless storage buffer table, or 0 if bindless resources are unavailable.
+ *
+ * `SDL_PROP_GPU_DEVICE_INDIRECT_DRAW_COUNT_BOOLEAN`: true if the device can
+ * read draw counts from a buffer, see SDL_DrawGPUPrimitivesIndirectCount().
+ *
  * \param device a GPU context to query.
  * \returns a valid property ID on success or 0 on failure; call
  *          SDL_GetError() for more information.
@@ -2487,10 +2611,13 @@ extern SDL_DECLSPEC SDL_GPUShaderFormat SDLCALL SDL_GetGPUShaderFormats(SDL_GPUD
  */
 extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetGPUDeviceProperties(SDL_GPUDevice *device);
 
-#define SDL_PROP_GPU_DEVICE_NAME_STRING               "SDL.gpu.device.name"
-#define SDL_PROP_GPU_DEVICE_DRIVER_NAME_STRING        "SDL.gpu.device.driver_name"
-#define SDL_PROP_GPU_DEVICE_DRIVER_VERSION_STRING     "SDL.gpu.device.driver_version"
-#define SDL_PROP_GPU_DEVICE_DRIVER_INFO_STRING        "SDL.gpu.device.driver_info"
+#define SDL_PROP_GPU_DEVICE_NAME_STRING                 "SDL.gpu.device.name"
+#define SDL_PROP_GPU_DEVICE_DRIVER_NAME_STRING          "SDL.gpu.device.driver_name"
+#define SDL_PROP_GPU_DEVICE_DRIVER_VERSION_STRING       "SDL.gpu.device.driver_version"
+#define SDL_PROP_GPU_DEVICE_DRIVER_INFO_STRING          "SDL.gpu.device.driver_info"
+#define SDL_PROP_GPU_DEVICE_BINDLESS_TEXTURES_NUMBER    "SDL.gpu.device.bindless.textures"
+#define SDL_PROP_GPU_DEVICE_BINDLESS_BUFFERS_NUMBER     "SDL.gpu.device.bindless.buffers"
+#define SDL_PROP_GPU_DEVICE_INDIRECT_DRAW_COUNT_BOOLEAN "SDL.gpu.device.indirect_draw_count"
 
 
 /* State Creation */
@@ -2507,6 +2634,8 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetGPUDeviceProperties(SDL_GPUD
  *   read-only storage buffers
  * - 1: Read-write storage textures, followed by read-write storage buffers
  * - 2: Uniform buffers
+ * - 3: The bindless table on devices that have one: binding 0 is an array of
+ *   combined image samplers, binding 1 an array of read-only storage buffers
  *
  * For DXBC and DXIL shaders, use the following register order:
  *
@@ -2573,6 +2702,164 @@ extern SDL_DECLSPEC SDL_GPUGraphicsPipeline * SDLCALL SDL_CreateGPUGraphicsPipel
 
 #define SDL_PROP_GPU_GRAPHICSPIPELINE_CREATE_NAME_STRING "SDL.gpu.graphicspipeline.create.name"
 
+/**
+ * Starts compiling a graphics pipeline on a worker thread.
+ *
+ * Pipeline creation can take a long time while the driver compiles shaders;
+ * this returns immediately so the pipeline can be created ahead of its first
+ * use without stalling the calling thread. The create info, including the
+ * arrays and properties it points to, is copied. The shaders must stay alive
+ * until the job has finished.
+ *
+ * Every job should eventually be passed to SDL_WaitForGPUGraphicsPipeline()
+ * or SDL_ReleaseGPUPipelineJob(). Jobs still outstanding when the device is
+ * destroyed are finished and their pipelines released.
+ *
+ * \param device a GPU Context.
+ * \param createinfo a struct describing the state of the graphics pipeline to
+ *                   create.
+ * \returns a pipeline job on success, or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_QueryGPUPipelineJob
+ * \sa SDL_WaitForGPUGraphicsPipeline
+ * \sa SDL_ReleaseGPUPipelineJob
+ */
+extern SDL_DECLSPEC SDL_GPUPipelineJob * SDLCALL SDL_CreateGPUGraphicsPipelineAsync(
+    SDL_GPUDevice *device,
+    const SDL_GPUGraphicsPipelineCreateInfo *createinfo);
+
+/**
+ * Starts compiling a compute pipeline on a worker thread.
+ *
+ * The create info, including the shader code and properties it points to, is
+ * copied. See SDL_CreateGPUGraphicsPipelineAsync() for details.
+ *
+ * \param device a GPU Context.
+ * \param createinfo a struct describing the state of the compute pipeline to
+ *                   create.
+ * \returns a pipeline job on success, or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_QueryGPUPipelineJob
+ * \sa SDL_WaitForGPUComputePipeline
+ * \sa SDL_ReleaseGPUPipelineJob
+ */
+extern SDL_DECLSPEC SDL_GPUPipelineJob * SDLCALL SDL_CreateGPUComputePipelineAsync(
+    SDL_GPUDevice *device,
+    const SDL_GPUComputePipelineCreateInfo *createinfo);
+
+/**
+ * Checks the status of a pipeline job.
+ *
+ * \param device a GPU context.
+ * \param job a pipeline job.
+ * \returns true if the job has finished, false otherwise.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_WaitForGPUGraphicsPipeline
+ * \sa SDL_WaitForGPUComputePipeline
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_QueryGPUPipelineJob(
+    SDL_GPUDevice *device,
+    SDL_GPUPipelineJob *job);
+
+/**
+ * Waits for a graphics pipeline job to finish and returns its pipeline.
+ *
+ * This returns immediately if SDL_QueryGPUPipelineJob() already reported the
+ * job as finished. The job is freed and must not be used again; the returned
+ * pipeline is owned by the app like one from SDL_CreateGPUGraphicsPipeline().
+ *
+ * \param device a GPU context.
+ * \param job a job from SDL_CreateGPUGraphicsPipelineAsync().
+ * \returns a graphics pipeline object on success, or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateGPUGraphicsPipelineAsync
+ */
+extern SDL_DECLSPEC SDL_GPUGraphicsPipeline * SDLCALL SDL_WaitForGPUGraphicsPipeline(
+    SDL_GPUDevice *device,
+    SDL_GPUPipelineJob *job);
+
+/**
+ * Waits for a compute pipeline job to finish and returns its pipeline.
+ *
+ * The job is freed and must not be used again.
+ *
+ * \param device a GPU context.
+ * \param job a job from SDL_CreateGPUComputePipelineAsync().
+ * \returns a compute pipeline object on success, or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateGPUComputePipelineAsync
+ */
+extern SDL_DECLSPEC SDL_GPUComputePipeline * SDLCALL SDL_WaitForGPUComputePipeline(
+    SDL_GPUDevice *device,
+    SDL_GPUPipelineJob *job);
+
+/**
+ * Abandons a pipeline job.
+ *
+ * If the pipeline is still compiling it is released once it is done.
+ *
+ * \param device a GPU context.
+ * \param job a pipeline job.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_ReleaseGPUPipelineJob(
+    SDL_GPUDevice *device,
+    SDL_GPUPipelineJob *job);
+
+/**
+ * Creates the backend objects a render pass with these targets needs ahead of
+ * time.
+ *
+ * Some backends lazily create render pass and framebuffer objects the first
+ * time a combination of targets and load/store operations is used, which
+ * causes a hitch in the frame that does it. Calling this during loading with
+ * the same arguments that will later be passed to SDL_BeginGPURenderPass()
+ * moves that cost out of the frame. Nothing is recorded and the textures are
+ * not modified. Targets with `cycle` set that are still in use are cycled
+ * here instead of in SDL_BeginGPURenderPass(), so the objects match the
+ * texture the pass will write. On backends that have no such objects this
+ * does nothing.
+ *
+ * \param device a GPU context.
+ * \param color_target_infos an array of texture subresources with
+ *                           corresponding clear values and load/store ops.
+ * \param num_color_targets the number of color targets in the
+ *                          color_target_infos array.
+ * \param depth_stencil_target_info a texture subresource with corresponding
+ *                                  clear value and load/store ops, may be
+ *                                  NULL.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_BeginGPURenderPass
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_PrepareGPURenderPass(
+    SDL_GPUDevice *device,
+    const SDL_GPUColorTargetInfo *color_target_infos,
+    Uint32 num_color_targets,
+    const SDL_GPUDepthStencilTargetInfo *depth_stencil_target_info);
+
 /**
  * Creates a sampler object to be used when binding textures in a graphics
  * workflow.
@@ -2620,6 +2907,11 @@ extern SDL_DECLSPEC SDL_GPUSampler * SDLCALL SDL_CreateGPUSampler(
  *   buffers
  * - 3: Uniform buffers
  *
+ * On devices with a bindless table, set 4 is visible to both stages: binding
+ * 0 is an array of combined image samplers and binding 1 an array of
+ * read-only storage buffers, indexed with the values returned by
+ * SDL_RegisterGPUBindlessTexture() and SDL_RegisterGPUBindlessBuffer().
+ *
  * For DXBC and DXIL shaders, use the following register order:
  *
  * For vertex shaders:
@@ -2832,6 +3124,104 @@ extern SDL_DECLSPEC SDL_GPUTransferBuffer * SDLCALL SDL_CreateGPUTransferBuffer(
 
 #define SDL_PROP_GPU_TRANSFERBUFFER_CREATE_NAME_STRING "SDL.gpu.transferbuffer.create.name"
 
+/* Bindless Resources */
+
+/**
+ * Places a texture and sampler in the device's bindless texture table.
+ *
+ * Shaders index the table directly instead of going through per-draw
+ * sampler bindings, so switching materials only needs a different index in
+ * uniform or storage data. See SDL_CreateGPUShader() for the binding layout.
+ *
+ * The table refers to the texture that is current at the time of
+ * registration, so don't cycle a registered texture, and don't index it from
+ * a pass that also writes to it. The table keeps the
+ * underlying resources alive until the slot is unregistered, even if the
+ * texture or sampler is released in the meantime.
+ *
+ * \param device a GPU context created with
+ *               `SDL_PROP_GPU_DEVICE_CREATE_BINDLESS_BOOLEAN`.
+ * \param texture a texture created with SDL_GPU_TEXTUREUSAGE_SAMPLER.
+ * \param sampler the sampler to combine with the texture.
+ * \param index a pointer filled in with the table slot.
+ * \returns true on success or false on failure, for example when the table
+ *          is full; call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_UnregisterGPUBindlessTexture
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_RegisterGPUBindlessTexture(
+    SDL_GPUDevice *device,
+    SDL_GPUTexture *texture,
+    SDL_GPUSampler *sampler,
+    Uint32 *index);
+
+/**
+ * Places a storage buffer in the device's bindless buffer table.
+ *
+ * The buffer must have SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ or
+ * SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ usage, matching the stages that
+ * index it, and no vertex, index or indirect usage. As with textures, the
+ * table refers to the buffer contents at the time of registration, so don't
+ * cycle a registered buffer.
+ *
+ * \param device a GPU context created with
+ *               `SDL_PROP_GPU_DEVICE_CREATE_BINDLESS_BOOLEAN`.
+ * \param buffer the storage buffer to register.
+ * \param index a pointer filled in with the table slot.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_UnregisterGPUBindlessBuffer
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_RegisterGPUBindlessBuffer(
+    SDL_GPUDevice *device,
+    SDL_GPUBuffer *buffer,
+    Uint32 *index);
+
+/**
+ * Frees a slot of the bindless texture table.
+ *
+ * Command buffers that were already submitted may keep reading the slot;
+ * it's only reused once the GPU has finished them. Don't submit command
+ * buffers that use the index after this call.
+ *
+ * \param device a GPU context.
+ * \param index a slot returned by SDL_RegisterGPUBindlessTexture().
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_RegisterGPUBindlessTexture
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_UnregisterGPUBindlessTexture(
+    SDL_GPUDevice *device,
+    Uint32 index);
+
+/**
+ * Frees a slot of the bindless buffer table.
+ *
+ * \param device a GPU context.
+ * \param index a slot returned by SDL_RegisterGPUBindlessBuffer().
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_RegisterGPUBindlessBuffer
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_UnregisterGPUBindlessBuffer(
+    SDL_GPUDevice *device,
+    Uint32 index);
+
 /* Debug Naming */
 
 /**
@@ -3518,6 +3908,75 @@ extern SDL_DECLSPEC void SDLCALL SDL_DrawGPUIndexedPrimitivesIndirect(
     Uint32 offset,
     Uint32 draw_count);
 
+/**
+ * Draws data using bound graphics state and with both the draw parameters
+ * and the number of draws read from buffers.
+ *
+ * The buffer must consist of tightly-packed draw parameter sets that each
+ * match the layout of SDL_GPUIndirectDrawCommand. The number of draws is a
+ * Uint32 read from count_buffer at count_offset when the command executes,
+ * and is clamped to max_draw_count. This lets a compute pass cull draws and
+ * write out the survivors without a round trip through the CPU.
+ *
+ * count_buffer must have been created with SDL_GPU_BUFFERUSAGE_INDIRECT and
+ * count_offset must be a multiple of 4. You must not call this function
+ * before binding a graphics pipeline.
+ *
+ * This is only available when the device reports
+ * `SDL_PROP_GPU_DEVICE_INDIRECT_DRAW_COUNT_BOOLEAN`; otherwise nothing is
+ * drawn and an error is set.
+ *
+ * \param render_pass a render pass handle.
+ * \param buffer a buffer containing draw parameters.
+ * \param offset the offset to start reading from the draw buffer.
+ * \param count_buffer a buffer containing the number of draws.
+ * \param count_offset the offset of the draw count in count_buffer.
+ * \param max_draw_count the maximum number of draw parameter sets that will
+ *                       be read from the draw buffer.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_DrawGPUPrimitivesIndirect
+ * \sa SDL_GetGPUDeviceProperties
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DrawGPUPrimitivesIndirectCount(
+    SDL_GPURenderPass *render_pass,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *count_buffer,
+    Uint32 count_offset,
+    Uint32 max_draw_count);
+
+/**
+ * Draws data using bound graphics state with an index buffer enabled and with
+ * both the draw parameters and the number of draws read from buffers.
+ *
+ * The buffer must consist of tightly-packed draw parameter sets that each
+ * match the layout of SDL_GPUIndexedIndirectDrawCommand. The number of draws
+ * is read from count_buffer as in SDL_DrawGPUPrimitivesIndirectCount(). You
+ * must not call this function before binding a graphics pipeline.
+ *
+ * \param render_pass a render pass handle.
+ * \param buffer a buffer containing draw parameters.
+ * \param offset the offset to start reading from the draw buffer.
+ * \param count_buffer a buffer containing the number of draws.
+ * \param count_offset the offset of the draw count in count_buffer.
+ * \param max_draw_count the maximum number of draw parameter sets that will
+ *                       be read from the draw buffer.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_DrawGPUIndexedPrimitivesIndirect
+ * \sa SDL_GetGPUDeviceProperties
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DrawGPUIndexedPrimitivesIndirectCount(
+    SDL_GPURenderPass *render_pass,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *count_buffer,
+    Uint32 count_offset,
+    Uint32 max_draw_count);
+
 /**
  * Ends the given render pass.
  *
@@ -3758,6 +4217,44 @@ extern SDL_DECLSPEC void SDLCALL SDL_UnmapGPUTransferBuffer(
     SDL_GPUDevice *device,
     SDL_GPUTransferBuffer *transfer_buffer);
 
+/**
+ * Allocates upload staging memory from the device's streaming upload ring.
+ *
+ * This is a shortcut for per-frame dynamic data that would otherwise need
+ * its own SDL_GPUTransferBuffer. The returned memory is already mapped and
+ * `location` is filled in with the transfer buffer and offset to use as the
+ * source of SDL_UploadToGPUBuffer() or SDL_UploadToGPUTexture().
+ *
+ * The memory belongs to `command_buffer`: it must be written before the
+ * command buffer is submitted, and may only be used as an upload source by
+ * copy passes recorded on that command buffer. Once the command buffer is
+ * submitted or canceled, the memory is handed back to the device and reused
+ * automatically after the GPU has finished with it. Do not map, unmap or
+ * release the transfer buffer in `location`.
+ *
+ * \param command_buffer a command buffer.
+ * \param size the number of bytes to allocate.
+ * \param alignment the required alignment of the returned offset, must be a
+ *                  power of two, or 0 for no particular alignment.
+ * \param location filled in with the transfer buffer location of the
+ *                 allocation.
+ * \returns a pointer to the mapped staging memory, or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as long as
+ *               each thread only uses its own command buffers.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_UploadToGPUBuffer
+ * \sa SDL_UploadToGPUTexture
+ */
+extern SDL_DECLSPEC void * SDLCALL SDL_AllocateGPUUploadMemory(
+    SDL_GPUCommandBuffer *command_buffer,
+    Uint32 size,
+    Uint32 alignment,
+    SDL_GPUTransferBufferLocation *location);
+
 /* Copy Pass */
 
 /**
@@ -3903,6 +4400,113 @@ extern SDL_DECLSPEC void SDLCALL SDL_DownloadFromGPUBuffer(
     const SDL_GPUBufferRegion *source,
     const SDL_GPUTransferBufferLocation *destination);
 
+/**
+ * Creates a persistent readback for streaming texture contents to the CPU.
+ *
+ * The readback holds `num_buffers` download transfer buffers of `size` bytes
+ * each. Every SDL_DownloadToGPUTextureReadback() call writes into a free
+ * buffer, and SDL_MapGPUTextureReadback() hands back the oldest completed
+ * download, so with two or more buffers the CPU reads frame N while the GPU
+ * renders frame N+1. Fences are acquired and tracked internally when the
+ * command buffer is submitted.
+ *
+ * \param device a GPU context.
+ * \param size the size in bytes of each buffer, large enough for the biggest
+ *             region that will be downloaded.
+ * \param num_buffers the number of buffers to cycle through, or 0 for the
+ *                    default of 2.
+ * \returns a readback handle on success or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_DownloadToGPUTextureReadback
+ * \sa SDL_MapGPUTextureReadback
+ * \sa SDL_ReleaseGPUTextureReadback
+ */
+extern SDL_DECLSPEC SDL_GPUTextureReadback * SDLCALL SDL_CreateGPUTextureReadback(
+    SDL_GPUDevice *device,
+    Uint32 size,
+    Uint32 num_buffers);
+
+/**
+ * Downloads a texture region into the next free buffer of a readback.
+ *
+ * The data is tightly packed, as if SDL_DownloadFromGPUTexture() was called
+ * with `pixels_per_row` and `rows_per_layer` set to 0. If every buffer is in
+ * use, the oldest completed download that hasn't been mapped yet is dropped
+ * and its buffer reused; if none has completed this fails.
+ *
+ * \param copy_pass a copy pass handle.
+ * \param source the source texture region.
+ * \param readback the readback to download into.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_MapGPUTextureReadback
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_DownloadToGPUTextureReadback(
+    SDL_GPUCopyPass *copy_pass,
+    const SDL_GPUTextureRegion *source,
+    SDL_GPUTextureReadback *readback);
+
+/**
+ * Maps the oldest submitted download of a readback into application memory.
+ *
+ * Only one download can be mapped at a time; call
+ * SDL_UnmapGPUTextureReadback() once done with the data to make its buffer
+ * available again.
+ *
+ * \param device a GPU context.
+ * \param readback the readback to map.
+ * \param wait true to block until the oldest download completes, false to
+ *             return NULL if it hasn't completed yet.
+ * \returns the address of the downloaded data or NULL if no download is
+ *          ready or on failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety Downloads may be recorded into a readback on other threads
+ *               while this waits, but only one thread at a time may map and
+ *               unmap a given readback.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_UnmapGPUTextureReadback
+ */
+extern SDL_DECLSPEC const void * SDLCALL SDL_MapGPUTextureReadback(
+    SDL_GPUDevice *device,
+    SDL_GPUTextureReadback *readback,
+    bool wait);
+
+/**
+ * Unmaps the download previously mapped by SDL_MapGPUTextureReadback().
+ *
+ * \param device a GPU context.
+ * \param readback a readback with a mapped download.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_UnmapGPUTextureReadback(
+    SDL_GPUDevice *device,
+    SDL_GPUTextureReadback *readback);
+
+/**
+ * Frees the given readback.
+ *
+ * Downloads that are still in flight complete before the buffers are freed.
+ * A readback must not be released while a download into it is recorded in a
+ * command buffer that hasn't been submitted or canceled yet.
+ *
+ * \param device a GPU context.
+ * \param readback a readback handle.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_ReleaseGPUTextureReadback(
+    SDL_GPUDevice *device,
+    SDL_GPUTextureReadback *readback);
+
 /**
  * Ends the current copy pass.
  *
@@ -3918,6 +4522,19 @@ extern SDL_DECLSPEC void SDLCALL SDL_EndGPUCopyPass(
  *
  * This function must not be called inside of any pass.
  *
+ * The texture must have SDL_GPU_TEXTUREUSAGE_SAMPLER usage and either
+ * SDL_GPU_TEXTUREUSAGE_COLOR_TARGET or
+ * SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE usage. Textures with
+ * COLOR_TARGET usage always use render passes. A 2D, 2D array or 3D texture
+ * with a non-integer format that only has COMPUTE_STORAGE_WRITE usage has its
+ * levels generated with compute dispatches instead. A 2D texture, or each
+ * layer of a 2D array, needs one dispatch for up to 8 levels; 3D textures
+ * need one dispatch per level. This is currently available on the Vulkan
+ * backend when the device supports shaderStorageImageWriteWithoutFormat.
+ *
+ * If mipmaps can't be generated, the reason is available from
+ * SDL_GetError().
+ *
  * \param command_buffer a command_buffer.
  * \param texture a texture with more than 1 mip level.
  *
@@ -3932,6 +4549,13 @@ extern SDL_DECLSPEC void SDLCALL SDL_GenerateMipmapsForGPUTexture(
  *
  * This function must not be called inside of any pass.
  *
+ * If the destination texture has SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE
+ * usage but not SDL_GPU_TEXTUREUSAGE_COLOR_TARGET, the blit is done with a
+ * compute dispatch that scales and converts to the destination format in one
+ * step, under the same conditions as SDL_GenerateMipmapsForGPUTexture().
+ * Destinations with COLOR_TARGET usage, and blits with SDL_GPU_LOADOP_CLEAR,
+ * always use a render pass.
+ *
  * \param command_buffer a command buffer.
  * \param info the blit info struct containing the blit parameters.
  *
@@ -4367,6 +4991,83 @@ extern SDL_DECLSPEC void SDLCALL SDL_ReleaseGPUFence(
     SDL_GPUDevice *device,
     SDL_GPUFence *fence);
 
+/* Timing */
+
+/**
+ * Enables GPU timestamps for every pass recorded into a command buffer.
+ *
+ * Once enabled, the GPU records when each render, compute and copy pass in
+ * the command buffer starts and ends. The results can be read with
+ * SDL_GetGPUPassTimings() once the command buffer has been submitted with
+ * SDL_SubmitGPUCommandBufferAndAcquireFence() and its fence has signaled.
+ *
+ * This must not be called while a pass is in progress. Only passes begun
+ * after this call are timed, so it is usually called right after acquiring
+ * the command buffer. Up to 128 passes are timed per command buffer, later
+ * passes are not recorded.
+ *
+ * Timestamps are not supported by the Metal backend, or on Vulkan devices
+ * whose graphics queue has no timestamp support.
+ *
+ * \param command_buffer a command buffer.
+ * \returns true on success, false if timestamps are not supported; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGPUPassTimings
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_EnableGPUTimestamps(
+    SDL_GPUCommandBuffer *command_buffer);
+
+/**
+ * Gets the GPU execution times of the passes in a completed command buffer.
+ *
+ * The timings are returned in the order the passes were recorded.
+ *
+ * \param device a GPU context.
+ * \param fence a fence obtained from
+ *              SDL_SubmitGPUCommandBufferAndAcquireFence() for a command
+ *              buffer that had SDL_EnableGPUTimestamps() called on it.
+ * \param count a pointer filled in with the number of timings returned, may
+ *              be NULL.
+ * \returns a pointer to an array of pass timings or NULL on failure, for
+ *          example if the fence hasn't signaled yet; call SDL_GetError() for
+ *          more information. This should be freed with SDL_free() when it is
+ *          no longer needed.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_EnableGPUTimestamps
+ * \sa SDL_QueryGPUFence
+ */
+extern SDL_DECLSPEC SDL_GPUPassTiming * SDLCALL SDL_GetGPUPassTimings(
+    SDL_GPUDevice *device,
+    SDL_GPUFence *fence,
+    int *count);
+
+/**
+ * Gets memory usage statistics for a GPU device.
+ *
+ * One entry is returned for every kind of memory the device currently has
+ * blocks allocated from. This is currently only supported by the Vulkan
+ * backend.
+ *
+ * \param device a GPU context.
+ * \param count a pointer filled in with the number of entries returned, may
+ *              be NULL.
+ * \returns a pointer to an array of memory statistics or NULL on failure;
+ *          call SDL_GetError() for more information. This should be freed
+ *          with SDL_free() when it is no longer needed.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC SDL_GPUMemoryStats * SDLCALL SDL_GetGPUMemoryStats(
+    SDL_GPUDevice *device,
+    int *count);
+
 /* Format Info */
 
 /**
@@ -212,6 +212,22 @@ extern "C" {
  */
 #define SDL_HINT_APPLE_TV_REMOTE_ALLOW_ROTATION "SDL_APPLE_TV_REMOTE_ALLOW_ROTATION"
 
+/**
+ * A variable that decides what async i/o backend to use.
+ *
+ * By default, SDL uses the operating system's native async i/o interface
+ * where one is available ("io_uring" on Linux, "ioring" on Windows), and
+ * falls back to a threadpool ("generic") otherwise. Setting this hint to
+ * "generic" forces the threadpool implementation, which is mostly useful for
+ * comparing the two.
+ *
+ * This hint needs to be set before the first async i/o queue or file is
+ * created, or after SDL_Quit() to take effect on the next use.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_ASYNCIO_DRIVER "SDL_ASYNCIO_DRIVER"
+
 /**
  * Specify the default ALSA audio device name.
  *
@@ -591,6 +607,50 @@ extern "C" {
  */
 #define SDL_HINT_CAMERA_DRIVER "SDL_CAMERA_DRIVER"
 
+/**
+ * A variable controlling how many frames a camera buffers for the app.
+ *
+ * This hint is an integer > 0, that represents the number of converted or
+ * scaled frames SDL will hold between the camera and SDL_AcquireCameraFrame().
+ * Frames the app has acquired but not yet released count against this limit.
+ *
+ * A deeper queue lets an app that records video fall behind for a moment
+ * without losing frames, at the cost of memory and latency. The value is
+ * clamped to 64.
+ *
+ * The default value is 8.
+ *
+ * This hint should be set before a camera is opened.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ *
+ * \sa SDL_HINT_CAMERA_FRAME_QUEUE_POLICY
+ */
+#define SDL_HINT_CAMERA_FRAME_QUEUE_DEPTH "SDL_CAMERA_FRAME_QUEUE_DEPTH"
+
+/**
+ * A variable controlling which frames a camera keeps when the app falls
+ * behind.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "fifo": SDL_AcquireCameraFrame() returns frames in the order they
+ *   arrived, and new frames are dropped while the queue is full. (default)
+ * - "latest": SDL_AcquireCameraFrame() returns only the newest frame, and
+ *   older queued frames are recycled, so the app always sees the most recent
+ *   image with the least latency.
+ *
+ * Frames dropped either way are counted in the camera's
+ * `SDL_PROP_CAMERA_DROPPED_FRAMES_NUMBER` property.
+ *
+ * This hint should be set before a camera is opened.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ *
+ * \sa SDL_HINT_CAMERA_FRAME_QUEUE_DEPTH
+ */
+#define SDL_HINT_CAMERA_FRAME_QUEUE_POLICY "SDL_CAMERA_FRAME_QUEUE_POLICY"
+
 /**
  * A variable that limits what CPU features are available.
  *
@@ -3096,6 +3156,31 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_METAL_PREFER_LOW_POWER_DEVICE "SDL_RENDER_METAL_PREFER_LOW_POWER_DEVICE"
 
+/**
+ * A variable controlling whether small static textures are packed into
+ * shared atlas textures.
+ *
+ * When enabled, textures up to 128x128 created with
+ * SDL_CreateTextureFromSurface() share larger textures with other textures of
+ * the same format, so drawing many different sprites doesn't force the
+ * renderer to switch textures between draws. Atlased textures are always
+ * sampled with SDL_TEXTURE_ADDRESS_CLAMP, and SDL_RenderGeometry() fails for
+ * them if a texture coordinate is outside of 0 to 1. They don't have backend
+ * specific texture properties.
+ *
+ * This hint overrides the application preference when creating a renderer.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Each texture is created separately. (default)
+ * - "1": Small static textures are packed into shared atlas textures.
+ *
+ * This hint should be set before creating a renderer.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_RENDER_TEXTURE_ATLAS "SDL_RENDER_TEXTURE_ATLAS"
+
 /**
  * A variable controlling whether updates to the SDL screen surface should be
  * synchronized with the vertical refresh, to avoid tearing.
@@ -157,6 +157,43 @@ typedef struct SDL_IOStreamInterface
      */
     bool (SDLCALL *close)(void *userdata);
 
+    /**
+     *  Read up to `size` bytes starting at `offset` in the data stream to the
+     *  area pointed at by `ptr`, without using or changing the current
+     *  stream position. `size` will always be > 0.
+     *
+     *  This may be called from several threads at once, for different parts
+     *  of the stream, and can run concurrently with itself and `write_at`.
+     *  Leave this NULL if the stream can't do that; SDL will fall back to
+     *  seeking and reading while holding a lock.
+     *
+     *  On an incomplete read, you should set `*status` to a value from the
+     *  SDL_IOStatus enum. You do not have to explicitly set this on
+     *  a complete, successful read.
+     *
+     *  \return the number of bytes read
+     *
+     *  \since This member is available since SDL 3.4.0.
+     */
+    size_t (SDLCALL *read_at)(void *userdata, void *ptr, size_t size, Uint64 offset, SDL_IOStatus *status);
+
+    /**
+     *  Write exactly `size` bytes from the area pointed at by `ptr` to the
+     *  data stream starting at `offset`, without using or changing the
+     *  current stream position. `size` will always be > 0.
+     *
+     *  This has the same threading rules as `read_at`, and may be NULL.
+     *
+     *  On an incomplete write, you should set `*status` to a value from the
+     *  SDL_IOStatus enum. You do not have to explicitly set this on
+     *  a complete, successful write.
+     *
+     *  \return the number of bytes written
+     *
+     *  \since This member is available since SDL 3.4.0.
+     */
+    size_t (SDLCALL *write_at)(void *userdata, const void *ptr, size_t size, Uint64 offset, SDL_IOStatus *status);
+
 } SDL_IOStreamInterface;
 
 /* Check the size of SDL_IOStreamInterface
@@ -166,8 +203,8 @@ typedef struct SDL_IOStreamInterface
  * the code using this interface should be updated to handle the old version.
  */
 SDL_COMPILE_TIME_ASSERT(SDL_IOStreamInterface_SIZE,
-    (sizeof(void *) == 4 && sizeof(SDL_IOStreamInterface) == 28) ||
-    (sizeof(void *) == 8 && sizeof(SDL_IOStreamInterface) == 56));
+    (sizeof(void *) == 4 && sizeof(SDL_IOStreamInterface) == 36) ||
+    (sizeof(void *) == 8 && sizeof(SDL_IOStreamInterface) == 72));
 
 /**
  * The read/write operation structure.
@@ -225,6 +262,16 @@ typedef struct SDL_IOStream SDL_IOStream;
  * effect. For example, "t" is sometimes appended to make explicit the file is
  * a text file.
  *
+ * An "m" character in a read-only mode ("rm", "rbm") asks SDL to map the
+ * whole file into memory instead of reading it through a file handle. Reads
+ * from a mapped file are plain memory copies, and SDL_GetIOMemoryRange() can
+ * hand out pointers directly into the file contents. This is intended for
+ * large read-mostly files; the file must not be truncated while it is mapped.
+ * If the file can't be mapped (the platform doesn't support it, the file is
+ * empty or not a regular file, etc), or "m" is combined with a writable mode,
+ * the "m" is ignored and the file is opened as usual. This flag is available
+ * since SDL 3.4.0.
+ *
  * This function supports Unicode filenames, but they must be encoded in UTF-8
  * format, regardless of the underlying operating system.
  *
@@ -253,6 +300,11 @@ typedef struct SDL_IOStream SDL_IOStream;
  *   to an Android NDK `AAsset *`, that this SDL_IOStream is using to access
  *   the filesystem. If SDL used some other method to access the filesystem,
  *   this property will not be set.
+ * - `SDL_PROP_IOSTREAM_MEMORY_POINTER`: the base address of the file contents
+ *   if the file was mapped into memory. If the file wasn't mapped, this
+ *   property will not be set.
+ * - `SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER`: the size of the mapping, if the
+ *   file was mapped into memory.
  *
  * \param file a UTF-8 string representing the filename to open.
  * \param mode an ASCII string representing the mode to be used for opening
@@ -569,6 +621,41 @@ extern SDL_DECLSPEC Sint64 SDLCALL SDL_SeekIO(SDL_IOStream *context, Sint64 offs
  */
 extern SDL_DECLSPEC Sint64 SDLCALL SDL_TellIO(SDL_IOStream *context);
 
+/**
+ * Get a pointer directly into the data of a memory-backed SDL_IOStream.
+ *
+ * This lets parsers work on the data in place instead of copying it out with
+ * SDL_ReadIO(). It works for streams created with SDL_IOFromMem(),
+ * SDL_IOFromConstMem(), SDL_IOFromDynamicMem(), and SDL_IOFromFile() when the
+ * file was mapped into memory. Custom streams can opt in by setting
+ * `SDL_PROP_IOSTREAM_MEMORY_POINTER` and
+ * `SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER` on their properties. For any other
+ * stream this function fails, and the caller should fall back to reading.
+ *
+ * This does not change the current read/write offset of the stream.
+ *
+ * The returned memory must not be written to. It stays valid until the stream
+ * is closed, or for dynamic memory streams, until the next write.
+ *
+ * \param context a pointer to an SDL_IOStream structure.
+ * \param offset the offset in bytes from the beginning of the stream.
+ * \param size on input, the number of bytes wanted. On output, the number of
+ *             bytes available at the returned pointer, which is less than
+ *             requested if the range extends past the end of the stream.
+ * \returns a pointer to the data at `offset` or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety Do not use the same SDL_IOStream from two threads at once.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_IOFromConstMem
+ * \sa SDL_IOFromFile
+ * \sa SDL_IOFromMem
+ * \sa SDL_ReadIO
+ */
+extern SDL_DECLSPEC const void * SDLCALL SDL_GetIOMemoryRange(SDL_IOStream *context, Uint64 offset, size_t *size);
+
 /**
  * Read from a data source.
  *
@@ -635,6 +722,99 @@ extern SDL_DECLSPEC size_t SDLCALL SDL_ReadIO(SDL_IOStream *context, void *ptr,
  */
 extern SDL_DECLSPEC size_t SDLCALL SDL_WriteIO(SDL_IOStream *context, const void *ptr, size_t size);
 
+/**
+ * Query whether a stream can read at an explicit offset.
+ *
+ * This is true when the stream's interface implements `read_at` and the
+ * stream isn't buffered (see SDL_SetIOBufferSize()), since positional reads
+ * go around the buffer.
+ *
+ * \param context the stream to query.
+ * \returns true if SDL_ReadIOAt() can be used on this stream, false
+ *          otherwise.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_ReadIOAt
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_IOHasPositionalRead(SDL_IOStream *context);
+
+/**
+ * Query whether a stream can write at an explicit offset.
+ *
+ * This is true when the stream's interface implements `write_at` and the
+ * stream isn't buffered (see SDL_SetIOBufferSize()).
+ *
+ * \param context the stream to query.
+ * \returns true if SDL_WriteIOAt() can be used on this stream, false
+ *          otherwise.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_WriteIOAt
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_IOHasPositionalWrite(SDL_IOStream *context);
+
+/**
+ * Read from a stream at an explicit offset.
+ *
+ * This reads up to `size` bytes starting at `offset`, without using or
+ * changing the stream position, and without changing the value returned by
+ * SDL_GetIOStatus(). It fails on streams where SDL_IOHasPositionalRead()
+ * returns false.
+ *
+ * \param context the stream to read from.
+ * \param ptr a pointer to a buffer to read data into.
+ * \param size the number of bytes to read.
+ * \param offset the offset in the stream to start reading at.
+ * \param status a pointer filled in with the status of this read, may be
+ *               NULL.
+ * \returns the number of bytes read, or 0 on end of file or other failure;
+ *          call SDL_GetError() for more information.
+ *
+ * \threadsafety Several threads may read and write different parts of the
+ *               same stream with SDL_ReadIOAt() and SDL_WriteIOAt() at once,
+ *               but not while another thread uses any other function on it.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_IOHasPositionalRead
+ * \sa SDL_WriteIOAt
+ */
+extern SDL_DECLSPEC size_t SDLCALL SDL_ReadIOAt(SDL_IOStream *context, void *ptr, size_t size, Uint64 offset, SDL_IOStatus *status);
+
+/**
+ * Write to a stream at an explicit offset.
+ *
+ * This writes `size` bytes starting at `offset`, without using or changing
+ * the stream position, and without changing the value returned by
+ * SDL_GetIOStatus(). It fails on streams where SDL_IOHasPositionalWrite()
+ * returns false.
+ *
+ * \param context the stream to write to.
+ * \param ptr a pointer to a buffer containing data to write.
+ * \param size the number of bytes to write.
+ * \param offset the offset in the stream to start writing at.
+ * \param status a pointer filled in with the status of this write, may be
+ *               NULL.
+ * \returns the number of bytes written, which will be less than `size` on
+ *          failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety Several threads may read and write different parts of the
+ *               same stream with SDL_ReadIOAt() and SDL_WriteIOAt() at once,
+ *               but not while another thread uses any other function on it.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_IOHasPositionalWrite
+ * \sa SDL_ReadIOAt
+ */
+extern SDL_DECLSPEC size_t SDLCALL SDL_WriteIOAt(SDL_IOStream *context, const void *ptr, size_t size, Uint64 offset, SDL_IOStatus *status);
+
 /**
  * Print to an SDL_IOStream data stream.
  *
@@ -696,6 +876,44 @@ extern SDL_DECLSPEC size_t SDLCALL SDL_IOvprintf(SDL_IOStream *context, SDL_PRIN
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_FlushIO(SDL_IOStream *context);
 
+/**
+ * Set the size of the read-ahead and write-behind buffer of a stream.
+ *
+ * A buffered stream reads from its data source in large blocks and collects
+ * small writes before passing them on, so code that reads or writes a few
+ * bytes at a time, like SDL_ReadU32LE() or SDL_WriteU16BE(), doesn't make a
+ * system call for every value.
+ *
+ * Streams for seekable files that SDL opens through its own file descriptors
+ * or handles (not stdio, which has its own buffering) are buffered by
+ * default. Pipes, memory streams and custom streams are unbuffered unless
+ * this function is called.
+ *
+ * Buffered writes reach the data source when the buffer fills up, and on
+ * SDL_FlushIO(), SDL_SeekIO(), SDL_GetIOSize(), a read, or SDL_CloseIO(). An
+ * error writing them is reported by whichever of those calls triggered it.
+ * Call SDL_FlushIO() before using the underlying file handle or descriptor
+ * directly, and don't move its file position behind SDL's back while the
+ * stream is buffered.
+ *
+ * Changing the size flushes pending writes and discards data that was read
+ * ahead.
+ *
+ * \param context the stream to change.
+ * \param size the size of the buffer in bytes, or 0 to disable buffering.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information. Buffering requires a stream that can seek.
+ *
+ * \threadsafety Do not use the same SDL_IOStream from two threads at once.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_FlushIO
+ * \sa SDL_ReadIO
+ * \sa SDL_WriteIO
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetIOBufferSize(SDL_IOStream *context, size_t size);
+
 /**
  * Load all the data from an SDL data stream.
  *
@@ -705,6 +923,16 @@ extern SDL_DECLSPEC bool SDLCALL SDL_FlushIO(SDL_IOStream *context);
  *
  * The data should be freed with SDL_free().
  *
+ * If the stream can't report its size, like a pipe, the buffer starts small
+ * and doubles as data arrives. When the caller has a good guess for the
+ * amount of data, setting it on the stream's properties avoids most of the
+ * regrowth:
+ *
+ * - `SDL_PROP_IOSTREAM_LOAD_SIZE_HINT_NUMBER`: the number of bytes to
+ *   allocate up front when the stream size is unknown. This is only a hint,
+ *   more or less data is handled correctly. This property is available
+ *   since SDL 3.4.0.
+ *
  * \param src the SDL_IOStream to read all available data from.
  * \param datasize a pointer filled in with the number of bytes read, may be
  *                 NULL.
@@ -717,11 +945,14 @@ extern SDL_DECLSPEC bool SDLCALL SDL_FlushIO(SDL_IOStream *context);
  *
  * \since This function is available since SDL 3.2.0.
  *
+ * \sa SDL_GetIOProperties
  * \sa SDL_LoadFile
  * \sa SDL_SaveFile_IO
  */
 extern SDL_DECLSPEC void * SDLCALL SDL_LoadFile_IO(SDL_IOStream *src, size_t *datasize, bool closeio);
 
+#define SDL_PROP_IOSTREAM_LOAD_SIZE_HINT_NUMBER "SDL.iostream.load_size_hint"
+
 /**
  * Load all the data from a file path.
  *
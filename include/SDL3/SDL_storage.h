@@ -244,6 +244,7 @@
 #define SDL_storage_h_
 
 #include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_asyncio.h>
 #include <SDL3/SDL_error.h>
 #include <SDL3/SDL_filesystem.h>
 #include <SDL3/SDL_properties.h>
@@ -677,6 +678,86 @@ extern SDL_DECLSPEC Uint64 SDLCALL SDL_GetStorageSpaceRemaining(SDL_Storage *sto
  */
 extern SDL_DECLSPEC char ** SDLCALL SDL_GlobStorageDirectory(SDL_Storage *storage, const char *path, const char *pattern, SDL_GlobFlags flags, int *count);
 
+/**
+ * Load all the data from a file in a storage container, asynchronously.
+ *
+ * This is the storage equivalent of SDL_LoadFileAsync(): the file is read in
+ * the background, and the result is added to `queue` when it's done. The
+ * outcome's `buffer` is allocated by SDL and holds the whole file, plus a
+ * null terminator that isn't counted in `bytes_transferred`, and you must
+ * SDL_free() it when done with it. The outcome's `asyncio` is always NULL.
+ *
+ * The storage container must remain open until the result arrives.
+ *
+ * Not every storage backend can read asynchronously; custom containers made
+ * with SDL_OpenStorage() never can. In that case this function fails without
+ * starting any work, and SDL_ReadStorageFile() should be used instead.
+ *
+ * \param storage a storage container to read from.
+ * \param path the relative path of the file to read.
+ * \param queue a queue to add the new task to.
+ * \param userdata an app-defined pointer that will be provided with the task
+ *                 results.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, assuming
+ *               the `storage` object is thread-safe.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetAsyncIOResult
+ * \sa SDL_ReadStorageFile
+ * \sa SDL_ReadStorageFilesAsync
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_ReadStorageFileAsync(SDL_Storage *storage, const char *path, SDL_AsyncIOQueue *queue, void *userdata);
+
+/**
+ * Start loading every file that matches a pattern in a storage container,
+ * asynchronously.
+ *
+ * This enumerates `path` like SDL_GlobStorageDirectory() does, skips
+ * anything that isn't a file, and starts an SDL_ReadStorageFileAsync() for
+ * each file that's left, so the reads all run in parallel. Each file's result
+ * arrives in `queue` separately, and its `userdata` is that file's string
+ * from the returned array, so the app can tell the results apart. As with
+ * SDL_ReadStorageFileAsync(), each result's buffer must be freed with
+ * SDL_free().
+ *
+ * The returned array lists the files, relative to `path`, and has one result
+ * coming for each of them. If the function fails partway through starting
+ * the reads, the array holds only the files that were started, and
+ * SDL_GetError() explains why the rest weren't. Don't free the array until
+ * all of its results have been received.
+ *
+ * Every file being read holds an open file handle until its result is
+ * received, so retrieve results as they arrive when loading a large number
+ * of files.
+ *
+ * \param storage a storage container.
+ * \param path the path of the directory to enumerate, or NULL for the root.
+ * \param pattern the pattern that files in the directory must match. Can be
+ *                NULL.
+ * \param flags `SDL_GLOB_*` bitflags that affect this search.
+ * \param queue a queue to add the new tasks to.
+ * \param count on return, will be set to the number of items in the returned
+ *              array. Can be NULL.
+ * \returns a NULL-terminated array of the files being read on success or
+ *          NULL on failure; call SDL_GetError() for more information. This
+ *          is a single allocation that should be freed with SDL_free() once
+ *          every result has arrived. If nothing matched, this returns an
+ *          empty array, not NULL.
+ *
+ * \threadsafety It is safe to call this function from any thread, assuming
+ *               the `storage` object is thread-safe.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GlobStorageDirectory
+ * \sa SDL_ReadStorageFileAsync
+ */
+extern SDL_DECLSPEC char ** SDLCALL SDL_ReadStorageFilesAsync(SDL_Storage *storage, const char *path, const char *pattern, SDL_GlobFlags flags, SDL_AsyncIOQueue *queue, int *count);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
@@ -73,6 +73,9 @@
 #cmakedefine HAVE_DLOPEN 1
 #cmakedefine HAVE_MALLOC 1
 #cmakedefine HAVE_FDATASYNC 1
+#cmakedefine HAVE_PREAD 1
+#cmakedefine HAVE_PWRITE 1
+#cmakedefine HAVE_MMAP 1
 #cmakedefine HAVE_GETENV 1
 #cmakedefine HAVE_GETHOSTNAME 1
 #cmakedefine HAVE_SETENV 1
@@ -179,6 +182,8 @@
 #cmakedefine HAVE_FSEEKO64 1
 #cmakedefine HAVE_MEMFD_CREATE 1
 #cmakedefine HAVE_POSIX_FALLOCATE 1
+#cmakedefine HAVE_COPY_FILE_RANGE 1
+#cmakedefine HAVE_SENDFILE 1
 #cmakedefine HAVE_SIGACTION 1
 #cmakedefine HAVE_SIGTIMEDWAIT 1
 #cmakedefine HAVE_SA_SIGACTION 1
@@ -55,6 +55,8 @@
 #define HAVE_DLOPEN 1
 #define HAVE_MALLOC 1
 #define HAVE_FDATASYNC 1
+#define HAVE_PREAD 1
+#define HAVE_PWRITE 1
 #define HAVE_GETENV 1
 #define HAVE_GETHOSTNAME 1
 #define HAVE_PUTENV 1
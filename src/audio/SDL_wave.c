@@ -35,6 +35,7 @@ SDL_COMPILE_TIME_ASSERT(int_size, sizeof(int) == sizeof(Sint32));
 
 #include "SDL_wave.h"
 #include "SDL_sysaudio.h"
+#include "../io/SDL_iostream_c.h"
 
 /* Reads the value stored at the location of the f1 pointer, multiplies it
  * with the second argument and then stores the result to f1.
@@ -1159,6 +1160,34 @@ static bool LAW_Init(WaveFile *file, size_t datalength)
     return true;
 }
 
+/* Hands the chunk data over in an allocation of at least `size` bytes that
+ * the caller owns. Borrowed stream memory gets copied at this point.
+ */
+static Uint8 *WaveDetachChunkData(WaveChunk *chunk, size_t size)
+{
+    Uint8 *data;
+
+    if (chunk->borrowed) {
+        data = (Uint8 *)SDL_malloc(size);
+        if (!data) {
+            return NULL;
+        }
+        SDL_memcpy(data, chunk->data, SDL_min(size, chunk->size));
+    } else if (size > chunk->size) {
+        data = (Uint8 *)SDL_realloc(chunk->data, size);
+        if (!data) {
+            return NULL;
+        }
+    } else {
+        data = chunk->data;
+    }
+
+    chunk->data = NULL;
+    chunk->size = 0;
+    chunk->borrowed = false;
+    return data;
+}
+
 static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
 #ifdef SDL_WAVE_LAW_LUT
@@ -1233,12 +1262,10 @@ static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
     }
 
     // 1 to avoid allocating zero bytes, to keep static analysis happy.
-    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
+    src = WaveDetachChunkData(chunk, expanded_len ? expanded_len : 1);
     if (!src) {
         return false;
     }
-    chunk->data = NULL;
-    chunk->size = 0;
 
     dst = (Sint16 *)src;
 
@@ -1364,15 +1391,11 @@ static bool PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32
     }
 
     // 1 to avoid allocating zero bytes, to keep static analysis happy.
-    ptr = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
+    ptr = WaveDetachChunkData(chunk, expanded_len ? expanded_len : 1);
     if (!ptr) {
         return false;
     }
 
-    // This pointer is now invalid.
-    chunk->data = NULL;
-    chunk->size = 0;
-
     *audio_buf = ptr;
     *audio_len = (Uint32)expanded_len;
 
@@ -1427,12 +1450,12 @@ static bool PCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         return SDL_SetError("WAVE file too big");
     }
 
-    *audio_buf = chunk->data;
-    *audio_len = (Uint32)outputsize;
-
     // This pointer is going to be returned to the caller. Prevent free in cleanup.
-    chunk->data = NULL;
-    chunk->size = 0;
+    *audio_buf = WaveDetachChunkData(chunk, outputsize);
+    if (!*audio_buf) {
+        return false;
+    }
+    *audio_len = (Uint32)outputsize;
 
     return true;
 }
@@ -1497,10 +1520,13 @@ static WaveFactChunkHint WaveGetFactChunkHint(void)
 static void WaveFreeChunkData(WaveChunk *chunk)
 {
     if (chunk->data) {
-        SDL_free(chunk->data);
+        if (!chunk->borrowed) {
+            SDL_free(chunk->data);
+        }
         chunk->data = NULL;
     }
     chunk->size = 0;
+    chunk->borrowed = false;
 }
 
 static int WaveNextChunk(SDL_IOStream *src, WaveChunk *chunk)
@@ -1544,6 +1570,17 @@ static int WaveReadPartialChunkData(SDL_IOStream *src, WaveChunk *chunk, size_t
     }
 
     if (length > 0) {
+        // Memory-backed streams, like mapped files, are parsed in place
+        size_t available = length;
+        const void *direct = SDL_PeekIOMemoryRange(src, (Uint64)chunk->position, &available);
+        if (direct) {
+            chunk->data = (Uint8 *)direct;
+            chunk->size = available;
+            chunk->borrowed = true;
+            SDL_SeekIO(src, chunk->position + (Sint64)available, SDL_IO_SEEK_SET);
+            return 0;
+        }
+
         chunk->data = (Uint8 *)SDL_malloc(length);
         if (!chunk->data) {
             return -1;
@@ -61,6 +61,10 @@ static const CameraBootStrap *const bootstrap[] = {
 
 static SDL_CameraDriver camera_driver;
 
+// How many converted frames we buffer for the app by default, and at most, if SDL_HINT_CAMERA_FRAME_QUEUE_DEPTH is set.
+#define DEFAULT_CAMERA_QUEUE_DEPTH 8
+#define MAX_CAMERA_QUEUE_DEPTH 64
+
 
 int SDL_GetNumCameraDrivers(void)
 {
@@ -257,16 +261,19 @@ static void ClosePhysicalCamera(SDL_Camera *device)
     camera_driver.impl.CloseDevice(device);
 
     SDL_DestroyProperties(device->props);
+    device->props = 0;
 
     SDL_DestroySurface(device->acquire_surface);
     device->acquire_surface = NULL;
     SDL_DestroySurface(device->conversion_surface);
     device->conversion_surface = NULL;
 
-    for (int i = 0; i < SDL_arraysize(device->output_surfaces); i++) {
+    for (int i = 0; i < device->num_output_surfaces; i++) {
         SDL_DestroySurface(device->output_surfaces[i].surface);
     }
-    SDL_zeroa(device->output_surfaces);
+    SDL_free(device->output_surfaces);
+    device->output_surfaces = NULL;
+    device->num_output_surfaces = 0;
 
     SDL_aligned_free(device->zombie_pixels);
 
@@ -279,6 +286,11 @@ static void ClosePhysicalCamera(SDL_Camera *device)
     device->base_timestamp = 0;
     device->adjust_timestamp = 0;
 
+    device->choose_latest_frame = false;
+    device->frame_duration_ns = 0;
+    device->dropped_frames = 0;
+    device->late_frames = 0;
+
     SDL_zero(device->spec);
 }
 
@@ -798,6 +810,40 @@ void SDL_CameraThreadSetup(SDL_Camera *device)
 #endif
 }
 
+// Publish the frame counters to the camera's properties, if the app has asked for them. Must hold device->lock!
+static void UpdateCameraFrameStats(SDL_Camera *device)
+{
+    if (device->props) {
+        SDL_SetNumberProperty(device->props, SDL_PROP_CAMERA_DROPPED_FRAMES_NUMBER, (Sint64) device->dropped_frames);
+        SDL_SetNumberProperty(device->props, SDL_PROP_CAMERA_LATE_FRAMES_NUMBER, (Sint64) device->late_frames);
+    }
+}
+
+// Unlink the oldest frame from the filled list (which is sorted newest to oldest). Must hold device->lock!
+static SurfaceList *RemoveOldestFilledSurface(SDL_Camera *device)
+{
+    SurfaceList *slistprev = &device->filled_output_surfaces;
+    SurfaceList *slist = slistprev->next;
+    SDL_assert(slist != NULL);
+    while (slist->next) {
+        slistprev = slist;
+        slist = slist->next;
+    }
+    slistprev->next = NULL;
+    return slist;
+}
+
+// Give a queued frame's pixels back to the backend if they were never copied out of its buffers. Must hold device->lock!
+static void ReleaseOutputSurfaceFrame(SDL_Camera *device, SurfaceList *slist)
+{
+    if (!device->needs_conversion && !device->needs_scaling) {
+        device->ReleaseFrame(device, slist->surface);
+        slist->surface->pixels = NULL;
+        slist->surface->pitch = 0;
+    }
+    slist->timestampNS = 0;
+}
+
 bool SDL_CameraThreadIterate(SDL_Camera *device)
 {
     SDL_LockMutex(device->lock);
@@ -835,7 +881,7 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
             device->ReleaseFrame(device, device->acquire_surface);
             device->acquire_surface->pixels = NULL;
             device->acquire_surface->pitch = 0;
-        } else if (device->empty_output_surfaces.next == NULL) {
+        } else if ((device->empty_output_surfaces.next == NULL) && (!device->choose_latest_frame || (device->filled_output_surfaces.next == NULL))) {
             // uhoh, no output frames available! Either the app is slow, or it forgot to release frames when done with them. Drop this new frame.
             #if DEBUG_CAMERA
             SDL_Log("CAMERA: No empty output surfaces! Dropping frame!");
@@ -843,6 +889,8 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
             device->ReleaseFrame(device, device->acquire_surface);
             device->acquire_surface->pixels = NULL;
             device->acquire_surface->pitch = 0;
+            device->dropped_frames++;
+            UpdateCameraFrameStats(device);
         } else {
             if (!device->adjust_timestamp) {
                 device->adjust_timestamp = SDL_GetTicksNS();
@@ -850,9 +898,20 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
             }
             timestampNS = (timestampNS - device->base_timestamp) + device->adjust_timestamp;
 
-            slist = device->empty_output_surfaces.next;
+            if (device->empty_output_surfaces.next) {
+                slist = device->empty_output_surfaces.next;
+                device->empty_output_surfaces.next = slist->next;
+            } else {
+                // queue is full, but the app only wants the newest frames: throw away the oldest queued frame and reuse its slot.
+                #if DEBUG_CAMERA
+                SDL_Log("CAMERA: No empty output surfaces! Dropping oldest queued frame!");
+                #endif
+                slist = RemoveOldestFilledSurface(device);
+                ReleaseOutputSurfaceFrame(device, slist);
+                device->dropped_frames++;
+                UpdateCameraFrameStats(device);
+            }
             output_surface = slist->surface;
-            device->empty_output_surfaces.next = slist->next;
             acquired = device->acquire_surface;
             slist->timestampNS = timestampNS;
         }
@@ -996,6 +1055,24 @@ bool SDL_PrepareCameraSurfaces(SDL_Camera *device)
 
     device->needs_conversion = (devspec->format != appspec->format);
 
+    if (devspec->framerate_numerator > 0 && devspec->framerate_denominator > 0) {
+        device->frame_duration_ns = SDL_NS_PER_SECOND * (Uint64) devspec->framerate_denominator / (Uint64) devspec->framerate_numerator;
+    } else {
+        device->frame_duration_ns = 0;
+    }
+
+    int queue_depth = DEFAULT_CAMERA_QUEUE_DEPTH;
+    const char *hint = SDL_GetHint(SDL_HINT_CAMERA_FRAME_QUEUE_DEPTH);
+    if (hint) {
+        const int val = SDL_atoi(hint);
+        if (val > 0) {
+            queue_depth = SDL_min(val, MAX_CAMERA_QUEUE_DEPTH);
+        }
+    }
+
+    hint = SDL_GetHint(SDL_HINT_CAMERA_FRAME_QUEUE_POLICY);
+    device->choose_latest_frame = (hint && SDL_strcasecmp(hint, "latest") == 0);
+
     device->acquire_surface = SDL_CreateSurfaceFrom(devspec->width, devspec->height, devspec->format, NULL, 0);
     if (!device->acquire_surface) {
         goto failed;
@@ -1018,12 +1095,18 @@ bool SDL_PrepareCameraSurfaces(SDL_Camera *device)
     // the backend fills into acquired_surface, and you can get all the way from DMA access in the camera hardware
     // to the app without a single copy. Otherwise, these will be full surfaces that hold converted/scaled copies.
 
-    for (int i = 0; i < (SDL_arraysize(device->output_surfaces) - 1); i++) {
+    device->output_surfaces = (SurfaceList *) SDL_calloc(queue_depth, sizeof (SurfaceList));
+    if (!device->output_surfaces) {
+        goto failed;
+    }
+    device->num_output_surfaces = queue_depth;
+
+    for (int i = 0; i < (device->num_output_surfaces - 1); i++) {
         device->output_surfaces[i].next = &device->output_surfaces[i + 1];
     }
     device->empty_output_surfaces.next = device->output_surfaces;
 
-    for (int i = 0; i < SDL_arraysize(device->output_surfaces); i++) {
+    for (int i = 0; i < device->num_output_surfaces; i++) {
         SDL_Surface *surf;
         if (device->needs_scaling || device->needs_conversion) {
             surf = SDL_CreateSurface(appspec->width, appspec->height, appspec->format);
@@ -1051,13 +1134,16 @@ failed:
         device->conversion_surface = NULL;
     }
 
-    for (int i = 0; i < SDL_arraysize(device->output_surfaces); i++) {
+    for (int i = 0; i < device->num_output_surfaces; i++) {
         SDL_Surface *surf = device->output_surfaces[i].surface;
         if (surf) {
             SDL_DestroySurface(surf);
         }
     }
-    SDL_zeroa(device->output_surfaces);
+    SDL_free(device->output_surfaces);
+    device->output_surfaces = NULL;
+    device->num_output_surfaces = 0;
+    device->empty_output_surfaces.next = NULL;
 
     return false;
 }
@@ -1271,22 +1357,36 @@ SDL_Surface *SDL_AcquireCameraFrame(SDL_Camera *camera, Uint64 *timestampNS)
     }
 
     SDL_Surface *result = NULL;
+    SurfaceList *slist = NULL;
 
-    // frames are in this list from newest to oldest, so find the end of the list...
-    SurfaceList *slistprev = &device->filled_output_surfaces;
-    SurfaceList *slist = slistprev;
-    while (slist->next) {
-        slistprev = slist;
-        slist = slist->next;
+    if (device->filled_output_surfaces.next == NULL) {
+        // nothing queued.
+    } else if (device->choose_latest_frame) {  // frames are in this list from newest to oldest, so report the first one and recycle the rest.
+        slist = device->filled_output_surfaces.next;
+        SurfaceList *stale = slist->next;
+        slist->next = NULL;
+        while (stale) {
+            SurfaceList *next = stale->next;
+            ReleaseOutputSurfaceFrame(device, stale);
+            stale->next = device->empty_output_surfaces.next;
+            device->empty_output_surfaces.next = stale;
+            device->dropped_frames++;
+            stale = next;
+        }
+        device->filled_output_surfaces.next = NULL;
+    } else {  // report the oldest frame.
+        slist = RemoveOldestFilledSurface(device);
     }
 
-    const bool list_is_empty = (slist == slistprev);
-    if (!list_is_empty) { // report the oldest frame.
+    if (slist) {
         if (timestampNS) {
             *timestampNS = slist->timestampNS;
         }
+        if (device->frame_duration_ns && ((slist->timestampNS + device->frame_duration_ns) < SDL_GetTicksNS())) {
+            device->late_frames++;
+        }
+        UpdateCameraFrameStats(device);
         result = slist->surface;
-        slistprev->next = slist->next;  // remove from filled list.
         slist->next = device->app_held_output_surfaces.next;  // add to app_held list.
         device->app_held_output_surfaces.next = slist;
     }
@@ -1363,6 +1463,7 @@ SDL_PropertiesID SDL_GetCameraProperties(SDL_Camera *camera)
         ObtainPhysicalCameraObj(device);
         if (device->props == 0) {
             device->props = SDL_CreateProperties();
+            UpdateCameraFrameStats(device);
         }
         result = device->props;
         ReleaseCamera(device);
@@ -136,11 +136,24 @@ struct SDL_Camera
     SDL_Surface *conversion_surface;
 
     // A queue of surfaces that buffer converted/scaled frames of video until the app claims them.
-    SurfaceList output_surfaces[8];
+    SurfaceList *output_surfaces;
+    int num_output_surfaces;
     SurfaceList filled_output_surfaces;        // this is FIFO
     SurfaceList empty_output_surfaces;         // this is LIFO
     SurfaceList app_held_output_surfaces;
 
+    // true to hand the app only the newest frame, recycling older queued frames instead of dropping new ones.
+    bool choose_latest_frame;
+
+    // Expected time between frames, from actual_spec. Zero if unknown.
+    Uint64 frame_duration_ns;
+
+    // Frames SDL threw away because the queue was full or they were superseded. Protected by `lock`.
+    Uint64 dropped_frames;
+
+    // Frames the app acquired more than one frame duration after their timestamp. Protected by `lock`.
+    Uint64 late_frames;
+
     // A fake video frame we allocate if the camera fails/disconnects.
     Uint8 *zombie_pixels;
 
@@ -1282,3 +1282,37 @@
 #define SDL_hid_get_properties SDL_hid_get_properties_REAL
 #define SDL_GetPixelFormatFromGPUTextureFormat SDL_GetPixelFormatFromGPUTextureFormat_REAL
 #define SDL_GetGPUTextureFormatFromPixelFormat SDL_GetGPUTextureFormatFromPixelFormat_REAL
+#define SDL_EnableGPUTimestamps SDL_EnableGPUTimestamps_REAL
+#define SDL_GetGPUPassTimings SDL_GetGPUPassTimings_REAL
+#define SDL_AllocateGPUUploadMemory SDL_AllocateGPUUploadMemory_REAL
+#define SDL_GetGPUMemoryStats SDL_GetGPUMemoryStats_REAL
+#define SDL_CreateGPUTextureReadback SDL_CreateGPUTextureReadback_REAL
+#define SDL_DownloadToGPUTextureReadback SDL_DownloadToGPUTextureReadback_REAL
+#define SDL_MapGPUTextureReadback SDL_MapGPUTextureReadback_REAL
+#define SDL_UnmapGPUTextureReadback SDL_UnmapGPUTextureReadback_REAL
+#define SDL_ReleaseGPUTextureReadback SDL_ReleaseGPUTextureReadback_REAL
+#define SDL_CreateGPUGraphicsPipelineAsync SDL_CreateGPUGraphicsPipelineAsync_REAL
+#define SDL_CreateGPUComputePipelineAsync SDL_CreateGPUComputePipelineAsync_REAL
+#define SDL_QueryGPUPipelineJob SDL_QueryGPUPipelineJob_REAL
+#define SDL_WaitForGPUGraphicsPipeline SDL_WaitForGPUGraphicsPipeline_REAL
+#define SDL_WaitForGPUComputePipeline SDL_WaitForGPUComputePipeline_REAL
+#define SDL_ReleaseGPUPipelineJob SDL_ReleaseGPUPipelineJob_REAL
+#define SDL_PrepareGPURenderPass SDL_PrepareGPURenderPass_REAL
+#define SDL_RegisterGPUBindlessTexture SDL_RegisterGPUBindlessTexture_REAL
+#define SDL_RegisterGPUBindlessBuffer SDL_RegisterGPUBindlessBuffer_REAL
+#define SDL_UnregisterGPUBindlessTexture SDL_UnregisterGPUBindlessTexture_REAL
+#define SDL_UnregisterGPUBindlessBuffer SDL_UnregisterGPUBindlessBuffer_REAL
+#define SDL_DrawGPUPrimitivesIndirectCount SDL_DrawGPUPrimitivesIndirectCount_REAL
+#define SDL_DrawGPUIndexedPrimitivesIndirectCount SDL_DrawGPUIndexedPrimitivesIndirectCount_REAL
+#define SDL_GetIOMemoryRange SDL_GetIOMemoryRange_REAL
+#define SDL_SetIOBufferSize SDL_SetIOBufferSize_REAL
+#define SDL_ReadAsyncIORanges SDL_ReadAsyncIORanges_REAL
+#define SDL_ReadStorageFileAsync SDL_ReadStorageFileAsync_REAL
+#define SDL_ReadStorageFilesAsync SDL_ReadStorageFilesAsync_REAL
+#define SDL_WatchDirectory SDL_WatchDirectory_REAL
+#define SDL_UnwatchDirectory SDL_UnwatchDirectory_REAL
+#define SDL_CopyFileWithProgress SDL_CopyFileWithProgress_REAL
+#define SDL_IOHasPositionalRead SDL_IOHasPositionalRead_REAL
+#define SDL_IOHasPositionalWrite SDL_IOHasPositionalWrite_REAL
+#define SDL_ReadIOAt SDL_ReadIOAt_REAL
+#define SDL_WriteIOAt SDL_WriteIOAt_REAL
@@ -1290,3 +1290,37 @@ SDL_DYNAPI_PROC(Uint32,SDL_AddAtomicU32,(SDL_AtomicU32 *a,int b),(a,b),return)
 SDL_DYNAPI_PROC(SDL_PropertiesID,SDL_hid_get_properties,(SDL_hid_device *a),(a),return)
 SDL_DYNAPI_PROC(SDL_PixelFormat,SDL_GetPixelFormatFromGPUTextureFormat,(SDL_GPUTextureFormat a),(a),return)
 SDL_DYNAPI_PROC(SDL_GPUTextureFormat,SDL_GetGPUTextureFormatFromPixelFormat,(SDL_PixelFormat a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_EnableGPUTimestamps,(SDL_GPUCommandBuffer *a),(a),return)
+SDL_DYNAPI_PROC(SDL_GPUPassTiming*,SDL_GetGPUPassTimings,(SDL_GPUDevice *a,SDL_GPUFence *b,int *c),(a,b,c),return)
+SDL_DYNAPI_PROC(void*,SDL_AllocateGPUUploadMemory,(SDL_GPUCommandBuffer *a,Uint32 b,Uint32 c,SDL_GPUTransferBufferLocation *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(SDL_GPUMemoryStats*,SDL_GetGPUMemoryStats,(SDL_GPUDevice *a,int *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_GPUTextureReadback*,SDL_CreateGPUTextureReadback,(SDL_GPUDevice *a,Uint32 b,Uint32 c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_DownloadToGPUTextureReadback,(SDL_GPUCopyPass *a,const SDL_GPUTextureRegion *b,SDL_GPUTextureReadback *c),(a,b,c),return)
+SDL_DYNAPI_PROC(const void*,SDL_MapGPUTextureReadback,(SDL_GPUDevice *a,SDL_GPUTextureReadback *b,bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_UnmapGPUTextureReadback,(SDL_GPUDevice *a,SDL_GPUTextureReadback *b),(a,b),)
+SDL_DYNAPI_PROC(void,SDL_ReleaseGPUTextureReadback,(SDL_GPUDevice *a,SDL_GPUTextureReadback *b),(a,b),)
+SDL_DYNAPI_PROC(SDL_GPUPipelineJob*,SDL_CreateGPUGraphicsPipelineAsync,(SDL_GPUDevice *a,const SDL_GPUGraphicsPipelineCreateInfo *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_GPUPipelineJob*,SDL_CreateGPUComputePipelineAsync,(SDL_GPUDevice *a,const SDL_GPUComputePipelineCreateInfo *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_QueryGPUPipelineJob,(SDL_GPUDevice *a,SDL_GPUPipelineJob *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_GPUGraphicsPipeline*,SDL_WaitForGPUGraphicsPipeline,(SDL_GPUDevice *a,SDL_GPUPipelineJob *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_GPUComputePipeline*,SDL_WaitForGPUComputePipeline,(SDL_GPUDevice *a,SDL_GPUPipelineJob *b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_ReleaseGPUPipelineJob,(SDL_GPUDevice *a,SDL_GPUPipelineJob *b),(a,b),)
+SDL_DYNAPI_PROC(bool,SDL_PrepareGPURenderPass,(SDL_GPUDevice *a,const SDL_GPUColorTargetInfo *b,Uint32 c,const SDL_GPUDepthStencilTargetInfo *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(bool,SDL_RegisterGPUBindlessTexture,(SDL_GPUDevice *a,SDL_GPUTexture *b,SDL_GPUSampler *c,Uint32 *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(bool,SDL_RegisterGPUBindlessBuffer,(SDL_GPUDevice *a,SDL_GPUBuffer *b,Uint32 *c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_UnregisterGPUBindlessTexture,(SDL_GPUDevice *a,Uint32 b),(a,b),)
+SDL_DYNAPI_PROC(void,SDL_UnregisterGPUBindlessBuffer,(SDL_GPUDevice *a,Uint32 b),(a,b),)
+SDL_DYNAPI_PROC(void,SDL_DrawGPUPrimitivesIndirectCount,(SDL_GPURenderPass *a,SDL_GPUBuffer *b,Uint32 c,SDL_GPUBuffer *d,Uint32 e,Uint32 f),(a,b,c,d,e,f),)
+SDL_DYNAPI_PROC(void,SDL_DrawGPUIndexedPrimitivesIndirectCount,(SDL_GPURenderPass *a,SDL_GPUBuffer *b,Uint32 c,SDL_GPUBuffer *d,Uint32 e,Uint32 f),(a,b,c,d,e,f),)
+SDL_DYNAPI_PROC(const void*,SDL_GetIOMemoryRange,(SDL_IOStream *a,Uint64 b,size_t *c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetIOBufferSize,(SDL_IOStream *a,size_t b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_ReadAsyncIORanges,(SDL_AsyncIO *a,const SDL_AsyncIORange *b,int c,SDL_AsyncIOQueue *d,void *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(bool,SDL_ReadStorageFileAsync,(SDL_Storage *a,const char *b,SDL_AsyncIOQueue *c,void *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(char **,SDL_ReadStorageFilesAsync,(SDL_Storage *a,const char *b,const char *c,SDL_GlobFlags d,SDL_AsyncIOQueue *e,int *f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(SDL_FileWatch*,SDL_WatchDirectory,(const char *a,SDL_FileWatchFlags b,SDL_FileWatchCallback c,void *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(void,SDL_UnwatchDirectory,(SDL_FileWatch *a),(a),)
+SDL_DYNAPI_PROC(bool,SDL_CopyFileWithProgress,(const char *a,const char *b,SDL_CopyFileProgressCallback c,void *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(bool,SDL_IOHasPositionalRead,(SDL_IOStream *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_IOHasPositionalWrite,(SDL_IOStream *a),(a),return)
+SDL_DYNAPI_PROC(size_t,SDL_ReadIOAt,(SDL_IOStream *a,void *b,size_t c,Uint64 d,SDL_IOStatus *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(size_t,SDL_WriteIOAt,(SDL_IOStream *a,const void *b,size_t c,Uint64 d,SDL_IOStatus *e),(a,b,c,d,e),return)
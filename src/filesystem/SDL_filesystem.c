@@ -50,7 +50,17 @@ bool SDL_CopyFile(const char *oldpath, const char *newpath)
     } else if (!newpath) {
         return SDL_InvalidParamError("newpath");
     }
-    return SDL_SYS_CopyFile(oldpath, newpath);
+    return SDL_SYS_CopyFile(oldpath, newpath, NULL, NULL);
+}
+
+bool SDL_CopyFileWithProgress(const char *oldpath, const char *newpath, SDL_CopyFileProgressCallback callback, void *userdata)
+{
+    if (!oldpath) {
+        return SDL_InvalidParamError("oldpath");
+    } else if (!newpath) {
+        return SDL_InvalidParamError("newpath");
+    }
+    return SDL_SYS_CopyFile(oldpath, newpath, callback, userdata);
 }
 
 bool SDL_CreateDirectory(const char *path)
@@ -114,6 +124,18 @@ bool SDL_CreateDirectory(const char *path)
     return retval;
 }
 
+typedef struct SDL_EnumerateDirectoryUntyped
+{
+    SDL_EnumerateDirectoryCallback callback;
+    void *userdata;
+} SDL_EnumerateDirectoryUntyped;
+
+static SDL_EnumerationResult SDLCALL UntypedEnumerateDirectoryCallback(void *userdata, const char *dirname, const char *fname, SDL_PathType type)
+{
+    const SDL_EnumerateDirectoryUntyped *untyped = (const SDL_EnumerateDirectoryUntyped *) userdata;
+    return untyped->callback(untyped->userdata, dirname, fname);
+}
+
 bool SDL_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback callback, void *userdata)
 {
     if (!path) {
@@ -121,7 +143,9 @@ bool SDL_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cal
     } else if (!callback) {
         return SDL_InvalidParamError("callback");
     }
-    return SDL_SYS_EnumerateDirectory(path, callback, userdata);
+
+    SDL_EnumerateDirectoryUntyped untyped = { callback, userdata };
+    return SDL_SYS_EnumerateDirectory(path, UntypedEnumerateDirectoryCallback, &untyped);
 }
 
 bool SDL_GetPathInfo(const char *path, SDL_PathInfo *info)
@@ -140,26 +164,14 @@ bool SDL_GetPathInfo(const char *path, SDL_PathInfo *info)
     return SDL_SYS_GetPathInfo(path, info);
 }
 
-static bool EverythingMatch(const char *pattern, const char *str, bool *matched_to_dir)
-{
-    SDL_assert(pattern == NULL);
-    SDL_assert(str != NULL);
-    SDL_assert(matched_to_dir != NULL);
-
-    *matched_to_dir = true;
-    return true;  // everything matches!
-}
-
-// this is just '*' and '?', with '/' matching nothing.
-static bool WildcardMatch(const char *pattern, const char *str, bool *matched_to_dir)
+// this is just '*' and '?' against a single path component; the caller splits patterns at '/', so a wildcard never matches a path separator.
+static bool WildcardMatch(const char *pattern, const char *str)
 {
     SDL_assert(pattern != NULL);
     SDL_assert(str != NULL);
-    SDL_assert(matched_to_dir != NULL);
 
     const char *str_backtrack = NULL;
     const char *pattern_backtrack = NULL;
-    char sch_backtrack = 0;
     char sch = *str;
     char pch = *pattern;
 
@@ -167,33 +179,18 @@ static bool WildcardMatch(const char *pattern, const char *str, bool *matched_to
         if (pch == '*') {
             str_backtrack = str;
             pattern_backtrack = ++pattern;
-            sch_backtrack = sch;
             pch = *pattern;
-        } else if (pch == sch) {
-            if (pch == '/') {
-                str_backtrack = pattern_backtrack = NULL;
-            }
+        } else if ((pch == sch) || (pch == '?')) {  // end of string was checked at `while`, so '?' always has something to eat here.
             sch = *(++str);
             pch = *(++pattern);
-        } else if ((pch == '?') && (sch != '/')) {  // end of string (checked at `while`) or path separator do not match '?'.
-            sch = *(++str);
-            pch = *(++pattern);
-        } else if (!pattern_backtrack || (sch_backtrack == '/')) { // we didn't have a match. Are we in a '*' and NOT on a path separator? Keep going. Otherwise, fail.
-            *matched_to_dir = false;
+        } else if (!pattern_backtrack) { // we didn't have a match and we aren't in a '*'? Fail.
             return false;
         } else {  // still here? Wasn't a match, but we're definitely in a '*' pattern.
             str = ++str_backtrack;
             pattern = pattern_backtrack;
-            sch_backtrack = sch;
             sch = *str;
             pch = *pattern;
         }
-
-        #ifdef SDL_PLATFORM_WINDOWS
-        if (sch == '\\') {
-            sch = '/';
-        }
-        #endif
     }
 
     // '*' at the end can be ignored, they are allowed to match nothing.
@@ -201,8 +198,6 @@ static bool WildcardMatch(const char *pattern, const char *str, bool *matched_to
         pch = *(++pattern);
     }
 
-    *matched_to_dir = ((pch == '/') || (pch == '\0'));  // end of string and the pattern is complete or failed at a '/'? We should descend into this directory.
-
     return (pch == '\0');  // survived the whole pattern? That's a match!
 }
 
@@ -243,19 +238,13 @@ static size_t EncodeCodepointToUtf8(char *ptr, Uint32 cp, size_t remaining)
     return 0;
 }
 
-static char *CaseFoldUtf8String(const char *fname)
+// `dst` needs room for (SDL_strlen(str) + 1) * 3 * 4 bytes, which is the most that folding can ever produce.
+static size_t CaseFoldUtf8Into(const char *str, char *dst, size_t dstlen)
 {
-    SDL_assert(fname != NULL);
-    const size_t allocation = (SDL_strlen(fname) + 1) * 3 * 4;
-    char *result = (char *) SDL_malloc(allocation);  // lazy: just allocating the max needed.
-    if (!result) {
-        return NULL;
-    }
-
     Uint32 codepoint;
-    char *ptr = result;
-    size_t remaining = allocation;
-    while ((codepoint = SDL_StepUTF8(&fname, NULL)) != 0) {
+    char *ptr = dst;
+    size_t remaining = dstlen;
+    while ((codepoint = SDL_StepUTF8(&str, NULL)) != 0) {
         Uint32 folded[3];
         const int num_folded = SDL_CaseFoldUnicode(codepoint, folded);
         SDL_assert(num_folded > 0);
@@ -271,12 +260,22 @@ static char *CaseFoldUtf8String(const char *fname)
     }
 
     SDL_assert(remaining > 0);
-    remaining--;
     *ptr = '\0';
+    return (size_t) (ptr - dst);
+}
 
-    if (remaining > 0) {
-        SDL_assert(allocation > remaining);
-        ptr = (char *)SDL_realloc(result, allocation - remaining);  // shrink it down.
+static char *CaseFoldUtf8String(const char *fname)
+{
+    SDL_assert(fname != NULL);
+    const size_t allocation = (SDL_strlen(fname) + 1) * 3 * 4;
+    char *result = (char *) SDL_malloc(allocation);  // lazy: just allocating the max needed.
+    if (!result) {
+        return NULL;
+    }
+
+    const size_t len = CaseFoldUtf8Into(fname, result, allocation);
+    if ((len + 1) < allocation) {
+        char *ptr = (char *)SDL_realloc(result, len + 1);  // shrink it down.
         if (ptr) {  // shouldn't fail, but if it does, `result` is still valid.
             result = ptr;
         }
@@ -286,20 +285,200 @@ static char *CaseFoldUtf8String(const char *fname)
 }
 
 
-typedef struct GlobDirCallbackData
+// Patterns are compiled into one segment per path component, so each directory entry only has to be
+//  matched by name against the segment for its depth, and a directory whose name can't match is never opened.
+typedef enum GlobSegmentType
+{
+    GLOB_SEGMENT_LITERAL,   // no wildcards, just compare the strings.
+    GLOB_SEGMENT_ANY,       // nothing but '*', matches any name.
+    GLOB_SEGMENT_WILDCARD
+} GlobSegmentType;
+
+typedef struct GlobSegment
 {
-    bool (*matcher)(const char *pattern, const char *str, bool *matched_to_dir);
+    GlobSegmentType type;
     const char *pattern;
+} GlobSegment;
+
+// a directory waiting for a worker thread to enumerate it. The path is stored right after this struct.
+typedef struct GlobWork
+{
+    struct GlobWork *next;
+    int depth;
+} GlobWork;
+
+typedef struct GlobDirectoryData GlobDirectoryData;
+
+typedef struct GlobWorker
+{
+    GlobDirectoryData *glob;
+    SDL_Thread *thread;
+    SDL_IOStream *string_stream;  // this worker's matches, created on the first one.
     int num_entries;
+    int depth;  // entries of the directory being enumerated are matched against segments[depth].
+    char *fullpath;  // scratch buffers, reused for every entry.
+    size_t fullpathlen;
+    char *folded;
+    size_t foldedlen;
+} GlobWorker;
+
+struct GlobDirectoryData
+{
+    GlobSegment *segments;  // NULL if there's no pattern; everything matches.
+    int num_segments;
     SDL_GlobFlags flags;
     SDL_GlobEnumeratorFunc enumerator;
     SDL_GlobGetPathInfoFunc getpathinfo;
     void *fsuserdata;
     size_t basedirlen;
-    SDL_IOStream *string_stream;
-} GlobDirCallbackData;
 
-static SDL_EnumerationResult SDLCALL GlobDirectoryCallback(void *userdata, const char *dirname, const char *fname)
+    // Everything below is only used when walking with worker threads (`lock` is non-NULL), and is protected by `lock`.
+    SDL_Mutex *lock;
+    SDL_Condition *condition;
+    GlobWork *work;
+    int num_queued;
+    int active;  // workers in the middle of enumerating a directory, which might queue up more.
+    int num_idle;
+    int num_workers;
+    int max_workers;
+    bool failed;
+    char error[256];  // SDL_GetError() is per-thread, so the first failure is carried back to the calling thread here.
+    GlobWorker *workers;
+};
+
+// Walking a tree is mostly waiting on the filesystem, but past a handful of threads they just contend for the same disk.
+#define MAX_GLOB_WORKERS 8
+
+static bool GlobCompilePattern(GlobDirectoryData *data, char *pattern)
+{
+    int num_segments = 1;
+    for (const char *ptr = pattern; *ptr; ptr++) {
+        if (*ptr == '/') {
+            num_segments++;
+        }
+    }
+
+    data->segments = (GlobSegment *) SDL_calloc(num_segments, sizeof (GlobSegment));
+    if (!data->segments) {
+        return false;
+    }
+    data->num_segments = num_segments;
+
+    char *segment = pattern;
+    for (int i = 0; i < num_segments; i++) {
+        char *end = SDL_strchr(segment, '/');
+        if (end) {
+            *end = '\0';
+        }
+
+        GlobSegmentType type = GLOB_SEGMENT_LITERAL;
+        if (SDL_strpbrk(segment, "*?")) {
+            const char *ptr = segment;
+            while (*ptr == '*') {
+                ptr++;
+            }
+            type = (*ptr == '\0') ? GLOB_SEGMENT_ANY : GLOB_SEGMENT_WILDCARD;
+        }
+        data->segments[i].type = type;
+        data->segments[i].pattern = segment;
+
+        segment = end + 1;  // if `end` is NULL, this was the last segment and the loop is over.
+    }
+
+    return true;
+}
+
+static bool GlobSegmentMatch(const GlobSegment *segment, const char *name)
+{
+    switch (segment->type) {
+    case GLOB_SEGMENT_LITERAL:
+        return (SDL_strcmp(segment->pattern, name) == 0);
+    case GLOB_SEGMENT_ANY:
+        return true;
+    case GLOB_SEGMENT_WILDCARD:
+        break;
+    }
+    return WildcardMatch(segment->pattern, name);
+}
+
+static bool GlobGrowBuffer(char **buf, size_t *buflen, size_t needed)
+{
+    if (*buflen < needed) {
+        const size_t newlen = SDL_max(needed, *buflen * 2);
+        char *ptr = (char *) SDL_realloc(*buf, newlen);
+        if (!ptr) {
+            return false;
+        }
+        *buf = ptr;
+        *buflen = newlen;
+    }
+    return true;
+}
+
+static GlobWork *GlobCreateWork(const char *path, int depth)
+{
+    const size_t len = SDL_strlen(path) + 1;
+    GlobWork *work = (GlobWork *) SDL_malloc(sizeof (GlobWork) + len);
+    if (work) {
+        work->next = NULL;
+        work->depth = depth;
+        SDL_memcpy(work + 1, path, len);
+    }
+    return work;
+}
+
+static SDL_EnumerationResult SDLCALL GlobDirectoryCallback(void *userdata, const char *dirname, const char *fname, SDL_PathType type);
+
+static bool GlobWalkDirectory(GlobWorker *worker, const char *path, int depth)
+{
+    GlobDirectoryData *data = worker->glob;
+
+    // `path` might be this worker's scratch buffer, which the callbacks will reuse, so the enumerator gets a copy.
+    char *pathcpy = SDL_strdup(path);
+    if (!pathcpy) {
+        return false;
+    }
+
+    const int prevdepth = worker->depth;
+    worker->depth = depth;
+    const bool result = data->enumerator(pathcpy, GlobDirectoryCallback, worker, data->fsuserdata);
+    worker->depth = prevdepth;
+
+    SDL_free(pathcpy);
+    return result;
+}
+
+static int SDLCALL GlobWorkerThread(void *userdata);
+
+static bool GlobQueueDirectory(GlobWorker *worker, const char *path, int depth)
+{
+    GlobDirectoryData *data = worker->glob;
+    GlobWork *work = GlobCreateWork(path, depth);
+    if (!work) {
+        return false;
+    }
+
+    GlobWorker *spawn = NULL;
+    SDL_LockMutex(data->lock);
+    work->next = data->work;
+    data->work = work;
+    data->num_queued++;
+    if (data->num_idle > 0) {
+        SDL_SignalCondition(data->condition);
+    } else if ((data->num_queued > 1) && (data->num_workers < data->max_workers)) {  // only bring in another thread once work is piling up.
+        spawn = &data->workers[data->num_workers++];
+    }
+    SDL_UnlockMutex(data->lock);
+
+    if (spawn) {
+        // if this fails, the workers we already have will just have to get through the queue themselves.
+        spawn->thread = SDL_CreateThread(GlobWorkerThread, "SDLGlob", spawn);
+    }
+
+    return true;
+}
+
+static SDL_EnumerationResult SDLCALL GlobDirectoryCallback(void *userdata, const char *dirname, const char *fname, SDL_PathType type)
 {
     SDL_assert(userdata != NULL);
     SDL_assert(dirname != NULL);
@@ -307,56 +486,162 @@ static SDL_EnumerationResult SDLCALL GlobDirectoryCallback(void *userdata, const
 
     //SDL_Log("GlobDirectoryCallback('%s', '%s')", dirname, fname);
 
-    GlobDirCallbackData *data = (GlobDirCallbackData *) userdata;
+    GlobWorker *worker = (GlobWorker *) userdata;
+    GlobDirectoryData *data = worker->glob;
+    bool matched = true;
+    bool descend = true;
 
-    // !!! FIXME: if we're careful, we can keep a single buffer in `data` that we push and pop paths off the end of as we walk the tree,
-    // !!! FIXME: and only casefold the new pieces instead of allocating and folding full paths for all of this.
-
-    char *fullpath = NULL;
-    if (SDL_asprintf(&fullpath, "%s%s", dirname, fname) < 0) {
-        return SDL_ENUM_FAILURE;
-    }
+    if (data->segments) {
+        const char *name = fname;
+        if (data->flags & SDL_GLOB_CASEINSENSITIVE) {
+            if (!GlobGrowBuffer(&worker->folded, &worker->foldedlen, (SDL_strlen(fname) + 1) * 3 * 4)) {
+                return SDL_ENUM_FAILURE;
+            }
+            CaseFoldUtf8Into(fname, worker->folded, worker->foldedlen);
+            name = worker->folded;
+        }
 
-    char *folded = NULL;
-    if (data->flags & SDL_GLOB_CASEINSENSITIVE) {
-        folded = CaseFoldUtf8String(fullpath);
-        if (!folded) {
-            return SDL_ENUM_FAILURE;
+        if (!GlobSegmentMatch(&data->segments[worker->depth], name)) {
+            return SDL_ENUM_CONTINUE;  // not a match, and nothing inside it can be either.
         }
+
+        // only the last segment produces results; a match on any earlier one is a directory to look inside.
+        matched = (worker->depth == (data->num_segments - 1));
+        descend = !matched;
     }
 
-    bool matched_to_dir = false;
-    const bool matched = data->matcher(data->pattern, (folded ? folded : fullpath) + data->basedirlen, &matched_to_dir);
-    //SDL_Log("GlobDirectoryCallback: Considered %spath='%s' vs pattern='%s': %smatched (matched_to_dir=%s)", folded ? "(folded) " : "", (folded ? folded : fullpath) + data->basedirlen, data->pattern, matched ? "" : "NOT ", matched_to_dir ? "TRUE" : "FALSE");
-    SDL_free(folded);
+    const size_t dirnamelen = SDL_strlen(dirname);
+    const size_t fnamelen = SDL_strlen(fname);
+    if (!GlobGrowBuffer(&worker->fullpath, &worker->fullpathlen, dirnamelen + fnamelen + 1)) {
+        return SDL_ENUM_FAILURE;
+    }
+    SDL_memcpy(worker->fullpath, dirname, dirnamelen);
+    SDL_memcpy(worker->fullpath + dirnamelen, fname, fnamelen + 1);
 
     if (matched) {
-        const char *subpath = fullpath + data->basedirlen;
+        if (!worker->string_stream) {
+            worker->string_stream = SDL_IOFromDynamicMem();
+            if (!worker->string_stream) {
+                return SDL_ENUM_FAILURE;
+            }
+        }
+
+        const char *subpath = worker->fullpath + data->basedirlen;
         const size_t slen = SDL_strlen(subpath) + 1;
-        if (SDL_WriteIO(data->string_stream, subpath, slen) != slen) {
-            SDL_free(fullpath);
+        if (SDL_WriteIO(worker->string_stream, subpath, slen) != slen) {
             return SDL_ENUM_FAILURE;  // stop enumerating, return failure to the app.
         }
-        data->num_entries++;
+        worker->num_entries++;
     }
 
-    SDL_EnumerationResult result = SDL_ENUM_CONTINUE;  // keep enumerating by default.
-    if (matched_to_dir) {
-        SDL_PathInfo info;
-        if (data->getpathinfo(fullpath, &info, data->fsuserdata) && (info.type == SDL_PATHTYPE_DIRECTORY)) {
+    if (descend) {
+        if (type == SDL_PATHTYPE_NONE) {  // the enumerator couldn't tell us for free (symlinks, etc), so go ask.
+            SDL_PathInfo info;
+            if (data->getpathinfo(worker->fullpath, &info, data->fsuserdata)) {
+                type = info.type;
+            }
+        }
+
+        if (type == SDL_PATHTYPE_DIRECTORY) {
             //SDL_Log("GlobDirectoryCallback: Descending into subdir '%s'", fname);
-            if (!data->enumerator(fullpath, GlobDirectoryCallback, data, data->fsuserdata)) {
-                result = SDL_ENUM_FAILURE;
+            const int depth = data->segments ? (worker->depth + 1) : 0;
+            if (data->lock) {
+                if (!GlobQueueDirectory(worker, worker->fullpath, depth)) {
+                    return SDL_ENUM_FAILURE;
+                }
+            } else if (!GlobWalkDirectory(worker, worker->fullpath, depth)) {
+                return SDL_ENUM_FAILURE;
             }
         }
     }
 
-    SDL_free(fullpath);
+    return SDL_ENUM_CONTINUE;  // keep enumerating by default.
+}
 
-    return result;
+static void GlobRunWorker(GlobWorker *worker)
+{
+    GlobDirectoryData *data = worker->glob;
+
+    SDL_LockMutex(data->lock);
+    while (!data->failed) {
+        GlobWork *work = data->work;
+        if (!work) {
+            if (data->active == 0) {
+                break;  // nothing queued and nobody left who could queue more: we're done.
+            }
+            data->num_idle++;
+            SDL_WaitCondition(data->condition, data->lock);
+            data->num_idle--;
+            continue;
+        }
+
+        data->work = work->next;
+        data->num_queued--;
+        data->active++;
+        SDL_UnlockMutex(data->lock);
+
+        worker->depth = work->depth;
+        const bool ok = data->enumerator((const char *) (work + 1), GlobDirectoryCallback, worker, data->fsuserdata);
+        SDL_free(work);
+
+        SDL_LockMutex(data->lock);
+        data->active--;
+        if (!ok && !data->failed) {
+            data->failed = true;
+            SDL_strlcpy(data->error, SDL_GetError(), sizeof (data->error));
+        }
+        if (data->failed || (!data->work && (data->active == 0))) {
+            SDL_BroadcastCondition(data->condition);  // finished (or gave up), so wake everyone to leave.
+        }
+    }
+    SDL_UnlockMutex(data->lock);
+}
+
+static int SDLCALL GlobWorkerThread(void *userdata)
+{
+    GlobRunWorker((GlobWorker *) userdata);
+    return 0;
+}
+
+// Sets up `data` to walk with worker threads. Returns false if that isn't possible, and the walk stays on the calling thread.
+static bool GlobStartThreads(GlobDirectoryData *data, const char *path)
+{
+#ifdef SDL_THREADS_DISABLED
+    return false;
+#else
+    const int max_workers = SDL_clamp(SDL_GetNumLogicalCPUCores(), 1, MAX_GLOB_WORKERS);
+    if (max_workers < 2) {
+        return false;
+    }
+
+    GlobWorker *workers = (GlobWorker *) SDL_calloc(max_workers, sizeof (GlobWorker));
+    GlobWork *work = GlobCreateWork(path, 0);
+    SDL_Mutex *lock = SDL_CreateMutex();
+    SDL_Condition *condition = SDL_CreateCondition();
+    if (!workers || !work || !lock || !condition) {
+        SDL_free(workers);
+        SDL_free(work);
+        SDL_DestroyMutex(lock);
+        SDL_DestroyCondition(condition);
+        return false;
+    }
+
+    for (int i = 0; i < max_workers; i++) {
+        workers[i].glob = data;
+    }
+
+    data->workers = workers;
+    data->max_workers = max_workers;
+    data->num_workers = 1;  // the calling thread.
+    data->work = work;
+    data->num_queued = 1;
+    data->lock = lock;
+    data->condition = condition;
+    return true;
+#endif
 }
 
-char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count, SDL_GlobEnumeratorFunc enumerator, SDL_GlobGetPathInfoFunc getpathinfo, void *userdata)
+char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count, SDL_GlobEnumeratorFunc enumerator, SDL_GlobGetPathInfoFunc getpathinfo, void *userdata, bool threaded)
 {
     int dummycount;
     if (!count) {
@@ -384,72 +669,114 @@ char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_Glob
         path = pathcpy;
     }
 
-    if (!pattern) {
-        flags &= ~SDL_GLOB_CASEINSENSITIVE;  // avoid some unnecessary allocations and work later.
-    }
-
-    char *folded = NULL;
-    if (flags & SDL_GLOB_CASEINSENSITIVE) {
-        SDL_assert(pattern != NULL);
-        folded = CaseFoldUtf8String(pattern);
-        if (!folded) {
+    // the compiled segments point into this copy of the pattern.
+    char *patterncpy = NULL;
+    if (pattern) {
+        patterncpy = (flags & SDL_GLOB_CASEINSENSITIVE) ? CaseFoldUtf8String(pattern) : SDL_strdup(pattern);
+        if (!patterncpy) {
             SDL_free(pathcpy);
             return NULL;
         }
     }
 
-    GlobDirCallbackData data;
+    GlobDirectoryData data;
     SDL_zero(data);
-    data.string_stream = SDL_IOFromDynamicMem();
-    if (!data.string_stream) {
-        SDL_free(folded);
+    data.flags = flags;
+    data.enumerator = enumerator;
+    data.getpathinfo = getpathinfo;
+    data.fsuserdata = userdata;
+    data.basedirlen = *path ? (SDL_strlen(path) + 1) : 0;  // +1 for the '/' we'll be adding.
+
+    // !!! FIXME: SDL_GLOB_GITIGNORE would need a different matcher here.
+    if (patterncpy && !GlobCompilePattern(&data, patterncpy)) {
+        SDL_free(patterncpy);
         SDL_free(pathcpy);
         return NULL;
     }
 
-    if (!pattern) {
-        data.matcher = EverythingMatch;  // no pattern? Everything matches.
+    GlobWorker mainworker;
+    SDL_zero(mainworker);
+    mainworker.glob = &data;
 
-    // !!! FIXME
-    //} else if (flags & SDL_GLOB_GITIGNORE) {
-    //    data.matcher = GitIgnoreMatch;
+    bool walked;
+    if (threaded && GlobStartThreads(&data, path)) {
+        GlobRunWorker(&data.workers[0]);
 
-    } else {
-        data.matcher = WildcardMatch;
-    }
+        for (int i = 1; i < data.num_workers; i++) {
+            SDL_WaitThread(data.workers[i].thread, NULL);  // this is a no-op for a NULL thread that failed to start.
+        }
 
-    data.pattern = folded ? folded : pattern;
-    data.flags = flags;
-    data.enumerator = enumerator;
-    data.getpathinfo = getpathinfo;
-    data.fsuserdata = userdata;
-    data.basedirlen = *path ? (SDL_strlen(path) + 1) : 0;  // +1 for the '/' we'll be adding.
+        while (data.work) {  // might be leftovers if we gave up early.
+            GlobWork *next = data.work->next;
+            SDL_free(data.work);
+            data.work = next;
+        }
 
+        SDL_DestroyCondition(data.condition);
+        SDL_DestroyMutex(data.lock);
+
+        walked = !data.failed;
+        if (!walked) {
+            SDL_SetError("%s", data.error);
+        }
+    } else {
+        data.workers = &mainworker;
+        data.num_workers = 1;
+        walked = GlobWalkDirectory(&mainworker, path, 0);
+    }
 
     char **result = NULL;
-    if (data.enumerator(path, GlobDirectoryCallback, &data, data.fsuserdata)) {
-        const size_t streamlen = (size_t) SDL_GetIOSize(data.string_stream);
-        const size_t buflen = streamlen + ((data.num_entries + 1) * sizeof (char *));  // +1 for NULL terminator at end of array.
+    size_t streamlen = 0;
+    int num_entries = 0;
+    for (int i = 0; i < data.num_workers; i++) {
+        const GlobWorker *worker = &data.workers[i];
+        if (worker->string_stream) {
+            streamlen += (size_t) SDL_GetIOSize(worker->string_stream);
+            num_entries += worker->num_entries;
+        }
+    }
+
+    if (walked) {
+        const size_t buflen = streamlen + ((num_entries + 1) * sizeof (char *));  // +1 for NULL terminator at end of array.
         result = (char **) SDL_malloc(buflen);
         if (result) {
-            if (data.num_entries > 0) {
-                Sint64 iorc = SDL_SeekIO(data.string_stream, 0, SDL_IO_SEEK_SET);
-                SDL_assert(iorc == 0);  // this should never fail for a memory stream!
-                char *ptr = (char *) (result + (data.num_entries + 1));
-                iorc = SDL_ReadIO(data.string_stream, ptr, streamlen);
-                SDL_assert(iorc == (Sint64) streamlen);  // this should never fail for a memory stream!
-                for (int i = 0; i < data.num_entries; i++) {
-                    result[i] = ptr;
-                    ptr += SDL_strlen(ptr) + 1;
+            char *strings = (char *) (result + (num_entries + 1));
+            char *ptr = strings;
+            for (int i = 0; i < data.num_workers; i++) {
+                SDL_IOStream *stream = data.workers[i].string_stream;
+                if (stream) {
+                    const size_t len = (size_t) SDL_GetIOSize(stream);
+                    Sint64 iorc = SDL_SeekIO(stream, 0, SDL_IO_SEEK_SET);
+                    SDL_assert(iorc == 0);  // this should never fail for a memory stream!
+                    iorc = SDL_ReadIO(stream, ptr, len);
+                    SDL_assert(iorc == (Sint64) len);  // this should never fail for a memory stream!
+                    ptr += len;
                 }
             }
-            result[data.num_entries] = NULL;  // NULL terminate the list.
-            *count = data.num_entries;
+
+            ptr = strings;
+            for (int i = 0; i < num_entries; i++) {
+                result[i] = ptr;
+                ptr += SDL_strlen(ptr) + 1;
+            }
+            result[num_entries] = NULL;  // NULL terminate the list.
+            *count = num_entries;
         }
     }
 
-    SDL_CloseIO(data.string_stream);
-    SDL_free(folded);
+    for (int i = 0; i < data.num_workers; i++) {
+        GlobWorker *worker = &data.workers[i];
+        if (worker->string_stream) {
+            SDL_CloseIO(worker->string_stream);
+        }
+        SDL_free(worker->fullpath);
+        SDL_free(worker->folded);
+    }
+    if (data.workers != &mainworker) {
+        SDL_free(data.workers);
+    }
+    SDL_free(data.segments);
+    SDL_free(patterncpy);
     SDL_free(pathcpy);
 
     return result;
@@ -460,15 +787,15 @@ static bool GlobDirectoryGetPathInfo(const char *path, SDL_PathInfo *info, void
     return SDL_GetPathInfo(path, info);
 }
 
-static bool GlobDirectoryEnumerator(const char *path, SDL_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata)
+static bool GlobDirectoryEnumerator(const char *path, SDL_EnumerateDirectoryTypedCallback cb, void *cbuserdata, void *userdata)
 {
-    return SDL_EnumerateDirectory(path, cb, cbuserdata);
+    return SDL_SYS_EnumerateDirectory(path, cb, cbuserdata);
 }
 
 char **SDL_GlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count)
 {
     //SDL_Log("SDL_GlobDirectory('%s', '%s') ...", path, pattern);
-    return SDL_InternalGlobDirectory(path, pattern, flags, count, GlobDirectoryEnumerator, GlobDirectoryGetPathInfo, NULL);
+    return SDL_InternalGlobDirectory(path, pattern, flags, count, GlobDirectoryEnumerator, GlobDirectoryGetPathInfo, NULL, true);
 }
 
 
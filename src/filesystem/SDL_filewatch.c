@@ -0,0 +1,909 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "SDL_internal.h"
+
+#include "SDL_sysfilesystem.h"
+#include "../SDL_hashtable.h"
+
+#ifdef HAVE_INOTIFY
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// Changes are held until the directory has been quiet this long, so a burst of them (an editor saving, a build writing files) is delivered coalesced...
+#define FILEWATCH_QUIET_NS SDL_MS_TO_NS(50)
+
+// ...but never held longer than this, so a directory that is never quiet still gets reported.
+#define FILEWATCH_MAX_DELAY_NS SDL_MS_TO_NS(500)
+
+// How often the fallback rescans the directory when there's no way to be notified.
+#define FILEWATCH_POLL_INTERVAL_NS SDL_MS_TO_NS(250)
+
+typedef enum FileWatchShutdown
+{
+    FILEWATCH_RUNNING,
+    FILEWATCH_SHUTDOWN,          // SDL_UnwatchDirectory is waiting for the thread.
+    FILEWATCH_SHUTDOWN_DETACHED  // SDL_UnwatchDirectory was called from the callback; the thread cleans up after itself.
+} FileWatchShutdown;
+
+typedef struct FileWatchChange
+{
+    SDL_FileWatchAction action;
+    char *path;
+    char *oldpath;
+    struct FileWatchChange *prev;
+    struct FileWatchChange *next;
+} FileWatchChange;
+
+typedef struct FileWatchPollEntry
+{
+    SDL_PathType type;
+    Uint64 size;
+    SDL_Time modify_time;
+    Uint32 generation;
+} FileWatchPollEntry;
+
+struct SDL_FileWatch
+{
+    char *path;  // the watched directory, with a trailing separator.
+    SDL_FileWatchFlags flags;
+    SDL_FileWatchCallback callback;
+    void *userdata;
+    SDL_Thread *thread;
+    SDL_AtomicInt shutdown;
+
+    // Everything below belongs to the watch thread (and SDL_WatchDirectory, before that thread starts).
+
+    // Changes waiting to be delivered: looked up by path to coalesce them, and linked in the order they happened.
+    SDL_HashTable *pending;
+    FileWatchChange *first_change;
+    FileWatchChange *last_change;
+    Uint64 first_change_ns;
+    Uint64 last_change_ns;
+
+#ifdef HAVE_INOTIFY
+    int inotify_fd;  // -1 if we're polling.
+    int wake_fds[2];
+    SDL_HashTable *directories;  // inotify watch descriptor -> that directory's relative path with a trailing '/', or "" for the root.
+    Uint32 move_cookie;  // an IN_MOVED_FROM still waiting for its IN_MOVED_TO.
+    char *move_from;
+    bool move_from_dir;
+#endif
+
+    // polling fallback.
+    SDL_Semaphore *wake;
+    SDL_HashTable *snapshot;  // relative path -> FileWatchPollEntry
+    Uint32 generation;
+    Uint64 next_poll_ns;
+};
+
+static bool FileWatchRecursive(const SDL_FileWatch *watch)
+{
+    return ((watch->flags & SDL_FILEWATCH_RECURSIVE) != 0);
+}
+
+// Gathers hash table keys during SDL_IterateHashTable, so they can be acted on once it's safe to change the table.
+typedef struct FileWatchKeyList
+{
+    const void **keys;
+    int count;
+    int capacity;
+    const char *prefix;
+    Uint32 generation;
+} FileWatchKeyList;
+
+static bool FileWatchAddKey(FileWatchKeyList *list, const void *key)
+{
+    if (list->count == list->capacity) {
+        const int capacity = list->capacity ? (list->capacity * 2) : 16;
+        const void **keys = (const void **) SDL_realloc((void *) list->keys, capacity * sizeof (*keys));
+        if (!keys) {
+            return false;
+        }
+        list->keys = keys;
+        list->capacity = capacity;
+    }
+    list->keys[list->count++] = key;
+    return true;
+}
+
+
+// Coalescing: each path has at most one pending change, which is the net effect of everything that happened to it since the last delivery.
+
+static FileWatchChange *FindChange(SDL_FileWatch *watch, const char *path)
+{
+    const void *change = NULL;
+    SDL_FindInHashTable(watch->pending, path, &change);
+    return (FileWatchChange *) change;
+}
+
+static void RemoveChange(SDL_FileWatch *watch, FileWatchChange *change)
+{
+    SDL_RemoveFromHashTable(watch->pending, change->path);
+
+    if (change->prev) {
+        change->prev->next = change->next;
+    } else {
+        watch->first_change = change->next;
+    }
+    if (change->next) {
+        change->next->prev = change->prev;
+    } else {
+        watch->last_change = change->prev;
+    }
+
+    SDL_free(change->path);
+    SDL_free(change->oldpath);
+    SDL_free(change);
+}
+
+static bool SetChangeOldPath(FileWatchChange *change, const char *oldpath)
+{
+    char *copy = NULL;
+    if (oldpath) {
+        copy = SDL_strdup(oldpath);
+        if (!copy) {
+            return false;
+        }
+    }
+    SDL_free(change->oldpath);
+    change->oldpath = copy;
+    return true;
+}
+
+static void AddChange(SDL_FileWatch *watch, SDL_FileWatchAction action, const char *path, const char *oldpath)
+{
+    // if we run out of memory, the change is dropped; there's nobody to report an error to on this thread.
+    FileWatchChange *change = (FileWatchChange *) SDL_calloc(1, sizeof (*change));
+    if (!change) {
+        return;
+    }
+    change->action = action;
+    change->path = SDL_strdup(path);
+    if (!change->path || !SetChangeOldPath(change, oldpath) || !SDL_InsertIntoHashTable(watch->pending, change->path, change, false)) {
+        SDL_free(change->path);
+        SDL_free(change->oldpath);
+        SDL_free(change);
+        return;
+    }
+
+    change->prev = watch->last_change;
+    if (watch->last_change) {
+        watch->last_change->next = change;
+    } else {
+        watch->first_change = change;
+    }
+    watch->last_change = change;
+}
+
+static void RecordChange(SDL_FileWatch *watch, SDL_FileWatchAction action, const char *path, const char *oldpath)
+{
+    const Uint64 now = SDL_GetTicksNS();
+    if (!watch->first_change) {
+        watch->first_change_ns = now;
+    }
+    watch->last_change_ns = now;
+
+    if (action == SDL_FILEWATCH_RENAMED) {
+        FileWatchChange *from = FindChange(watch, oldpath);
+        if (from) {
+            if (from->action == SDL_FILEWATCH_CREATED) {
+                // the old name never existed as far as the app knows (this is how most editors save), so this is something new at `path`.
+                RemoveChange(watch, from);
+                RecordChange(watch, SDL_FILEWATCH_CREATED, path, NULL);
+                return;
+            } else if (from->action == SDL_FILEWATCH_RENAMED) {
+                // a -> b, then b -> c, is a -> c.
+                char *original = from->oldpath;
+                from->oldpath = NULL;
+                RemoveChange(watch, from);
+                RecordChange(watch, (SDL_strcmp(original, path) == 0) ? SDL_FILEWATCH_MODIFIED : SDL_FILEWATCH_RENAMED, path, original);
+                SDL_free(original);
+                return;
+            }
+            RemoveChange(watch, from);  // the rename reported below covers it.
+        }
+    }
+
+    FileWatchChange *change = FindChange(watch, path);
+    if (!change) {
+        AddChange(watch, action, path, (action == SDL_FILEWATCH_RENAMED) ? oldpath : NULL);
+        return;
+    }
+
+    switch (change->action) {
+    case SDL_FILEWATCH_CREATED:
+        if (action == SDL_FILEWATCH_REMOVED) {
+            RemoveChange(watch, change);  // came and went before anyone saw it.
+        } else if (action == SDL_FILEWATCH_RENAMED) {
+            RecordChange(watch, SDL_FILEWATCH_REMOVED, oldpath, NULL);  // still new at `path`, but the old name is gone.
+        }
+        break;
+
+    case SDL_FILEWATCH_MODIFIED:
+        if (action == SDL_FILEWATCH_REMOVED) {
+            change->action = SDL_FILEWATCH_REMOVED;
+        } else if ((action == SDL_FILEWATCH_RENAMED) && SetChangeOldPath(change, oldpath)) {
+            change->action = SDL_FILEWATCH_RENAMED;
+        }
+        break;
+
+    case SDL_FILEWATCH_REMOVED:
+        if ((action == SDL_FILEWATCH_CREATED) || (action == SDL_FILEWATCH_MODIFIED)) {
+            change->action = SDL_FILEWATCH_MODIFIED;  // replaced.
+        } else if ((action == SDL_FILEWATCH_RENAMED) && SetChangeOldPath(change, oldpath)) {
+            change->action = SDL_FILEWATCH_RENAMED;
+        }
+        break;
+
+    case SDL_FILEWATCH_RENAMED:
+        if (action == SDL_FILEWATCH_REMOVED) {
+            // a -> b, then b is removed: as far as the app knows, a was removed.
+            char *original = change->oldpath;
+            change->oldpath = NULL;
+            RemoveChange(watch, change);
+            RecordChange(watch, SDL_FILEWATCH_REMOVED, original, NULL);
+            SDL_free(original);
+        } else if (action == SDL_FILEWATCH_RENAMED) {
+            // a -> c, then b -> c: a is gone, and c came from b.
+            char *original = change->oldpath;
+            change->oldpath = NULL;
+            if (!SetChangeOldPath(change, oldpath)) {
+                change->action = SDL_FILEWATCH_MODIFIED;
+            }
+            RecordChange(watch, SDL_FILEWATCH_REMOVED, original, NULL);
+            SDL_free(original);
+        }
+        break;
+    }
+}
+
+static void DeliverChanges(SDL_FileWatch *watch)
+{
+    while (watch->first_change && (SDL_GetAtomicInt(&watch->shutdown) == FILEWATCH_RUNNING)) {
+        FileWatchChange *change = watch->first_change;
+        watch->callback(watch->userdata, change->action, change->path, change->oldpath);
+        RemoveChange(watch, change);
+    }
+}
+
+
+// Polling fallback: keep the type, size and modification time of everything in the tree, and compare against a fresh look at it.
+
+typedef struct FileWatchScan
+{
+    SDL_FileWatch *watch;
+    const char *reldir;
+    bool report;
+} FileWatchScan;
+
+static bool POLL_ScanDirectory(SDL_FileWatch *watch, const char *reldir, bool report);
+
+static SDL_EnumerationResult SDLCALL POLL_ScanCallback(void *userdata, const char *dirname, const char *fname, SDL_PathType type)
+{
+    FileWatchScan *scan = (FileWatchScan *) userdata;
+    SDL_FileWatch *watch = scan->watch;
+
+    char *fullpath = NULL;
+    char *relpath = NULL;
+    if ((SDL_asprintf(&fullpath, "%s%s", dirname, fname) < 0) || (SDL_asprintf(&relpath, "%s%s", scan->reldir, fname) < 0)) {
+        SDL_free(fullpath);
+        return SDL_ENUM_FAILURE;
+    }
+
+    SDL_PathInfo info;
+    const bool exists = SDL_GetPathInfo(fullpath, &info);
+    SDL_free(fullpath);
+    if (!exists) {
+        SDL_free(relpath);
+        return SDL_ENUM_CONTINUE;  // removed while we were looking; the next scan will catch it if we knew about it.
+    }
+
+    const void *value = NULL;
+    FileWatchPollEntry *entry = NULL;
+    if (SDL_FindInHashTable(watch->snapshot, relpath, &value)) {
+        entry = (FileWatchPollEntry *) value;
+        if (scan->report && (info.type != SDL_PATHTYPE_DIRECTORY) &&
+            ((entry->type != info.type) || (entry->size != info.size) || (entry->modify_time != info.modify_time))) {
+            RecordChange(watch, SDL_FILEWATCH_MODIFIED, relpath, NULL);
+        }
+    } else {
+        entry = (FileWatchPollEntry *) SDL_calloc(1, sizeof (*entry));
+        if (!entry) {
+            SDL_free(relpath);
+            return SDL_ENUM_FAILURE;
+        }
+        if (scan->report) {
+            RecordChange(watch, SDL_FILEWATCH_CREATED, relpath, NULL);
+        }
+        char *key = SDL_strdup(relpath);
+        if (!key || !SDL_InsertIntoHashTable(watch->snapshot, key, entry, false)) {
+            SDL_free(key);
+            SDL_free(entry);
+            SDL_free(relpath);
+            return SDL_ENUM_FAILURE;
+        }
+    }
+
+    entry->type = info.type;
+    entry->size = info.size;
+    entry->modify_time = info.modify_time;
+    entry->generation = watch->generation;
+
+    bool result = true;
+    if ((info.type == SDL_PATHTYPE_DIRECTORY) && FileWatchRecursive(watch)) {
+        char *subdir = NULL;
+        if (SDL_asprintf(&subdir, "%s/", relpath) < 0) {
+            result = false;
+        } else {
+            result = POLL_ScanDirectory(watch, subdir, scan->report);
+            SDL_free(subdir);
+        }
+    }
+
+    SDL_free(relpath);
+    return result ? SDL_ENUM_CONTINUE : SDL_ENUM_FAILURE;
+}
+
+static bool POLL_ScanDirectory(SDL_FileWatch *watch, const char *reldir, bool report)
+{
+    char *fullpath = NULL;
+    if (SDL_asprintf(&fullpath, "%s%s", watch->path, reldir) < 0) {
+        return false;
+    }
+
+    FileWatchScan scan = { watch, reldir, report };
+    const bool result = SDL_SYS_EnumerateDirectory(fullpath, POLL_ScanCallback, &scan);
+    SDL_free(fullpath);
+    return result;
+}
+
+static bool SDLCALL POLL_CollectStale(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+{
+    FileWatchKeyList *list = (FileWatchKeyList *) userdata;
+    const FileWatchPollEntry *entry = (const FileWatchPollEntry *) value;
+    if (entry->generation != list->generation) {
+        return FileWatchAddKey(list, key);
+    }
+    return true;
+}
+
+static bool POLL_Scan(SDL_FileWatch *watch, bool report)
+{
+    watch->generation++;
+    if (!POLL_ScanDirectory(watch, "", report)) {
+        return false;  // don't report everything we didn't get to as removed.
+    }
+
+    FileWatchKeyList stale;
+    SDL_zero(stale);
+    stale.generation = watch->generation;
+    SDL_IterateHashTable(watch->snapshot, POLL_CollectStale, &stale);
+    for (int i = 0; i < stale.count; i++) {
+        RecordChange(watch, SDL_FILEWATCH_REMOVED, (const char *) stale.keys[i], NULL);
+        SDL_RemoveFromHashTable(watch->snapshot, stale.keys[i]);
+    }
+    SDL_free((void *) stale.keys);
+    return true;
+}
+
+static bool POLL_Init(SDL_FileWatch *watch)
+{
+    watch->wake = SDL_CreateSemaphore(0);
+    watch->snapshot = SDL_CreateHashTable(0, false, SDL_HashString, SDL_KeyMatchString, SDL_DestroyHashKeyAndValue, NULL);
+    if (!watch->wake || !watch->snapshot) {
+        return false;
+    }
+    if (!POLL_Scan(watch, false)) {
+        return false;
+    }
+    watch->next_poll_ns = SDL_GetTicksNS() + FILEWATCH_POLL_INTERVAL_NS;
+    return true;
+}
+
+static void POLL_Wait(SDL_FileWatch *watch, Sint64 timeoutNS)
+{
+    const Uint64 now = SDL_GetTicksNS();
+    if (now >= watch->next_poll_ns) {
+        POLL_Scan(watch, true);
+        watch->next_poll_ns = SDL_GetTicksNS() + FILEWATCH_POLL_INTERVAL_NS;
+        return;
+    }
+
+    Sint64 waitNS = (Sint64) (watch->next_poll_ns - now);
+    if ((timeoutNS >= 0) && (timeoutNS < waitNS)) {
+        waitNS = timeoutNS;
+    }
+    SDL_WaitSemaphoreTimeoutNS(watch->wake, waitNS);
+}
+
+
+#ifdef HAVE_INOTIFY
+
+#define INOTIFY_MASK (IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR)
+
+#ifdef HAVE_INOTIFY_INIT1
+static int SDL_inotify_init1(void)
+{
+    return inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+}
+#else
+static int SDL_inotify_init1(void)
+{
+    int fd = inotify_init();
+    if (fd < 0) {
+        return -1;
+    }
+    fcntl(fd, F_SETFL, O_NONBLOCK);
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+    return fd;
+}
+#endif
+
+static bool INOTIFY_AddDirectory(SDL_FileWatch *watch, const char *reldir, bool report);
+
+static SDL_EnumerationResult SDLCALL INOTIFY_AddDirectoryCallback(void *userdata, const char *dirname, const char *fname, SDL_PathType type)
+{
+    FileWatchScan *scan = (FileWatchScan *) userdata;
+    SDL_FileWatch *watch = scan->watch;
+
+    char *relpath = NULL;
+    if (SDL_asprintf(&relpath, "%s%s", scan->reldir, fname) < 0) {
+        return SDL_ENUM_FAILURE;
+    }
+
+    if (scan->report) {
+        // this directory just showed up, so nothing saw its contents arrive.
+        RecordChange(watch, SDL_FILEWATCH_CREATED, relpath, NULL);
+    }
+
+    if (type == SDL_PATHTYPE_NONE) {
+        char *fullpath = NULL;
+        SDL_PathInfo info;
+        if ((SDL_asprintf(&fullpath, "%s%s", dirname, fname) >= 0) && SDL_GetPathInfo(fullpath, &info)) {
+            type = info.type;
+        }
+        SDL_free(fullpath);
+    }
+
+    bool result = true;
+    if (type == SDL_PATHTYPE_DIRECTORY) {
+        char *subdir = NULL;
+        if (SDL_asprintf(&subdir, "%s/", relpath) < 0) {
+            result = false;
+        } else {
+            result = INOTIFY_AddDirectory(watch, subdir, scan->report);
+            SDL_free(subdir);
+        }
+    }
+
+    SDL_free(relpath);
+
+    // once we're running, a subdirectory we can't watch (it vanished, or we're out of watches) shouldn't stop the rest.
+    return (result || scan->report) ? SDL_ENUM_CONTINUE : SDL_ENUM_FAILURE;
+}
+
+static bool INOTIFY_AddDirectory(SDL_FileWatch *watch, const char *reldir, bool report)
+{
+    char *fullpath = NULL;
+    if (SDL_asprintf(&fullpath, "%s%s", watch->path, reldir) < 0) {
+        return false;
+    }
+
+    const int wd = inotify_add_watch(watch->inotify_fd, fullpath, INOTIFY_MASK);
+    if (wd < 0) {
+        SDL_SetError("Couldn't watch '%s': %s", fullpath, strerror(errno));
+        SDL_free(fullpath);
+        return false;
+    }
+
+    char *value = SDL_strdup(reldir);
+    if (!value || !SDL_InsertIntoHashTable(watch->directories, (const void *) (uintptr_t) wd, value, true)) {
+        SDL_free(value);
+        SDL_free(fullpath);
+        return false;
+    }
+
+    bool result = true;
+    if (FileWatchRecursive(watch)) {
+        FileWatchScan scan = { watch, reldir, report };
+        result = SDL_SYS_EnumerateDirectory(fullpath, INOTIFY_AddDirectoryCallback, &scan);
+    }
+
+    SDL_free(fullpath);
+    return result;
+}
+
+static bool SDLCALL INOTIFY_CollectPrefixed(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+{
+    FileWatchKeyList *list = (FileWatchKeyList *) userdata;
+    if (SDL_strncmp((const char *) value, list->prefix, SDL_strlen(list->prefix)) == 0) {
+        return FileWatchAddKey(list, key);
+    }
+    return true;
+}
+
+// A watched directory moved from `oldreldir` to `newreldir` (both with trailing '/'); NULL `newreldir` means it left the tree.
+static void INOTIFY_MoveDirectories(SDL_FileWatch *watch, const char *oldreldir, const char *newreldir)
+{
+    FileWatchKeyList list;
+    SDL_zero(list);
+    list.prefix = oldreldir;
+    SDL_IterateHashTable(watch->directories, INOTIFY_CollectPrefixed, &list);
+
+    const size_t oldlen = SDL_strlen(oldreldir);
+    for (int i = 0; i < list.count; i++) {
+        const void *key = list.keys[i];
+        if (!newreldir) {
+            inotify_rm_watch(watch->inotify_fd, (int) (uintptr_t) key);  // its IN_IGNORED will find nothing to remove.
+            SDL_RemoveFromHashTable(watch->directories, key);
+        } else {
+            const void *value = NULL;
+            char *moved = NULL;
+            if (SDL_FindInHashTable(watch->directories, key, &value) &&
+                (SDL_asprintf(&moved, "%s%s", newreldir, ((const char *) value) + oldlen) >= 0)) {
+                SDL_InsertIntoHashTable(watch->directories, key, moved, true);
+            }
+        }
+    }
+    SDL_free((void *) list.keys);
+}
+
+static void INOTIFY_FinishMove(SDL_FileWatch *watch, const char *newpath)
+{
+    char *oldpath = watch->move_from;
+    const bool isdir = watch->move_from_dir;
+    watch->move_from = NULL;
+
+    if (newpath) {
+        RecordChange(watch, SDL_FILEWATCH_RENAMED, newpath, oldpath);
+    } else {
+        RecordChange(watch, SDL_FILEWATCH_REMOVED, oldpath, NULL);  // moved somewhere we aren't watching.
+    }
+
+    if (isdir && FileWatchRecursive(watch)) {
+        char *oldreldir = NULL;
+        char *newreldir = NULL;
+        if ((SDL_asprintf(&oldreldir, "%s/", oldpath) >= 0) && (!newpath || (SDL_asprintf(&newreldir, "%s/", newpath) >= 0))) {
+            INOTIFY_MoveDirectories(watch, oldreldir, newreldir);
+        }
+        SDL_free(oldreldir);
+        SDL_free(newreldir);
+    }
+
+    SDL_free(oldpath);
+}
+
+static void INOTIFY_HandleEvent(SDL_FileWatch *watch, const struct inotify_event *event)
+{
+    if (event->mask & IN_Q_OVERFLOW) {
+        RecordChange(watch, SDL_FILEWATCH_MODIFIED, "", NULL);  // we lost track; tell the app anything might have changed.
+        return;
+    }
+
+    // a move with no partner left the tree. Finish it first, so its watches are gone before we look this event's directory up.
+    if (watch->move_from && (!(event->mask & IN_MOVED_TO) || (event->cookie != watch->move_cookie))) {
+        INOTIFY_FinishMove(watch, NULL);
+    }
+
+    const void *key = (const void *) (uintptr_t) event->wd;
+    if (event->mask & IN_IGNORED) {
+        SDL_RemoveFromHashTable(watch->directories, key);  // the directory is gone (or we stopped watching it).
+        return;
+    }
+
+    const void *value = NULL;
+    if (!SDL_FindInHashTable(watch->directories, key, &value) || (event->len == 0)) {
+        return;
+    }
+
+    char *relpath = NULL;
+    if (SDL_asprintf(&relpath, "%s%s", (const char *) value, event->name) < 0) {
+        return;
+    }
+
+    const bool isdir = ((event->mask & IN_ISDIR) != 0);
+
+    if (event->mask & IN_CREATE) {
+        RecordChange(watch, SDL_FILEWATCH_CREATED, relpath, NULL);
+    } else if (event->mask & IN_DELETE) {
+        RecordChange(watch, SDL_FILEWATCH_REMOVED, relpath, NULL);
+    } else if (event->mask & (IN_MODIFY | IN_ATTRIB)) {
+        if (!isdir) {
+            RecordChange(watch, SDL_FILEWATCH_MODIFIED, relpath, NULL);
+        }
+    } else if (event->mask & IN_MOVED_FROM) {
+        watch->move_cookie = event->cookie;
+        watch->move_from = relpath;
+        watch->move_from_dir = isdir;
+        relpath = NULL;
+    } else if (event->mask & IN_MOVED_TO) {
+        if (watch->move_from) {
+            INOTIFY_FinishMove(watch, relpath);
+        } else {
+            RecordChange(watch, SDL_FILEWATCH_CREATED, relpath, NULL);  // moved in from somewhere we aren't watching.
+            if (isdir && FileWatchRecursive(watch)) {
+                char *subdir = NULL;
+                if (SDL_asprintf(&subdir, "%s/", relpath) >= 0) {
+                    INOTIFY_AddDirectory(watch, subdir, true);
+                    SDL_free(subdir);
+                }
+            }
+        }
+    }
+
+    if (isdir && (event->mask & IN_CREATE) && FileWatchRecursive(watch)) {
+        char *subdir = NULL;
+        if (SDL_asprintf(&subdir, "%s/", relpath) >= 0) {
+            INOTIFY_AddDirectory(watch, subdir, true);
+            SDL_free(subdir);
+        }
+    }
+
+    SDL_free(relpath);
+}
+
+static void INOTIFY_Wait(SDL_FileWatch *watch, Sint64 timeoutNS)
+{
+    struct pollfd fds[2];
+    fds[0].fd = watch->inotify_fd;
+    fds[0].events = POLLIN;
+    fds[0].revents = 0;
+    fds[1].fd = watch->wake_fds[0];
+    fds[1].events = POLLIN;
+    fds[1].revents = 0;
+
+    const int timeoutMS = (timeoutNS < 0) ? -1 : (int) SDL_NS_TO_MS(timeoutNS + SDL_NS_PER_MS - 1);
+    if (poll(fds, SDL_arraysize(fds), timeoutMS) <= 0) {
+        return;
+    }
+
+    if (fds[1].revents) {
+        char drain[16];
+        while (read(watch->wake_fds[0], drain, sizeof (drain)) > 0) {
+        }
+    }
+
+    if (fds[0].revents) {
+        union
+        {
+            struct inotify_event event;
+            char storage[4096];
+            char enough_for_inotify[sizeof(struct inotify_event) + NAME_MAX + 1];
+        } buf;
+        ssize_t bytes;
+
+        while ((bytes = read(watch->inotify_fd, &buf, sizeof(buf))) > 0) {
+            size_t offset = 0;
+            while (offset < (size_t) bytes) {
+                const struct inotify_event *event = (const struct inotify_event *) &buf.storage[offset];
+                INOTIFY_HandleEvent(watch, event);
+                offset += sizeof(struct inotify_event) + event->len;
+            }
+        }
+
+        // the queue is drained, so a move with no partner by now left the tree.
+        if (watch->move_from) {
+            INOTIFY_FinishMove(watch, NULL);
+        }
+    }
+}
+
+static bool INOTIFY_Init(SDL_FileWatch *watch)
+{
+    watch->inotify_fd = SDL_inotify_init1();
+    if (watch->inotify_fd < 0) {
+        return SDL_SetError("Couldn't initialize inotify: %s", strerror(errno));
+    }
+
+    // SDL_UnwatchDirectory writes to this to interrupt the thread's poll().
+    if (pipe(watch->wake_fds) < 0) {
+        watch->wake_fds[0] = watch->wake_fds[1] = -1;
+        return SDL_SetError("Couldn't create pipe: %s", strerror(errno));
+    }
+    for (int i = 0; i < SDL_arraysize(watch->wake_fds); i++) {
+        fcntl(watch->wake_fds[i], F_SETFL, O_NONBLOCK);
+        fcntl(watch->wake_fds[i], F_SETFD, FD_CLOEXEC);
+    }
+
+    watch->directories = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, SDL_DestroyHashValue, NULL);
+    if (!watch->directories) {
+        return false;
+    }
+
+    return INOTIFY_AddDirectory(watch, "", false);
+}
+
+static void INOTIFY_Quit(SDL_FileWatch *watch)
+{
+    if (watch->inotify_fd >= 0) {
+        close(watch->inotify_fd);
+        watch->inotify_fd = -1;
+    }
+    if (watch->wake_fds[0] >= 0) {
+        close(watch->wake_fds[0]);
+        close(watch->wake_fds[1]);
+        watch->wake_fds[0] = watch->wake_fds[1] = -1;
+    }
+    SDL_DestroyHashTable(watch->directories);
+    watch->directories = NULL;
+    SDL_free(watch->move_from);
+    watch->move_from = NULL;
+}
+
+#endif // HAVE_INOTIFY
+
+
+static void DestroyFileWatch(SDL_FileWatch *watch)
+{
+#ifdef HAVE_INOTIFY
+    INOTIFY_Quit(watch);
+#endif
+    while (watch->first_change) {
+        RemoveChange(watch, watch->first_change);
+    }
+    SDL_DestroyHashTable(watch->pending);
+    SDL_DestroyHashTable(watch->snapshot);
+    SDL_DestroySemaphore(watch->wake);
+    SDL_free(watch->path);
+    SDL_free(watch);
+}
+
+static void WaitForChanges(SDL_FileWatch *watch, Sint64 timeoutNS)
+{
+#ifdef HAVE_INOTIFY
+    if (watch->inotify_fd >= 0) {
+        INOTIFY_Wait(watch, timeoutNS);
+        return;
+    }
+#endif
+    POLL_Wait(watch, timeoutNS);
+}
+
+static void WakeFileWatch(SDL_FileWatch *watch)
+{
+#ifdef HAVE_INOTIFY
+    if (watch->inotify_fd >= 0) {
+        const char wake = 0;
+        if (write(watch->wake_fds[1], &wake, sizeof (wake)) < 0) {
+            // the pipe is only full if a wakeup is already waiting.
+        }
+        return;
+    }
+#endif
+    SDL_SignalSemaphore(watch->wake);
+}
+
+static int SDLCALL FileWatchThread(void *data)
+{
+    SDL_FileWatch *watch = (SDL_FileWatch *) data;
+
+    while (SDL_GetAtomicInt(&watch->shutdown) == FILEWATCH_RUNNING) {
+        Sint64 timeoutNS = -1;  // nothing pending, so sleep until something happens.
+        if (watch->first_change) {
+            const Uint64 now = SDL_GetTicksNS();
+            const Uint64 deadline = SDL_min(watch->last_change_ns + FILEWATCH_QUIET_NS, watch->first_change_ns + FILEWATCH_MAX_DELAY_NS);
+            if (now >= deadline) {
+                DeliverChanges(watch);
+                continue;
+            }
+            timeoutNS = (Sint64) (deadline - now);
+        }
+        WaitForChanges(watch, timeoutNS);
+    }
+
+    if (SDL_GetAtomicInt(&watch->shutdown) == FILEWATCH_SHUTDOWN_DETACHED) {
+        DestroyFileWatch(watch);
+    }
+    return 0;
+}
+
+SDL_FileWatch *SDL_WatchDirectory(const char *path, SDL_FileWatchFlags flags, SDL_FileWatchCallback callback, void *userdata)
+{
+    SDL_PathInfo info;
+
+    if (!path) {
+        SDL_InvalidParamError("path");
+        return NULL;
+    } else if (!callback) {
+        SDL_InvalidParamError("callback");
+        return NULL;
+    } else if (!SDL_GetPathInfo(path, &info)) {
+        return NULL;
+    } else if (info.type != SDL_PATHTYPE_DIRECTORY) {
+        SDL_SetError("'%s' is not a directory", path);
+        return NULL;
+    }
+
+    SDL_FileWatch *watch = (SDL_FileWatch *) SDL_calloc(1, sizeof (*watch));
+    if (!watch) {
+        return NULL;
+    }
+    watch->flags = flags;
+    watch->callback = callback;
+    watch->userdata = userdata;
+#ifdef HAVE_INOTIFY
+    watch->inotify_fd = -1;
+    watch->wake_fds[0] = watch->wake_fds[1] = -1;
+#endif
+
+    const size_t pathlen = SDL_strlen(path);
+    const bool has_separator = (pathlen > 0) && ((path[pathlen - 1] == '/') || (path[pathlen - 1] == '\\'));
+    if (SDL_asprintf(&watch->path, "%s%s", path, has_separator ? "" : "/") < 0) {
+        SDL_free(watch);
+        return NULL;
+    }
+
+    watch->pending = SDL_CreateHashTable(0, false, SDL_HashString, SDL_KeyMatchString, NULL, NULL);
+    if (!watch->pending) {
+        DestroyFileWatch(watch);
+        return NULL;
+    }
+
+    // The initial look at the directory happens here rather than on the watch thread, so
+    // nothing that changes after we return is missed, and errors reach the caller.
+    bool ready = false;
+#ifdef HAVE_INOTIFY
+    ready = INOTIFY_Init(watch);
+    if (!ready) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM, "Can't watch '%s' with inotify, falling back to polling: %s", path, SDL_GetError());
+        INOTIFY_Quit(watch);
+    }
+#endif
+    if (!ready && !POLL_Init(watch)) {
+        DestroyFileWatch(watch);
+        return NULL;
+    }
+
+    SDL_SetAtomicInt(&watch->shutdown, FILEWATCH_RUNNING);
+    watch->thread = SDL_CreateThread(FileWatchThread, "SDLFileWatch", watch);
+    if (!watch->thread) {
+        DestroyFileWatch(watch);
+        return NULL;
+    }
+
+    return watch;
+}
+
+void SDL_UnwatchDirectory(SDL_FileWatch *watch)
+{
+    if (!watch) {
+        return;
+    }
+
+    if (SDL_GetCurrentThreadID() == SDL_GetThreadID(watch->thread)) {
+        // we're in the callback; the thread will stop delivering and clean up once it returns.
+        SDL_DetachThread(watch->thread);
+        SDL_SetAtomicInt(&watch->shutdown, FILEWATCH_SHUTDOWN_DETACHED);
+        return;
+    }
+
+    SDL_SetAtomicInt(&watch->shutdown, FILEWATCH_SHUTDOWN);
+    WakeFileWatch(watch);
+    SDL_WaitThread(watch->thread, NULL);
+    DestroyFileWatch(watch);
+}
@@ -28,16 +28,22 @@ extern char *SDL_SYS_GetPrefPath(const char *org, const char *app);
 extern char *SDL_SYS_GetUserFolder(SDL_Folder folder);
 extern char *SDL_SYS_GetCurrentDirectory(void);
 
-extern bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cb, void *userdata);
+// Like SDL_EnumerateDirectoryCallback, plus the entry's type when the platform learned it while listing the
+//  directory, or SDL_PATHTYPE_NONE if finding out would take a separate SDL_GetPathInfo() (symlinks, etc).
+typedef SDL_EnumerationResult (*SDL_EnumerateDirectoryTypedCallback)(void *userdata, const char *dirname, const char *fname, SDL_PathType type);
+
+extern bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryTypedCallback cb, void *userdata);
 extern bool SDL_SYS_RemovePath(const char *path);
 extern bool SDL_SYS_RenamePath(const char *oldpath, const char *newpath);
-extern bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath);
+extern bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath, SDL_CopyFileProgressCallback callback, void *userdata);
 extern bool SDL_SYS_CreateDirectory(const char *path);
 extern bool SDL_SYS_GetPathInfo(const char *path, SDL_PathInfo *info);
 
-typedef bool (*SDL_GlobEnumeratorFunc)(const char *path, SDL_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata);
+typedef bool (*SDL_GlobEnumeratorFunc)(const char *path, SDL_EnumerateDirectoryTypedCallback cb, void *cbuserdata, void *userdata);
 typedef bool (*SDL_GlobGetPathInfoFunc)(const char *path, SDL_PathInfo *info, void *userdata);
-extern char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count, SDL_GlobEnumeratorFunc enumerator, SDL_GlobGetPathInfoFunc getpathinfo, void *userdata);
+
+// `threaded` lets the walk use a pool of worker threads, so `enumerator` and `getpathinfo` must be safe to call concurrently.
+extern char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count, SDL_GlobEnumeratorFunc enumerator, SDL_GlobGetPathInfoFunc getpathinfo, void *userdata, bool threaded);
 
 #endif
 
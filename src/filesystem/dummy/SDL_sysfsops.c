@@ -28,7 +28,7 @@
 
 #include "../SDL_sysfilesystem.h"
 
-bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cb, void *userdata)
+bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryTypedCallback cb, void *userdata)
 {
     return SDL_Unsupported();
 }
@@ -43,7 +43,7 @@ bool SDL_SYS_RenamePath(const char *oldpath, const char *newpath)
     return SDL_Unsupported();
 }
 
-bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath)
+bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath, SDL_CopyFileProgressCallback callback, void *userdata)
 {
     return SDL_Unsupported();
 }
@@ -34,12 +34,57 @@
 #include <dirent.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <fcntl.h>
+
+#ifdef SDL_PLATFORM_LINUX
+#include <sys/ioctl.h>
+#include <linux/fs.h>  // FICLONE
+#endif
+#ifdef HAVE_SENDFILE
+#include <sys/sendfile.h>
+#endif
 
 #ifdef SDL_PLATFORM_ANDROID
 #include "../../core/android/SDL_android.h"
 #endif
 
-bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cb, void *userdata)
+#include "../../io/SDL_iostream_c.h"
+
+// readdir() already has the entry type in hand on most systems, which saves a stat() per entry when walking trees.
+static SDL_PathType PathTypeFromDirent(const struct dirent *ent)
+{
+#ifdef DT_DIR
+    switch (ent->d_type) {
+    case DT_DIR:
+        return SDL_PATHTYPE_DIRECTORY;
+    case DT_REG:
+        return SDL_PATHTYPE_FILE;
+    case DT_LNK:
+    case DT_UNKNOWN:
+        return SDL_PATHTYPE_NONE;  // stat() follows symlinks, and some filesystems don't fill this in.
+    default:
+        return SDL_PATHTYPE_OTHER;
+    }
+#else
+    return SDL_PATHTYPE_NONE;
+#endif
+}
+
+#ifdef SDL_PLATFORM_ANDROID
+typedef struct AndroidAssetEnumerateData
+{
+    SDL_EnumerateDirectoryTypedCallback cb;
+    void *userdata;
+} AndroidAssetEnumerateData;
+
+static SDL_EnumerationResult SDLCALL AndroidAssetEnumerateCallback(void *userdata, const char *dirname, const char *fname)
+{
+    AndroidAssetEnumerateData *data = (AndroidAssetEnumerateData *)userdata;
+    return data->cb(data->userdata, dirname, fname, SDL_PATHTYPE_NONE);
+}
+#endif
+
+bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryTypedCallback cb, void *userdata)
 {
     char *pathwithsep = NULL;
     int pathwithseplen = SDL_asprintf(&pathwithsep, "%s/", path);
@@ -56,7 +101,9 @@ bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback
     DIR *dir = opendir(pathwithsep);
     if (!dir) {
         #ifdef SDL_PLATFORM_ANDROID  // Maybe it's an asset...?
-        const bool retval = Android_JNI_EnumerateAssetDirectory(pathwithsep, cb, userdata);
+        AndroidAssetEnumerateData data = { cb, userdata };
+        const bool retval = Android_JNI_EnumerateAssetDirectory(pathwithsep, AndroidAssetEnumerateCallback, &data);
+
         SDL_free(pathwithsep);
         return retval;
         #else
@@ -76,7 +123,7 @@ bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback
         if ((SDL_strcmp(name, ".") == 0) || (SDL_strcmp(name, "..") == 0)) {
             continue;
         }
-        result = cb(userdata, pathwithsep, name);
+        result = cb(userdata, pathwithsep, name, PathTypeFromDirent(ent));
     }
 
     closedir(dir);
@@ -107,36 +154,207 @@ bool SDL_SYS_RenamePath(const char *oldpath, const char *newpath)
     return true;
 }
 
-bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath)
+#define COPYFILE_KERNEL_CHUNK_SIZE       (16 * 1024 * 1024)
+#define COPYFILE_BUFFER_SIZE             (256 * 1024)
+#define COPYFILE_PROGRESS_INTERVAL       (16 * 1024 * 1024)
+
+typedef struct CopyFileProgress
+{
+    SDL_CopyFileProgressCallback callback;
+    void *userdata;
+    Uint64 copied;
+    Uint64 total;
+    Uint64 reported;
+} CopyFileProgress;
+
+static bool ReportCopyProgress(CopyFileProgress *progress, bool finished)
+{
+    if (progress->copied > progress->total) {
+        progress->total = progress->copied;  // the file grew while we were copying it.
+    }
+    if (!progress->callback) {
+        return true;
+    } else if (!finished && ((progress->copied - progress->reported) < COPYFILE_PROGRESS_INTERVAL)) {
+        return true;
+    }
+    progress->reported = progress->copied;
+    if (!progress->callback(progress->userdata, progress->copied, progress->total)) {
+        return SDL_SetError("Copy canceled");
+    }
+    return true;
+}
+
+#if defined(HAVE_COPY_FILE_RANGE) || defined(HAVE_SENDFILE)
+// These errors mean this method can't handle this pair of files (or this kernel), not that the copy failed.
+static bool IsCopyMethodUnsupported(int err)
+{
+    return (err == ENOSYS) || (err == EXDEV) || (err == EINVAL) || (err == EOPNOTSUPP) || (err == EPERM);
+}
+#endif
+
+// Let the kernel move the data without it passing through userspace. All of these advance the file
+// offsets of both descriptors, so whatever one method doesn't get to is picked up by the next, and
+// finally by the read/write loop. Sets *finished if the whole file was cloned.
+static bool CopyFileInKernel(int infd, int outfd, CopyFileProgress *progress, bool *finished)
+{
+    *finished = false;
+
+#ifdef FICLONE
+    // A reflink shares the extents on copy-on-write filesystems (Btrfs, XFS, ...), no data moves at all.
+    if (ioctl(outfd, FICLONE, infd) == 0) {
+        progress->copied = progress->total;
+        *finished = true;
+        return true;
+    }
+#endif
+
+#ifdef HAVE_COPY_FILE_RANGE
+    for (;;) {
+        const ssize_t rc = copy_file_range(infd, NULL, outfd, NULL, COPYFILE_KERNEL_CHUNK_SIZE, 0);
+        if (rc < 0) {
+            if (errno == EINTR) {
+                continue;
+            } else if (IsCopyMethodUnsupported(errno)) {
+                break;
+            }
+            return SDL_SetError("Couldn't copy file: %s", strerror(errno));
+        } else if (rc == 0) {
+            break;  // EOF, or a filesystem (like procfs) that copy_file_range() can't see into.
+        }
+        progress->copied += (Uint64)rc;
+        if (!ReportCopyProgress(progress, false)) {
+            return false;
+        }
+    }
+#endif
+
+#ifdef HAVE_SENDFILE
+    for (;;) {
+        const ssize_t rc = sendfile(outfd, infd, NULL, COPYFILE_KERNEL_CHUNK_SIZE);
+        if (rc < 0) {
+            if (errno == EINTR) {
+                continue;
+            } else if (IsCopyMethodUnsupported(errno)) {
+                break;
+            }
+            return SDL_SetError("Couldn't copy file: %s", strerror(errno));
+        } else if (rc == 0) {
+            break;
+        }
+        progress->copied += (Uint64)rc;
+        if (!ReportCopyProgress(progress, false)) {
+            return false;
+        }
+    }
+#endif
+
+    return true;
+}
+
+bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath, SDL_CopyFileProgressCallback callback, void *userdata)
 {
     char *buffer = NULL;
     SDL_IOStream *input = NULL;
     SDL_IOStream *output = NULL;
-    const size_t maxlen = 4096;
+    CopyFileProgress progress;
+    int flags = O_RDONLY;
+    int infd, outfd;
+    bool finished = false;
     size_t len;
     bool result = false;
 
-    input = SDL_IOFromFile(oldpath, "rb");
-    if (!input) {
+    SDL_zero(progress);
+    progress.callback = callback;
+    progress.userdata = userdata;
+
+#ifdef O_CLOEXEC
+    flags |= O_CLOEXEC;
+#endif
+
+    infd = open(oldpath, flags);
+    if (infd >= 0) {
+        struct stat statbuf;
+        if (fstat(infd, &statbuf) < 0) {
+            SDL_SetError("Can't stat file: %s", strerror(errno));
+            close(infd);
+            goto done;
+        } else if (S_ISDIR(statbuf.st_mode)) {
+            SDL_SetError("%s is a directory", oldpath);
+            close(infd);
+            goto done;
+        }
+        progress.total = (Uint64)statbuf.st_size;
+
+        input = SDL_IOFromFD(infd, true);
+        if (!input) {
+            goto done;
+        }
+    } else {
+#ifdef SDL_PLATFORM_ANDROID
+        // Not a plain file, but it might be an asset or a content:// URI.
+        input = SDL_IOFromFile(oldpath, "rb");
+        if (!input) {
+            goto done;
+        }
+        const Sint64 size = SDL_GetIOSize(input);
+        progress.total = (size > 0) ? (Uint64)size : 0;
+#else
+        SDL_SetError("Couldn't open %s: %s", oldpath, strerror(errno));
         goto done;
+#endif
     }
 
-    output = SDL_IOFromFile(newpath, "wb");
-    if (!output) {
+    flags = O_WRONLY | O_CREAT | O_TRUNC;
+#ifdef O_CLOEXEC
+    flags |= O_CLOEXEC;
+#endif
+    outfd = open(newpath, flags, 0666);
+    if (outfd >= 0) {
+        output = SDL_IOFromFD(outfd, true);
+        if (!output) {
+            goto done;
+        }
+    } else {
+#ifdef SDL_PLATFORM_ANDROID
+        // Not a plain file, but it might be a content:// URI.
+        output = SDL_IOFromFile(newpath, "wb");
+        if (!output) {
+            goto done;
+        }
+#else
+        SDL_SetError("Couldn't open %s: %s", newpath, strerror(errno));
         goto done;
+#endif
     }
 
-    buffer = (char *)SDL_malloc(maxlen);
-    if (!buffer) {
-        goto done;
+    // Both streams are untouched so far, so the descriptors' offsets are still where the kernel left them.
+    if ((infd >= 0) && (outfd >= 0)) {
+        if (!CopyFileInKernel(infd, outfd, &progress, &finished)) {
+            goto done;
+        }
     }
 
-    while ((len = SDL_ReadIO(input, buffer, maxlen)) > 0) {
-        if (SDL_WriteIO(output, buffer, len) < len) {
+    if (!finished) {
+        buffer = (char *)SDL_malloc(COPYFILE_BUFFER_SIZE);
+        if (!buffer) {
+            goto done;
+        }
+
+        while ((len = SDL_ReadIO(input, buffer, COPYFILE_BUFFER_SIZE)) > 0) {
+            if (SDL_WriteIO(output, buffer, len) < len) {
+                goto done;
+            }
+            progress.copied += len;
+            if (!ReportCopyProgress(&progress, false)) {
+                goto done;
+            }
+        }
+        if (SDL_GetIOStatus(input) != SDL_IO_STATUS_EOF) {
             goto done;
         }
     }
-    if (SDL_GetIOStatus(input) != SDL_IO_STATUS_EOF) {
+
+    if (!ReportCopyProgress(&progress, true)) {
         goto done;
     }
 
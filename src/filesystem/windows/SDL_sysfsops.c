@@ -33,7 +33,7 @@
 #define COPY_FILE_NO_BUFFERING 0x00001000
 #endif
 
-bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cb, void *userdata)
+bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryTypedCallback cb, void *userdata)
 {
     SDL_EnumerationResult result = SDL_ENUM_CONTINUE;
     if (*path == '\0') {  // if empty (completely at the root), we need to enumerate drive letters.
@@ -42,7 +42,7 @@ bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback
         for (int i = 'A'; (result == SDL_ENUM_CONTINUE) && (i <= 'Z'); i++) {
             if (drives & (1 << (i - 'A'))) {
                 name[0] = (char) i;
-                result = cb(userdata, "", name);
+                result = cb(userdata, "", name, SDL_PATHTYPE_DIRECTORY);
             }
         }
     } else {
@@ -89,11 +89,23 @@ bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback
                 }
             }
 
+            // a reparse point (symlink, junction) reports its own attributes, not its target's, so leave those to SDL_GetPathInfo.
+            SDL_PathType type;
+            if (entw.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) {
+                type = SDL_PATHTYPE_NONE;
+            } else if (entw.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+                type = SDL_PATHTYPE_DIRECTORY;
+            } else if (entw.dwFileAttributes & (FILE_ATTRIBUTE_OFFLINE | FILE_ATTRIBUTE_DEVICE)) {
+                type = SDL_PATHTYPE_OTHER;
+            } else {
+                type = SDL_PATHTYPE_FILE;
+            }
+
             char *utf8fn = WIN_StringToUTF8W(fn);
             if (!utf8fn) {
                 result = SDL_ENUM_FAILURE;
             } else {
-                result = cb(userdata, pattern, utf8fn);
+                result = cb(userdata, pattern, utf8fn, type);
                 SDL_free(utf8fn);
             }
         } while ((result == SDL_ENUM_CONTINUE) && (FindNextFileW(dir, &entw) != 0));
@@ -153,8 +165,30 @@ bool SDL_SYS_RenamePath(const char *oldpath, const char *newpath)
     return true;
 }
 
-bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath)
+typedef struct CopyFileProgressData
 {
+    SDL_CopyFileProgressCallback callback;
+    void *userdata;
+    bool canceled;
+} CopyFileProgressData;
+
+static DWORD CALLBACK CopyFileProgressRoutine(LARGE_INTEGER TotalFileSize, LARGE_INTEGER TotalBytesTransferred, LARGE_INTEGER StreamSize, LARGE_INTEGER StreamBytesTransferred, DWORD dwStreamNumber, DWORD dwCallbackReason, HANDLE hSourceFile, HANDLE hDestinationFile, LPVOID lpData)
+{
+    CopyFileProgressData *data = (CopyFileProgressData *)lpData;
+    if (!data->callback(data->userdata, (Uint64)TotalBytesTransferred.QuadPart, (Uint64)TotalFileSize.QuadPart)) {
+        data->canceled = true;
+        return PROGRESS_CANCEL;
+    }
+    return PROGRESS_CONTINUE;
+}
+
+bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath, SDL_CopyFileProgressCallback callback, void *userdata)
+{
+    CopyFileProgressData progress;
+    progress.callback = callback;
+    progress.userdata = userdata;
+    progress.canceled = false;
+
     WCHAR *woldpath = WIN_UTF8ToStringW(oldpath);
     if (!woldpath) {
         return false;
@@ -166,10 +200,13 @@ bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath)
         return false;
     }
 
-    const BOOL rc = CopyFileExW(woldpath, wnewpath, NULL, NULL, NULL, COPY_FILE_ALLOW_DECRYPTED_DESTINATION|COPY_FILE_NO_BUFFERING);
+    const BOOL rc = CopyFileExW(woldpath, wnewpath, callback ? CopyFileProgressRoutine : NULL, &progress, NULL, COPY_FILE_ALLOW_DECRYPTED_DESTINATION|COPY_FILE_NO_BUFFERING);
     SDL_free(wnewpath);
     SDL_free(woldpath);
     if (!rc) {
+        if (progress.canceled) {
+            return SDL_SetError("Copy canceled");
+        }
         return WIN_SetError("Couldn't copy path");
     }
     return true;
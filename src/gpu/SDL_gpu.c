@@ -517,6 +517,452 @@ void SDL_GPU_BlitCommon(
     SDL_EndGPURenderPass(render_pass);
 }
 
+// Compute blits, used when the destination has storage write usage
+//
+// The kernels come from the driver, see Vulkan_ComputeBlit.glsl. The blit
+// kernels take one sampler, one read-write storage texture and one uniform
+// buffer. The mip chain kernels take one sampler, one read-write storage
+// texture per written level, the scratch buffer and one uniform buffer.
+
+#define MIP_CHAIN_MAX_LEVELS   8  // one read-write storage texture per level
+#define MIP_CHAIN_GROUP_LEVELS 6  // levels every workgroup reduces its 64x64 tile to
+#define MIP_CHAIN_TAIL_GROUPS  16 // the last workgroup reduces at most 16x16 level 6 texels
+#define MIP_CHAIN_SCRATCH_SIZE (16 + MIP_CHAIN_TAIL_GROUPS * MIP_CHAIN_TAIL_GROUPS * 16)
+
+typedef struct BlitComputeUniforms
+{
+    // texcoord space
+    float src_left;
+    float src_top;
+    float src_width;
+    float src_height;
+
+    // array layer, or texcoord depth offset and scale for 3D sources
+    float src_layer_or_depth;
+    float src_depth;
+    float src_mip_level;
+    float padding;
+
+    // texel space
+    Uint32 dst_x;
+    Uint32 dst_y;
+    Uint32 dst_w;
+    Uint32 dst_h;
+    Uint32 dst_z;
+    Uint32 dst_d;
+    Uint32 padding2[2];
+} BlitComputeUniforms;
+
+typedef struct MipChainComputeUniforms
+{
+    // level 0 size
+    Uint32 width;
+    Uint32 height;
+
+    Uint32 src_level;
+    Uint32 level_count;
+    Uint32 layer;
+    Uint32 padding[3];
+} MipChainComputeUniforms;
+
+static int SDL_GPU_ComputeBlitKernel(SDL_GPUTextureType source_type, SDL_GPUTextureType destination_type)
+{
+    switch (source_type) {
+    case SDL_GPU_TEXTURETYPE_2D:
+    case SDL_GPU_TEXTURETYPE_2D_ARRAY:
+        if (destination_type != SDL_GPU_TEXTURETYPE_2D && destination_type != SDL_GPU_TEXTURETYPE_2D_ARRAY) {
+            return -1;
+        }
+        return (source_type == SDL_GPU_TEXTURETYPE_2D) ? COMPUTE_BLIT_2D : COMPUTE_BLIT_2D_ARRAY;
+    case SDL_GPU_TEXTURETYPE_3D:
+        return (destination_type == SDL_GPU_TEXTURETYPE_3D) ? COMPUTE_BLIT_3D : -1;
+    default:
+        return -1;
+    }
+}
+
+static bool SDL_GPU_CanComputeBlit(
+    SDL_GPUDevice *device,
+    const TextureCommonHeader *src_header,
+    const TextureCommonHeader *dst_header)
+{
+    if (device->compute_blit_shaders == NULL) {
+        return false;
+    }
+    // Anything that can be a color target keeps using the render pass path
+    if (dst_header->info.usage & SDL_GPU_TEXTUREUSAGE_COLOR_TARGET) {
+        return false;
+    }
+    if (!(dst_header->info.usage & (SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE | SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_SIMULTANEOUS_READ_WRITE))) {
+        return false;
+    }
+    if (!(src_header->info.usage & SDL_GPU_TEXTUREUSAGE_SAMPLER)) {
+        return false;
+    }
+    if (SDL_GPU_ComputeBlitKernel(src_header->info.type, dst_header->info.type) < 0) {
+        return false;
+    }
+    return !IsIntegerFormat(dst_header->info.format);
+}
+
+// Called with compute_blit_lock held
+static bool SDL_GPU_CreateMipChainResources(SDL_GPUDevice *device)
+{
+    SDL_GPUBufferCreateInfo bufferinfo;
+    SDL_GPUTransferBufferCreateInfo transferinfo;
+    SDL_GPUTextureCreateInfo textureinfo;
+    void *zero;
+
+    if (device->compute_blit_scratch == NULL) {
+        SDL_zero(bufferinfo);
+        bufferinfo.usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE;
+        bufferinfo.size = MIP_CHAIN_SCRATCH_SIZE;
+        device->compute_blit_scratch = SDL_CreateGPUBuffer(device, &bufferinfo);
+        if (device->compute_blit_scratch == NULL) {
+            return false;
+        }
+    }
+
+    // Uploaded over the scratch counter before every mip chain
+    if (device->compute_blit_zero == NULL) {
+        SDL_zero(transferinfo);
+        transferinfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+        transferinfo.size = sizeof(Uint32);
+        device->compute_blit_zero = SDL_CreateGPUTransferBuffer(device, &transferinfo);
+        if (device->compute_blit_zero == NULL) {
+            return false;
+        }
+        zero = SDL_MapGPUTransferBuffer(device, device->compute_blit_zero, false);
+        if (zero == NULL) {
+            SDL_ReleaseGPUTransferBuffer(device, device->compute_blit_zero);
+            device->compute_blit_zero = NULL;
+            return false;
+        }
+        SDL_memset(zero, 0, sizeof(Uint32));
+        SDL_UnmapGPUTransferBuffer(device, device->compute_blit_zero);
+    }
+
+    // Every layer fills one level binding that a short mip chain doesn't write
+    if (device->compute_blit_spare == NULL) {
+        SDL_zero(textureinfo);
+        textureinfo.type = SDL_GPU_TEXTURETYPE_2D_ARRAY;
+        textureinfo.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+        textureinfo.usage = SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE;
+        textureinfo.width = 1;
+        textureinfo.height = 1;
+        textureinfo.layer_count_or_depth = MIP_CHAIN_MAX_LEVELS - 1;
+        textureinfo.num_levels = 1;
+        device->compute_blit_spare = SDL_CreateGPUTexture(device, &textureinfo);
+        if (device->compute_blit_spare == NULL) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static SDL_GPUComputePipeline *SDL_GPU_FetchComputeBlitPipeline(
+    SDL_GPUDevice *device,
+    ComputeBlitKernel kernel)
+{
+    const ComputeBlitShaders *shaders = device->compute_blit_shaders;
+    bool mip_chain = (kernel == COMPUTE_BLIT_MIP_CHAIN_2D || kernel == COMPUTE_BLIT_MIP_CHAIN_2D_ARRAY);
+    SDL_GPUComputePipeline *pipeline;
+    SDL_GPUComputePipelineCreateInfo createinfo;
+
+    SDL_LockMutex(device->compute_blit_lock);
+
+    pipeline = device->compute_blit_pipelines[kernel];
+    if (pipeline != NULL) {
+        SDL_UnlockMutex(device->compute_blit_lock);
+        return pipeline;
+    }
+
+    for (int i = 0; i < 2 && device->compute_blit_samplers[i] == NULL; i += 1) {
+        SDL_GPUSamplerCreateInfo samplerinfo;
+        SDL_zero(samplerinfo);
+        samplerinfo.min_filter = samplerinfo.mag_filter = (i == 0) ? SDL_GPU_FILTER_NEAREST : SDL_GPU_FILTER_LINEAR;
+        samplerinfo.mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST;
+        samplerinfo.address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+        samplerinfo.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+        samplerinfo.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+        samplerinfo.max_lod = 1000;
+        device->compute_blit_samplers[i] = SDL_CreateGPUSampler(device, &samplerinfo);
+    }
+    if (device->compute_blit_samplers[0] == NULL || device->compute_blit_samplers[1] == NULL) {
+        SDL_UnlockMutex(device->compute_blit_lock);
+        return NULL;
+    }
+
+    if (mip_chain && !SDL_GPU_CreateMipChainResources(device)) {
+        SDL_UnlockMutex(device->compute_blit_lock);
+        return NULL;
+    }
+
+    SDL_zero(createinfo);
+    createinfo.code = shaders->code[kernel];
+    createinfo.code_size = shaders->code_size[kernel];
+    createinfo.entrypoint = "main";
+    createinfo.format = shaders->format;
+    createinfo.num_samplers = 1;
+    createinfo.num_uniform_buffers = 1;
+    if (mip_chain) {
+        createinfo.num_readwrite_storage_textures = MIP_CHAIN_MAX_LEVELS;
+        createinfo.num_readwrite_storage_buffers = 1;
+        createinfo.threadcount_x = 16;
+        createinfo.threadcount_y = 16;
+    } else {
+        createinfo.num_readwrite_storage_textures = 1;
+        createinfo.threadcount_x = 8;
+        createinfo.threadcount_y = 8;
+    }
+    createinfo.threadcount_z = 1;
+
+    pipeline = SDL_CreateGPUComputePipeline(device, &createinfo);
+    if (pipeline == NULL) {
+        SDL_UnlockMutex(device->compute_blit_lock);
+        SDL_SetError("Failed to create GPU pipeline for compute blit");
+        return NULL;
+    }
+
+    device->compute_blit_pipelines[kernel] = pipeline;
+    SDL_UnlockMutex(device->compute_blit_lock);
+    return pipeline;
+}
+
+// volume_depth is 0 for blits between single layers or depth planes, mipmap
+// generation passes the destination level's depth to blit whole 3D levels
+static bool SDL_GPU_ComputeBlit(
+    SDL_GPUCommandBuffer *command_buffer,
+    const SDL_GPUBlitInfo *info,
+    Uint32 volume_depth)
+{
+    SDL_GPUDevice *device = ((CommandBufferCommonHeader *)command_buffer)->device;
+    TextureCommonHeader *src_header = (TextureCommonHeader *)info->source.texture;
+    TextureCommonHeader *dst_header = (TextureCommonHeader *)info->destination.texture;
+    int kernel = SDL_GPU_ComputeBlitKernel(src_header->info.type, dst_header->info.type);
+    SDL_GPUComputePipeline *pipeline;
+    SDL_GPUComputePass *compute_pass;
+    SDL_GPUStorageTextureReadWriteBinding storage_binding;
+    SDL_GPUTextureSamplerBinding texture_sampler_binding;
+    BlitComputeUniforms uniforms;
+    Uint32 src_width = SDL_max(src_header->info.width >> info->source.mip_level, 1);
+    Uint32 src_height = SDL_max(src_header->info.height >> info->source.mip_level, 1);
+
+    pipeline = SDL_GPU_FetchComputeBlitPipeline(device, (ComputeBlitKernel)kernel);
+    if (pipeline == NULL) {
+        return false;
+    }
+
+    SDL_zero(storage_binding);
+    storage_binding.texture = info->destination.texture;
+    storage_binding.mip_level = info->destination.mip_level;
+    storage_binding.layer = (dst_header->info.type == SDL_GPU_TEXTURETYPE_3D) ? 0 : info->destination.layer_or_depth_plane;
+    storage_binding.cycle = info->cycle;
+
+    compute_pass = SDL_BeginGPUComputePass(command_buffer, &storage_binding, 1, NULL, 0);
+    if (compute_pass == NULL) {
+        return false;
+    }
+
+    SDL_BindGPUComputePipeline(compute_pass, pipeline);
+
+    texture_sampler_binding.texture = info->source.texture;
+    texture_sampler_binding.sampler =
+        device->compute_blit_samplers[info->filter == SDL_GPU_FILTER_NEAREST ? 0 : 1];
+    SDL_BindGPUComputeSamplers(compute_pass, 0, &texture_sampler_binding, 1);
+
+    SDL_zero(uniforms);
+    uniforms.src_left = (float)info->source.x / src_width;
+    uniforms.src_top = (float)info->source.y / src_height;
+    uniforms.src_width = (float)info->source.w / src_width;
+    uniforms.src_height = (float)info->source.h / src_height;
+    uniforms.src_mip_level = (float)info->source.mip_level;
+
+    if (src_header->info.type == SDL_GPU_TEXTURETYPE_3D) {
+        Uint32 src_depth = SDL_max(src_header->info.layer_count_or_depth >> info->source.mip_level, 1);
+        if (volume_depth > 0) {
+            uniforms.src_layer_or_depth = 0.0f;
+            uniforms.src_depth = 1.0f;
+        } else {
+            uniforms.src_layer_or_depth = (float)info->source.layer_or_depth_plane / src_depth;
+            uniforms.src_depth = 1.0f / src_depth;
+        }
+        uniforms.dst_z = (volume_depth > 0) ? 0 : info->destination.layer_or_depth_plane;
+    } else {
+        uniforms.src_layer_or_depth = (float)info->source.layer_or_depth_plane;
+    }
+
+    if (info->flip_mode & SDL_FLIP_HORIZONTAL) {
+        uniforms.src_left += uniforms.src_width;
+        uniforms.src_width *= -1;
+    }
+
+    if (info->flip_mode & SDL_FLIP_VERTICAL) {
+        uniforms.src_top += uniforms.src_height;
+        uniforms.src_height *= -1;
+    }
+
+    uniforms.dst_x = info->destination.x;
+    uniforms.dst_y = info->destination.y;
+    uniforms.dst_w = info->destination.w;
+    uniforms.dst_h = info->destination.h;
+    uniforms.dst_d = SDL_max(volume_depth, 1);
+
+    SDL_PushGPUComputeUniformData(command_buffer, 0, &uniforms, sizeof(uniforms));
+
+    SDL_DispatchGPUCompute(
+        compute_pass,
+        (info->destination.w + 7) / 8,
+        (info->destination.h + 7) / 8,
+        SDL_max(volume_depth, 1));
+
+    SDL_EndGPUComputePass(compute_pass);
+    return true;
+}
+
+// Storage views of a 3D texture cover every depth plane of one level, so
+// those get one blit per level that writes the whole level at once
+static bool SDL_GPU_ComputeGenerateMipmaps3D(
+    SDL_GPUCommandBuffer *command_buffer,
+    SDL_GPUTexture *texture)
+{
+    TextureCommonHeader *header = (TextureCommonHeader *)texture;
+
+    for (Uint32 level = 1; level < header->info.num_levels; level += 1) {
+        SDL_GPUBlitInfo info;
+        SDL_zero(info);
+
+        info.source.texture = texture;
+        info.source.mip_level = level - 1;
+        info.source.w = SDL_max(header->info.width >> (level - 1), 1);
+        info.source.h = SDL_max(header->info.height >> (level - 1), 1);
+
+        info.destination.texture = texture;
+        info.destination.mip_level = level;
+        info.destination.w = SDL_max(header->info.width >> level, 1);
+        info.destination.h = SDL_max(header->info.height >> level, 1);
+
+        info.load_op = SDL_GPU_LOADOP_DONT_CARE;
+        info.filter = SDL_GPU_FILTER_LINEAR;
+
+        if (!SDL_GPU_ComputeBlit(
+                command_buffer,
+                &info,
+                SDL_max(header->info.layer_count_or_depth >> level, 1))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Writes up to MIP_CHAIN_MAX_LEVELS levels of a layer per dispatch, so most
+// textures need a single dispatch per layer. Levels that the last workgroup
+// would have to reduce from more than 16x16 texels start the next dispatch.
+static bool SDL_GPU_ComputeGenerateMipmaps(
+    SDL_GPUCommandBuffer *command_buffer,
+    SDL_GPUTexture *texture)
+{
+    SDL_GPUDevice *device = ((CommandBufferCommonHeader *)command_buffer)->device;
+    TextureCommonHeader *header = (TextureCommonHeader *)texture;
+    bool is_array = (header->info.type == SDL_GPU_TEXTURETYPE_2D_ARRAY);
+    SDL_GPUComputePipeline *pipeline;
+    SDL_GPUCopyPass *copy_pass;
+    SDL_GPUComputePass *compute_pass;
+    SDL_GPUTransferBufferLocation zero_location;
+    SDL_GPUBufferRegion counter_region;
+    SDL_GPUStorageTextureReadWriteBinding texture_bindings[MIP_CHAIN_MAX_LEVELS];
+    SDL_GPUStorageBufferReadWriteBinding scratch_binding;
+    SDL_GPUTextureSamplerBinding texture_sampler_binding;
+    MipChainComputeUniforms uniforms;
+
+    if (header->info.type == SDL_GPU_TEXTURETYPE_3D) {
+        return SDL_GPU_ComputeGenerateMipmaps3D(command_buffer, texture);
+    }
+
+    pipeline = SDL_GPU_FetchComputeBlitPipeline(
+        device,
+        is_array ? COMPUTE_BLIT_MIP_CHAIN_2D_ARRAY : COMPUTE_BLIT_MIP_CHAIN_2D);
+    if (pipeline == NULL) {
+        return false;
+    }
+
+    // The last workgroup of a dispatch is the one that finds the counter at
+    // the workgroup count, it resets the counter for the next dispatch
+    copy_pass = SDL_BeginGPUCopyPass(command_buffer);
+    if (copy_pass == NULL) {
+        return false;
+    }
+    zero_location.transfer_buffer = device->compute_blit_zero;
+    zero_location.offset = 0;
+    counter_region.buffer = device->compute_blit_scratch;
+    counter_region.offset = 0;
+    counter_region.size = sizeof(Uint32);
+    SDL_UploadToGPUBuffer(copy_pass, &zero_location, &counter_region, false);
+    SDL_EndGPUCopyPass(copy_pass);
+
+    SDL_zero(scratch_binding);
+    scratch_binding.buffer = device->compute_blit_scratch;
+
+    texture_sampler_binding.texture = texture;
+    texture_sampler_binding.sampler = device->compute_blit_samplers[0];
+
+    for (Uint32 layer = 0; layer < (is_array ? header->info.layer_count_or_depth : 1); layer += 1) {
+        Uint32 src_level = 0;
+
+        while (src_level + 1 < header->info.num_levels) {
+            Uint32 width = SDL_max(header->info.width >> src_level, 1);
+            Uint32 height = SDL_max(header->info.height >> src_level, 1);
+            Uint32 groups_x = (width + 63) / 64;
+            Uint32 groups_y = (height + 63) / 64;
+            Uint32 level_count = SDL_min(header->info.num_levels - 1 - src_level, MIP_CHAIN_MAX_LEVELS);
+
+            if (groups_x > MIP_CHAIN_TAIL_GROUPS || groups_y > MIP_CHAIN_TAIL_GROUPS) {
+                level_count = SDL_min(level_count, MIP_CHAIN_GROUP_LEVELS);
+            }
+
+            SDL_zeroa(texture_bindings);
+            for (Uint32 i = 0; i < MIP_CHAIN_MAX_LEVELS; i += 1) {
+                if (i < level_count) {
+                    texture_bindings[i].texture = texture;
+                    texture_bindings[i].mip_level = src_level + 1 + i;
+                    texture_bindings[i].layer = layer;
+                } else {
+                    texture_bindings[i].texture = device->compute_blit_spare;
+                    texture_bindings[i].layer = i - 1;
+                }
+            }
+
+            compute_pass = SDL_BeginGPUComputePass(
+                command_buffer,
+                texture_bindings,
+                MIP_CHAIN_MAX_LEVELS,
+                &scratch_binding,
+                1);
+            if (compute_pass == NULL) {
+                return false;
+            }
+
+            SDL_BindGPUComputePipeline(compute_pass, pipeline);
+            SDL_BindGPUComputeSamplers(compute_pass, 0, &texture_sampler_binding, 1);
+
+            SDL_zero(uniforms);
+            uniforms.width = header->info.width;
+            uniforms.height = header->info.height;
+            uniforms.src_level = src_level;
+            uniforms.level_count = level_count;
+            uniforms.layer = layer;
+            SDL_PushGPUComputeUniformData(command_buffer, 0, &uniforms, sizeof(uniforms));
+
+            SDL_DispatchGPUCompute(compute_pass, groups_x, groups_y, 1);
+            SDL_EndGPUComputePass(compute_pass);
+
+            src_level += level_count;
+        }
+    }
+    return true;
+}
+
 static void SDL_GPU_CheckGraphicsBindings(SDL_GPURenderPass *render_pass)
 {
     RenderPass *rp = (RenderPass *)render_pass;
@@ -593,7 +1039,10 @@ static const SDL_GPUBootstrap * SDL_GPUSelectBackend(SDL_PropertiesID props)
     const char *gpudriver;
     SDL_VideoDevice *_this = SDL_GetVideoDevice();
 
-    if (_this == NULL) {
+    // Headless devices never touch a window, so backends get a NULL video device
+    if (SDL_GetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_HEADLESS_BOOLEAN, false)) {
+        _this = NULL;
+    } else if (_this == NULL) {
         SDL_SetError("Video subsystem not initialized");
         return NULL;
     }
@@ -719,6 +1168,30 @@ SDL_GPUDevice *SDL_CreateGPUDeviceWithProperties(SDL_PropertiesID props)
         if (result != NULL) {
             result->backend = selectedBackend->name;
             result->debug_mode = debug_mode;
+            result->headless = SDL_GetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_HEADLESS_BOOLEAN, false);
+            result->upload_lock = SDL_CreateMutex();
+            result->upload_chunks = NULL;
+            result->upload_chunk_count = 0;
+            result->upload_chunk_capacity = 0;
+            result->compute_blit_lock = SDL_CreateMutex();
+            SDL_zeroa(result->compute_blit_samplers);
+            SDL_zeroa(result->compute_blit_pipelines);
+            result->compute_blit_scratch = NULL;
+            result->compute_blit_zero = NULL;
+            result->compute_blit_spare = NULL;
+            result->readbacks = NULL;
+            result->pipeline_job_lock = SDL_CreateMutex();
+            result->pipeline_job_queued = SDL_CreateCondition();
+            result->pipeline_job_finished = SDL_CreateCondition();
+            result->pipeline_job_head = NULL;
+            result->pipeline_job_tail = NULL;
+            result->pipeline_workers = NULL;
+            result->pipeline_worker_count = 0;
+            result->pipeline_worker_limit = (int)SDL_GetNumberProperty(props, SDL_PROP_GPU_DEVICE_CREATE_PIPELINE_THREADS_NUMBER, 0);
+            if (result->pipeline_worker_limit <= 0) {
+                result->pipeline_worker_limit = SDL_clamp(SDL_GetNumLogicalCPUCores() - 1, 1, 4);
+            }
+            result->pipeline_workers_quit = false;
         }
     }
     return result;
@@ -728,10 +1201,75 @@ SDL_GPUDevice *SDL_CreateGPUDeviceWithProperties(SDL_PropertiesID props)
 #endif // SDL_GPU_DISABLED
 }
 
+// Defined with the pipeline jobs below
+static void SDL_GPU_FreePipelineJob(SDL_GPUPipelineJob *job);
+static void SDL_GPU_ReleasePipelineJobResult(SDL_GPUPipelineJob *job);
+
 void SDL_DestroyGPUDevice(SDL_GPUDevice *device)
 {
     CHECK_DEVICE_MAGIC(device, );
 
+    // Workers drain the queue before they exit
+    SDL_LockMutex(device->pipeline_job_lock);
+    device->pipeline_workers_quit = true;
+    SDL_BroadcastCondition(device->pipeline_job_queued);
+    SDL_UnlockMutex(device->pipeline_job_lock);
+    for (int i = 0; i < device->pipeline_worker_count; i += 1) {
+        SDL_WaitThread(device->pipeline_workers[i], NULL);
+    }
+    // Pipelines the app never collected would otherwise outlive the device
+    while (device->pipeline_jobs_live != NULL) {
+        SDL_GPUPipelineJob *job = device->pipeline_jobs_live;
+        SDL_GPU_ReleasePipelineJobResult(job);
+        SDL_GPU_FreePipelineJob(job);
+    }
+    SDL_free(device->pipeline_workers);
+    SDL_DestroyCondition(device->pipeline_job_queued);
+    SDL_DestroyCondition(device->pipeline_job_finished);
+    SDL_DestroyMutex(device->pipeline_job_lock);
+
+    // Releasing is deferred by the backend until the GPU is done with the chunks
+    for (Uint32 i = 0; i < device->upload_chunk_count; i += 1) {
+        UploadChunk *chunk = &device->upload_chunks[i];
+        if (chunk->fence != NULL) {
+            SDL_GPUFence *fence = chunk->fence;
+            for (Uint32 j = i; j < device->upload_chunk_count; j += 1) {
+                if (device->upload_chunks[j].fence == fence) {
+                    device->upload_chunks[j].fence = NULL;
+                }
+            }
+            device->ReleaseFence(device->driverData, fence);
+        }
+        device->ReleaseTransferBuffer(device->driverData, chunk->transfer_buffer);
+    }
+    SDL_free(device->upload_chunks);
+
+    while (device->readbacks != NULL) {
+        SDL_ReleaseGPUTextureReadback(device, device->readbacks);
+    }
+    SDL_DestroyMutex(device->upload_lock);
+
+    for (int i = 0; i < SDL_arraysize(device->compute_blit_pipelines); i += 1) {
+        if (device->compute_blit_pipelines[i] != NULL) {
+            device->ReleaseComputePipeline(device->driverData, device->compute_blit_pipelines[i]);
+        }
+    }
+    for (int i = 0; i < SDL_arraysize(device->compute_blit_samplers); i += 1) {
+        if (device->compute_blit_samplers[i] != NULL) {
+            device->ReleaseSampler(device->driverData, device->compute_blit_samplers[i]);
+        }
+    }
+    if (device->compute_blit_scratch != NULL) {
+        device->ReleaseBuffer(device->driverData, device->compute_blit_scratch);
+    }
+    if (device->compute_blit_zero != NULL) {
+        device->ReleaseTransferBuffer(device->driverData, device->compute_blit_zero);
+    }
+    if (device->compute_blit_spare != NULL) {
+        device->ReleaseTexture(device->driverData, device->compute_blit_spare);
+    }
+    SDL_DestroyMutex(device->compute_blit_lock);
+
     device->DestroyDevice(device);
 }
 
@@ -1113,62 +1651,452 @@ SDL_GPUGraphicsPipeline *SDL_CreateGPUGraphicsPipeline(
         graphicsPipelineCreateInfo);
 }
 
-SDL_GPUSampler *SDL_CreateGPUSampler(
+// Pipeline Jobs
+
+static void SDL_GPU_FreePipelineJob(
+    SDL_GPUPipelineJob *job)
+{
+    SDL_GPUDevice *device = job->device;
+
+    // Jobs are linked once queued, unlinking needs the job lock
+    if (job->live_prev != NULL) {
+        job->live_prev->live_next = job->live_next;
+    } else if (device->pipeline_jobs_live == job) {
+        device->pipeline_jobs_live = job->live_next;
+    }
+    if (job->live_next != NULL) {
+        job->live_next->live_prev = job->live_prev;
+    }
+
+    if (job->compute) {
+        SDL_free((void *)job->compute_info.code);
+        SDL_free((void *)job->compute_info.entrypoint);
+        if (job->compute_info.props) {
+            SDL_DestroyProperties(job->compute_info.props);
+        }
+    } else {
+        SDL_free((void *)job->graphics_info.vertex_input_state.vertex_buffer_descriptions);
+        SDL_free((void *)job->graphics_info.vertex_input_state.vertex_attributes);
+        SDL_free((void *)job->graphics_info.target_info.color_target_descriptions);
+        if (job->graphics_info.props) {
+            SDL_DestroyProperties(job->graphics_info.props);
+        }
+    }
+    SDL_free(job->error);
+    SDL_free(job);
+}
+
+static void SDL_GPU_ReleasePipelineJobResult(
+    SDL_GPUPipelineJob *job)
+{
+    SDL_GPUDevice *device = job->device;
+
+    if (job->pipeline == NULL) {
+        return;
+    }
+    if (job->compute) {
+        device->ReleaseComputePipeline(device->driverData, (SDL_GPUComputePipeline *)job->pipeline);
+    } else {
+        device->ReleaseGraphicsPipeline(device->driverData, (SDL_GPUGraphicsPipeline *)job->pipeline);
+    }
+    job->pipeline = NULL;
+}
+
+static int SDLCALL SDL_GPU_PipelineWorker(void *data)
+{
+    SDL_GPUDevice *device = (SDL_GPUDevice *)data;
+
+    SDL_LockMutex(device->pipeline_job_lock);
+    for (;;) {
+        SDL_GPUPipelineJob *job;
+
+        while (device->pipeline_job_head == NULL && !device->pipeline_workers_quit) {
+            SDL_WaitCondition(device->pipeline_job_queued, device->pipeline_job_lock);
+        }
+        job = device->pipeline_job_head;
+        if (job == NULL) {
+            break;
+        }
+        device->pipeline_job_head = job->next;
+        if (device->pipeline_job_head == NULL) {
+            device->pipeline_job_tail = NULL;
+        }
+        SDL_UnlockMutex(device->pipeline_job_lock);
+
+        // The regular entry points validate and report errors on this thread
+        if (job->compute) {
+            job->pipeline = SDL_CreateGPUComputePipeline(device, &job->compute_info);
+        } else {
+            job->pipeline = SDL_CreateGPUGraphicsPipeline(device, &job->graphics_info);
+        }
+        if (job->pipeline == NULL) {
+            job->error = SDL_strdup(SDL_GetError());
+        }
+
+        SDL_LockMutex(device->pipeline_job_lock);
+        job->done = true;
+        if (job->released) {
+            SDL_GPU_ReleasePipelineJobResult(job);
+            SDL_GPU_FreePipelineJob(job);
+        }
+        SDL_BroadcastCondition(device->pipeline_job_finished);
+    }
+    SDL_UnlockMutex(device->pipeline_job_lock);
+
+    return 0;
+}
+
+static SDL_GPUPipelineJob *SDL_GPU_QueuePipelineJob(
     SDL_GPUDevice *device,
-    const SDL_GPUSamplerCreateInfo *createinfo)
+    SDL_GPUPipelineJob *job)
 {
-    CHECK_DEVICE_MAGIC(device, NULL);
-    if (createinfo == NULL) {
-        SDL_InvalidParamError("createinfo");
-        return NULL;
+    SDL_LockMutex(device->pipeline_job_lock);
+
+    if (device->pipeline_worker_count == 0) {
+        device->pipeline_workers = (SDL_Thread **)SDL_calloc(device->pipeline_worker_limit, sizeof(SDL_Thread *));
+        if (device->pipeline_workers != NULL) {
+            for (int i = 0; i < device->pipeline_worker_limit; i += 1) {
+                SDL_Thread *thread = SDL_CreateThread(SDL_GPU_PipelineWorker, "SDLGPUPipeline", device);
+                if (thread == NULL) {
+                    break;
+                }
+                device->pipeline_workers[device->pipeline_worker_count++] = thread;
+            }
+        }
+        if (device->pipeline_worker_count == 0) {
+            SDL_UnlockMutex(device->pipeline_job_lock);
+            SDL_GPU_FreePipelineJob(job);
+            return NULL;
+        }
     }
 
-    return device->CreateSampler(
-        device->driverData,
-        createinfo);
+    if (device->pipeline_job_tail != NULL) {
+        device->pipeline_job_tail->next = job;
+    } else {
+        device->pipeline_job_head = job;
+    }
+    device->pipeline_job_tail = job;
+    job->live_next = device->pipeline_jobs_live;
+    if (device->pipeline_jobs_live != NULL) {
+        device->pipeline_jobs_live->live_prev = job;
+    }
+    device->pipeline_jobs_live = job;
+    SDL_SignalCondition(device->pipeline_job_queued);
+
+    SDL_UnlockMutex(device->pipeline_job_lock);
+
+    return job;
 }
 
-SDL_GPUShader *SDL_CreateGPUShader(
+static bool SDL_GPU_CopyPipelineArray(
+    const void **array,
+    Uint32 count,
+    size_t element_size)
+{
+    void *copy;
+
+    if (count == 0 || *array == NULL) {
+        *array = NULL;
+        return true;
+    }
+    copy = SDL_malloc(count * element_size);
+    if (copy == NULL) {
+        *array = NULL;
+        return false;
+    }
+    SDL_memcpy(copy, *array, count * element_size);
+    *array = copy;
+    return true;
+}
+
+static SDL_PropertiesID SDL_GPU_CopyPipelineProperties(
+    SDL_PropertiesID props)
+{
+    SDL_PropertiesID copy;
+
+    if (props == 0) {
+        return 0;
+    }
+    copy = SDL_CreateProperties();
+    if (copy != 0) {
+        SDL_CopyProperties(props, copy);
+    }
+    return copy;
+}
+
+SDL_GPUPipelineJob *SDL_CreateGPUGraphicsPipelineAsync(
     SDL_GPUDevice *device,
-    const SDL_GPUShaderCreateInfo *createinfo)
+    const SDL_GPUGraphicsPipelineCreateInfo *createinfo)
 {
+    SDL_GPUPipelineJob *job;
+    bool copied;
+
     CHECK_DEVICE_MAGIC(device, NULL);
     if (createinfo == NULL) {
         SDL_InvalidParamError("createinfo");
         return NULL;
     }
 
-    if (device->debug_mode) {
-        if (createinfo->format == SDL_GPU_SHADERFORMAT_INVALID) {
-            SDL_assert_release(!"Shader format cannot be INVALID!");
-            return NULL;
-        }
-        if (!(createinfo->format & device->shader_formats)) {
-            SDL_assert_release(!"Incompatible shader format for GPU backend");
-            return NULL;
-        }
+    job = (SDL_GPUPipelineJob *)SDL_calloc(1, sizeof(SDL_GPUPipelineJob));
+    if (job == NULL) {
+        return NULL;
+    }
+    job->device = device;
+    job->compute = false;
+    job->graphics_info = *createinfo;
+
+    copied = SDL_GPU_CopyPipelineArray(
+        (const void **)&job->graphics_info.vertex_input_state.vertex_buffer_descriptions,
+        createinfo->vertex_input_state.num_vertex_buffers,
+        sizeof(SDL_GPUVertexBufferDescription));
+    copied &= SDL_GPU_CopyPipelineArray(
+        (const void **)&job->graphics_info.vertex_input_state.vertex_attributes,
+        createinfo->vertex_input_state.num_vertex_attributes,
+        sizeof(SDL_GPUVertexAttribute));
+    copied &= SDL_GPU_CopyPipelineArray(
+        (const void **)&job->graphics_info.target_info.color_target_descriptions,
+        createinfo->target_info.num_color_targets,
+        sizeof(SDL_GPUColorTargetDescription));
+    job->graphics_info.props = SDL_GPU_CopyPipelineProperties(createinfo->props);
+    if (!copied || (createinfo->props != 0 && job->graphics_info.props == 0)) {
+        SDL_GPU_FreePipelineJob(job);
+        return NULL;
     }
 
-    return device->CreateShader(
-        device->driverData,
-        createinfo);
+    return SDL_GPU_QueuePipelineJob(device, job);
 }
 
-SDL_GPUTexture *SDL_CreateGPUTexture(
+SDL_GPUPipelineJob *SDL_CreateGPUComputePipelineAsync(
     SDL_GPUDevice *device,
-    const SDL_GPUTextureCreateInfo *createinfo)
+    const SDL_GPUComputePipelineCreateInfo *createinfo)
 {
+    SDL_GPUPipelineJob *job;
+    bool copied;
+
     CHECK_DEVICE_MAGIC(device, NULL);
     if (createinfo == NULL) {
         SDL_InvalidParamError("createinfo");
         return NULL;
     }
 
-    if (device->debug_mode) {
-        bool failed = false;
-
-        const Uint32 MAX_2D_DIMENSION = 16384;
-        const Uint32 MAX_3D_DIMENSION = 2048;
+    job = (SDL_GPUPipelineJob *)SDL_calloc(1, sizeof(SDL_GPUPipelineJob));
+    if (job == NULL) {
+        return NULL;
+    }
+    job->device = device;
+    job->compute = true;
+    job->compute_info = *createinfo;
+
+    copied = SDL_GPU_CopyPipelineArray(
+        (const void **)&job->compute_info.code,
+        (Uint32)createinfo->code_size,
+        1);
+    job->compute_info.entrypoint = createinfo->entrypoint ? SDL_strdup(createinfo->entrypoint) : NULL;
+    job->compute_info.props = SDL_GPU_CopyPipelineProperties(createinfo->props);
+    if (!copied ||
+        (createinfo->entrypoint != NULL && job->compute_info.entrypoint == NULL) ||
+        (createinfo->props != 0 && job->compute_info.props == 0)) {
+        SDL_GPU_FreePipelineJob(job);
+        return NULL;
+    }
+
+    return SDL_GPU_QueuePipelineJob(device, job);
+}
+
+bool SDL_QueryGPUPipelineJob(
+    SDL_GPUDevice *device,
+    SDL_GPUPipelineJob *job)
+{
+    bool result;
+
+    CHECK_DEVICE_MAGIC(device, false);
+    if (job == NULL) {
+        return SDL_InvalidParamError("job");
+    }
+
+    SDL_LockMutex(device->pipeline_job_lock);
+    result = job->done;
+    SDL_UnlockMutex(device->pipeline_job_lock);
+
+    return result;
+}
+
+static void *SDL_GPU_WaitForPipelineJob(
+    SDL_GPUDevice *device,
+    SDL_GPUPipelineJob *job,
+    bool compute)
+{
+    void *result;
+
+    if (job->compute != compute) {
+        SDL_SetError("Pipeline job is not a %s pipeline job", compute ? "compute" : "graphics");
+        return NULL;
+    }
+
+    SDL_LockMutex(device->pipeline_job_lock);
+    while (!job->done) {
+        SDL_WaitCondition(device->pipeline_job_finished, device->pipeline_job_lock);
+    }
+    result = job->pipeline;
+    if (result == NULL) {
+        SDL_SetError("%s", job->error ? job->error : "Pipeline creation failed");
+    }
+    SDL_GPU_FreePipelineJob(job);
+    SDL_UnlockMutex(device->pipeline_job_lock);
+
+    return result;
+}
+
+SDL_GPUGraphicsPipeline *SDL_WaitForGPUGraphicsPipeline(
+    SDL_GPUDevice *device,
+    SDL_GPUPipelineJob *job)
+{
+    CHECK_DEVICE_MAGIC(device, NULL);
+    if (job == NULL) {
+        SDL_InvalidParamError("job");
+        return NULL;
+    }
+
+    return (SDL_GPUGraphicsPipeline *)SDL_GPU_WaitForPipelineJob(device, job, false);
+}
+
+SDL_GPUComputePipeline *SDL_WaitForGPUComputePipeline(
+    SDL_GPUDevice *device,
+    SDL_GPUPipelineJob *job)
+{
+    CHECK_DEVICE_MAGIC(device, NULL);
+    if (job == NULL) {
+        SDL_InvalidParamError("job");
+        return NULL;
+    }
+
+    return (SDL_GPUComputePipeline *)SDL_GPU_WaitForPipelineJob(device, job, true);
+}
+
+void SDL_ReleaseGPUPipelineJob(
+    SDL_GPUDevice *device,
+    SDL_GPUPipelineJob *job)
+{
+    SDL_GPUPipelineJob *prev = NULL;
+
+    CHECK_DEVICE_MAGIC(device, );
+    if (job == NULL) {
+        return;
+    }
+
+    SDL_LockMutex(device->pipeline_job_lock);
+
+    // Jobs that haven't started yet are simply dropped from the queue
+    for (SDL_GPUPipelineJob *queued = device->pipeline_job_head; queued != NULL; prev = queued, queued = queued->next) {
+        if (queued == job) {
+            if (prev != NULL) {
+                prev->next = job->next;
+            } else {
+                device->pipeline_job_head = job->next;
+            }
+            if (device->pipeline_job_tail == job) {
+                device->pipeline_job_tail = prev;
+            }
+            job->done = true;
+            break;
+        }
+    }
+
+    if (job->done) {
+        SDL_GPU_ReleasePipelineJobResult(job);
+        SDL_GPU_FreePipelineJob(job);
+    } else {
+        job->released = true;
+    }
+
+    SDL_UnlockMutex(device->pipeline_job_lock);
+}
+
+bool SDL_PrepareGPURenderPass(
+    SDL_GPUDevice *device,
+    const SDL_GPUColorTargetInfo *color_target_infos,
+    Uint32 num_color_targets,
+    const SDL_GPUDepthStencilTargetInfo *depth_stencil_target_info)
+{
+    CHECK_DEVICE_MAGIC(device, false);
+    if (color_target_infos == NULL && num_color_targets > 0) {
+        return SDL_InvalidParamError("color_target_infos");
+    }
+    if (num_color_targets > MAX_COLOR_TARGET_BINDINGS) {
+        return SDL_SetError("num_color_targets exceeds MAX_COLOR_TARGET_BINDINGS");
+    }
+    for (Uint32 i = 0; i < num_color_targets; i += 1) {
+        if (color_target_infos[i].texture == NULL) {
+            return SDL_SetError("Color target texture %" SDL_PRIu32 " is NULL", i);
+        }
+    }
+    if (depth_stencil_target_info != NULL && depth_stencil_target_info->texture == NULL) {
+        return SDL_SetError("Depth stencil target texture is NULL");
+    }
+
+    return device->PrepareRenderPass(
+        device->driverData,
+        color_target_infos,
+        num_color_targets,
+        depth_stencil_target_info);
+}
+
+SDL_GPUSampler *SDL_CreateGPUSampler(
+    SDL_GPUDevice *device,
+    const SDL_GPUSamplerCreateInfo *createinfo)
+{
+    CHECK_DEVICE_MAGIC(device, NULL);
+    if (createinfo == NULL) {
+        SDL_InvalidParamError("createinfo");
+        return NULL;
+    }
+
+    return device->CreateSampler(
+        device->driverData,
+        createinfo);
+}
+
+SDL_GPUShader *SDL_CreateGPUShader(
+    SDL_GPUDevice *device,
+    const SDL_GPUShaderCreateInfo *createinfo)
+{
+    CHECK_DEVICE_MAGIC(device, NULL);
+    if (createinfo == NULL) {
+        SDL_InvalidParamError("createinfo");
+        return NULL;
+    }
+
+    if (device->debug_mode) {
+        if (createinfo->format == SDL_GPU_SHADERFORMAT_INVALID) {
+            SDL_assert_release(!"Shader format cannot be INVALID!");
+            return NULL;
+        }
+        if (!(createinfo->format & device->shader_formats)) {
+            SDL_assert_release(!"Incompatible shader format for GPU backend");
+            return NULL;
+        }
+    }
+
+    return device->CreateShader(
+        device->driverData,
+        createinfo);
+}
+
+SDL_GPUTexture *SDL_CreateGPUTexture(
+    SDL_GPUDevice *device,
+    const SDL_GPUTextureCreateInfo *createinfo)
+{
+    CHECK_DEVICE_MAGIC(device, NULL);
+    if (createinfo == NULL) {
+        SDL_InvalidParamError("createinfo");
+        return NULL;
+    }
+
+    if (device->debug_mode) {
+        bool failed = false;
+
+        const Uint32 MAX_2D_DIMENSION = 16384;
+        const Uint32 MAX_3D_DIMENSION = 2048;
 
         // Common checks for all texture types
         CHECK_TEXTUREFORMAT_ENUM_INVALID(createinfo->format, NULL)
@@ -1334,6 +2262,76 @@ SDL_GPUTransferBuffer *SDL_CreateGPUTransferBuffer(
         debugName);
 }
 
+// Bindless Resources
+
+bool SDL_RegisterGPUBindlessTexture(
+    SDL_GPUDevice *device,
+    SDL_GPUTexture *texture,
+    SDL_GPUSampler *sampler,
+    Uint32 *index)
+{
+    CHECK_DEVICE_MAGIC(device, false);
+    if (texture == NULL) {
+        return SDL_InvalidParamError("texture");
+    }
+    if (sampler == NULL) {
+        return SDL_InvalidParamError("sampler");
+    }
+    if (index == NULL) {
+        return SDL_InvalidParamError("index");
+    }
+    if (!(((TextureCommonHeader *)texture)->info.usage & SDL_GPU_TEXTUREUSAGE_SAMPLER)) {
+        return SDL_SetError("Bindless textures must have the SAMPLER usage flag");
+    }
+
+    return device->RegisterBindlessTexture(
+        device->driverData,
+        texture,
+        sampler,
+        index);
+}
+
+bool SDL_RegisterGPUBindlessBuffer(
+    SDL_GPUDevice *device,
+    SDL_GPUBuffer *buffer,
+    Uint32 *index)
+{
+    CHECK_DEVICE_MAGIC(device, false);
+    if (buffer == NULL) {
+        return SDL_InvalidParamError("buffer");
+    }
+    if (index == NULL) {
+        return SDL_InvalidParamError("index");
+    }
+
+    return device->RegisterBindlessBuffer(
+        device->driverData,
+        buffer,
+        index);
+}
+
+void SDL_UnregisterGPUBindlessTexture(
+    SDL_GPUDevice *device,
+    Uint32 index)
+{
+    CHECK_DEVICE_MAGIC(device, );
+
+    device->UnregisterBindlessTexture(
+        device->driverData,
+        index);
+}
+
+void SDL_UnregisterGPUBindlessBuffer(
+    SDL_GPUDevice *device,
+    Uint32 index)
+{
+    CHECK_DEVICE_MAGIC(device, );
+
+    device->UnregisterBindlessBuffer(
+        device->driverData,
+        index);
+}
+
 // Debug Naming
 
 void SDL_SetGPUBufferName(
@@ -1558,6 +2556,9 @@ SDL_GPUCommandBuffer *SDL_AcquireGPUCommandBuffer(
     commandBufferHeader->render_pass.command_buffer = command_buffer;
     commandBufferHeader->compute_pass.command_buffer = command_buffer;
     commandBufferHeader->copy_pass.command_buffer = command_buffer;
+    commandBufferHeader->timestamps_enabled = false;
+    commandBufferHeader->upload_memory_used = false;
+    commandBufferHeader->readback_used = false;
 
     if (device->debug_mode) {
         commandBufferHeader->render_pass.in_progress = false;
@@ -1771,14 +2772,21 @@ SDL_GPURenderPass *SDL_BeginGPURenderPass(
         }
     }
 
+    commandBufferHeader = (CommandBufferCommonHeader *)command_buffer;
+
+    if (commandBufferHeader->timestamps_enabled) {
+        COMMAND_BUFFER_DEVICE->WriteTimestamp(
+            command_buffer,
+            SDL_GPU_PASSTYPE_RENDER,
+            false);
+    }
+
     COMMAND_BUFFER_DEVICE->BeginRenderPass(
         command_buffer,
         color_target_infos,
         num_color_targets,
         depth_stencil_target_info);
 
-    commandBufferHeader = (CommandBufferCommonHeader *)command_buffer;
-
     if (COMMAND_BUFFER_DEVICE->debug_mode) {
         commandBufferHeader->render_pass.in_progress = true;
         for (Uint32 i = 0; i < num_color_targets; i += 1) {
@@ -2249,6 +3257,94 @@ void SDL_DrawGPUIndexedPrimitivesIndirect(
         draw_count);
 }
 
+void SDL_DrawGPUPrimitivesIndirectCount(
+    SDL_GPURenderPass *render_pass,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *count_buffer,
+    Uint32 count_offset,
+    Uint32 max_draw_count)
+{
+    if (render_pass == NULL) {
+        SDL_InvalidParamError("render_pass");
+        return;
+    }
+    if (buffer == NULL) {
+        SDL_InvalidParamError("buffer");
+        return;
+    }
+    if (count_buffer == NULL) {
+        SDL_InvalidParamError("count_buffer");
+        return;
+    }
+    if (!RENDERPASS_DEVICE->indirect_draw_count) {
+        SDL_SetError("This device can't read draw counts from a buffer");
+        return;
+    }
+
+    if (RENDERPASS_DEVICE->debug_mode) {
+        CHECK_RENDERPASS
+        CHECK_GRAPHICS_PIPELINE_BOUND
+        SDL_GPU_CheckGraphicsBindings(render_pass);
+        if (count_offset % 4 != 0) {
+            SDL_assert_release(!"Draw count offset must be a multiple of 4!");
+            return;
+        }
+    }
+
+    RENDERPASS_DEVICE->DrawPrimitivesIndirectCount(
+        RENDERPASS_COMMAND_BUFFER,
+        buffer,
+        offset,
+        count_buffer,
+        count_offset,
+        max_draw_count);
+}
+
+void SDL_DrawGPUIndexedPrimitivesIndirectCount(
+    SDL_GPURenderPass *render_pass,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *count_buffer,
+    Uint32 count_offset,
+    Uint32 max_draw_count)
+{
+    if (render_pass == NULL) {
+        SDL_InvalidParamError("render_pass");
+        return;
+    }
+    if (buffer == NULL) {
+        SDL_InvalidParamError("buffer");
+        return;
+    }
+    if (count_buffer == NULL) {
+        SDL_InvalidParamError("count_buffer");
+        return;
+    }
+    if (!RENDERPASS_DEVICE->indirect_draw_count) {
+        SDL_SetError("This device can't read draw counts from a buffer");
+        return;
+    }
+
+    if (RENDERPASS_DEVICE->debug_mode) {
+        CHECK_RENDERPASS
+        CHECK_GRAPHICS_PIPELINE_BOUND
+        SDL_GPU_CheckGraphicsBindings(render_pass);
+        if (count_offset % 4 != 0) {
+            SDL_assert_release(!"Draw count offset must be a multiple of 4!");
+            return;
+        }
+    }
+
+    RENDERPASS_DEVICE->DrawIndexedPrimitivesIndirectCount(
+        RENDERPASS_COMMAND_BUFFER,
+        buffer,
+        offset,
+        count_buffer,
+        count_offset,
+        max_draw_count);
+}
+
 void SDL_EndGPURenderPass(
     SDL_GPURenderPass *render_pass)
 {
@@ -2267,6 +3363,13 @@ void SDL_EndGPURenderPass(
     RENDERPASS_DEVICE->EndRenderPass(
         RENDERPASS_COMMAND_BUFFER);
 
+    if (commandBufferCommonHeader->timestamps_enabled) {
+        RENDERPASS_DEVICE->WriteTimestamp(
+            RENDERPASS_COMMAND_BUFFER,
+            SDL_GPU_PASSTYPE_RENDER,
+            true);
+    }
+
     if (RENDERPASS_DEVICE->debug_mode) {
         commandBufferCommonHeader->render_pass.in_progress = false;
         for (Uint32 i = 0; i < MAX_COLOR_TARGET_BINDINGS; i += 1)
@@ -2341,6 +3444,15 @@ SDL_GPUComputePass *SDL_BeginGPUComputePass(
         // TODO: validate buffer usage?
     }
 
+    commandBufferHeader = (CommandBufferCommonHeader *)command_buffer;
+
+    if (commandBufferHeader->timestamps_enabled) {
+        COMMAND_BUFFER_DEVICE->WriteTimestamp(
+            command_buffer,
+            SDL_GPU_PASSTYPE_COMPUTE,
+            false);
+    }
+
     COMMAND_BUFFER_DEVICE->BeginComputePass(
         command_buffer,
         storage_texture_bindings,
@@ -2348,8 +3460,6 @@ SDL_GPUComputePass *SDL_BeginGPUComputePass(
         storage_buffer_bindings,
         num_storage_buffer_bindings);
 
-    commandBufferHeader = (CommandBufferCommonHeader *)command_buffer;
-
     if (COMMAND_BUFFER_DEVICE->debug_mode) {
         commandBufferHeader->compute_pass.in_progress = true;
 
@@ -2545,8 +3655,16 @@ void SDL_EndGPUComputePass(
     COMPUTEPASS_DEVICE->EndComputePass(
         COMPUTEPASS_COMMAND_BUFFER);
 
+    commandBufferCommonHeader = (CommandBufferCommonHeader *)COMPUTEPASS_COMMAND_BUFFER;
+
+    if (commandBufferCommonHeader->timestamps_enabled) {
+        COMPUTEPASS_DEVICE->WriteTimestamp(
+            COMPUTEPASS_COMMAND_BUFFER,
+            SDL_GPU_PASSTYPE_COMPUTE,
+            true);
+    }
+
     if (COMPUTEPASS_DEVICE->debug_mode) {
-        commandBufferCommonHeader = (CommandBufferCommonHeader *)COMPUTEPASS_COMMAND_BUFFER;
         commandBufferCommonHeader->compute_pass.in_progress = false;
         commandBufferCommonHeader->compute_pass.compute_pipeline = NULL;
         SDL_zeroa(commandBufferCommonHeader->compute_pass.sampler_bound);
@@ -2608,11 +3726,18 @@ SDL_GPUCopyPass *SDL_BeginGPUCopyPass(
         CHECK_ANY_PASS_IN_PROGRESS("Cannot begin copy pass during another pass!", NULL)
     }
 
+    commandBufferHeader = (CommandBufferCommonHeader *)command_buffer;
+
+    if (commandBufferHeader->timestamps_enabled) {
+        COMMAND_BUFFER_DEVICE->WriteTimestamp(
+            command_buffer,
+            SDL_GPU_PASSTYPE_COPY,
+            false);
+    }
+
     COMMAND_BUFFER_DEVICE->BeginCopyPass(
         command_buffer);
 
-    commandBufferHeader = (CommandBufferCommonHeader *)command_buffer;
-
     if (COMMAND_BUFFER_DEVICE->debug_mode) {
         commandBufferHeader->copy_pass.in_progress = true;
     }
@@ -2859,6 +3984,273 @@ void SDL_DownloadFromGPUBuffer(
         destination);
 }
 
+// Texture Readback
+
+SDL_GPUTextureReadback *SDL_CreateGPUTextureReadback(
+    SDL_GPUDevice *device,
+    Uint32 size,
+    Uint32 num_buffers)
+{
+    SDL_GPUTextureReadback *readback;
+
+    CHECK_DEVICE_MAGIC(device, NULL);
+    if (size == 0) {
+        SDL_InvalidParamError("size");
+        return NULL;
+    }
+    if (num_buffers == 0) {
+        num_buffers = 2;
+    }
+
+    readback = (SDL_GPUTextureReadback *)SDL_calloc(1, sizeof(SDL_GPUTextureReadback));
+    if (readback == NULL) {
+        return NULL;
+    }
+    readback->slots = (ReadbackSlot *)SDL_calloc(num_buffers, sizeof(ReadbackSlot));
+    if (readback->slots == NULL) {
+        SDL_free(readback);
+        return NULL;
+    }
+    readback->device = device;
+    readback->size = size;
+    readback->slot_count = num_buffers;
+
+    for (Uint32 i = 0; i < num_buffers; i += 1) {
+        readback->slots[i].transfer_buffer = device->CreateTransferBuffer(
+            device->driverData,
+            SDL_GPU_TRANSFERBUFFERUSAGE_DOWNLOAD,
+            size,
+            "SDL_GPU Texture Readback");
+        if (readback->slots[i].transfer_buffer == NULL) {
+            for (Uint32 j = 0; j < i; j += 1) {
+                device->ReleaseTransferBuffer(device->driverData, readback->slots[j].transfer_buffer);
+            }
+            SDL_free(readback->slots);
+            SDL_free(readback);
+            return NULL;
+        }
+    }
+
+    SDL_LockMutex(device->upload_lock);
+    readback->next = device->readbacks;
+    device->readbacks = readback;
+    SDL_UnlockMutex(device->upload_lock);
+
+    return readback;
+}
+
+bool SDL_DownloadToGPUTextureReadback(
+    SDL_GPUCopyPass *copy_pass,
+    const SDL_GPUTextureRegion *source,
+    SDL_GPUTextureReadback *readback)
+{
+    CommandBufferCommonHeader *commandBufferHeader;
+    SDL_GPUDevice *device;
+    TextureCommonHeader *textureHeader;
+    SDL_GPUTextureTransferInfo destination;
+    ReadbackSlot *slot = NULL;
+    Uint32 required_size;
+
+    if (copy_pass == NULL) {
+        return SDL_InvalidParamError("copy_pass");
+    }
+    if (source == NULL || source->texture == NULL) {
+        return SDL_InvalidParamError("source");
+    }
+    if (readback == NULL) {
+        return SDL_InvalidParamError("readback");
+    }
+
+    commandBufferHeader = (CommandBufferCommonHeader *)COPYPASS_COMMAND_BUFFER;
+    device = COPYPASS_DEVICE;
+
+    if (device->debug_mode) {
+        if (!((Pass *)copy_pass)->in_progress) {
+            SDL_assert_release(!"Copy pass not in progress!");
+            return false;
+        }
+    }
+
+    if (readback->device != device) {
+        return SDL_SetError("Readback belongs to a different GPU device");
+    }
+
+    textureHeader = (TextureCommonHeader *)source->texture;
+    required_size = SDL_CalculateGPUTextureFormatSize(textureHeader->info.format, source->w, source->h, source->d);
+    if (required_size == 0 || required_size > readback->size) {
+        return SDL_SetError("Texture region needs %" SDL_PRIu32 " bytes, readback buffers hold %" SDL_PRIu32, required_size, readback->size);
+    }
+
+    SDL_LockMutex(device->upload_lock);
+
+    for (Uint32 i = 0; i < readback->slot_count; i += 1) {
+        if (readback->slots[i].state == READBACK_SLOT_FREE) {
+            slot = &readback->slots[i];
+            break;
+        }
+    }
+
+    // Drop the oldest unread result rather than stalling on the GPU
+    if (slot == NULL) {
+        for (Uint32 i = 0; i < readback->slot_count; i += 1) {
+            ReadbackSlot *candidate = &readback->slots[i];
+            if (candidate->state == READBACK_SLOT_PENDING &&
+                device->QueryFence(device->driverData, candidate->fence) &&
+                (slot == NULL || candidate->sequence < slot->sequence)) {
+                slot = candidate;
+            }
+        }
+        if (slot != NULL) {
+            device->ReleaseFence(device->driverData, slot->fence);
+            slot->fence = NULL;
+        }
+    }
+
+    if (slot == NULL) {
+        SDL_UnlockMutex(device->upload_lock);
+        return SDL_SetError("All readback buffers are in use");
+    }
+
+    slot->state = READBACK_SLOT_RECORDED;
+    slot->owner = COPYPASS_COMMAND_BUFFER;
+    slot->sequence = readback->next_sequence++;
+    commandBufferHeader->readback_used = true;
+
+    SDL_UnlockMutex(device->upload_lock);
+
+    destination.transfer_buffer = slot->transfer_buffer;
+    destination.offset = 0;
+    destination.pixels_per_row = 0;
+    destination.rows_per_layer = 0;
+
+    device->DownloadFromTexture(
+        COPYPASS_COMMAND_BUFFER,
+        source,
+        &destination);
+
+    return true;
+}
+
+const void *SDL_MapGPUTextureReadback(
+    SDL_GPUDevice *device,
+    SDL_GPUTextureReadback *readback,
+    bool wait)
+{
+    ReadbackSlot *slot = NULL;
+    void *result;
+
+    CHECK_DEVICE_MAGIC(device, NULL);
+    if (readback == NULL) {
+        SDL_InvalidParamError("readback");
+        return NULL;
+    }
+
+    SDL_LockMutex(device->upload_lock);
+    for (Uint32 i = 0; i < readback->slot_count; i += 1) {
+        ReadbackSlot *candidate = &readback->slots[i];
+        if (candidate->state == READBACK_SLOT_MAPPED || candidate->state == READBACK_SLOT_MAPPING) {
+            SDL_UnlockMutex(device->upload_lock);
+            SDL_SetError("Readback is already mapped");
+            return NULL;
+        }
+        if (candidate->state == READBACK_SLOT_PENDING &&
+            (slot == NULL || candidate->sequence < slot->sequence)) {
+            slot = candidate;
+        }
+    }
+    if (slot == NULL) {
+        SDL_UnlockMutex(device->upload_lock);
+        SDL_SetError("No submitted downloads to map");
+        return NULL;
+    }
+
+    /* Claim the slot before waiting unlocked, otherwise a download on another thread
+       could reclaim it and release its fence while we're still waiting on it. */
+    slot->state = READBACK_SLOT_MAPPING;
+    SDL_UnlockMutex(device->upload_lock);
+
+    if (wait) {
+        result = device->WaitForFences(device->driverData, true, &slot->fence, 1) ? slot : NULL;
+    } else {
+        result = device->QueryFence(device->driverData, slot->fence) ? slot : NULL;
+        if (result == NULL) {
+            SDL_SetError("Readback not ready");
+        }
+    }
+    if (result != NULL) {
+        result = device->MapTransferBuffer(device->driverData, slot->transfer_buffer, false);
+    }
+
+    SDL_LockMutex(device->upload_lock);
+    if (result != NULL) {
+        device->ReleaseFence(device->driverData, slot->fence);
+        slot->fence = NULL;
+        slot->state = READBACK_SLOT_MAPPED;
+    } else {
+        slot->state = READBACK_SLOT_PENDING;
+    }
+    SDL_UnlockMutex(device->upload_lock);
+
+    return result;
+}
+
+void SDL_UnmapGPUTextureReadback(
+    SDL_GPUDevice *device,
+    SDL_GPUTextureReadback *readback)
+{
+    CHECK_DEVICE_MAGIC(device, );
+    if (readback == NULL) {
+        SDL_InvalidParamError("readback");
+        return;
+    }
+
+    SDL_LockMutex(device->upload_lock);
+    for (Uint32 i = 0; i < readback->slot_count; i += 1) {
+        ReadbackSlot *slot = &readback->slots[i];
+        if (slot->state == READBACK_SLOT_MAPPED) {
+            device->UnmapTransferBuffer(device->driverData, slot->transfer_buffer);
+            slot->state = READBACK_SLOT_FREE;
+        }
+    }
+    SDL_UnlockMutex(device->upload_lock);
+}
+
+void SDL_ReleaseGPUTextureReadback(
+    SDL_GPUDevice *device,
+    SDL_GPUTextureReadback *readback)
+{
+    SDL_GPUTextureReadback **prev;
+
+    CHECK_DEVICE_MAGIC(device, );
+    if (readback == NULL) {
+        return;
+    }
+
+    SDL_LockMutex(device->upload_lock);
+    for (prev = &device->readbacks; *prev != NULL; prev = &(*prev)->next) {
+        if (*prev == readback) {
+            *prev = readback->next;
+            break;
+        }
+    }
+
+    // Releasing is deferred by the backend until in-flight downloads are done
+    for (Uint32 i = 0; i < readback->slot_count; i += 1) {
+        ReadbackSlot *slot = &readback->slots[i];
+        if (slot->state == READBACK_SLOT_MAPPED) {
+            device->UnmapTransferBuffer(device->driverData, slot->transfer_buffer);
+        }
+        if (slot->fence != NULL) {
+            device->ReleaseFence(device->driverData, slot->fence);
+        }
+        device->ReleaseTransferBuffer(device->driverData, slot->transfer_buffer);
+    }
+    SDL_UnlockMutex(device->upload_lock);
+
+    SDL_free(readback->slots);
+    SDL_free(readback);
+}
+
 void SDL_EndGPUCopyPass(
     SDL_GPUCopyPass *copy_pass)
 {
@@ -2874,6 +4266,13 @@ void SDL_EndGPUCopyPass(
     COPYPASS_DEVICE->EndCopyPass(
         COPYPASS_COMMAND_BUFFER);
 
+    if (((CommandBufferCommonHeader *)COPYPASS_COMMAND_BUFFER)->timestamps_enabled) {
+        COPYPASS_DEVICE->WriteTimestamp(
+            COPYPASS_COMMAND_BUFFER,
+            SDL_GPU_PASSTYPE_COPY,
+            true);
+    }
+
     if (COPYPASS_DEVICE->debug_mode) {
         ((CommandBufferCommonHeader *)COPYPASS_COMMAND_BUFFER)->copy_pass.in_progress = false;
     }
@@ -2902,8 +4301,9 @@ void SDL_GenerateMipmapsForGPUTexture(
             return;
         }
 
-        if (!(header->info.usage & SDL_GPU_TEXTUREUSAGE_SAMPLER) || !(header->info.usage & SDL_GPU_TEXTUREUSAGE_COLOR_TARGET)) {
-            SDL_assert_release(!"GenerateMipmaps texture must be created with SAMPLER and COLOR_TARGET usage flags!");
+        if (!(header->info.usage & SDL_GPU_TEXTUREUSAGE_SAMPLER) ||
+            (!(header->info.usage & SDL_GPU_TEXTUREUSAGE_COLOR_TARGET) && !SDL_GPU_CanComputeBlit(COMMAND_BUFFER_DEVICE, header, header))) {
+            SDL_assert_release(!"GenerateMipmaps texture must be created with SAMPLER and COLOR_TARGET or COMPUTE_STORAGE_WRITE usage flags!");
             return;
         }
 
@@ -2911,9 +4311,17 @@ void SDL_GenerateMipmapsForGPUTexture(
         commandBufferHeader->ignore_render_pass_texture_validation = true;
     }
 
-    COMMAND_BUFFER_DEVICE->GenerateMipmaps(
-        command_buffer,
-        texture);
+    TextureCommonHeader *textureHeader = (TextureCommonHeader *)texture;
+    if (SDL_GPU_CanComputeBlit(COMMAND_BUFFER_DEVICE, textureHeader, textureHeader)) {
+        // Without COLOR_TARGET usage there is no render pass path to fall back to
+        if (!SDL_GPU_ComputeGenerateMipmaps(command_buffer, texture)) {
+            SDL_LogError(SDL_LOG_CATEGORY_GPU, "Couldn't generate mipmaps with compute: %s", SDL_GetError());
+        }
+    } else {
+        COMMAND_BUFFER_DEVICE->GenerateMipmaps(
+            command_buffer,
+            texture);
+    }
 
     if (COMMAND_BUFFER_DEVICE->debug_mode) {
         CommandBufferCommonHeader *commandBufferHeader = (CommandBufferCommonHeader *)command_buffer;
@@ -2959,8 +4367,9 @@ void SDL_BlitGPUTexture(
             SDL_assert_release(!"Blit source texture must be created with the SAMPLER usage flag");
             failed = true;
         }
-        if ((dstHeader->info.usage & SDL_GPU_TEXTUREUSAGE_COLOR_TARGET) == 0) {
-            SDL_assert_release(!"Blit destination texture must be created with the COLOR_TARGET usage flag");
+        if ((dstHeader->info.usage & SDL_GPU_TEXTUREUSAGE_COLOR_TARGET) == 0 &&
+            (!SDL_GPU_CanComputeBlit(COMMAND_BUFFER_DEVICE, srcHeader, dstHeader) || info->load_op == SDL_GPU_LOADOP_CLEAR)) {
+            SDL_assert_release(!"Blit destination texture must be created with the COLOR_TARGET or COMPUTE_STORAGE_WRITE usage flag");
             failed = true;
         }
         if (IsDepthFormat(srcHeader->info.format)) {
@@ -2977,6 +4386,15 @@ void SDL_BlitGPUTexture(
         }
     }
 
+    // Compute blits can't clear the rest of the destination, leave that to the render pass path
+    if (info->load_op != SDL_GPU_LOADOP_CLEAR &&
+        SDL_GPU_CanComputeBlit(COMMAND_BUFFER_DEVICE, (TextureCommonHeader *)info->source.texture, (TextureCommonHeader *)info->destination.texture)) {
+        if (!SDL_GPU_ComputeBlit(command_buffer, info, 0)) {
+            SDL_LogError(SDL_LOG_CATEGORY_GPU, "Couldn't blit with compute: %s", SDL_GetError());
+        }
+        return;
+    }
+
     COMMAND_BUFFER_DEVICE->Blit(
         command_buffer,
         info);
@@ -3039,6 +4457,10 @@ bool SDL_ClaimWindowForGPUDevice(
         return SDL_SetError("The GPU API doesn't support transparent windows");
     }
 
+    if (device->headless) {
+        return SDL_SetError("Cannot claim a window with a headless GPU device");
+    }
+
     return device->ClaimWindow(
         device->driverData,
         window);
@@ -3208,6 +4630,245 @@ bool SDL_WaitAndAcquireGPUSwapchainTexture(
     return result;
 }
 
+// Upload Ring
+
+// Must be called with upload_lock held
+static void SDL_GPU_RecycleUploadChunks(
+    SDL_GPUDevice *device)
+{
+    Uint32 i;
+
+    for (i = 0; i < device->upload_chunk_count; i += 1) {
+        UploadChunk *chunk = &device->upload_chunks[i];
+
+        if (chunk->fence != NULL && device->QueryFence(device->driverData, chunk->fence)) {
+            // Every chunk used by the same submission shares its fence
+            SDL_GPUFence *fence = chunk->fence;
+            for (Uint32 j = i; j < device->upload_chunk_count; j += 1) {
+                if (device->upload_chunks[j].fence == fence) {
+                    device->upload_chunks[j].fence = NULL;
+                    device->upload_chunks[j].offset = 0;
+                }
+            }
+            device->ReleaseFence(device->driverData, fence);
+        }
+    }
+
+    // Don't hold on to oversized chunks made for one-off large allocations
+    i = device->upload_chunk_count;
+    while (i > 0) {
+        UploadChunk *chunk = &device->upload_chunks[--i];
+
+        if (chunk->owner == NULL && chunk->fence == NULL && chunk->size > UPLOAD_CHUNK_SIZE) {
+            device->ReleaseTransferBuffer(device->driverData, chunk->transfer_buffer);
+            *chunk = device->upload_chunks[device->upload_chunk_count - 1];
+            device->upload_chunk_count -= 1;
+        }
+    }
+}
+
+// Must be called with upload_lock held, fence is NULL if the command buffer never reached the GPU
+static void SDL_GPU_RetireUploadChunks(
+    SDL_GPUDevice *device,
+    SDL_GPUCommandBuffer *command_buffer,
+    SDL_GPUFence *fence)
+{
+    for (Uint32 i = 0; i < device->upload_chunk_count; i += 1) {
+        UploadChunk *chunk = &device->upload_chunks[i];
+
+        if (chunk->owner == command_buffer) {
+            device->UnmapTransferBuffer(device->driverData, chunk->transfer_buffer);
+            chunk->mapped = NULL;
+            chunk->owner = NULL;
+            chunk->fence = fence;
+            if (fence == NULL) {
+                chunk->offset = 0;
+            }
+        }
+    }
+}
+
+// Must be called with upload_lock held, fence is NULL if the command buffer never reached the GPU
+static void SDL_GPU_RetireReadbackSlots(
+    SDL_GPUDevice *device,
+    SDL_GPUCommandBuffer *command_buffer,
+    SDL_GPUFence *fence)
+{
+    for (SDL_GPUTextureReadback *readback = device->readbacks; readback != NULL; readback = readback->next) {
+        for (Uint32 i = 0; i < readback->slot_count; i += 1) {
+            ReadbackSlot *slot = &readback->slots[i];
+
+            if (slot->state == READBACK_SLOT_RECORDED && slot->owner == command_buffer) {
+                slot->owner = NULL;
+                if (fence != NULL) {
+                    device->ReferenceFence(device->driverData, fence);
+                    slot->fence = fence;
+                    slot->state = READBACK_SLOT_PENDING;
+                } else {
+                    slot->state = READBACK_SLOT_FREE;
+                }
+            }
+        }
+    }
+}
+
+// Submits a command buffer that used the upload ring or a readback, both need its fence
+static SDL_GPUFence *SDL_GPU_SubmitTracked(
+    SDL_GPUCommandBuffer *command_buffer,
+    bool acquire_fence,
+    bool *result)
+{
+    CommandBufferCommonHeader *commandBufferHeader = (CommandBufferCommonHeader *)command_buffer;
+    SDL_GPUDevice *device = COMMAND_BUFFER_DEVICE;
+    SDL_GPUFence *fence;
+
+    SDL_LockMutex(device->upload_lock);
+    fence = device->SubmitAndAcquireFence(command_buffer);
+
+    // The upload ring and every readback slot hold their own reference
+    if (commandBufferHeader->upload_memory_used) {
+        if (fence != NULL) {
+            device->ReferenceFence(device->driverData, fence);
+        }
+        SDL_GPU_RetireUploadChunks(device, command_buffer, fence);
+    }
+    if (commandBufferHeader->readback_used) {
+        SDL_GPU_RetireReadbackSlots(device, command_buffer, fence);
+    }
+    SDL_UnlockMutex(device->upload_lock);
+
+    *result = (fence != NULL);
+    if (fence != NULL && !acquire_fence) {
+        device->ReleaseFence(device->driverData, fence);
+        fence = NULL;
+    }
+    return fence;
+}
+
+void *SDL_AllocateGPUUploadMemory(
+    SDL_GPUCommandBuffer *command_buffer,
+    Uint32 size,
+    Uint32 alignment,
+    SDL_GPUTransferBufferLocation *location)
+{
+    CommandBufferCommonHeader *commandBufferHeader = (CommandBufferCommonHeader *)command_buffer;
+    SDL_GPUDevice *device;
+    UploadChunk *chunk = NULL;
+    Uint32 offset = 0;
+    void *result;
+
+    if (command_buffer == NULL) {
+        SDL_InvalidParamError("command_buffer");
+        return NULL;
+    }
+    if (location == NULL) {
+        SDL_InvalidParamError("location");
+        return NULL;
+    }
+    if (size == 0) {
+        SDL_InvalidParamError("size");
+        return NULL;
+    }
+    if (alignment == 0) {
+        alignment = 1;
+    } else if ((alignment & (alignment - 1)) != 0) {
+        SDL_SetError("Upload memory alignment must be a power of two");
+        return NULL;
+    }
+
+    if (COMMAND_BUFFER_DEVICE->debug_mode) {
+        CHECK_COMMAND_BUFFER_RETURN_NULL
+    }
+
+    device = COMMAND_BUFFER_DEVICE;
+
+    SDL_LockMutex(device->upload_lock);
+
+    // Keep bump-allocating from a chunk this command buffer already owns
+    for (Uint32 i = 0; i < device->upload_chunk_count; i += 1) {
+        UploadChunk *candidate = &device->upload_chunks[i];
+
+        if (candidate->owner == command_buffer) {
+            Uint64 aligned = ((Uint64)candidate->offset + alignment - 1) & ~((Uint64)alignment - 1);
+            if (aligned + size <= candidate->size) {
+                chunk = candidate;
+                offset = (Uint32)aligned;
+                break;
+            }
+        }
+    }
+
+    if (chunk == NULL) {
+        SDL_GPU_RecycleUploadChunks(device);
+
+        for (Uint32 i = 0; i < device->upload_chunk_count; i += 1) {
+            UploadChunk *candidate = &device->upload_chunks[i];
+
+            if (candidate->owner == NULL && candidate->fence == NULL && size <= candidate->size) {
+                chunk = candidate;
+                chunk->offset = 0;
+                break;
+            }
+        }
+    }
+
+    if (chunk == NULL) {
+        Uint32 chunk_size = SDL_max(size, UPLOAD_CHUNK_SIZE);
+        SDL_GPUTransferBuffer *transfer_buffer;
+
+        if (device->upload_chunk_count == device->upload_chunk_capacity) {
+            Uint32 new_capacity = SDL_max(device->upload_chunk_capacity * 2, 4);
+            UploadChunk *new_chunks = SDL_realloc(device->upload_chunks, new_capacity * sizeof(UploadChunk));
+            if (new_chunks == NULL) {
+                SDL_UnlockMutex(device->upload_lock);
+                return NULL;
+            }
+            device->upload_chunks = new_chunks;
+            device->upload_chunk_capacity = new_capacity;
+        }
+
+        transfer_buffer = device->CreateTransferBuffer(
+            device->driverData,
+            SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+            chunk_size,
+            "SDL_GPU Upload Ring");
+        if (transfer_buffer == NULL) {
+            SDL_UnlockMutex(device->upload_lock);
+            return NULL;
+        }
+
+        chunk = &device->upload_chunks[device->upload_chunk_count];
+        device->upload_chunk_count += 1;
+
+        chunk->transfer_buffer = transfer_buffer;
+        chunk->mapped = NULL;
+        chunk->size = chunk_size;
+        chunk->offset = 0;
+        chunk->owner = NULL;
+        chunk->fence = NULL;
+    }
+
+    if (chunk->owner == NULL) {
+        chunk->mapped = device->MapTransferBuffer(device->driverData, chunk->transfer_buffer, false);
+        if (chunk->mapped == NULL) {
+            SDL_UnlockMutex(device->upload_lock);
+            return NULL;
+        }
+        chunk->owner = command_buffer;
+        commandBufferHeader->upload_memory_used = true;
+    }
+
+    chunk->offset = offset + size;
+
+    location->transfer_buffer = chunk->transfer_buffer;
+    location->offset = offset;
+    result = chunk->mapped + offset;
+
+    SDL_UnlockMutex(device->upload_lock);
+
+    return result;
+}
+
 bool SDL_SubmitGPUCommandBuffer(
     SDL_GPUCommandBuffer *command_buffer)
 {
@@ -3231,6 +4892,13 @@ bool SDL_SubmitGPUCommandBuffer(
 
     commandBufferHeader->submitted = true;
 
+    // The upload ring and readbacks need to know when the GPU is done with this submission
+    if (commandBufferHeader->upload_memory_used || commandBufferHeader->readback_used) {
+        bool result;
+        SDL_GPU_SubmitTracked(command_buffer, false, &result);
+        return result;
+    }
+
     return COMMAND_BUFFER_DEVICE->Submit(
         command_buffer);
 }
@@ -3258,6 +4926,11 @@ SDL_GPUFence *SDL_SubmitGPUCommandBufferAndAcquireFence(
 
     commandBufferHeader->submitted = true;
 
+    if (commandBufferHeader->upload_memory_used || commandBufferHeader->readback_used) {
+        bool result;
+        return SDL_GPU_SubmitTracked(command_buffer, true, &result);
+    }
+
     return COMMAND_BUFFER_DEVICE->SubmitAndAcquireFence(
         command_buffer);
 }
@@ -3279,6 +4952,19 @@ bool SDL_CancelGPUCommandBuffer(
         }
     }
 
+    if (commandBufferHeader->upload_memory_used || commandBufferHeader->readback_used) {
+        SDL_GPUDevice *device = COMMAND_BUFFER_DEVICE;
+        bool result;
+
+        SDL_LockMutex(device->upload_lock);
+        result = device->Cancel(command_buffer);
+        SDL_GPU_RetireUploadChunks(device, command_buffer, NULL);
+        SDL_GPU_RetireReadbackSlots(device, command_buffer, NULL);
+        SDL_UnlockMutex(device->upload_lock);
+
+        return result;
+    }
+
     return COMMAND_BUFFER_DEVICE->Cancel(
         command_buffer);
 }
@@ -3340,6 +5026,68 @@ void SDL_ReleaseGPUFence(
         fence);
 }
 
+bool SDL_EnableGPUTimestamps(
+    SDL_GPUCommandBuffer *command_buffer)
+{
+    CommandBufferCommonHeader *commandBufferHeader = (CommandBufferCommonHeader *)command_buffer;
+
+    if (command_buffer == NULL) {
+        return SDL_InvalidParamError("command_buffer");
+    }
+
+    if (COMMAND_BUFFER_DEVICE->debug_mode) {
+        CHECK_COMMAND_BUFFER_RETURN_FALSE
+        CHECK_ANY_PASS_IN_PROGRESS("Cannot enable timestamps during a pass!", false)
+    }
+
+    if (commandBufferHeader->timestamps_enabled) {
+        return true;
+    }
+
+    if (!COMMAND_BUFFER_DEVICE->EnableTimestamps(command_buffer)) {
+        return false;
+    }
+
+    commandBufferHeader->timestamps_enabled = true;
+    return true;
+}
+
+SDL_GPUPassTiming *SDL_GetGPUPassTimings(
+    SDL_GPUDevice *device,
+    SDL_GPUFence *fence,
+    int *count)
+{
+    if (count) {
+        *count = 0;
+    }
+
+    CHECK_DEVICE_MAGIC(device, NULL);
+    if (fence == NULL) {
+        SDL_InvalidParamError("fence");
+        return NULL;
+    }
+
+    return device->GetPassTimings(
+        device->driverData,
+        fence,
+        count);
+}
+
+SDL_GPUMemoryStats *SDL_GetGPUMemoryStats(
+    SDL_GPUDevice *device,
+    int *count)
+{
+    if (count) {
+        *count = 0;
+    }
+
+    CHECK_DEVICE_MAGIC(device, NULL);
+
+    return device->GetMemoryStats(
+        device->driverData,
+        count);
+}
+
 Uint32 SDL_CalculateGPUTextureFormatSize(
     SDL_GPUTextureFormat format,
     Uint32 width,
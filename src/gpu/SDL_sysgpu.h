@@ -38,6 +38,8 @@
 #define MAX_COLOR_TARGET_BINDINGS      8
 #define MAX_PRESENT_COUNT              16
 #define MAX_FRAMES_IN_FLIGHT           3
+#define MAX_TIMESTAMP_PASSES           128
+#define UPLOAD_CHUNK_SIZE              4194304
 
 // Common Structs
 
@@ -92,8 +94,67 @@ typedef struct CommandBufferCommonHeader
     bool submitted;
     // used to avoid tripping assert on GenerateMipmaps
     bool ignore_render_pass_texture_validation;
+    // set by SDL_EnableGPUTimestamps, passes write timestamps when true
+    bool timestamps_enabled;
+    // set by SDL_AllocateGPUUploadMemory, submission has to retire upload chunks
+    bool upload_memory_used;
+    // set by SDL_DownloadToGPUTextureReadback, submission has to retire readback slots
+    bool readback_used;
 } CommandBufferCommonHeader;
 
+typedef struct UploadChunk
+{
+    SDL_GPUTransferBuffer *transfer_buffer;
+    Uint8 *mapped;
+    Uint32 size;
+    Uint32 offset;
+    SDL_GPUCommandBuffer *owner; // command buffer allocating from this chunk, or NULL
+    SDL_GPUFence *fence;         // signaled when the GPU is done with the owner's submission
+} UploadChunk;
+
+typedef enum ReadbackSlotState
+{
+    READBACK_SLOT_FREE,
+    READBACK_SLOT_RECORDED, // download recorded into a command buffer that wasn't submitted yet
+    READBACK_SLOT_PENDING,  // submitted, data is valid once the fence signals
+    READBACK_SLOT_MAPPING,  // claimed by SDL_MapGPUTextureReadback() while it waits on the fence
+    READBACK_SLOT_MAPPED
+} ReadbackSlotState;
+
+typedef struct ReadbackSlot
+{
+    SDL_GPUTransferBuffer *transfer_buffer;
+    ReadbackSlotState state;
+    SDL_GPUCommandBuffer *owner; // command buffer recording the download, or NULL
+    SDL_GPUFence *fence;
+    Uint64 sequence; // download order, the oldest pending slot is mapped first
+} ReadbackSlot;
+
+struct SDL_GPUPipelineJob
+{
+    SDL_GPUDevice *device;
+    bool compute;
+    SDL_GPUGraphicsPipelineCreateInfo graphics_info; // arrays and props are owned copies
+    SDL_GPUComputePipelineCreateInfo compute_info;   // code, entrypoint and props are owned copies
+    void *pipeline;
+    char *error;
+    bool done;
+    bool released; // abandoned by the app, the worker cleans up
+    SDL_GPUPipelineJob *next; // device job queue
+    SDL_GPUPipelineJob *live_prev; // every job the app hasn't waited on or released
+    SDL_GPUPipelineJob *live_next;
+};
+
+struct SDL_GPUTextureReadback
+{
+    SDL_GPUDevice *device;
+    Uint32 size;
+    Uint32 slot_count;
+    ReadbackSlot *slots;
+    Uint64 next_sequence;
+    SDL_GPUTextureReadback *next; // device readback list
+};
+
 typedef struct TextureCommonHeader
 {
     SDL_GPUTextureCreateInfo info;
@@ -141,6 +202,25 @@ typedef struct BlitPipelineCacheEntry
     SDL_GPUGraphicsPipeline *pipeline;
 } BlitPipelineCacheEntry;
 
+// Compute kernels for SDL_BlitGPUTexture() and SDL_GenerateMipmapsForGPUTexture(),
+// SDL_gpu.c describes their resources
+typedef enum ComputeBlitKernel
+{
+    COMPUTE_BLIT_2D,
+    COMPUTE_BLIT_2D_ARRAY,
+    COMPUTE_BLIT_3D,
+    COMPUTE_BLIT_MIP_CHAIN_2D,
+    COMPUTE_BLIT_MIP_CHAIN_2D_ARRAY,
+    COMPUTE_BLIT_KERNEL_COUNT
+} ComputeBlitKernel;
+
+typedef struct ComputeBlitShaders
+{
+    SDL_GPUShaderFormat format;
+    const Uint8 *code[COMPUTE_BLIT_KERNEL_COUNT];
+    size_t code_size[COMPUTE_BLIT_KERNEL_COUNT];
+} ComputeBlitShaders;
+
 // Internal Helper Utilities
 
 #define SDL_GPU_TEXTUREFORMAT_MAX_ENUM_VALUE        (SDL_GPU_TEXTUREFORMAT_ASTC_12x12_FLOAT + 1)
@@ -681,6 +761,12 @@ struct SDL_GPUDevice
         SDL_GPURenderer *driverData,
         const SDL_GPUGraphicsPipelineCreateInfo *createinfo);
 
+    bool (*PrepareRenderPass)(
+        SDL_GPURenderer *driverData,
+        const SDL_GPUColorTargetInfo *colorTargetInfos,
+        Uint32 numColorTargets,
+        const SDL_GPUDepthStencilTargetInfo *depthStencilTargetInfo);
+
     SDL_GPUSampler *(*CreateSampler)(
         SDL_GPURenderer *driverData,
         const SDL_GPUSamplerCreateInfo *createinfo);
@@ -705,6 +791,27 @@ struct SDL_GPUDevice
         Uint32 size,
         const char *debugName);
 
+    // Bindless Resources
+
+    bool (*RegisterBindlessTexture)(
+        SDL_GPURenderer *driverData,
+        SDL_GPUTexture *texture,
+        SDL_GPUSampler *sampler,
+        Uint32 *index);
+
+    bool (*RegisterBindlessBuffer)(
+        SDL_GPURenderer *driverData,
+        SDL_GPUBuffer *buffer,
+        Uint32 *index);
+
+    void (*UnregisterBindlessTexture)(
+        SDL_GPURenderer *driverData,
+        Uint32 index);
+
+    void (*UnregisterBindlessBuffer)(
+        SDL_GPURenderer *driverData,
+        Uint32 index);
+
     // Debug Naming
 
     void (*SetBufferName)(
@@ -872,6 +979,22 @@ struct SDL_GPUDevice
         Uint32 offset,
         Uint32 drawCount);
 
+    void (*DrawPrimitivesIndirectCount)(
+        SDL_GPUCommandBuffer *commandBuffer,
+        SDL_GPUBuffer *buffer,
+        Uint32 offset,
+        SDL_GPUBuffer *countBuffer,
+        Uint32 countOffset,
+        Uint32 maxDrawCount);
+
+    void (*DrawIndexedPrimitivesIndirectCount)(
+        SDL_GPUCommandBuffer *commandBuffer,
+        SDL_GPUBuffer *buffer,
+        Uint32 offset,
+        SDL_GPUBuffer *countBuffer,
+        Uint32 countOffset,
+        Uint32 maxDrawCount);
+
     void (*EndRenderPass)(
         SDL_GPUCommandBuffer *commandBuffer);
 
@@ -1072,6 +1195,29 @@ struct SDL_GPUDevice
         SDL_GPURenderer *driverData,
         SDL_GPUFence *fence);
 
+    void (*ReferenceFence)(
+        SDL_GPURenderer *driverData,
+        SDL_GPUFence *fence);
+
+    // Timing
+
+    bool (*EnableTimestamps)(
+        SDL_GPUCommandBuffer *commandBuffer);
+
+    void (*WriteTimestamp)(
+        SDL_GPUCommandBuffer *commandBuffer,
+        SDL_GPUPassType passType,
+        bool passEnd);
+
+    SDL_GPUPassTiming *(*GetPassTimings)(
+        SDL_GPURenderer *driverData,
+        SDL_GPUFence *fence,
+        int *count);
+
+    SDL_GPUMemoryStats *(*GetMemoryStats)(
+        SDL_GPURenderer *driverData,
+        int *count);
+
     // Feature Queries
 
     bool (*SupportsTextureFormat)(
@@ -1094,8 +1240,48 @@ struct SDL_GPUDevice
     // Store this for SDL_GetGPUShaderFormats()
     SDL_GPUShaderFormat shader_formats;
 
+    // Store this for SDL_DrawGPUPrimitivesIndirectCount(), set by the driver
+    bool indirect_draw_count;
+
     // Store this for SDL_gpu.c's debug layer
     bool debug_mode;
+
+    // Set by SDL_PROP_GPU_DEVICE_CREATE_HEADLESS_BOOLEAN, no window can be claimed
+    bool headless;
+
+    // Streaming upload ring, see SDL_AllocateGPUUploadMemory()
+    // The lock also guards the readback list.
+    SDL_Mutex *upload_lock;
+    UploadChunk *upload_chunks;
+    Uint32 upload_chunk_count;
+    Uint32 upload_chunk_capacity;
+
+    // Persistent readbacks, see SDL_CreateGPUTextureReadback()
+    SDL_GPUTextureReadback *readbacks;
+
+    // Background pipeline compilation, see SDL_CreateGPUGraphicsPipelineAsync()
+    SDL_Mutex *pipeline_job_lock;
+    SDL_Condition *pipeline_job_queued;
+    SDL_Condition *pipeline_job_finished;
+    SDL_GPUPipelineJob *pipeline_job_head;
+    SDL_GPUPipelineJob *pipeline_job_tail;
+    SDL_GPUPipelineJob *pipeline_jobs_live;
+    SDL_Thread **pipeline_workers;
+    int pipeline_worker_count;
+    int pipeline_worker_limit;
+    bool pipeline_workers_quit;
+
+    // Compute blit kernels, set by the driver when its storage textures can
+    // be written without declaring their format. NULL otherwise.
+    const ComputeBlitShaders *compute_blit_shaders;
+
+    // Compute blit pipelines and resources, created on first use
+    SDL_Mutex *compute_blit_lock;
+    SDL_GPUSampler *compute_blit_samplers[2];
+    SDL_GPUComputePipeline *compute_blit_pipelines[COMPUTE_BLIT_KERNEL_COUNT];
+    SDL_GPUBuffer *compute_blit_scratch;
+    SDL_GPUTransferBuffer *compute_blit_zero;
+    SDL_GPUTexture *compute_blit_spare;
 };
 
 #define ASSIGN_DRIVER_FUNC(func, name) \
@@ -1105,11 +1291,16 @@ struct SDL_GPUDevice
     ASSIGN_DRIVER_FUNC(GetDeviceProperties, name)      \
     ASSIGN_DRIVER_FUNC(CreateComputePipeline, name)         \
     ASSIGN_DRIVER_FUNC(CreateGraphicsPipeline, name)        \
+    ASSIGN_DRIVER_FUNC(PrepareRenderPass, name)             \
     ASSIGN_DRIVER_FUNC(CreateSampler, name)                 \
     ASSIGN_DRIVER_FUNC(CreateShader, name)                  \
     ASSIGN_DRIVER_FUNC(CreateTexture, name)                 \
     ASSIGN_DRIVER_FUNC(CreateBuffer, name)                  \
     ASSIGN_DRIVER_FUNC(CreateTransferBuffer, name)          \
+    ASSIGN_DRIVER_FUNC(RegisterBindlessTexture, name)       \
+    ASSIGN_DRIVER_FUNC(RegisterBindlessBuffer, name)        \
+    ASSIGN_DRIVER_FUNC(UnregisterBindlessTexture, name)     \
+    ASSIGN_DRIVER_FUNC(UnregisterBindlessBuffer, name)      \
     ASSIGN_DRIVER_FUNC(SetBufferName, name)                 \
     ASSIGN_DRIVER_FUNC(SetTextureName, name)                \
     ASSIGN_DRIVER_FUNC(InsertDebugLabel, name)              \
@@ -1142,6 +1333,8 @@ struct SDL_GPUDevice
     ASSIGN_DRIVER_FUNC(DrawPrimitives, name)                \
     ASSIGN_DRIVER_FUNC(DrawPrimitivesIndirect, name)        \
     ASSIGN_DRIVER_FUNC(DrawIndexedPrimitivesIndirect, name) \
+    ASSIGN_DRIVER_FUNC(DrawPrimitivesIndirectCount, name)   \
+    ASSIGN_DRIVER_FUNC(DrawIndexedPrimitivesIndirectCount, name) \
     ASSIGN_DRIVER_FUNC(EndRenderPass, name)                 \
     ASSIGN_DRIVER_FUNC(BeginComputePass, name)              \
     ASSIGN_DRIVER_FUNC(BindComputePipeline, name)           \
@@ -1182,6 +1375,11 @@ struct SDL_GPUDevice
     ASSIGN_DRIVER_FUNC(WaitForFences, name)                 \
     ASSIGN_DRIVER_FUNC(QueryFence, name)                    \
     ASSIGN_DRIVER_FUNC(ReleaseFence, name)                  \
+    ASSIGN_DRIVER_FUNC(ReferenceFence, name)                \
+    ASSIGN_DRIVER_FUNC(EnableTimestamps, name)              \
+    ASSIGN_DRIVER_FUNC(WriteTimestamp, name)                \
+    ASSIGN_DRIVER_FUNC(GetPassTimings, name)                \
+    ASSIGN_DRIVER_FUNC(GetMemoryStats, name)                \
     ASSIGN_DRIVER_FUNC(SupportsTextureFormat, name)         \
     ASSIGN_DRIVER_FUNC(SupportsSampleCount, name)
 
@@ -160,6 +160,7 @@ static const IID D3D_IID_ID3D12Fence = { 0x0a753dcf, 0xc4d8, 0x4b91, { 0xad, 0xf
 static const IID D3D_IID_ID3D12RootSignature = { 0xc54a6b66, 0x72df, 0x4ee8, { 0x8b, 0xe5, 0xa9, 0x46, 0xa1, 0x42, 0x92, 0x14 } };
 static const IID D3D_IID_ID3D12CommandSignature = { 0xc36a797c, 0xec80, 0x4f0a, { 0x89, 0x85, 0xa7, 0xb2, 0x47, 0x50, 0x82, 0xd1 } };
 static const IID D3D_IID_ID3D12PipelineState = { 0x765a30f3, 0xf624, 0x4c6f, { 0xa8, 0x28, 0xac, 0xe9, 0x48, 0x62, 0x24, 0x45 } };
+static const IID D3D_IID_ID3D12QueryHeap = { 0x0d9658ae, 0xed45, 0x469e, { 0xa6, 0x1d, 0x97, 0x0e, 0xc5, 0x83, 0xca, 0xb4 } };
 static const IID D3D_IID_ID3D12Debug = { 0x344488b7, 0x6846, 0x474b, { 0xb9, 0x89, 0xf0, 0x27, 0x44, 0x82, 0x45, 0xe0 } };
 static const IID D3D_IID_ID3D12InfoQueue = { 0x0742a90b, 0xc387, 0x483f, { 0xb9, 0x46, 0x30, 0xa7, 0xe4, 0xe6, 0x14, 0x58 } };
 static const IID D3D_IID_ID3D12InfoQueue1 = { 0x2852dd88, 0xb484, 0x4c0c, { 0xb6, 0xb1, 0x67, 0x16, 0x85, 0x00, 0xe6, 0x00 } };
@@ -713,11 +714,20 @@ typedef struct D3D12DescriptorHeap D3D12DescriptorHeap;
 typedef struct D3D12StagingDescriptor D3D12StagingDescriptor;
 typedef struct D3D12TextureDownload D3D12TextureDownload;
 
+typedef struct D3D12TimestampQueries
+{
+    ID3D12QueryHeap *queryHeap;
+    ID3D12Resource *readbackBuffer;
+    Uint32 timestampCount;
+    SDL_GPUPassType passTypes[MAX_TIMESTAMP_PASSES];
+} D3D12TimestampQueries;
+
 typedef struct D3D12Fence
 {
     ID3D12Fence *handle;
     HANDLE event; // used for blocking
     SDL_AtomicInt referenceCount;
+    D3D12TimestampQueries *timestamps; // results of the last submission using this fence, may be NULL
 } D3D12Fence;
 
 struct D3D12DescriptorHeap
@@ -966,6 +976,9 @@ struct D3D12CommandBuffer
     D3D12Fence *inFlightFence;
     bool autoReleaseFence;
 
+    // Handed over to the in-flight fence on submit when timestamps are enabled
+    D3D12TimestampQueries *timestamps;
+
     // Presentation data
     D3D12PresentData *presentDatas;
     Uint32 presentDataCount;
@@ -1516,6 +1529,13 @@ static void D3D12_ReleaseFence(
     }
 }
 
+static void D3D12_ReferenceFence(
+    SDL_GPURenderer *driverData,
+    SDL_GPUFence *fence)
+{
+    (void)SDL_AtomicIncRef(&((D3D12Fence *)fence)->referenceCount);
+}
+
 static bool D3D12_QueryFence(
     SDL_GPURenderer *driverData,
     SDL_GPUFence *fence)
@@ -1524,6 +1544,177 @@ static bool D3D12_QueryFence(
     return ID3D12Fence_GetCompletedValue(d3d12Fence->handle) == D3D12_FENCE_SIGNAL_VALUE;
 }
 
+// Timing
+
+static bool D3D12_EnableTimestamps(
+    SDL_GPUCommandBuffer *commandBuffer)
+{
+    D3D12CommandBuffer *d3d12CommandBuffer = (D3D12CommandBuffer *)commandBuffer;
+    D3D12Renderer *renderer = d3d12CommandBuffer->renderer;
+    D3D12TimestampQueries *timestamps;
+    D3D12_QUERY_HEAP_DESC queryHeapDesc;
+    D3D12_HEAP_PROPERTIES heapProperties;
+    D3D12_RESOURCE_DESC resourceDesc;
+    HRESULT res;
+
+    if (d3d12CommandBuffer->timestamps == NULL) {
+        timestamps = (D3D12TimestampQueries *)SDL_calloc(1, sizeof(D3D12TimestampQueries));
+        if (!timestamps) {
+            return false;
+        }
+
+        queryHeapDesc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+        queryHeapDesc.Count = MAX_TIMESTAMP_PASSES * 2;
+        queryHeapDesc.NodeMask = 0;
+
+        res = ID3D12Device_CreateQueryHeap(
+            renderer->device,
+            &queryHeapDesc,
+            D3D_GUID(D3D_IID_ID3D12QueryHeap),
+            (void **)&timestamps->queryHeap);
+        if (FAILED(res)) {
+            D3D12_INTERNAL_DestroyTimestampQueries(timestamps);
+            CHECK_D3D12_ERROR_AND_RETURN("Failed to create query heap!", false);
+        }
+
+        heapProperties.Type = D3D12_HEAP_TYPE_READBACK;
+        heapProperties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+        heapProperties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+        heapProperties.CreationNodeMask = 0; // We don't do multi-adapter operation
+        heapProperties.VisibleNodeMask = 0;  // We don't do multi-adapter operation
+
+        resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+        resourceDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+        resourceDesc.Width = MAX_TIMESTAMP_PASSES * 2 * sizeof(Uint64);
+        resourceDesc.Height = 1;
+        resourceDesc.DepthOrArraySize = 1;
+        resourceDesc.MipLevels = 1;
+        resourceDesc.Format = DXGI_FORMAT_UNKNOWN;
+        resourceDesc.SampleDesc.Count = 1;
+        resourceDesc.SampleDesc.Quality = 0;
+        resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+        resourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+        res = ID3D12Device_CreateCommittedResource(
+            renderer->device,
+            &heapProperties,
+            D3D12_HEAP_FLAG_NONE,
+            &resourceDesc,
+            D3D12_RESOURCE_STATE_COPY_DEST,
+            NULL,
+            D3D_GUID(D3D_IID_ID3D12Resource),
+            (void **)&timestamps->readbackBuffer);
+        if (FAILED(res)) {
+            D3D12_INTERNAL_DestroyTimestampQueries(timestamps);
+            CHECK_D3D12_ERROR_AND_RETURN("Failed to create timestamp readback buffer!", false);
+        }
+
+        d3d12CommandBuffer->timestamps = timestamps;
+    }
+
+    d3d12CommandBuffer->timestamps->timestampCount = 0;
+
+    return true;
+}
+
+static void D3D12_WriteTimestamp(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUPassType passType,
+    bool passEnd)
+{
+    D3D12CommandBuffer *d3d12CommandBuffer = (D3D12CommandBuffer *)commandBuffer;
+    D3D12TimestampQueries *timestamps = d3d12CommandBuffer->timestamps;
+
+    // Passes past the limit are silently not timed
+    if (timestamps->timestampCount == MAX_TIMESTAMP_PASSES * 2) {
+        return;
+    }
+
+    if (!passEnd) {
+        timestamps->passTypes[timestamps->timestampCount / 2] = passType;
+    }
+
+    ID3D12GraphicsCommandList_EndQuery(
+        d3d12CommandBuffer->graphicsCommandList,
+        timestamps->queryHeap,
+        D3D12_QUERY_TYPE_TIMESTAMP,
+        timestamps->timestampCount);
+
+    timestamps->timestampCount += 1;
+}
+
+static SDL_GPUPassTiming *D3D12_GetPassTimings(
+    SDL_GPURenderer *driverData,
+    SDL_GPUFence *fence,
+    int *count)
+{
+    D3D12Renderer *renderer = (D3D12Renderer *)driverData;
+    D3D12Fence *d3d12Fence = (D3D12Fence *)fence;
+    D3D12TimestampQueries *timestamps = d3d12Fence->timestamps;
+    D3D12_RANGE readRange;
+    D3D12_RANGE writeRange;
+    Uint64 *results;
+    UINT64 frequency;
+    Uint32 passCount;
+    SDL_GPUPassTiming *timings;
+    HRESULT res;
+
+    if (timestamps == NULL || timestamps->timestampCount < 2) {
+        SDL_SetError("No timestamps were recorded for this fence");
+        return NULL;
+    }
+
+    if (!D3D12_QueryFence(driverData, fence)) {
+        SDL_SetError("Fence has not been signaled yet");
+        return NULL;
+    }
+
+    res = ID3D12CommandQueue_GetTimestampFrequency(renderer->commandQueue, &frequency);
+    CHECK_D3D12_ERROR_AND_RETURN("Failed to get timestamp frequency!", NULL);
+
+    passCount = timestamps->timestampCount / 2;
+
+    timings = (SDL_GPUPassTiming *)SDL_malloc(passCount * sizeof(SDL_GPUPassTiming));
+    if (!timings) {
+        return NULL;
+    }
+
+    readRange.Begin = 0;
+    readRange.End = passCount * 2 * sizeof(Uint64);
+    res = ID3D12Resource_Map(
+        timestamps->readbackBuffer,
+        0,
+        &readRange,
+        (void **)&results);
+    if (FAILED(res)) {
+        SDL_free(timings);
+        CHECK_D3D12_ERROR_AND_RETURN("Failed to map timestamp readback buffer!", NULL);
+    }
+
+    for (Uint32 i = 0; i < passCount; i += 1) {
+        timings[i].type = timestamps->passTypes[i];
+        timings[i].start_ns = (Uint64)((results[i * 2] - results[0]) * (1000000000.0 / frequency));
+        timings[i].duration_ns = (Uint64)((results[i * 2 + 1] - results[i * 2]) * (1000000000.0 / frequency));
+    }
+
+    writeRange.Begin = 0;
+    writeRange.End = 0;
+    ID3D12Resource_Unmap(timestamps->readbackBuffer, 0, &writeRange);
+
+    if (count) {
+        *count = (int)passCount;
+    }
+    return timings;
+}
+
+static SDL_GPUMemoryStats *D3D12_GetMemoryStats(
+    SDL_GPURenderer *driverData,
+    int *count)
+{
+    SDL_Unsupported();
+    return NULL;
+}
+
 static void D3D12_INTERNAL_DestroyDescriptorHeap(D3D12DescriptorHeap *descriptorHeap)
 {
     if (!descriptorHeap) {
@@ -1548,6 +1739,20 @@ static void D3D12_INTERNAL_DestroyStagingDescriptorPool(
     SDL_free(pool);
 }
 
+static void D3D12_INTERNAL_DestroyTimestampQueries(D3D12TimestampQueries *timestamps)
+{
+    if (!timestamps) {
+        return;
+    }
+    if (timestamps->queryHeap) {
+        ID3D12QueryHeap_Release(timestamps->queryHeap);
+    }
+    if (timestamps->readbackBuffer) {
+        ID3D12Resource_Release(timestamps->readbackBuffer);
+    }
+    SDL_free(timestamps);
+}
+
 static void D3D12_INTERNAL_DestroyCommandBuffer(D3D12CommandBuffer *commandBuffer)
 {
     if (!commandBuffer) {
@@ -1567,6 +1772,7 @@ static void D3D12_INTERNAL_DestroyCommandBuffer(D3D12CommandBuffer *commandBuffe
     SDL_free(commandBuffer->usedComputePipelines);
     SDL_free(commandBuffer->usedUniformBuffers);
     SDL_free(commandBuffer->textureDownloads);
+    D3D12_INTERNAL_DestroyTimestampQueries(commandBuffer->timestamps);
     SDL_free(commandBuffer);
 }
 
@@ -1581,6 +1787,7 @@ static void D3D12_INTERNAL_DestroyFence(D3D12Fence *fence)
     if (fence->event) {
         CloseHandle(fence->event);
     }
+    D3D12_INTERNAL_DestroyTimestampQueries(fence->timestamps);
     SDL_free(fence);
 }
 
@@ -3918,6 +4125,42 @@ static SDL_GPUTransferBuffer *D3D12_CreateTransferBuffer(
         debugName);
 }
 
+// Bindless Resources
+
+/* Unbounded descriptor heap ranges could back this, but bindless tables
+ * are only implemented for Vulkan so far.
+ */
+static bool D3D12_RegisterBindlessTexture(
+    SDL_GPURenderer *driverData,
+    SDL_GPUTexture *texture,
+    SDL_GPUSampler *sampler,
+    Uint32 *index)
+{
+    return SDL_Unsupported();
+}
+
+static bool D3D12_RegisterBindlessBuffer(
+    SDL_GPURenderer *driverData,
+    SDL_GPUBuffer *buffer,
+    Uint32 *index)
+{
+    return SDL_Unsupported();
+}
+
+static void D3D12_UnregisterBindlessTexture(
+    SDL_GPURenderer *driverData,
+    Uint32 index)
+{
+    // Nothing can be registered
+}
+
+static void D3D12_UnregisterBindlessBuffer(
+    SDL_GPURenderer *driverData,
+    Uint32 index)
+{
+    // Nothing can be registered
+}
+
 // Disposal
 
 static void D3D12_ReleaseTexture(
@@ -4259,6 +4502,16 @@ static D3D12Buffer *D3D12_INTERNAL_PrepareBufferForWrite(
     return container->activeBuffer;
 }
 
+static bool D3D12_PrepareRenderPass(
+    SDL_GPURenderer *driverData,
+    const SDL_GPUColorTargetInfo *colorTargetInfos,
+    Uint32 numColorTargets,
+    const SDL_GPUDepthStencilTargetInfo *depthStencilTargetInfo)
+{
+    // D3D12 binds render target views directly, there is nothing to create ahead of time
+    return true;
+}
+
 static void D3D12_BeginRenderPass(
     SDL_GPUCommandBuffer *commandBuffer,
     const SDL_GPUColorTargetInfo *colorTargetInfos,
@@ -5232,6 +5485,60 @@ static void D3D12_DrawIndexedPrimitivesIndirect(
     D3D12_INTERNAL_TrackBuffer(d3d12CommandBuffer, d3d12Buffer);
 }
 
+static void D3D12_DrawPrimitivesIndirectCount(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *countBuffer,
+    Uint32 countOffset,
+    Uint32 maxDrawCount)
+{
+    D3D12CommandBuffer *d3d12CommandBuffer = (D3D12CommandBuffer *)commandBuffer;
+    D3D12Buffer *d3d12Buffer = ((D3D12BufferContainer *)buffer)->activeBuffer;
+    D3D12Buffer *d3d12CountBuffer = ((D3D12BufferContainer *)countBuffer)->activeBuffer;
+
+    D3D12_INTERNAL_BindGraphicsResources(d3d12CommandBuffer);
+
+    ID3D12GraphicsCommandList_ExecuteIndirect(
+        d3d12CommandBuffer->graphicsCommandList,
+        d3d12CommandBuffer->renderer->indirectDrawCommandSignature,
+        maxDrawCount,
+        d3d12Buffer->handle,
+        offset,
+        d3d12CountBuffer->handle,
+        countOffset);
+
+    D3D12_INTERNAL_TrackBuffer(d3d12CommandBuffer, d3d12Buffer);
+    D3D12_INTERNAL_TrackBuffer(d3d12CommandBuffer, d3d12CountBuffer);
+}
+
+static void D3D12_DrawIndexedPrimitivesIndirectCount(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *countBuffer,
+    Uint32 countOffset,
+    Uint32 maxDrawCount)
+{
+    D3D12CommandBuffer *d3d12CommandBuffer = (D3D12CommandBuffer *)commandBuffer;
+    D3D12Buffer *d3d12Buffer = ((D3D12BufferContainer *)buffer)->activeBuffer;
+    D3D12Buffer *d3d12CountBuffer = ((D3D12BufferContainer *)countBuffer)->activeBuffer;
+
+    D3D12_INTERNAL_BindGraphicsResources(d3d12CommandBuffer);
+
+    ID3D12GraphicsCommandList_ExecuteIndirect(
+        d3d12CommandBuffer->graphicsCommandList,
+        d3d12CommandBuffer->renderer->indirectIndexedDrawCommandSignature,
+        maxDrawCount,
+        d3d12Buffer->handle,
+        offset,
+        d3d12CountBuffer->handle,
+        countOffset);
+
+    D3D12_INTERNAL_TrackBuffer(d3d12CommandBuffer, d3d12Buffer);
+    D3D12_INTERNAL_TrackBuffer(d3d12CommandBuffer, d3d12CountBuffer);
+}
+
 static void D3D12_EndRenderPass(
     SDL_GPUCommandBuffer *commandBuffer)
 {
@@ -7193,6 +7500,11 @@ static D3D12Fence *D3D12_INTERNAL_AcquireFence(
         fence = renderer->availableFences[renderer->availableFenceCount - 1];
         renderer->availableFenceCount -= 1;
         ID3D12Fence_Signal(fence->handle, D3D12_FENCE_UNSIGNALED_VALUE);
+
+        // Forget the timings of the previous submission
+        if (fence->timestamps) {
+            fence->timestamps->timestampCount = 0;
+        }
     }
 
     SDL_UnlockMutex(renderer->fenceLock);
@@ -7385,6 +7697,7 @@ static SDL_GPUCommandBuffer *D3D12_AcquireCommandBuffer(
     SDL_zeroa(commandBuffer->computeUniformBuffers);
 
     commandBuffer->autoReleaseFence = true;
+    commandBuffer->common.timestamps_enabled = false;
 
     return (SDL_GPUCommandBuffer *)commandBuffer;
 }
@@ -7836,6 +8149,18 @@ static bool D3D12_Submit(
             &barrierDesc);
     }
 
+    // Copy the recorded timestamps somewhere the CPU can read them
+    if (d3d12CommandBuffer->common.timestamps_enabled && d3d12CommandBuffer->timestamps->timestampCount > 0) {
+        ID3D12GraphicsCommandList_ResolveQueryData(
+            d3d12CommandBuffer->graphicsCommandList,
+            d3d12CommandBuffer->timestamps->queryHeap,
+            D3D12_QUERY_TYPE_TIMESTAMP,
+            0,
+            d3d12CommandBuffer->timestamps->timestampCount,
+            d3d12CommandBuffer->timestamps->readbackBuffer,
+            0);
+    }
+
     // Notify the command buffer that we have completed recording
     res = ID3D12GraphicsCommandList_Close(d3d12CommandBuffer->graphicsCommandList);
     CHECK_D3D12_ERROR_AND_RETURN("Failed to close command list!", false);
@@ -7864,6 +8189,15 @@ static bool D3D12_Submit(
         return false;
     }
 
+    /* The fence outlives the command buffer, so it takes the recorded queries
+     * and gives the command buffer its previous (completed) queries to reuse.
+     */
+    if (d3d12CommandBuffer->common.timestamps_enabled) {
+        D3D12TimestampQueries *timestamps = d3d12CommandBuffer->inFlightFence->timestamps;
+        d3d12CommandBuffer->inFlightFence->timestamps = d3d12CommandBuffer->timestamps;
+        d3d12CommandBuffer->timestamps = timestamps;
+    }
+
     // Mark that a fence should be signaled after command list execution
     res = ID3D12CommandQueue_Signal(
         renderer->commandQueue,
@@ -8881,6 +9215,15 @@ static SDL_GPUDevice *D3D12_CreateDevice(bool debugMode, bool preferLowPower, SD
     }
 #endif
 
+    // Xbox doesn't record adapter info, but the capabilities still need somewhere to go
+    if (!renderer->props) {
+        renderer->props = SDL_CreateProperties();
+    }
+    SDL_SetBooleanProperty(
+        renderer->props,
+        SDL_PROP_GPU_DEVICE_INDIRECT_DRAW_COUNT_BOOLEAN,
+        true);
+
     // Load the D3D library
     renderer->d3d12_dll = SDL_LoadObject(D3D12_DLL);
     if (renderer->d3d12_dll == NULL) {
@@ -9282,6 +9625,8 @@ static SDL_GPUDevice *D3D12_CreateDevice(bool debugMode, bool preferLowPower, SD
     ASSIGN_DRIVER(D3D12)
     result->driverData = (SDL_GPURenderer *)renderer;
     result->shader_formats = shaderFormats;
+    result->indirect_draw_count = true; // ExecuteIndirect always accepts a count buffer
+    result->compute_blit_shaders = NULL; // blits and mipmaps use render passes
     result->debug_mode = debugMode;
     renderer->sdlGPUDevice = result;
 
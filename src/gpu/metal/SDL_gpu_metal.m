@@ -1675,6 +1675,42 @@ static SDL_GPUTransferBuffer *METAL_CreateTransferBuffer(
     }
 }
 
+// Bindless Resources
+
+/* Argument buffers could back this, but bindless tables are only
+ * implemented for Vulkan so far.
+ */
+static bool METAL_RegisterBindlessTexture(
+    SDL_GPURenderer *driverData,
+    SDL_GPUTexture *texture,
+    SDL_GPUSampler *sampler,
+    Uint32 *index)
+{
+    return SDL_Unsupported();
+}
+
+static bool METAL_RegisterBindlessBuffer(
+    SDL_GPURenderer *driverData,
+    SDL_GPUBuffer *buffer,
+    Uint32 *index)
+{
+    return SDL_Unsupported();
+}
+
+static void METAL_UnregisterBindlessTexture(
+    SDL_GPURenderer *driverData,
+    Uint32 index)
+{
+    // Nothing can be registered
+}
+
+static void METAL_UnregisterBindlessBuffer(
+    SDL_GPURenderer *driverData,
+    Uint32 index)
+{
+    // Nothing can be registered
+}
+
 // This function assumes that it's called from within an autorelease pool
 static MetalUniformBuffer *METAL_INTERNAL_CreateUniformBuffer(
     MetalRenderer *renderer,
@@ -2256,6 +2292,16 @@ static void METAL_SetStencilReference(
     }
 }
 
+static bool METAL_PrepareRenderPass(
+    SDL_GPURenderer *driverData,
+    const SDL_GPUColorTargetInfo *colorTargetInfos,
+    Uint32 numColorTargets,
+    const SDL_GPUDepthStencilTargetInfo *depthStencilTargetInfo)
+{
+    // Metal render pass descriptors are cheap and built per pass, there is nothing to cache
+    return true;
+}
+
 static void METAL_BeginRenderPass(
     SDL_GPUCommandBuffer *commandBuffer,
     const SDL_GPUColorTargetInfo *colorTargetInfos,
@@ -2917,6 +2963,32 @@ static void METAL_DrawIndexedPrimitivesIndirect(
     }
 }
 
+/* Metal has no draw call that reads its count from a buffer, that would need
+ * an indirect command buffer encoded on the GPU. The device doesn't report
+ * SDL_PROP_GPU_DEVICE_INDIRECT_DRAW_COUNT_BOOLEAN, so these are never called.
+ */
+static void METAL_DrawPrimitivesIndirectCount(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *countBuffer,
+    Uint32 countOffset,
+    Uint32 maxDrawCount)
+{
+    SDL_Unsupported();
+}
+
+static void METAL_DrawIndexedPrimitivesIndirectCount(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *countBuffer,
+    Uint32 countOffset,
+    Uint32 maxDrawCount)
+{
+    SDL_Unsupported();
+}
+
 static void METAL_EndRenderPass(
     SDL_GPUCommandBuffer *commandBuffer)
 {
@@ -3383,6 +3455,49 @@ static void METAL_ReleaseFence(
     }
 }
 
+static void METAL_ReferenceFence(
+    SDL_GPURenderer *driverData,
+    SDL_GPUFence *fence)
+{
+    (void)SDL_AtomicIncRef(&((MetalFence *)fence)->referenceCount);
+}
+
+// Timing
+
+/* Per-pass timing would need MTLCounterSampleBuffer, which isn't available
+ * on every device we support, so timestamps aren't implemented here yet.
+ */
+static bool METAL_EnableTimestamps(
+    SDL_GPUCommandBuffer *commandBuffer)
+{
+    return SDL_Unsupported();
+}
+
+static void METAL_WriteTimestamp(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUPassType passType,
+    bool passEnd)
+{
+    // Never called, timestamps can't be enabled
+}
+
+static SDL_GPUPassTiming *METAL_GetPassTimings(
+    SDL_GPURenderer *driverData,
+    SDL_GPUFence *fence,
+    int *count)
+{
+    SDL_Unsupported();
+    return NULL;
+}
+
+static SDL_GPUMemoryStats *METAL_GetMemoryStats(
+    SDL_GPURenderer *driverData,
+    int *count)
+{
+    SDL_Unsupported();
+    return NULL;
+}
+
 // Cleanup
 
 static void METAL_INTERNAL_CleanCommandBuffer(
@@ -4306,7 +4421,8 @@ static bool METAL_PrepareDriver(SDL_VideoDevice *this, SDL_PropertiesID props)
     }
 
     if (@available(macOS 10.14, iOS 13.0, tvOS 13.0, *)) {
-        return (this->Metal_CreateView != NULL);
+        // this is NULL for headless devices, which don't need a view
+        return (this == NULL || this->Metal_CreateView != NULL);
     }
     return false;
 }
@@ -4607,6 +4723,8 @@ static SDL_GPUDevice *METAL_CreateDevice(bool debugMode, bool preferLowPower, SD
         ASSIGN_DRIVER(METAL)
         result->driverData = (SDL_GPURenderer *)renderer;
         result->shader_formats = SDL_GPU_SHADERFORMAT_MSL | SDL_GPU_SHADERFORMAT_METALLIB;
+        result->indirect_draw_count = false;
+        result->compute_blit_shaders = NULL; // blits and mipmaps use render passes
         renderer->sdlGPUDevice = result;
 
         return result;
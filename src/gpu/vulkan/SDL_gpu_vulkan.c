@@ -33,6 +33,15 @@
 
 #include "../SDL_sysgpu.h"
 
+// Compute blit kernels, regenerate with compile_shaders.sh
+#include "Vulkan_ComputeBlit.h"
+
+static const ComputeBlitShaders VULKAN_ComputeBlitShaders = {
+    SDL_GPU_SHADERFORMAT_SPIRV,
+    { BlitCompute2D_spv, BlitCompute2DArray_spv, BlitCompute3D_spv, MipChain2D_spv, MipChain2DArray_spv },
+    { sizeof(BlitCompute2D_spv), sizeof(BlitCompute2DArray_spv), sizeof(BlitCompute3D_spv), sizeof(MipChain2D_spv), sizeof(MipChain2DArray_spv) }
+};
+
 // Global Vulkan Loader Entry Points
 
 static PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr = NULL;
@@ -41,6 +50,82 @@ static PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr = NULL;
     static PFN_##name name = NULL;
 #include "SDL_gpu_vulkan_vkfuncs.h"
 
+/* Headless devices load the Vulkan loader themselves, the video subsystem
+ * may not be initialized and its loader would insist on surface extensions.
+ */
+static const char *headlessLoaderPaths[] = {
+#if defined(SDL_PLATFORM_WINDOWS)
+    "vulkan-1.dll"
+#elif defined(SDL_PLATFORM_APPLE)
+    "vulkan.framework/vulkan",
+    "libvulkan.1.dylib",
+    "libvulkan.dylib",
+    "MoltenVK.framework/MoltenVK",
+    "libMoltenVK.dylib"
+#elif defined(SDL_PLATFORM_OPENBSD)
+    "libvulkan.so"
+#else
+    "libvulkan.so.1"
+#endif
+};
+
+static SDL_SharedObject *headlessLoader = NULL;
+static PFN_vkGetInstanceProcAddr headlessGetInstanceProcAddr = NULL;
+static int headlessLoaderRefCount = 0;
+
+static bool VULKAN_INTERNAL_LoadLibrary(bool headless)
+{
+    if (!headless) {
+        return SDL_Vulkan_LoadLibrary(NULL);
+    }
+
+    if (headlessLoaderRefCount == 0) {
+        const char *path = SDL_GetHint(SDL_HINT_VULKAN_LIBRARY);
+
+        if (path != NULL) {
+            headlessLoader = SDL_LoadObject(path);
+        } else {
+            for (int i = 0; i < SDL_arraysize(headlessLoaderPaths) && headlessLoader == NULL; i += 1) {
+                headlessLoader = SDL_LoadObject(headlessLoaderPaths[i]);
+            }
+        }
+        if (headlessLoader == NULL) {
+            return false;
+        }
+
+#ifdef HAVE_GCC_DIAGNOSTIC_PRAGMA
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+        headlessGetInstanceProcAddr = (PFN_vkGetInstanceProcAddr)SDL_LoadFunction(headlessLoader, "vkGetInstanceProcAddr");
+#ifdef HAVE_GCC_DIAGNOSTIC_PRAGMA
+#pragma GCC diagnostic pop
+#endif
+        if (headlessGetInstanceProcAddr == NULL) {
+            SDL_UnloadObject(headlessLoader);
+            headlessLoader = NULL;
+            return false;
+        }
+    }
+
+    headlessLoaderRefCount += 1;
+    return true;
+}
+
+static void VULKAN_INTERNAL_UnloadLibrary(bool headless)
+{
+    if (!headless) {
+        SDL_Vulkan_UnloadLibrary();
+        return;
+    }
+
+    if (headlessLoaderRefCount > 0 && --headlessLoaderRefCount == 0) {
+        SDL_UnloadObject(headlessLoader);
+        headlessLoader = NULL;
+        headlessGetInstanceProcAddr = NULL;
+    }
+}
+
 typedef struct VulkanExtensions
 {
     // These extensions are required!
@@ -58,6 +143,11 @@ typedef struct VulkanExtensions
     Uint8 KHR_portability_subset;
     // Only required for decoding HDR ASTC textures
     Uint8 EXT_texture_compression_astc_hdr;
+    // Only required for the bindless table, core since 1.1 and 1.2
+    Uint8 KHR_maintenance3;
+    Uint8 EXT_descriptor_indexing;
+    // Only required for draw counts read from buffers, core since 1.2
+    Uint8 KHR_draw_indirect_count;
 } VulkanExtensions;
 
 // Defines
@@ -67,6 +157,8 @@ typedef struct VulkanExtensions
 #define LARGE_ALLOCATION_INCREMENT    67108864 // 64  MiB
 #define MAX_UBO_SECTION_SIZE          4096     // 4   KiB
 #define DESCRIPTOR_POOL_SIZE          128
+#define BINDLESS_TABLE_MAX_SIZE       16384
+#define BINDLESS_RESERVED_DESCRIPTORS 64 // per-stage limits also count the regular bindings
 #define WINDOW_PROPERTY_DATA          "SDL_GPUVulkanWindowPropertyData"
 
 #define IDENTITY_SWIZZLE               \
@@ -452,10 +544,18 @@ typedef struct VulkanUniformBuffer VulkanUniformBuffer;
 typedef struct VulkanTexture VulkanTexture;
 typedef struct VulkanTextureContainer VulkanTextureContainer;
 
+typedef struct VulkanTimestampQueries
+{
+    VkQueryPool queryPool;
+    Uint32 timestampCount;
+    SDL_GPUPassType passTypes[MAX_TIMESTAMP_PASSES];
+} VulkanTimestampQueries;
+
 typedef struct VulkanFenceHandle
 {
     VkFence fence;
     SDL_AtomicInt referenceCount;
+    VulkanTimestampQueries *timestamps; // results of the last submission using this fence, may be NULL
 } VulkanFenceHandle;
 
 // Memory Allocation
@@ -541,6 +641,7 @@ struct VulkanBuffer
     VkDeviceSize size;
 
     SDL_AtomicInt referenceCount;
+    SDL_AtomicInt bindlessCount; // defrag can't move buffers in the bindless table
     bool transitioned;
     bool markedForDestroy; // so that defrag doesn't double-free
     VulkanUniformBuffer *uniformBufferForDefrag;
@@ -621,6 +722,7 @@ struct VulkanTexture
 
     bool markedForDestroy; // so that defrag doesn't double-free
     SDL_AtomicInt referenceCount;
+    SDL_AtomicInt bindlessCount; // defrag can't move textures in the bindless table
 };
 
 struct VulkanTextureContainer
@@ -929,6 +1031,22 @@ typedef struct FramebufferHashTableKey
     Uint32 height;
 } FramebufferHashTableKey;
 
+// Bindless table
+
+typedef struct VulkanBindlessSlot
+{
+    VulkanTexture *texture; // NULL in buffer slots
+    VulkanSampler *sampler;
+    VulkanBuffer *buffer;   // NULL in texture slots
+    bool releasing;         // unregistered, waiting for the GPU to finish with it
+} VulkanBindlessSlot;
+
+typedef struct VulkanBindlessRelease
+{
+    bool isBuffer;
+    Uint32 index;
+} VulkanBindlessRelease;
+
 // Command structures
 
 typedef struct VulkanFencePool
@@ -1076,9 +1194,17 @@ typedef struct VulkanCommandBuffer
     Sint32 usedUniformBufferCount;
     Sint32 usedUniformBufferCapacity;
 
+    // Bindless slots unregistered before this submission, freed once it completes
+    VulkanBindlessRelease *bindlessReleases;
+    Uint32 bindlessReleaseCount;
+    Uint32 bindlessReleaseCapacity;
+
     VulkanFenceHandle *inFlightFence;
     bool autoReleaseFence;
 
+    // Handed over to the in-flight fence on submit when timestamps are enabled
+    VulkanTimestampQueries *timestamps;
+
     bool swapchainRequested;
     bool isDefrag; // Whether this CB was created for defragging
 } VulkanCommandBuffer;
@@ -1088,9 +1214,22 @@ struct VulkanCommandPool
     SDL_ThreadID threadID;
     VkCommandPool commandPool;
 
+    /* Only contended between the owning thread and whichever thread cleans up
+     * its submitted command buffers, never between two recording threads.
+     */
+    SDL_Mutex *lock;
+
     VulkanCommandBuffer **inactiveCommandBuffers;
     Uint32 inactiveCommandBufferCapacity;
     Uint32 inactiveCommandBufferCount;
+
+    VulkanUniformBuffer **uniformBufferPool;
+    Uint32 uniformBufferPoolCount;
+    Uint32 uniformBufferPoolCapacity;
+
+    DescriptorSetCache **descriptorSetCachePool;
+    Uint32 descriptorSetCachePoolCount;
+    Uint32 descriptorSetCachePoolCapacity;
 };
 
 // Context
@@ -1110,6 +1249,7 @@ struct VulkanRenderer
 
     bool debugMode;
     bool preferLowPower;
+    bool headless;
     SDL_PropertiesID props;
     Uint32 allowedFramesInFlight;
 
@@ -1119,6 +1259,7 @@ struct VulkanRenderer
     bool supportsPhysicalDeviceProperties2;
     bool supportsFillModeNonSolid;
     bool supportsMultiDrawIndirect;
+    bool supportsStorageImageWriteWithoutFormat;
 
     VulkanMemoryAllocator *memoryAllocator;
     VkPhysicalDeviceMemoryProperties memoryProperties;
@@ -1129,6 +1270,7 @@ struct VulkanRenderer
     Uint32 claimedWindowCapacity;
 
     Uint32 queueFamilyIndex;
+    Uint32 timestampValidBits;
     VkQueue unifiedQueue;
 
     VulkanCommandBuffer **submittedCommandBuffers;
@@ -1144,14 +1286,6 @@ struct VulkanRenderer
     SDL_HashTable *computePipelineResourceLayoutHashTable;
     SDL_HashTable *descriptorSetLayoutHashTable;
 
-    VulkanUniformBuffer **uniformBufferPool;
-    Uint32 uniformBufferPoolCount;
-    Uint32 uniformBufferPoolCapacity;
-
-    DescriptorSetCache **descriptorSetCachePool;
-    Uint32 descriptorSetCachePoolCount;
-    Uint32 descriptorSetCachePoolCapacity;
-
     SDL_AtomicInt layoutResourceID;
 
     Uint32 minUBOAlignment;
@@ -1189,8 +1323,6 @@ struct VulkanRenderer
     SDL_Mutex *allocatorLock;
     SDL_Mutex *disposeLock;
     SDL_Mutex *submitLock;
-    SDL_Mutex *acquireCommandBufferLock;
-    SDL_Mutex *acquireUniformBufferLock;
     SDL_Mutex *renderPassFetchLock;
     SDL_Mutex *framebufferFetchLock;
     SDL_Mutex *graphicsPipelineLayoutFetchLock;
@@ -1204,6 +1336,34 @@ struct VulkanRenderer
     Uint32 allocationsToDefragCount;
     Uint32 allocationsToDefragCapacity;
 
+    // Per-submission defrag limits, 0 means unlimited
+    VkDeviceSize defragBudgetBytes;
+    Uint64 defragBudgetNS;
+
+    // Bindless table, only created when requested and supported
+    bool bindlessRequested;
+    bool supportsBindless;
+    VkPhysicalDeviceDescriptorIndexingPropertiesEXT descriptorIndexingProperties;
+    VkDescriptorSetLayout bindlessSetLayout;
+    VkDescriptorPool bindlessPool;
+    VkDescriptorSet bindlessSet;
+    SDL_Mutex *bindlessLock;
+
+    VulkanBindlessSlot *bindlessTextures;
+    Uint32 bindlessTextureCapacity;
+    Uint32 *freeBindlessTextures;
+    Uint32 freeBindlessTextureCount;
+
+    VulkanBindlessSlot *bindlessBuffers;
+    Uint32 bindlessBufferCapacity;
+    Uint32 *freeBindlessBuffers;
+    Uint32 freeBindlessBufferCount;
+
+    // Handed to the next submitted command buffer
+    VulkanBindlessRelease *pendingBindlessReleases;
+    Uint32 pendingBindlessReleaseCount;
+    Uint32 pendingBindlessReleaseCapacity;
+
 #define VULKAN_INSTANCE_FUNCTION(func) \
     PFN_##func func;
 #define VULKAN_DEVICE_FUNCTION(func) \
@@ -1345,6 +1505,22 @@ static void VULKAN_INTERNAL_MakeMemoryUnavailable(
     }
 }
 
+static bool VULKAN_INTERNAL_AllocationHasBindlessRegions(
+    VulkanMemoryAllocation *allocation)
+{
+    for (Uint32 i = 0; i < allocation->usedRegionCount; i += 1) {
+        VulkanMemoryUsedRegion *region = allocation->usedRegions[i];
+        SDL_AtomicInt *bindlessCount = region->isBuffer ?
+            &region->vulkanBuffer->bindlessCount :
+            &region->vulkanTexture->bindlessCount;
+
+        if (SDL_GetAtomicInt(bindlessCount) > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
 static void VULKAN_INTERNAL_MarkAllocationsForDefrag(
     VulkanRenderer *renderer)
 {
@@ -1356,7 +1532,9 @@ static void VULKAN_INTERNAL_MarkAllocationsForDefrag(
 
         for (allocationIndex = 0; allocationIndex < currentAllocator->allocationCount; allocationIndex += 1) {
             if (currentAllocator->allocations[allocationIndex]->availableForAllocation == 1) {
-                if (currentAllocator->allocations[allocationIndex]->freeRegionCount > 1) {
+                // Allocations holding bindless resources can't be emptied, keep allocating from them
+                if (currentAllocator->allocations[allocationIndex]->freeRegionCount > 1 &&
+                    !VULKAN_INTERNAL_AllocationHasBindlessRegions(currentAllocator->allocations[allocationIndex])) {
                     EXPAND_ARRAY_IF_NEEDED(
                         renderer->allocationsToDefrag,
                         VulkanMemoryAllocation *,
@@ -3052,6 +3230,24 @@ static void VULKAN_INTERNAL_DestroyBuffer(
     SDL_free(buffer);
 }
 
+static void VULKAN_INTERNAL_DestroyDescriptorSetCache(
+    VulkanRenderer *renderer,
+    DescriptorSetCache *descriptorSetCache)
+{
+    for (Uint32 i = 0; i < descriptorSetCache->poolCount; i += 1) {
+        for (Uint32 j = 0; j < descriptorSetCache->pools[i].poolCount; j += 1) {
+            renderer->vkDestroyDescriptorPool(
+                renderer->logicalDevice,
+                descriptorSetCache->pools[i].descriptorPools[j],
+                NULL);
+        }
+        SDL_free(descriptorSetCache->pools[i].descriptorSets);
+        SDL_free(descriptorSetCache->pools[i].descriptorPools);
+    }
+    SDL_free(descriptorSetCache->pools);
+    SDL_free(descriptorSetCache);
+}
+
 static void VULKAN_INTERNAL_DestroyCommandPool(
     VulkanRenderer *renderer,
     VulkanCommandPool *commandPool)
@@ -3077,11 +3273,37 @@ static void VULKAN_INTERNAL_DestroyCommandPool(
         SDL_free(commandBuffer->usedComputePipelines);
         SDL_free(commandBuffer->usedFramebuffers);
         SDL_free(commandBuffer->usedUniformBuffers);
+        SDL_free(commandBuffer->bindlessReleases);
+
+        if (commandBuffer->timestamps) {
+            renderer->vkDestroyQueryPool(
+                renderer->logicalDevice,
+                commandBuffer->timestamps->queryPool,
+                NULL);
+            SDL_free(commandBuffer->timestamps);
+        }
 
         SDL_free(commandBuffer);
     }
 
     SDL_free(commandPool->inactiveCommandBuffers);
+
+    for (i = 0; i < commandPool->uniformBufferPoolCount; i += 1) {
+        VULKAN_INTERNAL_DestroyBuffer(
+            renderer,
+            commandPool->uniformBufferPool[i]->buffer);
+        SDL_free(commandPool->uniformBufferPool[i]);
+    }
+    SDL_free(commandPool->uniformBufferPool);
+
+    for (i = 0; i < commandPool->descriptorSetCachePoolCount; i += 1) {
+        VULKAN_INTERNAL_DestroyDescriptorSetCache(
+            renderer,
+            commandPool->descriptorSetCachePool[i]);
+    }
+    SDL_free(commandPool->descriptorSetCachePool);
+
+    SDL_DestroyMutex(commandPool->lock);
     SDL_free(commandPool);
 }
 
@@ -3258,24 +3480,6 @@ static void VULKAN_INTERNAL_DestroyComputePipelineResourceLayout(
     SDL_free(resourceLayout);
 }
 
-static void VULKAN_INTERNAL_DestroyDescriptorSetCache(
-    VulkanRenderer *renderer,
-    DescriptorSetCache *descriptorSetCache)
-{
-    for (Uint32 i = 0; i < descriptorSetCache->poolCount; i += 1) {
-        for (Uint32 j = 0; j < descriptorSetCache->pools[i].poolCount; j += 1) {
-            renderer->vkDestroyDescriptorPool(
-                renderer->logicalDevice,
-                descriptorSetCache->pools[i].descriptorPools[j],
-                NULL);
-        }
-        SDL_free(descriptorSetCache->pools[i].descriptorSets);
-        SDL_free(descriptorSetCache->pools[i].descriptorPools);
-    }
-    SDL_free(descriptorSetCache->pools);
-    SDL_free(descriptorSetCache);
-}
-
 // Hashtable functions
 
 static Uint32 SDLCALL VULKAN_INTERNAL_GraphicsPipelineResourceLayoutHashFunction(void *userdata, const void *key)
@@ -3874,7 +4078,8 @@ static VulkanGraphicsPipelineResourceLayout *VULKAN_INTERNAL_FetchGraphicsPipeli
     }
 
     VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo;
-    VkDescriptorSetLayout descriptorSetLayouts[4];
+    VkDescriptorSetLayout descriptorSetLayouts[5];
+    Uint32 descriptorSetLayoutCount = 4;
     VkResult vulkanResult;
 
     pipelineResourceLayout = SDL_calloc(1, sizeof(VulkanGraphicsPipelineResourceLayout));
@@ -3924,6 +4129,12 @@ static VulkanGraphicsPipelineResourceLayout *VULKAN_INTERNAL_FetchGraphicsPipeli
     descriptorSetLayouts[2] = pipelineResourceLayout->descriptorSetLayouts[2]->descriptorSetLayout;
     descriptorSetLayouts[3] = pipelineResourceLayout->descriptorSetLayouts[3]->descriptorSetLayout;
 
+    // Every pipeline on a bindless device can see the table
+    if (renderer->bindlessSetLayout != VK_NULL_HANDLE) {
+        descriptorSetLayouts[4] = renderer->bindlessSetLayout;
+        descriptorSetLayoutCount = 5;
+    }
+
     pipelineResourceLayout->vertexSamplerCount = vertexShader->numSamplers;
     pipelineResourceLayout->vertexStorageTextureCount = vertexShader->numStorageTextures;
     pipelineResourceLayout->vertexStorageBufferCount = vertexShader->numStorageBuffers;
@@ -3939,7 +4150,7 @@ static VulkanGraphicsPipelineResourceLayout *VULKAN_INTERNAL_FetchGraphicsPipeli
     pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     pipelineLayoutCreateInfo.pNext = NULL;
     pipelineLayoutCreateInfo.flags = 0;
-    pipelineLayoutCreateInfo.setLayoutCount = 4;
+    pipelineLayoutCreateInfo.setLayoutCount = descriptorSetLayoutCount;
     pipelineLayoutCreateInfo.pSetLayouts = descriptorSetLayouts;
     pipelineLayoutCreateInfo.pushConstantRangeCount = 0;
     pipelineLayoutCreateInfo.pPushConstantRanges = NULL;
@@ -3993,7 +4204,8 @@ static VulkanComputePipelineResourceLayout *VULKAN_INTERNAL_FetchComputePipeline
         return pipelineResourceLayout;
     }
 
-    VkDescriptorSetLayout descriptorSetLayouts[3];
+    VkDescriptorSetLayout descriptorSetLayouts[4];
+    Uint32 descriptorSetLayoutCount = 3;
     VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo;
     VkResult vulkanResult;
 
@@ -4033,6 +4245,11 @@ static VulkanComputePipelineResourceLayout *VULKAN_INTERNAL_FetchComputePipeline
     descriptorSetLayouts[1] = pipelineResourceLayout->descriptorSetLayouts[1]->descriptorSetLayout;
     descriptorSetLayouts[2] = pipelineResourceLayout->descriptorSetLayouts[2]->descriptorSetLayout;
 
+    if (renderer->bindlessSetLayout != VK_NULL_HANDLE) {
+        descriptorSetLayouts[3] = renderer->bindlessSetLayout;
+        descriptorSetLayoutCount = 4;
+    }
+
     pipelineResourceLayout->numSamplers = createinfo->num_samplers;
     pipelineResourceLayout->numReadonlyStorageTextures = createinfo->num_readonly_storage_textures;
     pipelineResourceLayout->numReadonlyStorageBuffers = createinfo->num_readonly_storage_buffers;
@@ -4045,7 +4262,7 @@ static VulkanComputePipelineResourceLayout *VULKAN_INTERNAL_FetchComputePipeline
     pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     pipelineLayoutCreateInfo.pNext = NULL;
     pipelineLayoutCreateInfo.flags = 0;
-    pipelineLayoutCreateInfo.setLayoutCount = 3;
+    pipelineLayoutCreateInfo.setLayoutCount = descriptorSetLayoutCount;
     pipelineLayoutCreateInfo.pSetLayouts = descriptorSetLayouts;
     pipelineLayoutCreateInfo.pushConstantRangeCount = 0;
     pipelineLayoutCreateInfo.pPushConstantRanges = NULL;
@@ -4872,6 +5089,83 @@ static bool VULKAN_INTERNAL_EndCommandBuffer(
     return true;
 }
 
+// Bindless table
+
+// Assumes that the bindless lock is held
+static void VULKAN_INTERNAL_FreeBindlessSlot(
+    VulkanRenderer *renderer,
+    const VulkanBindlessRelease *release)
+{
+    VulkanBindlessSlot *slot;
+
+    if (release->isBuffer) {
+        slot = &renderer->bindlessBuffers[release->index];
+        (void)SDL_AtomicDecRef(&slot->buffer->bindlessCount);
+        (void)SDL_AtomicDecRef(&slot->buffer->referenceCount);
+
+        renderer->freeBindlessBuffers[renderer->freeBindlessBufferCount] = release->index;
+        renderer->freeBindlessBufferCount += 1;
+    } else {
+        slot = &renderer->bindlessTextures[release->index];
+        (void)SDL_AtomicDecRef(&slot->texture->bindlessCount);
+        (void)SDL_AtomicDecRef(&slot->texture->referenceCount);
+        (void)SDL_AtomicDecRef(&slot->sampler->referenceCount);
+
+        renderer->freeBindlessTextures[renderer->freeBindlessTextureCount] = release->index;
+        renderer->freeBindlessTextureCount += 1;
+    }
+
+    SDL_zerop(slot);
+}
+
+// Drops the references of slots that are still registered so pending destroys can finish
+static void VULKAN_INTERNAL_DestroyBindlessTable(
+    VulkanRenderer *renderer)
+{
+    VulkanBindlessRelease release;
+
+    SDL_LockMutex(renderer->bindlessLock);
+
+    release.isBuffer = false;
+    for (Uint32 i = 0; i < renderer->bindlessTextureCapacity; i += 1) {
+        if (renderer->bindlessTextures[i].texture != NULL) {
+            release.index = i;
+            VULKAN_INTERNAL_FreeBindlessSlot(renderer, &release);
+        }
+    }
+
+    release.isBuffer = true;
+    for (Uint32 i = 0; i < renderer->bindlessBufferCapacity; i += 1) {
+        if (renderer->bindlessBuffers[i].buffer != NULL) {
+            release.index = i;
+            VULKAN_INTERNAL_FreeBindlessSlot(renderer, &release);
+        }
+    }
+
+    SDL_UnlockMutex(renderer->bindlessLock);
+
+    // Frees the table's descriptor set as well
+    renderer->vkDestroyDescriptorPool(
+        renderer->logicalDevice,
+        renderer->bindlessPool,
+        NULL);
+    renderer->vkDestroyDescriptorSetLayout(
+        renderer->logicalDevice,
+        renderer->bindlessSetLayout,
+        NULL);
+
+    SDL_free(renderer->bindlessTextures);
+    SDL_free(renderer->freeBindlessTextures);
+    SDL_free(renderer->bindlessBuffers);
+    SDL_free(renderer->freeBindlessBuffers);
+    SDL_free(renderer->pendingBindlessReleases);
+    SDL_DestroyMutex(renderer->bindlessLock);
+
+    renderer->bindlessPool = VK_NULL_HANDLE;
+    renderer->bindlessSetLayout = VK_NULL_HANDLE;
+    renderer->bindlessSet = VK_NULL_HANDLE;
+}
+
 static void VULKAN_DestroyDevice(
     SDL_GPUDevice *device)
 {
@@ -4880,6 +5174,10 @@ static void VULKAN_DestroyDevice(
 
     VULKAN_Wait(device->driverData);
 
+    if (renderer->bindlessSet != VK_NULL_HANDLE) {
+        VULKAN_INTERNAL_DestroyBindlessTable(renderer);
+    }
+
     for (Sint32 i = renderer->claimedWindowCount - 1; i >= 0; i -= 1) {
         VULKAN_ReleaseWindow(device->driverData, renderer->claimedWindows[i]->window);
     }
@@ -4890,27 +5188,20 @@ static void VULKAN_DestroyDevice(
 
     SDL_free(renderer->submittedCommandBuffers);
 
-    for (Uint32 i = 0; i < renderer->uniformBufferPoolCount; i += 1) {
-        VULKAN_INTERNAL_DestroyBuffer(
-            renderer,
-            renderer->uniformBufferPool[i]->buffer);
-        SDL_free(renderer->uniformBufferPool[i]);
-    }
-    SDL_free(renderer->uniformBufferPool);
-
-    for (Uint32 i = 0; i < renderer->descriptorSetCachePoolCount; i += 1) {
-        VULKAN_INTERNAL_DestroyDescriptorSetCache(
-            renderer,
-            renderer->descriptorSetCachePool[i]);
-    }
-    SDL_free(renderer->descriptorSetCachePool);
-
     for (Uint32 i = 0; i < renderer->fencePool.availableFenceCount; i += 1) {
         renderer->vkDestroyFence(
             renderer->logicalDevice,
             renderer->fencePool.availableFences[i]->fence,
             NULL);
 
+        if (renderer->fencePool.availableFences[i]->timestamps) {
+            renderer->vkDestroyQueryPool(
+                renderer->logicalDevice,
+                renderer->fencePool.availableFences[i]->timestamps->queryPool,
+                NULL);
+            SDL_free(renderer->fencePool.availableFences[i]->timestamps);
+        }
+
         SDL_free(renderer->fencePool.availableFences[i]);
     }
 
@@ -4961,8 +5252,6 @@ static void VULKAN_DestroyDevice(
     SDL_DestroyMutex(renderer->allocatorLock);
     SDL_DestroyMutex(renderer->disposeLock);
     SDL_DestroyMutex(renderer->submitLock);
-    SDL_DestroyMutex(renderer->acquireCommandBufferLock);
-    SDL_DestroyMutex(renderer->acquireUniformBufferLock);
     SDL_DestroyMutex(renderer->renderPassFetchLock);
     SDL_DestroyMutex(renderer->framebufferFetchLock);
     SDL_DestroyMutex(renderer->graphicsPipelineLayoutFetchLock);
@@ -4975,9 +5264,10 @@ static void VULKAN_DestroyDevice(
 
     SDL_DestroyProperties(renderer->props);
 
+    bool headless = renderer->headless;
     SDL_free(renderer);
     SDL_free(device);
-    SDL_Vulkan_UnloadLibrary();
+    VULKAN_INTERNAL_UnloadLibrary(headless);
 }
 
 static SDL_PropertiesID VULKAN_GetDeviceProperties(
@@ -4988,35 +5278,35 @@ static SDL_PropertiesID VULKAN_GetDeviceProperties(
 }
 
 static DescriptorSetCache *VULKAN_INTERNAL_AcquireDescriptorSetCache(
-    VulkanRenderer *renderer)
+    VulkanCommandPool *commandPool)
 {
     DescriptorSetCache *cache;
 
-    if (renderer->descriptorSetCachePoolCount == 0) {
+    if (commandPool->descriptorSetCachePoolCount == 0) {
         cache = SDL_malloc(sizeof(DescriptorSetCache));
         cache->poolCount = 0;
         cache->pools = NULL;
     } else {
-        cache = renderer->descriptorSetCachePool[renderer->descriptorSetCachePoolCount - 1];
-        renderer->descriptorSetCachePoolCount -= 1;
+        cache = commandPool->descriptorSetCachePool[commandPool->descriptorSetCachePoolCount - 1];
+        commandPool->descriptorSetCachePoolCount -= 1;
     }
 
     return cache;
 }
 
 static void VULKAN_INTERNAL_ReturnDescriptorSetCacheToPool(
-    VulkanRenderer *renderer,
+    VulkanCommandPool *commandPool,
     DescriptorSetCache *descriptorSetCache)
 {
     EXPAND_ARRAY_IF_NEEDED(
-        renderer->descriptorSetCachePool,
+        commandPool->descriptorSetCachePool,
         DescriptorSetCache *,
-        renderer->descriptorSetCachePoolCount + 1,
-        renderer->descriptorSetCachePoolCapacity,
-        renderer->descriptorSetCachePoolCapacity * 2);
+        commandPool->descriptorSetCachePoolCount + 1,
+        commandPool->descriptorSetCachePoolCapacity,
+        commandPool->descriptorSetCachePoolCapacity * 2);
 
-    renderer->descriptorSetCachePool[renderer->descriptorSetCachePoolCount] = descriptorSetCache;
-    renderer->descriptorSetCachePoolCount += 1;
+    commandPool->descriptorSetCachePool[commandPool->descriptorSetCachePoolCount] = descriptorSetCache;
+    commandPool->descriptorSetCachePoolCount += 1;
 
     for (Uint32 i = 0; i < descriptorSetCache->poolCount; i += 1) {
         descriptorSetCache->pools[i].descriptorSetIndex = 0;
@@ -5484,6 +5774,62 @@ static void VULKAN_DrawIndexedPrimitivesIndirect(
     VULKAN_INTERNAL_TrackBuffer(vulkanCommandBuffer, vulkanBuffer);
 }
 
+static void VULKAN_DrawPrimitivesIndirectCount(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *countBuffer,
+    Uint32 countOffset,
+    Uint32 maxDrawCount)
+{
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer *)commandBuffer;
+    VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
+    VulkanBuffer *vulkanBuffer = ((VulkanBufferContainer *)buffer)->activeBuffer;
+    VulkanBuffer *vulkanCountBuffer = ((VulkanBufferContainer *)countBuffer)->activeBuffer;
+
+    VULKAN_INTERNAL_BindGraphicsDescriptorSets(renderer, vulkanCommandBuffer);
+
+    renderer->vkCmdDrawIndirectCountKHR(
+        vulkanCommandBuffer->commandBuffer,
+        vulkanBuffer->buffer,
+        offset,
+        vulkanCountBuffer->buffer,
+        countOffset,
+        maxDrawCount,
+        sizeof(SDL_GPUIndirectDrawCommand));
+
+    VULKAN_INTERNAL_TrackBuffer(vulkanCommandBuffer, vulkanBuffer);
+    VULKAN_INTERNAL_TrackBuffer(vulkanCommandBuffer, vulkanCountBuffer);
+}
+
+static void VULKAN_DrawIndexedPrimitivesIndirectCount(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUBuffer *buffer,
+    Uint32 offset,
+    SDL_GPUBuffer *countBuffer,
+    Uint32 countOffset,
+    Uint32 maxDrawCount)
+{
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer *)commandBuffer;
+    VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
+    VulkanBuffer *vulkanBuffer = ((VulkanBufferContainer *)buffer)->activeBuffer;
+    VulkanBuffer *vulkanCountBuffer = ((VulkanBufferContainer *)countBuffer)->activeBuffer;
+
+    VULKAN_INTERNAL_BindGraphicsDescriptorSets(renderer, vulkanCommandBuffer);
+
+    renderer->vkCmdDrawIndexedIndirectCountKHR(
+        vulkanCommandBuffer->commandBuffer,
+        vulkanBuffer->buffer,
+        offset,
+        vulkanCountBuffer->buffer,
+        countOffset,
+        maxDrawCount,
+        sizeof(SDL_GPUIndexedIndirectDrawCommand));
+
+    VULKAN_INTERNAL_TrackBuffer(vulkanCommandBuffer, vulkanBuffer);
+    VULKAN_INTERNAL_TrackBuffer(vulkanCommandBuffer, vulkanCountBuffer);
+}
+
 // Debug Naming
 
 static void VULKAN_INTERNAL_SetBufferName(
@@ -5937,16 +6283,19 @@ static void VULKAN_INTERNAL_CycleActiveTexture(
     }
 
     // No texture is available, generate a new one.
+    // Without a command buffer the texture submits its own layout transition.
     texture = VULKAN_INTERNAL_CreateTexture(
         renderer,
-        false,
+        commandBuffer == NULL,
         &container->header.info);
 
-    VULKAN_INTERNAL_TextureTransitionToDefaultUsage(
-        renderer,
-        commandBuffer,
-        VULKAN_TEXTURE_USAGE_MODE_UNINITIALIZED,
-        texture);
+    if (commandBuffer != NULL) {
+        VULKAN_INTERNAL_TextureTransitionToDefaultUsage(
+            renderer,
+            commandBuffer,
+            VULKAN_TEXTURE_USAGE_MODE_UNINITIALIZED,
+            texture);
+    }
 
     if (!texture) {
         return;
@@ -6927,29 +7276,235 @@ static SDL_GPUTransferBuffer *VULKAN_CreateTransferBuffer(
         debugName);
 }
 
-static void VULKAN_INTERNAL_ReleaseTexture(
-    VulkanRenderer *renderer,
-    VulkanTexture *vulkanTexture)
+// Bindless Resources
+
+static bool VULKAN_RegisterBindlessTexture(
+    SDL_GPURenderer *driverData,
+    SDL_GPUTexture *texture,
+    SDL_GPUSampler *sampler,
+    Uint32 *index)
 {
-    if (vulkanTexture->markedForDestroy) {
-        return;
-    }
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+    VulkanTextureContainer *container = (VulkanTextureContainer *)texture;
+    VulkanSampler *vulkanSampler = (VulkanSampler *)sampler;
+    VulkanTexture *vulkanTexture;
+    VulkanBindlessSlot *slot;
+    VkDescriptorImageInfo imageInfo;
+    VkWriteDescriptorSet writeDescriptorSet;
+    Uint32 slotIndex;
 
-    SDL_LockMutex(renderer->disposeLock);
+    if (renderer->bindlessSet == VK_NULL_HANDLE) {
+        SET_STRING_ERROR_AND_RETURN("This device doesn't have a bindless table", false);
+    }
 
-    EXPAND_ARRAY_IF_NEEDED(
-        renderer->texturesToDestroy,
-        VulkanTexture *,
-        renderer->texturesToDestroyCount + 1,
-        renderer->texturesToDestroyCapacity,
-        renderer->texturesToDestroyCapacity * 2);
+    // Defrag swaps the active texture while submitting, so pin it under the submit lock
+    SDL_LockMutex(renderer->submitLock);
+    SDL_LockMutex(renderer->bindlessLock);
 
-    renderer->texturesToDestroy[renderer->texturesToDestroyCount] = vulkanTexture;
-    renderer->texturesToDestroyCount += 1;
+    if (renderer->freeBindlessTextureCount == 0) {
+        SDL_UnlockMutex(renderer->bindlessLock);
+        SDL_UnlockMutex(renderer->submitLock);
+        SET_STRING_ERROR_AND_RETURN("The bindless texture table is full", false);
+    }
+
+    renderer->freeBindlessTextureCount -= 1;
+    slotIndex = renderer->freeBindlessTextures[renderer->freeBindlessTextureCount];
+
+    vulkanTexture = container->activeTexture;
+    (void)SDL_AtomicIncRef(&vulkanTexture->bindlessCount);
+    (void)SDL_AtomicIncRef(&vulkanTexture->referenceCount);
+    (void)SDL_AtomicIncRef(&vulkanSampler->referenceCount);
+
+    slot = &renderer->bindlessTextures[slotIndex];
+    slot->texture = vulkanTexture;
+    slot->sampler = vulkanSampler;
+    slot->releasing = false;
+
+    imageInfo.sampler = vulkanSampler->sampler;
+    imageInfo.imageView = vulkanTexture->fullView;
+    imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+    writeDescriptorSet.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writeDescriptorSet.pNext = NULL;
+    writeDescriptorSet.dstSet = renderer->bindlessSet;
+    writeDescriptorSet.dstBinding = 0;
+    writeDescriptorSet.dstArrayElement = slotIndex;
+    writeDescriptorSet.descriptorCount = 1;
+    writeDescriptorSet.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    writeDescriptorSet.pImageInfo = &imageInfo;
+    writeDescriptorSet.pBufferInfo = NULL;
+    writeDescriptorSet.pTexelBufferView = NULL;
+
+    // The slot is unused, so this is fine even while command buffers using the table are in flight
+    renderer->vkUpdateDescriptorSets(
+        renderer->logicalDevice,
+        1,
+        &writeDescriptorSet,
+        0,
+        NULL);
 
-    vulkanTexture->markedForDestroy = true;
+    SDL_UnlockMutex(renderer->bindlessLock);
+    SDL_UnlockMutex(renderer->submitLock);
 
-    SDL_UnlockMutex(renderer->disposeLock);
+    *index = slotIndex;
+    return true;
+}
+
+static bool VULKAN_RegisterBindlessBuffer(
+    SDL_GPURenderer *driverData,
+    SDL_GPUBuffer *buffer,
+    Uint32 *index)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+    VulkanBufferContainer *container = (VulkanBufferContainer *)buffer;
+    VulkanBuffer *vulkanBuffer;
+    VulkanBindlessSlot *slot;
+    VkDescriptorBufferInfo bufferInfo;
+    VkWriteDescriptorSet writeDescriptorSet;
+    Uint32 slotIndex;
+
+    if (renderer->bindlessSet == VK_NULL_HANDLE) {
+        SET_STRING_ERROR_AND_RETURN("This device doesn't have a bindless table", false);
+    }
+
+    // Buffers are barriered for their default usage, so that has to be a storage read
+    if (VULKAN_INTERNAL_DefaultBufferUsageMode(container->activeBuffer) != VULKAN_BUFFER_USAGE_MODE_GRAPHICS_STORAGE_READ &&
+        VULKAN_INTERNAL_DefaultBufferUsageMode(container->activeBuffer) != VULKAN_BUFFER_USAGE_MODE_COMPUTE_STORAGE_READ) {
+        SET_STRING_ERROR_AND_RETURN("Bindless buffers need storage read usage and no vertex, index or indirect usage", false);
+    }
+
+    SDL_LockMutex(renderer->submitLock);
+    SDL_LockMutex(renderer->bindlessLock);
+
+    if (renderer->freeBindlessBufferCount == 0) {
+        SDL_UnlockMutex(renderer->bindlessLock);
+        SDL_UnlockMutex(renderer->submitLock);
+        SET_STRING_ERROR_AND_RETURN("The bindless buffer table is full", false);
+    }
+
+    renderer->freeBindlessBufferCount -= 1;
+    slotIndex = renderer->freeBindlessBuffers[renderer->freeBindlessBufferCount];
+
+    vulkanBuffer = container->activeBuffer;
+    (void)SDL_AtomicIncRef(&vulkanBuffer->bindlessCount);
+    (void)SDL_AtomicIncRef(&vulkanBuffer->referenceCount);
+
+    slot = &renderer->bindlessBuffers[slotIndex];
+    slot->buffer = vulkanBuffer;
+    slot->releasing = false;
+
+    bufferInfo.buffer = vulkanBuffer->buffer;
+    bufferInfo.offset = 0;
+    bufferInfo.range = VK_WHOLE_SIZE;
+
+    writeDescriptorSet.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writeDescriptorSet.pNext = NULL;
+    writeDescriptorSet.dstSet = renderer->bindlessSet;
+    writeDescriptorSet.dstBinding = 1;
+    writeDescriptorSet.dstArrayElement = slotIndex;
+    writeDescriptorSet.descriptorCount = 1;
+    writeDescriptorSet.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    writeDescriptorSet.pImageInfo = NULL;
+    writeDescriptorSet.pBufferInfo = &bufferInfo;
+    writeDescriptorSet.pTexelBufferView = NULL;
+
+    renderer->vkUpdateDescriptorSets(
+        renderer->logicalDevice,
+        1,
+        &writeDescriptorSet,
+        0,
+        NULL);
+
+    SDL_UnlockMutex(renderer->bindlessLock);
+    SDL_UnlockMutex(renderer->submitLock);
+
+    *index = slotIndex;
+    return true;
+}
+
+// The slot is freed when the next submitted command buffer completes, see VULKAN_Submit
+static void VULKAN_INTERNAL_UnregisterBindlessSlot(
+    VulkanRenderer *renderer,
+    bool isBuffer,
+    Uint32 index)
+{
+    VulkanBindlessSlot *slot;
+
+    if (renderer->bindlessSet == VK_NULL_HANDLE) {
+        return;
+    }
+
+    if (index >= (isBuffer ? renderer->bindlessBufferCapacity : renderer->bindlessTextureCapacity)) {
+        SDL_SetError("Bindless %s index %" SDL_PRIu32 " is out of range", isBuffer ? "buffer" : "texture", index);
+        return;
+    }
+
+    SDL_LockMutex(renderer->bindlessLock);
+
+    slot = isBuffer ? &renderer->bindlessBuffers[index] : &renderer->bindlessTextures[index];
+    if ((isBuffer ? slot->buffer == NULL : slot->texture == NULL) || slot->releasing) {
+        SDL_UnlockMutex(renderer->bindlessLock);
+        return;
+    }
+    slot->releasing = true;
+
+    EXPAND_ARRAY_IF_NEEDED(
+        renderer->pendingBindlessReleases,
+        VulkanBindlessRelease,
+        renderer->pendingBindlessReleaseCount + 1,
+        renderer->pendingBindlessReleaseCapacity,
+        SDL_max(16, renderer->pendingBindlessReleaseCapacity * 2));
+
+    renderer->pendingBindlessReleases[renderer->pendingBindlessReleaseCount].isBuffer = isBuffer;
+    renderer->pendingBindlessReleases[renderer->pendingBindlessReleaseCount].index = index;
+    renderer->pendingBindlessReleaseCount += 1;
+
+    SDL_UnlockMutex(renderer->bindlessLock);
+}
+
+static void VULKAN_UnregisterBindlessTexture(
+    SDL_GPURenderer *driverData,
+    Uint32 index)
+{
+    VULKAN_INTERNAL_UnregisterBindlessSlot(
+        (VulkanRenderer *)driverData,
+        false,
+        index);
+}
+
+static void VULKAN_UnregisterBindlessBuffer(
+    SDL_GPURenderer *driverData,
+    Uint32 index)
+{
+    VULKAN_INTERNAL_UnregisterBindlessSlot(
+        (VulkanRenderer *)driverData,
+        true,
+        index);
+}
+
+static void VULKAN_INTERNAL_ReleaseTexture(
+    VulkanRenderer *renderer,
+    VulkanTexture *vulkanTexture)
+{
+    if (vulkanTexture->markedForDestroy) {
+        return;
+    }
+
+    SDL_LockMutex(renderer->disposeLock);
+
+    EXPAND_ARRAY_IF_NEEDED(
+        renderer->texturesToDestroy,
+        VulkanTexture *,
+        renderer->texturesToDestroyCount + 1,
+        renderer->texturesToDestroyCapacity,
+        renderer->texturesToDestroyCapacity * 2);
+
+    renderer->texturesToDestroy[renderer->texturesToDestroyCount] = vulkanTexture;
+    renderer->texturesToDestroyCount += 1;
+
+    vulkanTexture->markedForDestroy = true;
+
+    SDL_UnlockMutex(renderer->disposeLock);
 }
 
 static void VULKAN_ReleaseTexture(
@@ -7648,39 +8203,42 @@ static VulkanUniformBuffer *VULKAN_INTERNAL_AcquireUniformBufferFromPool(
     VulkanCommandBuffer *commandBuffer)
 {
     VulkanRenderer *renderer = commandBuffer->renderer;
-    VulkanUniformBuffer *uniformBuffer;
+    VulkanCommandPool *commandPool = commandBuffer->commandPool;
+    VulkanUniformBuffer *uniformBuffer = NULL;
 
-    SDL_LockMutex(renderer->acquireUniformBufferLock);
+    SDL_LockMutex(commandPool->lock);
 
-    if (renderer->uniformBufferPoolCount > 0) {
-        uniformBuffer = renderer->uniformBufferPool[renderer->uniformBufferPoolCount - 1];
-        renderer->uniformBufferPoolCount -= 1;
-    } else {
+    if (commandPool->uniformBufferPoolCount > 0) {
+        uniformBuffer = commandPool->uniformBufferPool[commandPool->uniformBufferPoolCount - 1];
+        commandPool->uniformBufferPoolCount -= 1;
+    }
+
+    SDL_UnlockMutex(commandPool->lock);
+
+    if (uniformBuffer == NULL) {
         uniformBuffer = VULKAN_INTERNAL_CreateUniformBuffer(
             renderer,
             UNIFORM_BUFFER_SIZE);
     }
 
-    SDL_UnlockMutex(renderer->acquireUniformBufferLock);
-
     VULKAN_INTERNAL_TrackUniformBuffer(commandBuffer, uniformBuffer);
 
     return uniformBuffer;
 }
 
 static void VULKAN_INTERNAL_ReturnUniformBufferToPool(
-    VulkanRenderer *renderer,
+    VulkanCommandPool *commandPool,
     VulkanUniformBuffer *uniformBuffer)
 {
-    if (renderer->uniformBufferPoolCount >= renderer->uniformBufferPoolCapacity) {
-        renderer->uniformBufferPoolCapacity *= 2;
-        renderer->uniformBufferPool = SDL_realloc(
-            renderer->uniformBufferPool,
-            renderer->uniformBufferPoolCapacity * sizeof(VulkanUniformBuffer *));
-    }
+    EXPAND_ARRAY_IF_NEEDED(
+        commandPool->uniformBufferPool,
+        VulkanUniformBuffer *,
+        commandPool->uniformBufferPoolCount + 1,
+        commandPool->uniformBufferPoolCapacity,
+        commandPool->uniformBufferPoolCapacity * 2);
 
-    renderer->uniformBufferPool[renderer->uniformBufferPoolCount] = uniformBuffer;
-    renderer->uniformBufferPoolCount += 1;
+    commandPool->uniformBufferPool[commandPool->uniformBufferPoolCount] = uniformBuffer;
+    commandPool->uniformBufferPoolCount += 1;
 
     uniformBuffer->writeOffset = 0;
     uniformBuffer->drawOffset = 0;
@@ -7771,6 +8329,90 @@ static void VULKAN_INTERNAL_PushUniformData(
     }
 }
 
+static void VULKAN_INTERNAL_PrepareCycle(
+    VulkanRenderer *renderer,
+    VulkanTextureContainer *textureContainer,
+    bool cycle)
+{
+    // Same condition as VULKAN_INTERNAL_PrepareTextureSubresourceForWrite
+    if (
+        cycle &&
+        textureContainer->canBeCycled &&
+        SDL_GetAtomicInt(&textureContainer->activeTexture->referenceCount) > 0) {
+        VULKAN_INTERNAL_CycleActiveTexture(
+            renderer,
+            NULL,
+            textureContainer);
+    }
+}
+
+static bool VULKAN_PrepareRenderPass(
+    SDL_GPURenderer *driverData,
+    const SDL_GPUColorTargetInfo *colorTargetInfos,
+    Uint32 numColorTargets,
+    const SDL_GPUDepthStencilTargetInfo *depthStencilTargetInfo)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+    VkRenderPass renderPass;
+    Uint32 framebufferWidth = SDL_MAX_UINT32;
+    Uint32 framebufferHeight = SDL_MAX_UINT32;
+    Uint32 i;
+
+    /* Framebuffers are keyed on the active textures' views. Cycle busy targets
+     * now, as VULKAN_BeginRenderPass would, so the pass finds the framebuffer
+     * for the texture it actually writes. */
+    for (i = 0; i < numColorTargets; i += 1) {
+        VULKAN_INTERNAL_PrepareCycle(
+            renderer,
+            (VulkanTextureContainer *)colorTargetInfos[i].texture,
+            colorTargetInfos[i].cycle);
+        if (colorTargetInfos[i].store_op == SDL_GPU_STOREOP_RESOLVE || colorTargetInfos[i].store_op == SDL_GPU_STOREOP_RESOLVE_AND_STORE) {
+            VULKAN_INTERNAL_PrepareCycle(
+                renderer,
+                (VulkanTextureContainer *)colorTargetInfos[i].resolve_texture,
+                colorTargetInfos[i].cycle_resolve_texture);
+        }
+    }
+    if (depthStencilTargetInfo != NULL) {
+        VULKAN_INTERNAL_PrepareCycle(
+            renderer,
+            (VulkanTextureContainer *)depthStencilTargetInfo->texture,
+            depthStencilTargetInfo->cycle);
+    }
+
+    // Same sizing as VULKAN_BeginRenderPass, so the cached framebuffer matches
+    for (i = 0; i < numColorTargets; i += 1) {
+        VulkanTextureContainer *textureContainer = (VulkanTextureContainer *)colorTargetInfos[i].texture;
+        framebufferWidth = SDL_min(framebufferWidth, textureContainer->header.info.width >> colorTargetInfos[i].mip_level);
+        framebufferHeight = SDL_min(framebufferHeight, textureContainer->header.info.height >> colorTargetInfos[i].mip_level);
+    }
+
+    if (depthStencilTargetInfo != NULL) {
+        VulkanTextureContainer *textureContainer = (VulkanTextureContainer *)depthStencilTargetInfo->texture;
+        framebufferWidth = SDL_min(framebufferWidth, textureContainer->header.info.width >> depthStencilTargetInfo->mip_level);
+        framebufferHeight = SDL_min(framebufferHeight, textureContainer->header.info.height >> depthStencilTargetInfo->mip_level);
+    }
+
+    renderPass = VULKAN_INTERNAL_FetchRenderPass(
+        renderer,
+        colorTargetInfos,
+        numColorTargets,
+        depthStencilTargetInfo);
+
+    if (renderPass == VK_NULL_HANDLE) {
+        return false;
+    }
+
+    return VULKAN_INTERNAL_FetchFramebuffer(
+               renderer,
+               renderPass,
+               colorTargetInfos,
+               numColorTargets,
+               depthStencilTargetInfo,
+               framebufferWidth,
+               framebufferHeight) != NULL;
+}
+
 static void VULKAN_BeginRenderPass(
     SDL_GPUCommandBuffer *commandBuffer,
     const SDL_GPUColorTargetInfo *colorTargetInfos,
@@ -8001,6 +8643,19 @@ static void VULKAN_BindGraphicsPipeline(
 
     VULKAN_INTERNAL_TrackGraphicsPipeline(vulkanCommandBuffer, pipeline);
 
+    // The bindless table never changes binding, so it's bound once per pipeline instead of per draw
+    if (renderer->bindlessSet != VK_NULL_HANDLE) {
+        renderer->vkCmdBindDescriptorSets(
+            vulkanCommandBuffer->commandBuffer,
+            VK_PIPELINE_BIND_POINT_GRAPHICS,
+            pipeline->resourceLayout->pipelineLayout,
+            4,
+            1,
+            &renderer->bindlessSet,
+            0,
+            NULL);
+    }
+
     // Acquire uniform buffers if necessary
     for (Uint32 i = 0; i < pipeline->resourceLayout->vertexUniformBufferCount; i += 1) {
         if (vulkanCommandBuffer->vertexUniformBuffers[i] == NULL) {
@@ -8231,6 +8886,18 @@ static void VULKAN_BindComputePipeline(
 
     VULKAN_INTERNAL_TrackComputePipeline(vulkanCommandBuffer, vulkanComputePipeline);
 
+    if (renderer->bindlessSet != VK_NULL_HANDLE) {
+        renderer->vkCmdBindDescriptorSets(
+            vulkanCommandBuffer->commandBuffer,
+            VK_PIPELINE_BIND_POINT_COMPUTE,
+            vulkanComputePipeline->resourceLayout->pipelineLayout,
+            3,
+            1,
+            &renderer->bindlessSet,
+            0,
+            NULL);
+    }
+
     // Acquire uniform buffers if necessary
     for (Uint32 i = 0; i < vulkanComputePipeline->resourceLayout->numUniformBuffers; i += 1) {
         if (vulkanCommandBuffer->computeUniformBuffers[i] == NULL) {
@@ -9330,6 +9997,7 @@ static bool VULKAN_INTERNAL_AllocateCommandBuffer(
     commandBuffer->commandBuffer = commandBufferHandle;
 
     commandBuffer->inFlightFence = VK_NULL_HANDLE;
+    commandBuffer->timestamps = NULL;
 
     // Presentation tracking
 
@@ -9409,6 +10077,10 @@ static bool VULKAN_INTERNAL_AllocateCommandBuffer(
     commandBuffer->usedUniformBuffers = SDL_malloc(
         commandBuffer->usedUniformBufferCapacity * sizeof(VulkanUniformBuffer *));
 
+    commandBuffer->bindlessReleaseCapacity = 0;
+    commandBuffer->bindlessReleaseCount = 0;
+    commandBuffer->bindlessReleases = NULL;
+
     commandBuffer->swapchainRequested = false;
 
     // Pool it!
@@ -9458,11 +10130,22 @@ static VulkanCommandPool *VULKAN_INTERNAL_FetchCommandPool(
     }
 
     vulkanCommandPool->threadID = threadID;
+    vulkanCommandPool->lock = SDL_CreateMutex();
 
     vulkanCommandPool->inactiveCommandBufferCapacity = 0;
     vulkanCommandPool->inactiveCommandBufferCount = 0;
     vulkanCommandPool->inactiveCommandBuffers = NULL;
 
+    vulkanCommandPool->uniformBufferPoolCapacity = 4;
+    vulkanCommandPool->uniformBufferPoolCount = 0;
+    vulkanCommandPool->uniformBufferPool = SDL_malloc(
+        vulkanCommandPool->uniformBufferPoolCapacity * sizeof(VulkanUniformBuffer *));
+
+    vulkanCommandPool->descriptorSetCachePoolCapacity = 4;
+    vulkanCommandPool->descriptorSetCachePoolCount = 0;
+    vulkanCommandPool->descriptorSetCachePool = SDL_malloc(
+        vulkanCommandPool->descriptorSetCachePoolCapacity * sizeof(DescriptorSetCache *));
+
     if (!VULKAN_INTERNAL_AllocateCommandBuffer(
         renderer,
         vulkanCommandPool)) {
@@ -9493,10 +10176,13 @@ static VulkanCommandBuffer *VULKAN_INTERNAL_GetInactiveCommandBufferFromPool(
         return NULL;
     }
 
+    SDL_LockMutex(commandPool->lock);
+
     if (commandPool->inactiveCommandBufferCount == 0) {
         if (!VULKAN_INTERNAL_AllocateCommandBuffer(
             renderer,
             commandPool)) {
+            SDL_UnlockMutex(commandPool->lock);
             return NULL;
         }
     }
@@ -9504,6 +10190,11 @@ static VulkanCommandBuffer *VULKAN_INTERNAL_GetInactiveCommandBufferFromPool(
     commandBuffer = commandPool->inactiveCommandBuffers[commandPool->inactiveCommandBufferCount - 1];
     commandPool->inactiveCommandBufferCount -= 1;
 
+    commandBuffer->descriptorSetCache =
+        VULKAN_INTERNAL_AcquireDescriptorSetCache(commandPool);
+
+    SDL_UnlockMutex(commandPool->lock);
+
     return commandBuffer;
 }
 
@@ -9516,22 +10207,13 @@ static SDL_GPUCommandBuffer *VULKAN_AcquireCommandBuffer(
 
     SDL_ThreadID threadID = SDL_GetCurrentThreadID();
 
-    SDL_LockMutex(renderer->acquireCommandBufferLock);
-
     VulkanCommandBuffer *commandBuffer =
         VULKAN_INTERNAL_GetInactiveCommandBufferFromPool(renderer, threadID);
 
-    DescriptorSetCache *descriptorSetCache =
-        VULKAN_INTERNAL_AcquireDescriptorSetCache(renderer);
-
-    SDL_UnlockMutex(renderer->acquireCommandBufferLock);
-
     if (commandBuffer == NULL) {
         return NULL;
     }
 
-    commandBuffer->descriptorSetCache = descriptorSetCache;
-
     // Reset state
 
     commandBuffer->currentComputePipeline = NULL;
@@ -9595,6 +10277,7 @@ static SDL_GPUCommandBuffer *VULKAN_AcquireCommandBuffer(
     SDL_zeroa(commandBuffer->readOnlyComputeStorageBuffers);
 
     commandBuffer->autoReleaseFence = true;
+    commandBuffer->common.timestamps_enabled = false;
 
     commandBuffer->swapchainRequested = false;
     commandBuffer->isDefrag = 0;
@@ -9665,6 +10348,211 @@ static void VULKAN_ReleaseFence(
     }
 }
 
+static void VULKAN_ReferenceFence(
+    SDL_GPURenderer *driverData,
+    SDL_GPUFence *fence)
+{
+    (void)SDL_AtomicIncRef(&((VulkanFenceHandle *)fence)->referenceCount);
+}
+
+// Timing
+
+static bool VULKAN_EnableTimestamps(
+    SDL_GPUCommandBuffer *commandBuffer)
+{
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer *)commandBuffer;
+    VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
+    VkQueryPoolCreateInfo queryPoolCreateInfo;
+    VkQueryPool queryPool;
+    VkResult vulkanResult;
+
+    if (renderer->timestampValidBits == 0) {
+        return SDL_Unsupported();
+    }
+
+    if (vulkanCommandBuffer->timestamps == NULL) {
+        queryPoolCreateInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        queryPoolCreateInfo.pNext = NULL;
+        queryPoolCreateInfo.flags = 0;
+        queryPoolCreateInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        queryPoolCreateInfo.queryCount = MAX_TIMESTAMP_PASSES * 2;
+        queryPoolCreateInfo.pipelineStatistics = 0;
+
+        vulkanResult = renderer->vkCreateQueryPool(
+            renderer->logicalDevice,
+            &queryPoolCreateInfo,
+            NULL,
+            &queryPool);
+
+        CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkCreateQueryPool, false);
+
+        vulkanCommandBuffer->timestamps = SDL_malloc(sizeof(VulkanTimestampQueries));
+        if (!vulkanCommandBuffer->timestamps) {
+            renderer->vkDestroyQueryPool(
+                renderer->logicalDevice,
+                queryPool,
+                NULL);
+            return false;
+        }
+        vulkanCommandBuffer->timestamps->queryPool = queryPool;
+    }
+
+    renderer->vkCmdResetQueryPool(
+        vulkanCommandBuffer->commandBuffer,
+        vulkanCommandBuffer->timestamps->queryPool,
+        0,
+        MAX_TIMESTAMP_PASSES * 2);
+
+    vulkanCommandBuffer->timestamps->timestampCount = 0;
+
+    return true;
+}
+
+static void VULKAN_WriteTimestamp(
+    SDL_GPUCommandBuffer *commandBuffer,
+    SDL_GPUPassType passType,
+    bool passEnd)
+{
+    VulkanCommandBuffer *vulkanCommandBuffer = (VulkanCommandBuffer *)commandBuffer;
+    VulkanRenderer *renderer = vulkanCommandBuffer->renderer;
+    VulkanTimestampQueries *timestamps = vulkanCommandBuffer->timestamps;
+
+    // Passes past the limit are silently not timed
+    if (timestamps->timestampCount == MAX_TIMESTAMP_PASSES * 2) {
+        return;
+    }
+
+    if (!passEnd) {
+        timestamps->passTypes[timestamps->timestampCount / 2] = passType;
+    }
+
+    // The start is taken as soon as the pass reaches the GPU, the end once all of its work has retired
+    renderer->vkCmdWriteTimestamp(
+        vulkanCommandBuffer->commandBuffer,
+        passEnd ? VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+        timestamps->queryPool,
+        timestamps->timestampCount);
+
+    timestamps->timestampCount += 1;
+}
+
+static SDL_GPUPassTiming *VULKAN_GetPassTimings(
+    SDL_GPURenderer *driverData,
+    SDL_GPUFence *fence,
+    int *count)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+    VulkanFenceHandle *handle = (VulkanFenceHandle *)fence;
+    VulkanTimestampQueries *timestamps = handle->timestamps;
+    Uint64 results[MAX_TIMESTAMP_PASSES * 2];
+    Uint64 mask;
+    float period;
+    Uint32 passCount;
+    SDL_GPUPassTiming *timings;
+    VkResult vulkanResult;
+
+    if (timestamps == NULL || timestamps->timestampCount < 2) {
+        SDL_SetError("No timestamps were recorded for this fence");
+        return NULL;
+    }
+
+    if (!VULKAN_QueryFence(driverData, fence)) {
+        SDL_SetError("Fence has not been signaled yet");
+        return NULL;
+    }
+
+    passCount = timestamps->timestampCount / 2;
+
+    vulkanResult = renderer->vkGetQueryPoolResults(
+        renderer->logicalDevice,
+        timestamps->queryPool,
+        0,
+        passCount * 2,
+        sizeof(results),
+        results,
+        sizeof(Uint64),
+        VK_QUERY_RESULT_64_BIT);
+
+    CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkGetQueryPoolResults, NULL);
+
+    timings = SDL_malloc(passCount * sizeof(SDL_GPUPassTiming));
+    if (!timings) {
+        return NULL;
+    }
+
+    // Timestamps may wrap around, so only the valid bits of each difference count
+    mask = (renderer->timestampValidBits >= 64) ? SDL_MAX_UINT64 : ((Uint64)1 << renderer->timestampValidBits) - 1;
+    period = renderer->physicalDeviceProperties.properties.limits.timestampPeriod;
+
+    for (Uint32 i = 0; i < passCount; i += 1) {
+        timings[i].type = timestamps->passTypes[i];
+        timings[i].start_ns = (Uint64)(((results[i * 2] - results[0]) & mask) * (double)period);
+        timings[i].duration_ns = (Uint64)(((results[i * 2 + 1] - results[i * 2]) & mask) * (double)period);
+    }
+
+    if (count) {
+        *count = (int)passCount;
+    }
+    return timings;
+}
+
+static SDL_GPUMemoryStats *VULKAN_GetMemoryStats(
+    SDL_GPURenderer *driverData,
+    int *count)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+    SDL_GPUMemoryStats *stats;
+    Uint32 statCount = 0;
+
+    SDL_LockMutex(renderer->allocatorLock);
+
+    stats = SDL_calloc(VK_MAX_MEMORY_TYPES, sizeof(SDL_GPUMemoryStats));
+    if (!stats) {
+        SDL_UnlockMutex(renderer->allocatorLock);
+        return NULL;
+    }
+
+    for (Uint32 memoryType = 0; memoryType < VK_MAX_MEMORY_TYPES; memoryType += 1) {
+        VulkanMemorySubAllocator *allocator = &renderer->memoryAllocator->subAllocators[memoryType];
+        SDL_GPUMemoryStats *stat;
+
+        if (allocator->allocationCount == 0) {
+            continue;
+        }
+
+        stat = &stats[statCount];
+        statCount += 1;
+
+        stat->memory_type = memoryType;
+        stat->block_count = allocator->allocationCount;
+
+        for (Uint32 i = 0; i < allocator->allocationCount; i += 1) {
+            VulkanMemoryAllocation *allocation = allocator->allocations[i];
+            stat->free_region_count += allocation->freeRegionCount;
+            stat->allocated_bytes += allocation->size;
+            stat->used_bytes += allocation->usedSpace;
+        }
+
+        // Free regions are sorted largest first
+        if (allocator->sortedFreeRegionCount > 0) {
+            stat->largest_free_region = allocator->sortedFreeRegions[0]->size;
+        }
+
+        for (Uint32 i = 0; i < renderer->allocationsToDefragCount; i += 1) {
+            if (renderer->allocationsToDefrag[i]->allocator == allocator) {
+                stat->defrag_pending_count += 1;
+            }
+        }
+    }
+
+    SDL_UnlockMutex(renderer->allocatorLock);
+
+    if (count) {
+        *count = (int)statCount;
+    }
+    return stats;
+}
+
 static WindowData *VULKAN_INTERNAL_FetchWindowData(
     SDL_Window *window)
 {
@@ -10237,6 +11125,7 @@ static VulkanFenceHandle *VULKAN_INTERNAL_AcquireFenceFromPool(
 
         handle = SDL_malloc(sizeof(VulkanFenceHandle));
         handle->fence = fence;
+        handle->timestamps = NULL;
         SDL_SetAtomicInt(&handle->referenceCount, 0);
         return handle;
     }
@@ -10246,6 +11135,11 @@ static VulkanFenceHandle *VULKAN_INTERNAL_AcquireFenceFromPool(
     handle = renderer->fencePool.availableFences[renderer->fencePool.availableFenceCount - 1];
     renderer->fencePool.availableFenceCount -= 1;
 
+    // Forget the timings of the previous submission
+    if (handle->timestamps) {
+        handle->timestamps->timestampCount = 0;
+    }
+
     vulkanResult = renderer->vkResetFences(
         renderer->logicalDevice,
         1,
@@ -10358,16 +11252,16 @@ static void VULKAN_INTERNAL_CleanCommandBuffer(
 
     // Uniform buffers are now available
 
-    SDL_LockMutex(renderer->acquireUniformBufferLock);
+    SDL_LockMutex(commandBuffer->commandPool->lock);
 
     for (Sint32 i = 0; i < commandBuffer->usedUniformBufferCount; i += 1) {
         VULKAN_INTERNAL_ReturnUniformBufferToPool(
-            renderer,
+            commandBuffer->commandPool,
             commandBuffer->usedUniformBuffers[i]);
     }
     commandBuffer->usedUniformBufferCount = 0;
 
-    SDL_UnlockMutex(renderer->acquireUniformBufferLock);
+    SDL_UnlockMutex(commandBuffer->commandPool->lock);
 
     // Decrement reference counts
 
@@ -10401,6 +11295,19 @@ static void VULKAN_INTERNAL_CleanCommandBuffer(
     }
     commandBuffer->usedFramebufferCount = 0;
 
+    // Bindless slots unregistered before this submission are no longer in use
+
+    if (commandBuffer->bindlessReleaseCount > 0) {
+        SDL_LockMutex(renderer->bindlessLock);
+        for (Uint32 i = 0; i < commandBuffer->bindlessReleaseCount; i += 1) {
+            VULKAN_INTERNAL_FreeBindlessSlot(
+                renderer,
+                &commandBuffer->bindlessReleases[i]);
+        }
+        SDL_UnlockMutex(renderer->bindlessLock);
+        commandBuffer->bindlessReleaseCount = 0;
+    }
+
     // Reset presentation data
 
     commandBuffer->presentDataCount = 0;
@@ -10416,7 +11323,7 @@ static void VULKAN_INTERNAL_CleanCommandBuffer(
 
     // Return command buffer to pool
 
-    SDL_LockMutex(renderer->acquireCommandBufferLock);
+    SDL_LockMutex(commandBuffer->commandPool->lock);
 
     if (commandBuffer->commandPool->inactiveCommandBufferCount == commandBuffer->commandPool->inactiveCommandBufferCapacity) {
         commandBuffer->commandPool->inactiveCommandBufferCapacity += 1;
@@ -10431,12 +11338,12 @@ static void VULKAN_INTERNAL_CleanCommandBuffer(
     // Release descriptor set cache
 
     VULKAN_INTERNAL_ReturnDescriptorSetCacheToPool(
-        renderer,
+        commandBuffer->commandPool,
         commandBuffer->descriptorSetCache);
 
     commandBuffer->descriptorSetCache = NULL;
 
-    SDL_UnlockMutex(renderer->acquireCommandBufferLock);
+    SDL_UnlockMutex(commandBuffer->commandPool->lock);
 
     // Remove this command buffer from the submitted list
     if (!cancel) {
@@ -10617,6 +11524,15 @@ static bool VULKAN_Submit(
     // Command buffer has a reference to the in-flight fence
     (void)SDL_AtomicIncRef(&vulkanCommandBuffer->inFlightFence->referenceCount);
 
+    /* The fence outlives the command buffer, so it takes the recorded queries
+     * and gives the command buffer its previous (completed) query pool to reuse.
+     */
+    if (vulkanCommandBuffer->common.timestamps_enabled) {
+        VulkanTimestampQueries *timestamps = vulkanCommandBuffer->inFlightFence->timestamps;
+        vulkanCommandBuffer->inFlightFence->timestamps = vulkanCommandBuffer->timestamps;
+        vulkanCommandBuffer->timestamps = timestamps;
+    }
+
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
     submitInfo.pNext = NULL;
     submitInfo.commandBufferCount = 1;
@@ -10639,6 +11555,27 @@ static bool VULKAN_Submit(
         CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkQueueSubmit, false);
     }
 
+    /* Earlier submissions complete before this one's fence signals, so bindless
+     * slots unregistered so far can be reused once this command buffer is done.
+     * The command buffer's release list is empty, trade it for the pending one.
+     */
+    if (renderer->bindlessSet != VK_NULL_HANDLE) {
+        SDL_LockMutex(renderer->bindlessLock);
+        if (renderer->pendingBindlessReleaseCount > 0) {
+            VulkanBindlessRelease *releases = vulkanCommandBuffer->bindlessReleases;
+            Uint32 capacity = vulkanCommandBuffer->bindlessReleaseCapacity;
+
+            vulkanCommandBuffer->bindlessReleases = renderer->pendingBindlessReleases;
+            vulkanCommandBuffer->bindlessReleaseCount = renderer->pendingBindlessReleaseCount;
+            vulkanCommandBuffer->bindlessReleaseCapacity = renderer->pendingBindlessReleaseCapacity;
+
+            renderer->pendingBindlessReleases = releases;
+            renderer->pendingBindlessReleaseCount = 0;
+            renderer->pendingBindlessReleaseCapacity = capacity;
+        }
+        SDL_UnlockMutex(renderer->bindlessLock);
+    }
+
     // Present, if applicable
     for (Uint32 j = 0; j < vulkanCommandBuffer->presentDataCount; j += 1) {
         presentData = &vulkanCommandBuffer->presentDatas[j];
@@ -10751,22 +11688,50 @@ static bool VULKAN_INTERNAL_DefragmentMemory(
     VulkanRenderer *renderer,
     VulkanCommandBuffer *commandBuffer)
 {
+    Uint64 startTime = SDL_GetTicksNS();
+    VkDeviceSize bytesMoved = 0;
+    bool budgetExhausted = false;
+
     renderer->defragInProgress = 1;
     commandBuffer->isDefrag = 1;
 
     SDL_LockMutex(renderer->allocatorLock);
 
     VulkanMemoryAllocation *allocation = renderer->allocationsToDefrag[renderer->allocationsToDefragCount - 1];
-    renderer->allocationsToDefragCount -= 1;
 
     /* For each used region in the allocation
      * create a new resource, copy the data
-     * and re-point the resource containers
+     * and re-point the resource containers.
+     *
+     * Regions are moved until the per-submission budget runs out. The allocation
+     * stays marked until all of its live regions have been moved, regions moved
+     * by an earlier submission are skipped since the old resource is pending destroy.
      */
     for (Uint32 i = 0; i < allocation->usedRegionCount; i += 1) {
         VulkanMemoryUsedRegion *currentRegion = allocation->usedRegions[i];
+        bool live = currentRegion->isBuffer ?
+            !currentRegion->vulkanBuffer->markedForDestroy :
+            !currentRegion->vulkanTexture->markedForDestroy;
+        bool pinned = currentRegion->isBuffer ?
+            SDL_GetAtomicInt(&currentRegion->vulkanBuffer->bindlessCount) > 0 :
+            SDL_GetAtomicInt(&currentRegion->vulkanTexture->bindlessCount) > 0;
+
+        // The bindless table points at the resource itself, so it can't move
+        if (!live || pinned) {
+            continue;
+        }
+
+        // Always make progress, but don't let one submission move everything at once
+        if (bytesMoved > 0 &&
+            ((renderer->defragBudgetBytes > 0 && bytesMoved + currentRegion->resourceSize > renderer->defragBudgetBytes) ||
+             (renderer->defragBudgetNS > 0 && SDL_GetTicksNS() - startTime > renderer->defragBudgetNS))) {
+            budgetExhausted = true;
+            break;
+        }
 
-        if (currentRegion->isBuffer && !currentRegion->vulkanBuffer->markedForDestroy) {
+        bytesMoved += currentRegion->resourceSize;
+
+        if (currentRegion->isBuffer) {
             currentRegion->vulkanBuffer->usage |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
 
             VulkanBuffer *newBuffer = VULKAN_INTERNAL_CreateBuffer(
@@ -10778,6 +11743,7 @@ static bool VULKAN_INTERNAL_DefragmentMemory(
                 currentRegion->vulkanBuffer->container != NULL ? currentRegion->vulkanBuffer->container->debugName : NULL);
 
             if (newBuffer == NULL) {
+                renderer->allocationsToDefragCount -= 1;
                 SDL_UnlockMutex(renderer->allocatorLock);
                 SDL_LogError(SDL_LOG_CATEGORY_GPU, "%s", "Failed to allocate defrag buffer!");
                 return false;
@@ -10837,13 +11803,14 @@ static bool VULKAN_INTERNAL_DefragmentMemory(
             }
 
             VULKAN_INTERNAL_ReleaseBuffer(renderer, currentRegion->vulkanBuffer);
-        } else if (!currentRegion->isBuffer && !currentRegion->vulkanTexture->markedForDestroy) {
+        } else {
             VulkanTexture *newTexture = VULKAN_INTERNAL_CreateTexture(
                 renderer,
                 false,
                 &currentRegion->vulkanTexture->container->header.info);
 
             if (newTexture == NULL) {
+                renderer->allocationsToDefragCount -= 1;
                 SDL_UnlockMutex(renderer->allocatorLock);
                 SDL_LogError(SDL_LOG_CATEGORY_GPU, "%s", "Failed to allocate defrag buffer!");
                 return false;
@@ -10918,6 +11885,10 @@ static bool VULKAN_INTERNAL_DefragmentMemory(
         }
     }
 
+    if (!budgetExhausted) {
+        renderer->allocationsToDefragCount -= 1;
+    }
+
     SDL_UnlockMutex(renderer->allocatorLock);
 
     return true;
@@ -10975,7 +11946,8 @@ static bool VULKAN_SupportsTextureFormat(
 static inline Uint8 CheckDeviceExtensions(
     VkExtensionProperties *extensions,
     Uint32 numExtensions,
-    VulkanExtensions *supports)
+    VulkanExtensions *supports,
+    bool requireSwapchain)
 {
     Uint32 i;
 
@@ -10987,11 +11959,11 @@ static inline Uint8 CheckDeviceExtensions(
         supports->ext = 1;                   \
     }
         CHECK(KHR_swapchain)
-        else CHECK(KHR_maintenance1) else CHECK(KHR_driver_properties) else CHECK(KHR_portability_subset) else CHECK(EXT_texture_compression_astc_hdr)
+        else CHECK(KHR_maintenance1) else CHECK(KHR_driver_properties) else CHECK(KHR_portability_subset) else CHECK(EXT_texture_compression_astc_hdr) else CHECK(KHR_maintenance3) else CHECK(EXT_descriptor_indexing) else CHECK(KHR_draw_indirect_count)
 #undef CHECK
     }
 
-    return (supports->KHR_swapchain &&
+    return ((supports->KHR_swapchain || !requireSwapchain) &&
             supports->KHR_maintenance1);
 }
 
@@ -11002,7 +11974,10 @@ static inline Uint32 GetDeviceExtensionCount(VulkanExtensions *supports)
         supports->KHR_maintenance1 +
         supports->KHR_driver_properties +
         supports->KHR_portability_subset +
-        supports->EXT_texture_compression_astc_hdr);
+        supports->EXT_texture_compression_astc_hdr +
+        supports->KHR_maintenance3 +
+        supports->EXT_descriptor_indexing +
+        supports->KHR_draw_indirect_count);
 }
 
 static inline void CreateDeviceExtensionArray(
@@ -11019,6 +11994,9 @@ static inline void CreateDeviceExtensionArray(
     CHECK(KHR_driver_properties)
     CHECK(KHR_portability_subset)
     CHECK(EXT_texture_compression_astc_hdr)
+    CHECK(KHR_maintenance3)
+    CHECK(EXT_descriptor_indexing)
+    CHECK(KHR_draw_indirect_count)
 #undef CHECK
 }
 
@@ -11112,10 +12090,12 @@ static Uint8 VULKAN_INTERNAL_CheckDeviceExtensions(
         &extensionCount,
         availableExtensions);
 
+    // Software implementations like lavapipe may not offer a swapchain, headless devices don't need one
     allExtensionsSupported = CheckDeviceExtensions(
         availableExtensions,
         extensionCount,
-        physicalDeviceExtensions);
+        physicalDeviceExtensions,
+        !renderer->headless);
 
     SDL_free(availableExtensions);
     return allExtensionsSupported;
@@ -11175,8 +12155,14 @@ static Uint8 VULKAN_INTERNAL_CreateInstance(VulkanRenderer *renderer)
 
     createFlags = 0;
 
-    originalInstanceExtensionNames = SDL_Vulkan_GetInstanceExtensions(&instanceExtensionCount);
-    if (!originalInstanceExtensionNames) {
+    if (renderer->headless) {
+        // No surfaces, so none of the window system extensions are needed
+        originalInstanceExtensionNames = NULL;
+        instanceExtensionCount = 0;
+    } else {
+        originalInstanceExtensionNames = SDL_Vulkan_GetInstanceExtensions(&instanceExtensionCount);
+    }
+    if (!originalInstanceExtensionNames && !renderer->headless) {
         SDL_LogError(
             SDL_LOG_CATEGORY_GPU,
             "SDL_Vulkan_GetInstanceExtensions(): getExtensionCount: %s",
@@ -11194,7 +12180,9 @@ static Uint8 VULKAN_INTERNAL_CreateInstance(VulkanRenderer *renderer)
     instanceExtensionNames = SDL_stack_alloc(
         const char *,
         instanceExtensionCount + 4);
-    SDL_memcpy((void *)instanceExtensionNames, originalInstanceExtensionNames, instanceExtensionCount * sizeof(const char *));
+    if (instanceExtensionCount > 0) {
+        SDL_memcpy((void *)instanceExtensionNames, originalInstanceExtensionNames, instanceExtensionCount * sizeof(const char *));
+    }
 
 #ifdef SDL_PLATFORM_APPLE
     instanceExtensionNames[instanceExtensionCount++] =
@@ -11223,6 +12211,11 @@ static Uint8 VULKAN_INTERNAL_CreateInstance(VulkanRenderer *renderer)
             VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
     }
 
+    // The colorspace extension depends on VK_KHR_surface
+    if (renderer->headless) {
+        renderer->supportsColorspace = false;
+    }
+
     if (renderer->supportsColorspace) {
         // Append colorspace extension
         instanceExtensionNames[instanceExtensionCount++] =
@@ -11348,7 +12341,7 @@ static Uint8 VULKAN_INTERNAL_IsDeviceSuitable(
     queueFamilyBest = 0;
     *queueFamilyIndex = SDL_MAX_UINT32;
     for (i = 0; i < queueFamilyCount; i += 1) {
-        supportsPresent = SDL_Vulkan_GetPresentationSupport(
+        supportsPresent = renderer->headless || SDL_Vulkan_GetPresentationSupport(
             renderer->instance,
             physicalDevice,
             i);
@@ -11442,6 +12435,8 @@ static Uint8 VULKAN_INTERNAL_DeterminePhysicalDevice(VulkanRenderer *renderer)
     Uint32 i, physicalDeviceCount;
     Sint32 suitableIndex;
     Uint32 queueFamilyIndex, suitableQueueFamilyIndex;
+    Uint32 queueFamilyCount;
+    VkQueueFamilyProperties *queueProps;
     Uint64 deviceRank, highestRank;
 
     vulkanResult = renderer->vkEnumeratePhysicalDevices(
@@ -11551,11 +12546,88 @@ static Uint8 VULKAN_INTERNAL_DeterminePhysicalDevice(VulkanRenderer *renderer)
         renderer->physicalDevice,
         &renderer->memoryProperties);
 
+    renderer->vkGetPhysicalDeviceQueueFamilyProperties(
+        renderer->physicalDevice,
+        &queueFamilyCount,
+        NULL);
+
+    queueProps = SDL_stack_alloc(
+        VkQueueFamilyProperties,
+        queueFamilyCount);
+    renderer->vkGetPhysicalDeviceQueueFamilyProperties(
+        renderer->physicalDevice,
+        &queueFamilyCount,
+        queueProps);
+
+    renderer->timestampValidBits = queueProps[renderer->queueFamilyIndex].timestampValidBits;
+
+    SDL_stack_free(queueProps);
     SDL_stack_free(physicalDevices);
     SDL_stack_free(physicalDeviceExtensions);
     return 1;
 }
 
+/* Fills in the descriptor indexing features to enable for the bindless table,
+ * returns false if the device can't support one.
+ */
+static bool VULKAN_INTERNAL_CheckBindlessSupport(
+    VulkanRenderer *renderer,
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT *enabledFeatures)
+{
+    VkPhysicalDeviceFeatures2KHR features;
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT haveFeatures;
+    VkPhysicalDeviceProperties2KHR properties;
+
+    if (!renderer->supportsPhysicalDeviceProperties2 ||
+        !renderer->supports.KHR_maintenance3 ||
+        !renderer->supports.EXT_descriptor_indexing) {
+        return false;
+    }
+
+    // Graphics pipelines use sets 0-3, the table goes after them
+    if (renderer->physicalDeviceProperties.properties.limits.maxBoundDescriptorSets < 5) {
+        return false;
+    }
+
+    SDL_zero(haveFeatures);
+    haveFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+    features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+    features.pNext = &haveFeatures;
+    renderer->vkGetPhysicalDeviceFeatures2KHR(
+        renderer->physicalDevice,
+        &features);
+
+    if (!haveFeatures.runtimeDescriptorArray ||
+        !haveFeatures.descriptorBindingPartiallyBound ||
+        !haveFeatures.descriptorBindingUpdateUnusedWhilePending ||
+        !haveFeatures.descriptorBindingSampledImageUpdateAfterBind ||
+        !haveFeatures.descriptorBindingStorageBufferUpdateAfterBind) {
+        return false;
+    }
+
+    SDL_zerop(enabledFeatures);
+    enabledFeatures->sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+    enabledFeatures->runtimeDescriptorArray = VK_TRUE;
+    enabledFeatures->descriptorBindingPartiallyBound = VK_TRUE;
+    enabledFeatures->descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+    enabledFeatures->descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+    enabledFeatures->descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+
+    // Let shaders use per-draw or per-invocation indices where the hardware can
+    enabledFeatures->shaderSampledImageArrayNonUniformIndexing = haveFeatures.shaderSampledImageArrayNonUniformIndexing;
+    enabledFeatures->shaderStorageBufferArrayNonUniformIndexing = haveFeatures.shaderStorageBufferArrayNonUniformIndexing;
+
+    SDL_zero(renderer->descriptorIndexingProperties);
+    renderer->descriptorIndexingProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT;
+    properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR;
+    properties.pNext = &renderer->descriptorIndexingProperties;
+    renderer->vkGetPhysicalDeviceProperties2KHR(
+        renderer->physicalDevice,
+        &properties);
+
+    return true;
+}
+
 static Uint8 VULKAN_INTERNAL_CreateLogicalDevice(
     VulkanRenderer *renderer)
 {
@@ -11563,6 +12635,7 @@ static Uint8 VULKAN_INTERNAL_CreateLogicalDevice(
     VkDeviceCreateInfo deviceCreateInfo;
     VkPhysicalDeviceFeatures haveDeviceFeatures;
     VkPhysicalDevicePortabilitySubsetFeaturesKHR portabilityFeatures;
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures;
     const char **deviceExtensions;
 
     VkDeviceQueueCreateInfo queueCreateInfo;
@@ -11594,6 +12667,30 @@ static Uint8 VULKAN_INTERNAL_CreateLogicalDevice(
         renderer->supportsMultiDrawIndirect = true;
     }
 
+    if (haveDeviceFeatures.shaderStorageImageWriteWithoutFormat) {
+        renderer->desiredDeviceFeatures.shaderStorageImageWriteWithoutFormat = VK_TRUE;
+        renderer->supportsStorageImageWriteWithoutFormat = true;
+    }
+
+    SDL_zero(descriptorIndexingFeatures);
+    if (renderer->bindlessRequested &&
+        haveDeviceFeatures.shaderSampledImageArrayDynamicIndexing &&
+        haveDeviceFeatures.shaderStorageBufferArrayDynamicIndexing) {
+        renderer->supportsBindless = VULKAN_INTERNAL_CheckBindlessSupport(
+            renderer,
+            &descriptorIndexingFeatures);
+    }
+    if (renderer->supportsBindless) {
+        // Shaders index the table with values from uniform or storage data
+        renderer->desiredDeviceFeatures.shaderSampledImageArrayDynamicIndexing = VK_TRUE;
+        renderer->desiredDeviceFeatures.shaderStorageBufferArrayDynamicIndexing = VK_TRUE;
+    }
+    if (!renderer->supportsBindless) {
+        // Don't enable extensions that only the bindless table uses
+        renderer->supports.KHR_maintenance3 = 0;
+        renderer->supports.EXT_descriptor_indexing = 0;
+    }
+
     // creating the logical device
 
     deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
@@ -11619,6 +12716,10 @@ static Uint8 VULKAN_INTERNAL_CreateLogicalDevice(
     } else {
         deviceCreateInfo.pNext = NULL;
     }
+    if (renderer->supportsBindless) {
+        descriptorIndexingFeatures.pNext = (void *)deviceCreateInfo.pNext;
+        deviceCreateInfo.pNext = &descriptorIndexingFeatures;
+    }
     deviceCreateInfo.flags = 0;
     deviceCreateInfo.queueCreateInfoCount = 1;
     deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
@@ -11659,25 +12760,178 @@ static Uint8 VULKAN_INTERNAL_CreateLogicalDevice(
     return 1;
 }
 
-static void VULKAN_INTERNAL_LoadEntryPoints(void)
+static bool VULKAN_INTERNAL_CreateBindlessTable(
+    VulkanRenderer *renderer)
+{
+    const VkPhysicalDeviceDescriptorIndexingPropertiesEXT *limits = &renderer->descriptorIndexingProperties;
+    VkDescriptorSetLayoutBinding bindings[2];
+    VkDescriptorBindingFlagsEXT bindingFlags[2];
+    VkDescriptorSetLayoutBindingFlagsCreateInfoEXT bindingFlagsCreateInfo;
+    VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo;
+    VkDescriptorPoolSize poolSizes[2];
+    VkDescriptorPoolCreateInfo descriptorPoolInfo;
+    VkDescriptorSetAllocateInfo descriptorSetAllocateInfo;
+    VkResult vulkanResult;
+    Uint32 textureCount = BINDLESS_TABLE_MAX_SIZE;
+    Uint32 bufferCount = BINDLESS_TABLE_MAX_SIZE;
+    Uint32 resourceCount;
+
+    // Size the table to fit the update-after-bind limits next to the regular bindings
+
+    textureCount = SDL_min(textureCount, limits->maxPerStageDescriptorUpdateAfterBindSamplers);
+    textureCount = SDL_min(textureCount, limits->maxPerStageDescriptorUpdateAfterBindSampledImages);
+    textureCount = SDL_min(textureCount, limits->maxDescriptorSetUpdateAfterBindSamplers);
+    textureCount = SDL_min(textureCount, limits->maxDescriptorSetUpdateAfterBindSampledImages);
+    bufferCount = SDL_min(bufferCount, limits->maxPerStageDescriptorUpdateAfterBindStorageBuffers);
+    bufferCount = SDL_min(bufferCount, limits->maxDescriptorSetUpdateAfterBindStorageBuffers);
+    resourceCount = limits->maxPerStageUpdateAfterBindResources;
+
+    if (textureCount <= BINDLESS_RESERVED_DESCRIPTORS ||
+        bufferCount <= BINDLESS_RESERVED_DESCRIPTORS ||
+        resourceCount <= 2 * BINDLESS_RESERVED_DESCRIPTORS) {
+        SET_STRING_ERROR_AND_RETURN("Device limits are too low for a bindless table", false);
+    }
+
+    textureCount -= BINDLESS_RESERVED_DESCRIPTORS;
+    bufferCount -= BINDLESS_RESERVED_DESCRIPTORS;
+    resourceCount = SDL_min(resourceCount - 2 * BINDLESS_RESERVED_DESCRIPTORS, limits->maxUpdateAfterBindDescriptorsInAllPools);
+    if (textureCount + bufferCount > resourceCount) {
+        textureCount = SDL_min(textureCount, resourceCount / 2);
+        bufferCount = SDL_min(bufferCount, resourceCount - textureCount);
+    }
+
+    // Binding 0: combined image samplers, binding 1: storage buffers
+
+    bindings[0].binding = 0;
+    bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    bindings[0].descriptorCount = textureCount;
+    bindings[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT | VK_SHADER_STAGE_COMPUTE_BIT;
+    bindings[0].pImmutableSamplers = NULL;
+
+    bindings[1].binding = 1;
+    bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    bindings[1].descriptorCount = bufferCount;
+    bindings[1].stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT | VK_SHADER_STAGE_COMPUTE_BIT;
+    bindings[1].pImmutableSamplers = NULL;
+
+    /* Unregistered slots are never written back, and slots can be written
+     * while command buffers that use other slots are still in flight.
+     */
+    bindingFlags[0] =
+        VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT |
+        VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT |
+        VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT;
+    bindingFlags[1] = bindingFlags[0];
+
+    bindingFlagsCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+    bindingFlagsCreateInfo.pNext = NULL;
+    bindingFlagsCreateInfo.bindingCount = 2;
+    bindingFlagsCreateInfo.pBindingFlags = bindingFlags;
+
+    descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    descriptorSetLayoutCreateInfo.pNext = &bindingFlagsCreateInfo;
+    descriptorSetLayoutCreateInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT;
+    descriptorSetLayoutCreateInfo.bindingCount = 2;
+    descriptorSetLayoutCreateInfo.pBindings = bindings;
+
+    vulkanResult = renderer->vkCreateDescriptorSetLayout(
+        renderer->logicalDevice,
+        &descriptorSetLayoutCreateInfo,
+        NULL,
+        &renderer->bindlessSetLayout);
+    CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkCreateDescriptorSetLayout, false);
+
+    poolSizes[0].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    poolSizes[0].descriptorCount = textureCount;
+    poolSizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    poolSizes[1].descriptorCount = bufferCount;
+
+    descriptorPoolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    descriptorPoolInfo.pNext = NULL;
+    descriptorPoolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT;
+    descriptorPoolInfo.maxSets = 1;
+    descriptorPoolInfo.poolSizeCount = 2;
+    descriptorPoolInfo.pPoolSizes = poolSizes;
+
+    vulkanResult = renderer->vkCreateDescriptorPool(
+        renderer->logicalDevice,
+        &descriptorPoolInfo,
+        NULL,
+        &renderer->bindlessPool);
+    if (vulkanResult != VK_SUCCESS) {
+        renderer->vkDestroyDescriptorSetLayout(renderer->logicalDevice, renderer->bindlessSetLayout, NULL);
+        renderer->bindlessSetLayout = VK_NULL_HANDLE;
+        CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkCreateDescriptorPool, false);
+    }
+
+    descriptorSetAllocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    descriptorSetAllocateInfo.pNext = NULL;
+    descriptorSetAllocateInfo.descriptorPool = renderer->bindlessPool;
+    descriptorSetAllocateInfo.descriptorSetCount = 1;
+    descriptorSetAllocateInfo.pSetLayouts = &renderer->bindlessSetLayout;
+
+    vulkanResult = renderer->vkAllocateDescriptorSets(
+        renderer->logicalDevice,
+        &descriptorSetAllocateInfo,
+        &renderer->bindlessSet);
+    if (vulkanResult != VK_SUCCESS) {
+        renderer->vkDestroyDescriptorPool(renderer->logicalDevice, renderer->bindlessPool, NULL);
+        renderer->vkDestroyDescriptorSetLayout(renderer->logicalDevice, renderer->bindlessSetLayout, NULL);
+        renderer->bindlessPool = VK_NULL_HANDLE;
+        renderer->bindlessSetLayout = VK_NULL_HANDLE;
+        CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkAllocateDescriptorSets, false);
+    }
+
+    // Slots are handed out lowest first
+    renderer->bindlessTextureCapacity = textureCount;
+    renderer->bindlessTextures = SDL_calloc(textureCount, sizeof(VulkanBindlessSlot));
+    renderer->freeBindlessTextures = SDL_malloc(textureCount * sizeof(Uint32));
+    for (Uint32 i = 0; i < textureCount; i += 1) {
+        renderer->freeBindlessTextures[i] = textureCount - 1 - i;
+    }
+    renderer->freeBindlessTextureCount = textureCount;
+
+    renderer->bindlessBufferCapacity = bufferCount;
+    renderer->bindlessBuffers = SDL_calloc(bufferCount, sizeof(VulkanBindlessSlot));
+    renderer->freeBindlessBuffers = SDL_malloc(bufferCount * sizeof(Uint32));
+    for (Uint32 i = 0; i < bufferCount; i += 1) {
+        renderer->freeBindlessBuffers[i] = bufferCount - 1 - i;
+    }
+    renderer->freeBindlessBufferCount = bufferCount;
+
+    renderer->pendingBindlessReleases = NULL;
+    renderer->pendingBindlessReleaseCount = 0;
+    renderer->pendingBindlessReleaseCapacity = 0;
+
+    renderer->bindlessLock = SDL_CreateMutex();
+
+    return true;
+}
+
+static void VULKAN_INTERNAL_LoadEntryPoints(bool headless)
 {
     // Required for MoltenVK support
     SDL_setenv_unsafe("MVK_CONFIG_FULL_IMAGE_VIEW_SWIZZLE", "1", 1);
 
-    // Load Vulkan entry points
-    if (!SDL_Vulkan_LoadLibrary(NULL)) {
-        SDL_LogWarn(SDL_LOG_CATEGORY_GPU, "Vulkan: SDL_Vulkan_LoadLibrary failed!");
-        return;
-    }
+    if (headless) {
+        // Already loaded by VULKAN_INTERNAL_LoadLibrary()
+        vkGetInstanceProcAddr = headlessGetInstanceProcAddr;
+    } else {
+        // Load Vulkan entry points
+        if (!SDL_Vulkan_LoadLibrary(NULL)) {
+            SDL_LogWarn(SDL_LOG_CATEGORY_GPU, "Vulkan: SDL_Vulkan_LoadLibrary failed!");
+            return;
+        }
 
 #ifdef HAVE_GCC_DIAGNOSTIC_PRAGMA
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wpedantic"
 #endif
-    vkGetInstanceProcAddr = (PFN_vkGetInstanceProcAddr)SDL_Vulkan_GetVkGetInstanceProcAddr();
+        vkGetInstanceProcAddr = (PFN_vkGetInstanceProcAddr)SDL_Vulkan_GetVkGetInstanceProcAddr();
 #ifdef HAVE_GCC_DIAGNOSTIC_PRAGMA
 #pragma GCC diagnostic pop
 #endif
+    }
     if (vkGetInstanceProcAddr == NULL) {
         SDL_LogWarn(
             SDL_LOG_CATEGORY_GPU,
@@ -11698,7 +12952,7 @@ static void VULKAN_INTERNAL_LoadEntryPoints(void)
 static bool VULKAN_INTERNAL_PrepareVulkan(
     VulkanRenderer *renderer)
 {
-    VULKAN_INTERNAL_LoadEntryPoints();
+    VULKAN_INTERNAL_LoadEntryPoints(renderer->headless);
 
     if (!VULKAN_INTERNAL_CreateInstance(renderer)) {
         SDL_LogWarn(SDL_LOG_CATEGORY_GPU, "Vulkan: Could not create Vulkan instance");
@@ -11720,22 +12974,25 @@ static bool VULKAN_PrepareDriver(SDL_VideoDevice *_this, SDL_PropertiesID props)
 {
     // Set up dummy VulkanRenderer
     VulkanRenderer *renderer;
+    bool headless = SDL_GetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_HEADLESS_BOOLEAN, false);
     bool result = false;
 
     if (!SDL_GetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_SHADERS_SPIRV_BOOLEAN, false)) {
         return false;
     }
 
-    if (_this->Vulkan_CreateSurface == NULL) {
+    if (!headless && _this->Vulkan_CreateSurface == NULL) {
         return false;
     }
 
-    if (!SDL_Vulkan_LoadLibrary(NULL)) {
+    if (!VULKAN_INTERNAL_LoadLibrary(headless)) {
         return false;
     }
 
     renderer = (VulkanRenderer *)SDL_calloc(1, sizeof(*renderer));
     if (renderer) {
+        renderer->headless = headless;
+
         // Opt out device features (higher compatibility in exchange for reduced functionality)
         renderer->desiredDeviceFeatures.samplerAnisotropy = SDL_GetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_VULKAN_SAMPLERANISOTROPY_BOOLEAN, true) ? VK_TRUE : VK_FALSE;
         renderer->desiredDeviceFeatures.depthClamp = SDL_GetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_VULKAN_DEPTHCLAMP_BOOLEAN, true) ? VK_TRUE : VK_FALSE;
@@ -11753,7 +13010,7 @@ static bool VULKAN_PrepareDriver(SDL_VideoDevice *_this, SDL_PropertiesID props)
         }
         SDL_free(renderer);
     }
-    SDL_Vulkan_UnloadLibrary();
+    VULKAN_INTERNAL_UnloadLibrary(headless);
 
     return result;
 }
@@ -11769,21 +13026,29 @@ static SDL_GPUDevice *VULKAN_CreateDevice(bool debugMode, bool preferLowPower, S
         props,
         SDL_PROP_GPU_DEVICE_CREATE_VERBOSE_BOOLEAN,
         true);
+    bool headless = SDL_GetBooleanProperty(
+        props,
+        SDL_PROP_GPU_DEVICE_CREATE_HEADLESS_BOOLEAN,
+        false);
 
-    if (!SDL_Vulkan_LoadLibrary(NULL)) {
+    if (!VULKAN_INTERNAL_LoadLibrary(headless)) {
         SDL_assert(!"This should have failed in PrepareDevice first!");
         return NULL;
     }
 
     renderer = (VulkanRenderer *)SDL_calloc(1, sizeof(*renderer));
     if (!renderer) {
-        SDL_Vulkan_UnloadLibrary();
+        VULKAN_INTERNAL_UnloadLibrary(headless);
         return NULL;
     }
 
     renderer->debugMode = debugMode;
     renderer->preferLowPower = preferLowPower;
+    renderer->headless = headless;
     renderer->allowedFramesInFlight = 2;
+    renderer->defragBudgetBytes = (VkDeviceSize)SDL_GetNumberProperty(props, SDL_PROP_GPU_DEVICE_CREATE_VULKAN_DEFRAG_BUDGET_BYTES_NUMBER, 16 * 1024 * 1024);
+    renderer->defragBudgetNS = (Uint64)SDL_GetNumberProperty(props, SDL_PROP_GPU_DEVICE_CREATE_VULKAN_DEFRAG_BUDGET_NS_NUMBER, SDL_NS_PER_MS);
+    renderer->bindlessRequested = SDL_GetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_BINDLESS_BOOLEAN, false);
 
     // Opt out device features (higher compatibility in exchange for reduced functionality)
     renderer->desiredDeviceFeatures.samplerAnisotropy = SDL_GetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_VULKAN_SAMPLERANISOTROPY_BOOLEAN, true) ? VK_TRUE : VK_FALSE;
@@ -11799,7 +13064,7 @@ static SDL_GPUDevice *VULKAN_CreateDevice(bool debugMode, bool preferLowPower, S
     if (!VULKAN_INTERNAL_PrepareVulkan(renderer)) {
         SET_STRING_ERROR("Failed to initialize Vulkan!");
         SDL_free(renderer);
-        SDL_Vulkan_UnloadLibrary();
+        VULKAN_INTERNAL_UnloadLibrary(headless);
         return NULL;
     }
 
@@ -11907,16 +13172,40 @@ static SDL_GPUDevice *VULKAN_CreateDevice(bool debugMode, bool preferLowPower, S
             renderer)) {
         SET_STRING_ERROR("Failed to create logical device!");
         SDL_free(renderer);
-        SDL_Vulkan_UnloadLibrary();
+        VULKAN_INTERNAL_UnloadLibrary(headless);
         return NULL;
     }
 
+    // The device still works without the table, it just reports zero slots
+    if (renderer->supportsBindless &&
+        !VULKAN_INTERNAL_CreateBindlessTable(renderer)) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_GPU, "Couldn't create bindless table: %s", SDL_GetError());
+    }
+    SDL_SetNumberProperty(
+        renderer->props,
+        SDL_PROP_GPU_DEVICE_BINDLESS_TEXTURES_NUMBER,
+        renderer->bindlessTextureCapacity);
+    SDL_SetNumberProperty(
+        renderer->props,
+        SDL_PROP_GPU_DEVICE_BINDLESS_BUFFERS_NUMBER,
+        renderer->bindlessBufferCapacity);
+    SDL_SetBooleanProperty(
+        renderer->props,
+        SDL_PROP_GPU_DEVICE_INDIRECT_DRAW_COUNT_BOOLEAN,
+        renderer->supports.KHR_draw_indirect_count);
+    if (verboseLogs && renderer->bindlessRequested) {
+        SDL_LogInfo(SDL_LOG_CATEGORY_GPU, "Vulkan Bindless: %" SDL_PRIu32 " textures, %" SDL_PRIu32 " buffers",
+                    renderer->bindlessTextureCapacity, renderer->bindlessBufferCapacity);
+    }
+
     // FIXME: just move this into this function
     result = (SDL_GPUDevice *)SDL_malloc(sizeof(SDL_GPUDevice));
     ASSIGN_DRIVER(VULKAN)
 
     result->driverData = (SDL_GPURenderer *)renderer;
     result->shader_formats = SDL_GPU_SHADERFORMAT_SPIRV;
+    result->indirect_draw_count = renderer->supports.KHR_draw_indirect_count;
+    result->compute_blit_shaders = renderer->supportsStorageImageWriteWithoutFormat ? &VULKAN_ComputeBlitShaders : NULL;
 
     /*
      * Create initial swapchain array
@@ -11932,8 +13221,6 @@ static SDL_GPUDevice *VULKAN_CreateDevice(bool debugMode, bool preferLowPower, S
     renderer->allocatorLock = SDL_CreateMutex();
     renderer->disposeLock = SDL_CreateMutex();
     renderer->submitLock = SDL_CreateMutex();
-    renderer->acquireCommandBufferLock = SDL_CreateMutex();
-    renderer->acquireUniformBufferLock = SDL_CreateMutex();
     renderer->renderPassFetchLock = SDL_CreateMutex();
     renderer->framebufferFetchLock = SDL_CreateMutex();
     renderer->graphicsPipelineLayoutFetchLock = SDL_CreateMutex();
@@ -11964,23 +13251,6 @@ static SDL_GPUDevice *VULKAN_CreateDevice(bool debugMode, bool preferLowPower, S
         renderer->memoryAllocator->subAllocators[i].sortedFreeRegionCapacity = 4;
     }
 
-    // Create uniform buffer pool
-
-    renderer->uniformBufferPoolCount = 32;
-    renderer->uniformBufferPoolCapacity = 32;
-    renderer->uniformBufferPool = SDL_malloc(
-        renderer->uniformBufferPoolCapacity * sizeof(VulkanUniformBuffer *));
-
-    for (i = 0; i < renderer->uniformBufferPoolCount; i += 1) {
-        renderer->uniformBufferPool[i] = VULKAN_INTERNAL_CreateUniformBuffer(
-            renderer,
-            UNIFORM_BUFFER_SIZE);
-    }
-
-    renderer->descriptorSetCachePoolCapacity = 8;
-    renderer->descriptorSetCachePoolCount = 0;
-    renderer->descriptorSetCachePool = SDL_calloc(renderer->descriptorSetCachePoolCapacity, sizeof(DescriptorSetCache *));
-
     SDL_SetAtomicInt(&renderer->layoutResourceID, 0);
 
     // Device limits
@@ -11991,7 +13261,7 @@ static SDL_GPUDevice *VULKAN_CreateDevice(bool debugMode, bool preferLowPower, S
 
     renderer->commandPoolHashTable = SDL_CreateHashTable(
         0,  // !!! FIXME: a real guess here, for a _minimum_ if not a maximum, could be useful.
-        false,  // manually synchronized due to submission timing
+        true,  // looked up by every recording thread without any other lock held
         VULKAN_INTERNAL_CommandPoolHashFunction,
         VULKAN_INTERNAL_CommandPoolHashKeyMatch,
         VULKAN_INTERNAL_CommandPoolHashDestroy,
@@ -51,7 +51,8 @@ VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceImageFormatProperties)
 VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceMemoryProperties)
 VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceProperties)
 
-// VK_KHR_get_physical_device_properties2, needed for KHR_driver_properties
+// VK_KHR_get_physical_device_properties2, needed for KHR_driver_properties and EXT_descriptor_indexing
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceFeatures2KHR)
 VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceProperties2KHR)
 
 // VK_KHR_surface
@@ -103,12 +104,14 @@ VULKAN_DEVICE_FUNCTION(vkCmdDrawIndexedIndirect)
 VULKAN_DEVICE_FUNCTION(vkCmdDrawIndirect)
 VULKAN_DEVICE_FUNCTION(vkCmdEndRenderPass)
 VULKAN_DEVICE_FUNCTION(vkCmdPipelineBarrier)
+VULKAN_DEVICE_FUNCTION(vkCmdResetQueryPool)
 VULKAN_DEVICE_FUNCTION(vkCmdResolveImage)
 VULKAN_DEVICE_FUNCTION(vkCmdSetBlendConstants)
 VULKAN_DEVICE_FUNCTION(vkCmdSetDepthBias)
 VULKAN_DEVICE_FUNCTION(vkCmdSetScissor)
 VULKAN_DEVICE_FUNCTION(vkCmdSetStencilReference)
 VULKAN_DEVICE_FUNCTION(vkCmdSetViewport)
+VULKAN_DEVICE_FUNCTION(vkCmdWriteTimestamp)
 VULKAN_DEVICE_FUNCTION(vkCreateBuffer)
 VULKAN_DEVICE_FUNCTION(vkCreateCommandPool)
 VULKAN_DEVICE_FUNCTION(vkCreateDescriptorPool)
@@ -121,6 +124,7 @@ VULKAN_DEVICE_FUNCTION(vkCreateImage)
 VULKAN_DEVICE_FUNCTION(vkCreateImageView)
 VULKAN_DEVICE_FUNCTION(vkCreatePipelineCache)
 VULKAN_DEVICE_FUNCTION(vkCreatePipelineLayout)
+VULKAN_DEVICE_FUNCTION(vkCreateQueryPool)
 VULKAN_DEVICE_FUNCTION(vkCreateRenderPass)
 VULKAN_DEVICE_FUNCTION(vkCreateSampler)
 VULKAN_DEVICE_FUNCTION(vkCreateSemaphore)
@@ -137,6 +141,7 @@ VULKAN_DEVICE_FUNCTION(vkDestroyImageView)
 VULKAN_DEVICE_FUNCTION(vkDestroyPipeline)
 VULKAN_DEVICE_FUNCTION(vkDestroyPipelineCache)
 VULKAN_DEVICE_FUNCTION(vkDestroyPipelineLayout)
+VULKAN_DEVICE_FUNCTION(vkDestroyQueryPool)
 VULKAN_DEVICE_FUNCTION(vkDestroyRenderPass)
 VULKAN_DEVICE_FUNCTION(vkDestroySampler)
 VULKAN_DEVICE_FUNCTION(vkDestroySemaphore)
@@ -148,6 +153,7 @@ VULKAN_DEVICE_FUNCTION(vkFreeMemory)
 VULKAN_DEVICE_FUNCTION(vkGetDeviceQueue)
 VULKAN_DEVICE_FUNCTION(vkGetPipelineCacheData)
 VULKAN_DEVICE_FUNCTION(vkGetFenceStatus)
+VULKAN_DEVICE_FUNCTION(vkGetQueryPoolResults)
 VULKAN_DEVICE_FUNCTION(vkGetBufferMemoryRequirements)
 VULKAN_DEVICE_FUNCTION(vkGetImageMemoryRequirements)
 VULKAN_DEVICE_FUNCTION(vkMapMemory)
@@ -168,6 +174,10 @@ VULKAN_DEVICE_FUNCTION(vkDestroySwapchainKHR)
 VULKAN_DEVICE_FUNCTION(vkQueuePresentKHR)
 VULKAN_DEVICE_FUNCTION(vkGetSwapchainImagesKHR)
 
+// VK_KHR_draw_indirect_count, optional
+VULKAN_DEVICE_FUNCTION(vkCmdDrawIndirectCountKHR)
+VULKAN_DEVICE_FUNCTION(vkCmdDrawIndexedIndirectCountKHR)
+
 /*
  * Redefine these every time you include this header!
  */
@@ -0,0 +1,222 @@
+#version 450
+
+// Compute kernels for SDL_BlitGPUTexture() and SDL_GenerateMipmapsForGPUTexture().
+//
+// The storage images have no format qualifier, so one kernel writes to any
+// float or normalized format. This needs shaderStorageImageWriteWithoutFormat.
+
+#if defined(COMPILE_BlitCompute2D) || defined(COMPILE_BlitCompute2DArray) || defined(COMPILE_BlitCompute3D)
+
+// Samples the source at the center of every destination texel, so scaling
+// and format conversion happen in the same dispatch.
+
+layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+#if defined(COMPILE_BlitCompute2D)
+layout(set = 0, binding = 0) uniform sampler2D src;
+layout(set = 1, binding = 0) writeonly uniform image2D dst;
+#elif defined(COMPILE_BlitCompute2DArray)
+layout(set = 0, binding = 0) uniform sampler2DArray src;
+layout(set = 1, binding = 0) writeonly uniform image2D dst;
+#else
+layout(set = 0, binding = 0) uniform sampler3D src;
+layout(set = 1, binding = 0) writeonly uniform image3D dst;
+#endif
+
+layout(set = 2, binding = 0) uniform Context
+{
+    vec4 src_uv;  // left, top, width, height in texcoord space
+    vec4 src_w;   // layer or depth offset, depth scale, mip level
+    uvec4 dst;    // x, y, w, h in texels
+    uvec4 dst_z;  // depth plane, depth
+} u;
+
+void main()
+{
+    uvec3 gid = gl_GlobalInvocationID;
+    if (gid.x >= u.dst.z || gid.y >= u.dst.w || gid.z >= u.dst_z.y) {
+        return;
+    }
+
+    vec2 uv = u.src_uv.xy + ((vec2(gid.xy) + 0.5) / vec2(u.dst.zw)) * u.src_uv.zw;
+    ivec2 p = ivec2(u.dst.xy + gid.xy);
+#if defined(COMPILE_BlitCompute2D)
+    imageStore(dst, p, textureLod(src, uv, u.src_w.z));
+#elif defined(COMPILE_BlitCompute2DArray)
+    imageStore(dst, p, textureLod(src, vec3(uv, u.src_w.x), u.src_w.z));
+#else
+    float w = u.src_w.x + ((float(gid.z) + 0.5) / float(u.dst_z.y)) * u.src_w.y;
+    imageStore(dst, ivec3(p, int(u.dst_z.x + gid.z)), textureLod(src, vec3(uv, w), u.src_w.z));
+#endif
+}
+
+#endif
+
+#if defined(COMPILE_MipChain2D) || defined(COMPILE_MipChain2DArray)
+
+// Writes up to 8 levels below src_level in one dispatch.
+//
+// Every workgroup reduces a 64x64 tile of the source level down to a single
+// texel of level 6, keeping the intermediate levels in shared memory. When
+// more than 6 levels are requested, the workgroups leave their level 6 texel
+// in the scratch buffer and the last one to finish reduces those to levels 7
+// and 8. That needs all of level 6 to fit in 16x16 texels.
+//
+// Each level is a 2x2 box filter of the one above it, odd texels at the end
+// of a row or column are dropped like in the render pass path.
+
+layout(local_size_x = 16, local_size_y = 16, local_size_z = 1) in;
+
+#if defined(COMPILE_MipChain2D)
+layout(set = 0, binding = 0) uniform sampler2D src;
+#else
+layout(set = 0, binding = 0) uniform sampler2DArray src;
+#endif
+
+// Levels past level_count are bound to spare textures and never written
+layout(set = 1, binding = 0) writeonly uniform image2D dst1;
+layout(set = 1, binding = 1) writeonly uniform image2D dst2;
+layout(set = 1, binding = 2) writeonly uniform image2D dst3;
+layout(set = 1, binding = 3) writeonly uniform image2D dst4;
+layout(set = 1, binding = 4) writeonly uniform image2D dst5;
+layout(set = 1, binding = 5) writeonly uniform image2D dst6;
+layout(set = 1, binding = 6) writeonly uniform image2D dst7;
+layout(set = 1, binding = 7) writeonly uniform image2D dst8;
+
+// The counter starts at zero and the last workgroup resets it
+layout(set = 1, binding = 8) coherent buffer Scratch
+{
+    uint counter;
+    uint padding[3];
+    vec4 texels[256];
+} scratch;
+
+layout(set = 2, binding = 0) uniform Context
+{
+    uvec2 size;        // level 0 size
+    uint src_level;
+    uint level_count;  // levels written by this dispatch
+    uint layer;
+} u;
+
+shared vec4 tile[16][16];
+shared uint is_last;
+
+// level is relative to src_level
+ivec2 LevelSize(uint level)
+{
+    return ivec2(max(u.size >> (u.src_level + level), uvec2(1)));
+}
+
+void Store(uint level, ivec2 p, vec4 v)
+{
+    if (level > u.level_count || any(greaterThanEqual(p, LevelSize(level)))) {
+        return;
+    }
+    switch (level) {
+    case 1: imageStore(dst1, p, v); break;
+    case 2: imageStore(dst2, p, v); break;
+    case 3: imageStore(dst3, p, v); break;
+    case 4: imageStore(dst4, p, v); break;
+    case 5: imageStore(dst5, p, v); break;
+    case 6: imageStore(dst6, p, v); break;
+    case 7: imageStore(dst7, p, v); break;
+    case 8: imageStore(dst8, p, v); break;
+    }
+}
+
+vec4 Fetch(ivec2 p)
+{
+    p = min(p, LevelSize(0) - 1);
+#if defined(COMPILE_MipChain2D)
+    return texelFetch(src, p, int(u.src_level));
+#else
+    return texelFetch(src, ivec3(p, int(u.layer)), int(u.src_level));
+#endif
+}
+
+// Reduces the texels of level in tile, whose first texel is at origin, to
+// texel p of the next level
+vec4 Reduce(uint level, ivec2 origin, ivec2 p)
+{
+    ivec2 last = max(LevelSize(level) - 1 - origin, ivec2(0));
+    ivec2 a = min(2 * p, last);
+    ivec2 b = min(2 * p + 1, last);
+    return 0.25 * (tile[a.y][a.x] + tile[a.y][b.x] + tile[b.y][a.x] + tile[b.y][b.x]);
+}
+
+// Reduces tile from level first - 1 to level last, tile_size is the size of level first
+void ReduceLevels(uint first, uint last, ivec2 group, int tile_size)
+{
+    ivec2 local = ivec2(gl_LocalInvocationID.xy);
+
+    for (uint level = first; level <= last; level += 1) {
+        bool inside = all(lessThan(local, ivec2(tile_size)));
+        vec4 v = vec4(0.0);
+        if (inside) {
+            v = Reduce(level - 1, group * tile_size * 2, local);
+        }
+        barrier();
+        if (inside) {
+            tile[local.y][local.x] = v;
+            Store(level, group * tile_size + local, v);
+        }
+        barrier();
+        tile_size /= 2;
+    }
+}
+
+void main()
+{
+    ivec2 local = ivec2(gl_LocalInvocationID.xy);
+    ivec2 group = ivec2(gl_WorkGroupID.xy);
+
+    // Levels 1 and 2, every invocation reduces a 4x4 block of the source
+    vec4 v[2][2];
+    ivec2 q = group * 32 + local * 2;
+    for (int y = 0; y < 2; y += 1) {
+        for (int x = 0; x < 2; x += 1) {
+            ivec2 s = (q + ivec2(x, y)) * 2;
+            v[y][x] = 0.25 * (Fetch(s) + Fetch(s + ivec2(1, 0)) + Fetch(s + ivec2(0, 1)) + Fetch(s + ivec2(1, 1)));
+            Store(1, q + ivec2(x, y), v[y][x]);
+        }
+    }
+
+    ivec2 r = group * 16 + local;
+    ivec2 last = LevelSize(1) - 1;
+    int x1 = (2 * r.x + 1 > last.x) ? 0 : 1;
+    int y1 = (2 * r.y + 1 > last.y) ? 0 : 1;
+    vec4 v2 = 0.25 * (v[0][0] + v[0][x1] + v[y1][0] + v[y1][x1]);
+    tile[local.y][local.x] = v2;
+    Store(2, r, v2);
+    barrier();
+
+    // Levels 3 to 6 from shared memory
+    ReduceLevels(3, min(u.level_count, 6u), group, 8);
+
+    if (u.level_count > 6) {
+        if (local == ivec2(0)) {
+            scratch.texels[group.y * 16 + group.x] = tile[0][0];
+            memoryBarrierBuffer();
+            uint finished = atomicAdd(scratch.counter, 1u);
+            is_last = (finished == gl_NumWorkGroups.x * gl_NumWorkGroups.y - 1u) ? 1u : 0u;
+        }
+        barrier();
+
+        if (is_last != 0u) {
+            memoryBarrierBuffer();
+            if (all(lessThan(local, LevelSize(6)))) {
+                tile[local.y][local.x] = scratch.texels[local.y * 16 + local.x];
+            }
+            if (local == ivec2(0)) {
+                scratch.counter = 0u;
+            }
+            barrier();
+
+            // Levels 7 and 8, level 6 is a single 16x16 tile now
+            ReduceLevels(7, u.level_count, ivec2(0), 8);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,16 @@
+#!/bin/bash
+
+# Requires glslangValidator, which can be obtained from the LunarG Vulkan SDK.
+
+set -x
+set -e
+cd `dirname "$0"`
+
+shadernames=(BlitCompute2D BlitCompute2DArray BlitCompute3D MipChain2D MipChain2DArray)
+
+rm -f Vulkan_ComputeBlit.h
+for shadername in "${shadernames[@]}"; do
+    glslangValidator -V -S comp --quiet -DCOMPILE_$shadername -o $shadername.spv Vulkan_ComputeBlit.glsl || exit $?
+    xxd -i $shadername.spv | perl -w -p -e 's/\Aunsigned /const unsigned /;' >> Vulkan_ComputeBlit.h
+    rm -f $shadername.spv
+done
@@ -85,6 +85,44 @@ Sint64 SDL_GetAsyncIOSize(SDL_AsyncIO *asyncio)
     return asyncio->iface.size(asyncio->userdata);
 }
 
+// takes ownership of `task`, freeing it if it couldn't be started.
+static bool StartAsyncIOTask(SDL_AsyncIOTask *task)
+{
+    SDL_AsyncIO *asyncio = task->asyncio;
+    SDL_AsyncIOQueue *queue = task->queue;
+
+    SDL_LockMutex(asyncio->lock);
+    if (asyncio->closing) {
+        SDL_free(task);
+        SDL_UnlockMutex(asyncio->lock);
+        return SDL_SetError("SDL_AsyncIO is closing, can't start new tasks");
+    }
+    LINKED_LIST_PREPEND(task, asyncio->tasks, asyncio);
+    SDL_AddAtomicInt(&queue->tasks_inflight, 1);
+    SDL_UnlockMutex(asyncio->lock);
+
+    bool queued;
+    if (task->ranges) {
+        queued = asyncio->iface.read_ranges(asyncio->userdata, task);
+    } else if (task->type == SDL_ASYNCIO_TASK_READ) {
+        queued = asyncio->iface.read(asyncio->userdata, task);
+    } else {
+        queued = asyncio->iface.write(asyncio->userdata, task);
+    }
+
+    if (!queued) {
+        SDL_AddAtomicInt(&queue->tasks_inflight, -1);
+        SDL_LockMutex(asyncio->lock);
+        LINKED_LIST_UNLINK(task, asyncio);
+        SDL_UnlockMutex(asyncio->lock);
+        SDL_free(task->sys_data);
+        SDL_free(task);
+        return false;
+    }
+
+    return true;
+}
+
 static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
 {
     if (!asyncio) {
@@ -108,27 +146,7 @@ static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64
     task->app_userdata = userdata;
     task->queue = queue;
 
-    SDL_LockMutex(asyncio->lock);
-    if (asyncio->closing) {
-        SDL_free(task);
-        SDL_UnlockMutex(asyncio->lock);
-        return SDL_SetError("SDL_AsyncIO is closing, can't start new tasks");
-    }
-    LINKED_LIST_PREPEND(task, asyncio->tasks, asyncio);
-    SDL_AddAtomicInt(&queue->tasks_inflight, 1);
-    SDL_UnlockMutex(asyncio->lock);
-
-    const bool queued = reading ? asyncio->iface.read(asyncio->userdata, task) : asyncio->iface.write(asyncio->userdata, task);
-    if (!queued) {
-        SDL_AddAtomicInt(&queue->tasks_inflight, -1);
-        SDL_LockMutex(asyncio->lock);
-        LINKED_LIST_UNLINK(task, asyncio);
-        SDL_UnlockMutex(asyncio->lock);
-        SDL_free(task);
-        task = NULL;
-    }
-
-    return (task != NULL);
+    return StartAsyncIOTask(task);
 }
 
 bool SDL_ReadAsyncIO(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
@@ -141,6 +159,67 @@ bool SDL_WriteAsyncIO(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 siz
     return RequestAsyncIO(false, asyncio, ptr, offset, size, queue, userdata);
 }
 
+bool SDL_ReadAsyncIORanges(SDL_AsyncIO *asyncio, const SDL_AsyncIORange *ranges, int num_ranges, SDL_AsyncIOQueue *queue, void *userdata)
+{
+    if (!asyncio) {
+        return SDL_InvalidParamError("asyncio");
+    } else if (!ranges) {
+        return SDL_InvalidParamError("ranges");
+    } else if (num_ranges <= 0) {
+        return SDL_InvalidParamError("num_ranges");
+    } else if (!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    Uint64 total = 0;
+    for (int i = 0; i < num_ranges; i++) {
+        if (!ranges[i].ptr) {
+            return SDL_InvalidParamError("ranges[i].ptr");
+        } else if (ranges[i].size > (SDL_MAX_UINT64 - total)) {
+            return SDL_SetError("Ranges are too large");
+        }
+        total += ranges[i].size;
+    }
+
+    // the ranges live right after the task, so they go away with it.
+    SDL_AsyncIOTask *task = (SDL_AsyncIOTask *) SDL_calloc(1, sizeof (*task) + (num_ranges * sizeof (SDL_AsyncIORange)));
+    if (!task) {
+        return false;
+    }
+
+    task->asyncio = asyncio;
+    task->type = SDL_ASYNCIO_TASK_READ;
+    task->ranges = (SDL_AsyncIORange *) (task + 1);
+    task->num_ranges = num_ranges;
+    SDL_memcpy(task->ranges, ranges, num_ranges * sizeof (SDL_AsyncIORange));
+    task->offset = ranges[0].offset;
+    task->buffer = ranges[0].ptr;
+    task->requested_size = total;
+    task->app_userdata = userdata;
+    task->queue = queue;
+
+    return StartAsyncIOTask(task);
+}
+
+bool SDL_AsyncIORangePartComplete(SDL_AsyncIOTask *task, Uint64 transferred, bool failed)
+{
+    SDL_AsyncIO *asyncio = task->asyncio;
+
+    SDL_LockMutex(asyncio->lock);
+    task->result_size += transferred;
+    if (failed) {
+        task->result = SDL_ASYNCIO_FAILURE;
+    }
+    SDL_assert(task->ranges_pending > 0);
+    const bool finished = (--task->ranges_pending == 0);
+    if (finished && (task->result == SDL_ASYNCIO_COMPLETE) && (task->result_size != task->requested_size)) {
+        task->result = SDL_ASYNCIO_FAILURE;  // short reads are failures for ranged tasks.
+    }
+    SDL_UnlockMutex(asyncio->lock);
+
+    return finished;
+}
+
 bool SDL_CloseAsyncIO(SDL_AsyncIO *asyncio, bool flush, SDL_AsyncIOQueue *queue, void *userdata)
 {
     if (!asyncio) {
@@ -242,6 +321,7 @@ static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *out
     }
 
     SDL_AddAtomicInt(&task->queue->tasks_inflight, -1);
+    SDL_free(task->sys_data);
     SDL_free(task);
 
     return retval;
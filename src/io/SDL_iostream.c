@@ -35,10 +35,15 @@
 #include <limits.h>
 #endif
 
-#ifdef SDL_PLATFORM_APPLE
+#ifndef SDL_PLATFORM_WINDOWS
 #include <fcntl.h>
 #endif
 
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #include "SDL_iostream_c.h"
 
 /* This file provides a general interface for SDL to read and write
@@ -51,8 +56,24 @@ struct SDL_IOStream
     void *userdata;
     SDL_IOStatus status;
     SDL_PropertiesID props;
+
+    /* Optional read-ahead / write-behind buffer, see SDL_SetIOBufferSize().
+       When buffer_dirty is set, buffer[0..buffer_len) are writes that haven't
+       reached the interface yet. Otherwise buffer[buffer_pos..buffer_len) is
+       data that was read ahead of the current position. iface_pos is where
+       the interface itself is while buffering, or -1 if it isn't known yet,
+       so seeks and tells inside the buffer don't have to ask the interface. */
+    Uint8 *buffer;
+    size_t buffer_size;
+    size_t buffer_pos;
+    size_t buffer_len;
+    bool buffer_dirty;
+    Sint64 iface_pos;
 };
 
+// Used for seekable file streams, matches the usual stdio buffer size
+#define IOSTREAM_DEFAULT_BUFFER_SIZE 8192
+
 #ifdef SDL_PLATFORM_3DS
 #include "n3ds/SDL_iostreamromfs.h"
 #endif // SDL_PLATFORM_3DS
@@ -357,6 +378,11 @@ SDL_IOStream *SDL_IOFromHandle(HANDLE handle, const char *mode, bool autoclose)
         if (props) {
             SDL_SetPointerProperty(props, SDL_PROP_IOSTREAM_WINDOWS_HANDLE_POINTER, iodata->h);
         }
+
+        // Appending writes move the file pointer behind our back, so only buffer plain disk files
+        if (iface.seek && !iodata->append) {
+            SDL_SetIOBufferSize(iostr, IOSTREAM_DEFAULT_BUFFER_SIZE);
+        }
     }
 
     return iostr;
@@ -388,6 +414,75 @@ static int SDL_fdatasync(int fd)
     return result;
 }
 
+#ifdef HAVE_PREAD
+// Shared by the fd and stdio streams, these never touch the file position.
+static size_t fd_pread(int fd, void *ptr, size_t size, Uint64 offset, SDL_IOStatus *status)
+{
+    size_t total = 0;
+
+    while (total < size) {
+        ssize_t result;
+        do {
+            result = pread(fd, ((Uint8 *) ptr) + total, size - total, (off_t)(offset + total));
+        } while ((result < 0) && (errno == EINTR));
+
+        if (result < 0) {
+            if (errno == EAGAIN) {
+                *status = SDL_IO_STATUS_NOT_READY;
+            } else {
+                *status = SDL_IO_STATUS_ERROR;
+                SDL_SetError("Error reading from datastream: %s", strerror(errno));
+            }
+            break;
+        } else if (result == 0) {
+            *status = SDL_IO_STATUS_EOF;
+            break;
+        }
+        total += (size_t)result;
+    }
+    return total;
+}
+#endif // HAVE_PREAD
+
+/* pwrite() ignores the offset on some systems when the file is in append mode,
+   and appending writes would confuse the stream buffer's idea of the position */
+static bool fd_is_append(int fd)
+{
+#if defined(F_GETFL) && defined(O_APPEND)
+    const int flags = fcntl(fd, F_GETFL);
+    return (flags >= 0) && ((flags & O_APPEND) != 0);
+#else
+    return false;
+#endif
+}
+
+#ifdef HAVE_PWRITE
+
+static size_t fd_pwrite(int fd, const void *ptr, size_t size, Uint64 offset, SDL_IOStatus *status)
+{
+    size_t total = 0;
+
+    while (total < size) {
+        ssize_t result;
+        do {
+            result = pwrite(fd, ((const Uint8 *) ptr) + total, size - total, (off_t)(offset + total));
+        } while ((result < 0) && (errno == EINTR));
+
+        if (result <= 0) {
+            if (result < 0 && errno == EAGAIN) {
+                *status = SDL_IO_STATUS_NOT_READY;
+            } else {
+                *status = SDL_IO_STATUS_ERROR;
+                SDL_SetError("Error writing to datastream: %s", strerror(errno));
+            }
+            break;
+        }
+        total += (size_t)result;
+    }
+    return total;
+}
+#endif // HAVE_PWRITE
+
 static Sint64 SDLCALL fd_seek(void *userdata, Sint64 offset, SDL_IOWhence whence)
 {
     IOStreamFDData *iodata = (IOStreamFDData *) userdata;
@@ -494,6 +589,22 @@ static size_t SDLCALL fd_write(void *userdata, const void *ptr, size_t size, SDL
     return (size_t)bytes;
 }
 
+#ifdef HAVE_PREAD
+static size_t SDLCALL fd_read_at(void *userdata, void *ptr, size_t size, Uint64 offset, SDL_IOStatus *status)
+{
+    IOStreamFDData *iodata = (IOStreamFDData *) userdata;
+    return fd_pread(iodata->fd, ptr, size, offset, status);
+}
+#endif
+
+#ifdef HAVE_PWRITE
+static size_t SDLCALL fd_write_at(void *userdata, const void *ptr, size_t size, Uint64 offset, SDL_IOStatus *status)
+{
+    IOStreamFDData *iodata = (IOStreamFDData *) userdata;
+    return fd_pwrite(iodata->fd, ptr, size, offset, status);
+}
+#endif
+
 static bool SDLCALL fd_flush(void *userdata, SDL_IOStatus *status)
 {
     IOStreamFDData *iodata = (IOStreamFDData *) userdata;
@@ -547,6 +658,18 @@ SDL_IOStream *SDL_IOFromFD(int fd, bool autoclose)
     struct stat st;
     iodata->regular_file = ((fstat(fd, &st) == 0) && S_ISREG(st.st_mode));
 
+    // pread() and pwrite() need a seekable file, pipes and sockets don't qualify
+    if (iodata->regular_file) {
+#ifdef HAVE_PREAD
+        iface.read_at = fd_read_at;
+#endif
+#ifdef HAVE_PWRITE
+        if (!fd_is_append(fd)) {
+            iface.write_at = fd_write_at;
+        }
+#endif
+    }
+
     SDL_IOStream *iostr = SDL_OpenIO(&iface, iodata);
     if (!iostr) {
         iface.close(iodata);
@@ -555,6 +678,11 @@ SDL_IOStream *SDL_IOFromFD(int fd, bool autoclose)
         if (props) {
             SDL_SetNumberProperty(props, SDL_PROP_IOSTREAM_FILE_DESCRIPTOR_NUMBER, fd);
         }
+
+        // Pipes and sockets stay unbuffered so data moves as soon as it's written
+        if (iodata->regular_file && !fd_is_append(fd)) {
+            SDL_SetIOBufferSize(iostr, IOSTREAM_DEFAULT_BUFFER_SIZE);
+        }
     }
 
     return iostr;
@@ -687,6 +815,25 @@ static size_t SDLCALL stdio_write(void *userdata, const void *ptr, size_t size,
     return bytes;
 }
 
+/* These go straight to the file descriptor, past stdio's buffer. That's fine
+   for SDL's async i/o, which only ever uses the positional calls, but mixing
+   them with buffered writes on the same stream needs an SDL_FlushIO() first. */
+#ifdef HAVE_PREAD
+static size_t SDLCALL stdio_read_at(void *userdata, void *ptr, size_t size, Uint64 offset, SDL_IOStatus *status)
+{
+    IOStreamStdioData *iodata = (IOStreamStdioData *) userdata;
+    return fd_pread(fileno(iodata->fp), ptr, size, offset, status);
+}
+#endif
+
+#ifdef HAVE_PWRITE
+static size_t SDLCALL stdio_write_at(void *userdata, const void *ptr, size_t size, Uint64 offset, SDL_IOStatus *status)
+{
+    IOStreamStdioData *iodata = (IOStreamStdioData *) userdata;
+    return fd_pwrite(fileno(iodata->fp), ptr, size, offset, status);
+}
+#endif
+
 static bool SDLCALL stdio_flush(void *userdata, SDL_IOStatus *status)
 {
     IOStreamStdioData *iodata = (IOStreamStdioData *) userdata;
@@ -749,6 +896,17 @@ SDL_IOStream *SDL_IOFromFP(FILE *fp, bool autoclose)
     struct stat st;
     iodata->regular_file = ((fstat(fileno(fp), &st) == 0) && S_ISREG(st.st_mode));
 
+    if (iodata->regular_file) {
+#ifdef HAVE_PREAD
+        iface.read_at = stdio_read_at;
+#endif
+#ifdef HAVE_PWRITE
+        if (!fd_is_append(fileno(fp))) {
+            iface.write_at = stdio_write_at;
+        }
+#endif
+    }
+
     SDL_IOStream *iostr = SDL_OpenIO(&iface, iodata);
     if (!iostr) {
         iface.close(iodata);
@@ -842,6 +1000,44 @@ static size_t SDLCALL mem_write(void *userdata, const void *ptr, size_t size, SD
     return retval;
 }
 
+// The positional calls only read the fixed base and size, so any thread can use them
+static size_t SDLCALL mem_read_at(void *userdata, void *ptr, size_t size, Uint64 offset, SDL_IOStatus *status)
+{
+    const IOStreamMemData *iodata = (IOStreamMemData *) userdata;
+    const size_t total = (size_t)(iodata->stop - iodata->base);
+    size_t avail;
+
+    if (offset >= total) {
+        *status = SDL_IO_STATUS_EOF;
+        return 0;
+    }
+    avail = total - (size_t)offset;
+    if (size > avail) {
+        size = avail;
+        *status = SDL_IO_STATUS_EOF;
+    }
+    SDL_memcpy(ptr, iodata->base + offset, size);
+    return size;
+}
+
+static size_t SDLCALL mem_write_at(void *userdata, const void *ptr, size_t size, Uint64 offset, SDL_IOStatus *status)
+{
+    const IOStreamMemData *iodata = (IOStreamMemData *) userdata;
+    const size_t total = (size_t)(iodata->stop - iodata->base);
+    size_t avail;
+
+    avail = (offset < total) ? (total - (size_t)offset) : 0;
+    if (size > avail) {
+        size = avail;
+        SDL_SetError("Memory buffer is full");
+        *status = SDL_IO_STATUS_ERROR;
+    }
+    if (size > 0) {
+        SDL_memcpy(iodata->base + offset, ptr, size);
+    }
+    return size;
+}
+
 static bool SDLCALL mem_close(void *userdata)
 {
     IOStreamMemData *iodata = (IOStreamMemData *) userdata;
@@ -853,6 +1049,124 @@ static bool SDLCALL mem_close(void *userdata)
     return true;
 }
 
+#if defined(HAVE_MMAP) || (defined(SDL_PLATFORM_WINDOWS) && !defined(SDL_PLATFORM_XBOXONE) && !defined(SDL_PLATFORM_XBOXSERIES))
+#define HAVE_MAPPED_FILES
+
+// Functions to read memory-mapped files
+
+static bool SDLCALL mapped_close(void *userdata)
+{
+    IOStreamMemData *iodata = (IOStreamMemData *) userdata;
+#ifdef SDL_PLATFORM_WINDOWS
+    UnmapViewOfFile(iodata->base);
+#else
+    munmap(iodata->base, (size_t)(iodata->stop - iodata->base));
+#endif
+    SDL_free(userdata);
+    return true;
+}
+
+static bool IsReadOnlyMode(const char *mode)
+{
+    return SDL_strchr(mode, 'r') && !SDL_strpbrk(mode, "wa+");
+}
+
+// Returns NULL without setting an error if the file can't be mapped, the caller falls back to regular file access
+static SDL_IOStream *IOFromMappedFile(const char *file)
+{
+    IOStreamMemData *iodata;
+    SDL_IOStreamInterface iface;
+    SDL_IOStream *iostr;
+    SDL_PropertiesID props;
+    void *mem = NULL;
+    size_t size = 0;
+
+#ifdef SDL_PLATFORM_WINDOWS
+    HANDLE handle = windows_file_open(file, "rb");
+    LARGE_INTEGER filesize;
+
+    if (handle == INVALID_HANDLE_VALUE) {
+        return NULL;
+    }
+    if (GetFileSizeEx(handle, &filesize) && filesize.QuadPart > 0 && (Uint64)filesize.QuadPart <= SDL_SIZE_MAX) {
+        HANDLE mapping = CreateFileMappingW(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping) {
+            // The view keeps the mapping and the file open
+            mem = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            size = (size_t)filesize.QuadPart;
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(handle);
+#else
+    struct stat st;
+    int flags = O_RDONLY;
+    int fd;
+
+#ifdef O_CLOEXEC
+    flags |= O_CLOEXEC;
+#endif
+    fd = open(file, flags);
+    if (fd < 0) {
+        return NULL;
+    }
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 && (Uint64)st.st_size <= SDL_SIZE_MAX) {
+        // The mapping stays valid after the descriptor is closed
+        mem = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mem == MAP_FAILED) {
+            mem = NULL;
+        } else {
+            size = (size_t)st.st_size;
+        }
+    }
+    close(fd);
+#endif
+
+    if (!mem) {
+        return NULL;
+    }
+
+    iodata = (IOStreamMemData *) SDL_calloc(1, sizeof (*iodata));
+    if (!iodata) {
+        goto failed;
+    }
+
+    SDL_INIT_INTERFACE(&iface);
+    iface.size = mem_size;
+    iface.seek = mem_seek;
+    iface.read = mem_read;
+    // leave iface.write as NULL.
+    iface.close = mapped_close;
+    iface.read_at = mem_read_at;
+
+    iodata->base = (Uint8 *)mem;
+    iodata->here = iodata->base;
+    iodata->stop = iodata->base + size;
+
+    iostr = SDL_OpenIO(&iface, iodata);
+    if (!iostr) {
+        SDL_free(iodata);
+        goto failed;
+    }
+
+    props = SDL_GetIOProperties(iostr);
+    if (props) {
+        iodata->props = props;
+        SDL_SetPointerProperty(props, SDL_PROP_IOSTREAM_MEMORY_POINTER, mem);
+        SDL_SetNumberProperty(props, SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER, size);
+    }
+    return iostr;
+
+failed:
+#ifdef SDL_PLATFORM_WINDOWS
+    UnmapViewOfFile(mem);
+#else
+    munmap(mem, size);
+#endif
+    return NULL;
+}
+#endif // HAVE_MMAP || SDL_PLATFORM_WINDOWS
+
 // Functions to create SDL_IOStream structures from various data sources
 
 #if defined(HAVE_STDIO_H) && !defined(SDL_PLATFORM_WINDOWS)
@@ -869,19 +1183,10 @@ static bool IsRegularFileOrPipe(FILE *f)
 }
 #endif
 
-SDL_IOStream *SDL_IOFromFile(const char *file, const char *mode)
+static SDL_IOStream *IOFromFile(const char *file, const char *mode)
 {
     SDL_IOStream *iostr = NULL;
 
-    if (!file || !*file) {
-        SDL_InvalidParamError("file");
-        return NULL;
-    }
-    if (!mode || !*mode) {
-        SDL_InvalidParamError("mode");
-        return NULL;
-    }
-
 #ifdef SDL_PLATFORM_ANDROID
 #ifdef HAVE_STDIO_H
     // Try to open the file on the filesystem first
@@ -987,6 +1292,50 @@ SDL_IOStream *SDL_IOFromFile(const char *file, const char *mode)
     return iostr;
 }
 
+SDL_IOStream *SDL_IOFromFile(const char *file, const char *mode)
+{
+    if (!file || !*file) {
+        SDL_InvalidParamError("file");
+        return NULL;
+    }
+    if (!mode || !*mode) {
+        SDL_InvalidParamError("mode");
+        return NULL;
+    }
+
+    if (SDL_strchr(mode, 'm')) {
+        SDL_IOStream *iostr;
+        char *plain_mode;
+        char *src, *dst;
+
+#ifdef HAVE_MAPPED_FILES
+        if (IsReadOnlyMode(mode)) {
+            iostr = IOFromMappedFile(file);
+            if (iostr) {
+                return iostr;
+            }
+        }
+#endif
+
+        // Fall back to regular file access, without handing 'm' to the C runtime
+        plain_mode = SDL_strdup(mode);
+        if (!plain_mode) {
+            return NULL;
+        }
+        for (src = dst = plain_mode; *src; ++src) {
+            if (*src != 'm') {
+                *dst++ = *src;
+            }
+        }
+        *dst = '\0';
+        iostr = IOFromFile(file, plain_mode);
+        SDL_free(plain_mode);
+        return iostr;
+    }
+
+    return IOFromFile(file, mode);
+}
+
 SDL_IOStream *SDL_IOFromMem(void *mem, size_t size)
 {
     if (!mem) {
@@ -1009,6 +1358,8 @@ SDL_IOStream *SDL_IOFromMem(void *mem, size_t size)
     iface.read = mem_read;
     iface.write = mem_write;
     iface.close = mem_close;
+    iface.read_at = mem_read_at;
+    iface.write_at = mem_write_at;
 
     iodata->base = (Uint8 *)mem;
     iodata->here = iodata->base;
@@ -1050,6 +1401,7 @@ SDL_IOStream *SDL_IOFromConstMem(const void *mem, size_t size)
     iface.read = mem_read;
     // leave iface.write as NULL.
     iface.close = mem_close;
+    iface.read_at = mem_read_at;
 
     iodata->base = (Uint8 *)mem;
     iodata->here = iodata->base;
@@ -1189,7 +1541,8 @@ SDL_IOStream *SDL_OpenIO(const SDL_IOStreamInterface *iface, void *userdata)
         SDL_InvalidParamError("iface");
         return NULL;
     }
-    if (iface->version < sizeof(*iface)) {
+    // SDL 3.2 interfaces end before read_at, the positional members stay NULL
+    if (iface->version < offsetof(SDL_IOStreamInterface, read_at)) {
         // Update this to handle older versions of this interface
         SDL_SetError("Invalid interface, should be initialized with SDL_INIT_INTERFACE()");
         return NULL;
@@ -1197,18 +1550,141 @@ SDL_IOStream *SDL_OpenIO(const SDL_IOStreamInterface *iface, void *userdata)
 
     SDL_IOStream *iostr = (SDL_IOStream *)SDL_calloc(1, sizeof(*iostr));
     if (iostr) {
-        SDL_copyp(&iostr->iface, iface);
+        SDL_memcpy(&iostr->iface, iface, SDL_min(iface->version, sizeof(*iface)));
+        iostr->iface.version = sizeof(iostr->iface);
         iostr->userdata = userdata;
     }
     return iostr;
 }
 
+// The buffered paths go through these, so they always know where the interface is
+static Sint64 InterfaceSeek(SDL_IOStream *context, Sint64 offset, SDL_IOWhence whence)
+{
+    const Sint64 pos = context->iface.seek(context->userdata, offset, whence);
+    context->iface_pos = (pos < 0) ? -1 : pos;
+    return pos;
+}
+
+static Sint64 InterfacePosition(SDL_IOStream *context)
+{
+    if (context->iface_pos < 0) {
+        return InterfaceSeek(context, 0, SDL_IO_SEEK_CUR);
+    }
+    return context->iface_pos;
+}
+
+static size_t InterfaceRead(SDL_IOStream *context, void *ptr, size_t size)
+{
+    const size_t amount = context->iface.read(context->userdata, ptr, size, &context->status);
+    if (context->iface_pos >= 0) {
+        context->iface_pos += (Sint64)amount;
+    }
+    return amount;
+}
+
+static size_t InterfaceWrite(SDL_IOStream *context, const void *ptr, size_t size)
+{
+    const size_t amount = context->iface.write(context->userdata, ptr, size, &context->status);
+    if (context->iface_pos >= 0) {
+        context->iface_pos += (Sint64)amount;
+    }
+    return amount;
+}
+
+// Hands buffered writes to the interface, keeping whatever couldn't be written
+static bool FlushBufferedWrites(SDL_IOStream *context)
+{
+    size_t written = 0;
+
+    context->status = SDL_IO_STATUS_READY;
+
+    while (written < context->buffer_len) {
+        const size_t amount = InterfaceWrite(context, context->buffer + written, context->buffer_len - written);
+        written += amount;
+        if (amount == 0 || context->status != SDL_IO_STATUS_READY) {
+            break;
+        }
+    }
+
+    if (written < context->buffer_len) {
+        SDL_memmove(context->buffer, context->buffer + written, context->buffer_len - written);
+        context->buffer_len -= written;
+        if (context->status == SDL_IO_STATUS_READY) {
+            context->status = SDL_IO_STATUS_ERROR;
+        }
+        return false;
+    }
+
+    context->buffer_len = 0;
+    context->buffer_dirty = false;
+    return true;
+}
+
+// Moves the interface back to the logical position, so data read ahead can be thrown away
+static bool DropReadAhead(SDL_IOStream *context)
+{
+    const size_t unread = context->buffer_len - context->buffer_pos;
+
+    if (unread > 0 && InterfaceSeek(context, -(Sint64)unread, SDL_IO_SEEK_CUR) < 0) {
+        return false;
+    }
+    context->buffer_pos = 0;
+    context->buffer_len = 0;
+    return true;
+}
+
+// Brings the interface in line with the logical position of the stream and empties the buffer
+static bool SyncBuffer(SDL_IOStream *context)
+{
+    if (context->buffer_dirty) {
+        return FlushBufferedWrites(context);
+    }
+    return DropReadAhead(context);
+}
+
+bool SDL_SetIOBufferSize(SDL_IOStream *context, size_t size)
+{
+    Uint8 *buffer = NULL;
+
+    if (!context) {
+        return SDL_InvalidParamError("context");
+    } else if (size > 0 && !context->iface.seek) {
+        return SDL_SetError("Buffering requires a seekable stream");
+    } else if (size == context->buffer_size) {
+        return true;
+    }
+
+    if (size > 0) {
+        buffer = (Uint8 *)SDL_malloc(size);
+        if (!buffer) {
+            return false;
+        }
+    }
+
+    if (!SyncBuffer(context)) {
+        SDL_free(buffer);
+        return false;
+    }
+
+    SDL_free(context->buffer);
+    context->buffer = buffer;
+    context->buffer_size = size;
+    context->buffer_pos = 0;
+    context->buffer_len = 0;
+    context->iface_pos = -1;  // unbuffered calls don't keep track, ask again when it's needed
+    return true;
+}
+
 bool SDL_CloseIO(SDL_IOStream *iostr)
 {
     bool result = true;
     if (iostr) {
-        if (iostr->iface.close) {
-            result = iostr->iface.close(iostr->userdata);
+        if (iostr->buffer_dirty && !FlushBufferedWrites(iostr)) {
+            result = false;
+        }
+        SDL_free(iostr->buffer);
+        if (iostr->iface.close && !iostr->iface.close(iostr->userdata)) {
+            result = false;
         }
         SDL_DestroyProperties(iostr->props);
         SDL_free(iostr);
@@ -1232,13 +1708,25 @@ void *SDL_LoadFile_IO(SDL_IOStream *src, size_t *datasize, bool closeio)
 
     size = SDL_GetIOSize(src);
     if (size < 0) {
-        size = FILE_CHUNK_SIZE;
+        // Start from the caller's guess, if any, don't create properties just to look
+        size = src->props ? SDL_GetNumberProperty(src->props, SDL_PROP_IOSTREAM_LOAD_SIZE_HINT_NUMBER, 0) : 0;
+        if (size < FILE_CHUNK_SIZE) {
+            size = FILE_CHUNK_SIZE;
+        }
         loading_chunks = true;
     }
-    if (size >= SDL_SIZE_MAX - 1) {
-        goto done;
+    if ((Uint64)size >= SDL_SIZE_MAX - 1) {
+        if (!loading_chunks) {
+            SDL_OutOfMemory();
+            goto done;
+        }
+        size = FILE_CHUNK_SIZE;  // the hint is only a guess, don't fail over it
     }
     data = (char *)SDL_malloc((size_t)(size + 1));
+    if (!data && loading_chunks && size > FILE_CHUNK_SIZE) {
+        size = FILE_CHUNK_SIZE;
+        data = (char *)SDL_malloc((size_t)(size + 1));
+    }
     if (!data) {
         goto done;
     }
@@ -1247,11 +1735,17 @@ void *SDL_LoadFile_IO(SDL_IOStream *src, size_t *datasize, bool closeio)
     for (;;) {
         if (loading_chunks) {
             if ((size_total + FILE_CHUNK_SIZE) > size) {
-                size = (size_total + FILE_CHUNK_SIZE);
-                if (size >= SDL_SIZE_MAX - 1) {
-                    newdata = NULL;
+                // Double the buffer so large pipes take a logarithmic number of reallocs, without overflowing
+                const Sint64 max_size = (Sint64)SDL_min((Uint64)SDL_MAX_SINT64, (Uint64)SDL_SIZE_MAX - 2);
+                Sint64 new_size = (size > max_size / 2) ? max_size : (size * 2);
+                if (new_size < size_total + FILE_CHUNK_SIZE && size_total <= max_size - FILE_CHUNK_SIZE) {
+                    new_size = size_total + FILE_CHUNK_SIZE;
+                }
+                if (new_size > size) {
+                    newdata = (char *)SDL_realloc(data, (size_t)(new_size + 1));
+                    size = new_size;
                 } else {
-                    newdata = (char *)SDL_realloc(data, (size_t)(size + 1));
+                    newdata = (size_total < size) ? data : NULL;
                 }
                 if (!newdata) {
                     SDL_free(data);
@@ -1276,6 +1770,14 @@ void *SDL_LoadFile_IO(SDL_IOStream *src, size_t *datasize, bool closeio)
         break;
     }
 
+    // Give back the slack from growing, shrinking in place can't fail in practice
+    if (loading_chunks && size_total < size) {
+        newdata = (char *)SDL_realloc(data, (size_t)(size_total + 1));
+        if (newdata) {
+            data = newdata;
+        }
+    }
+
     data[size_total] = '\0';
 
 done:
@@ -1370,6 +1872,9 @@ Sint64 SDL_GetIOSize(SDL_IOStream *context)
     if (!context) {
         return SDL_InvalidParamError("context");
     }
+    if (context->buffer_dirty && !FlushBufferedWrites(context)) {
+        return -1;
+    }
     if (!context->iface.size) {
         Sint64 pos, size;
 
@@ -1385,6 +1890,59 @@ Sint64 SDL_GetIOSize(SDL_IOStream *context)
     return context->iface.size(context->userdata);
 }
 
+const void *SDL_PeekIOMemoryRange(SDL_IOStream *context, Uint64 offset, size_t *size)
+{
+    const Uint8 *base = NULL;
+    Uint64 total = 0;
+
+    if (context->props) {
+        base = (const Uint8 *)SDL_GetPointerProperty(context->props, SDL_PROP_IOSTREAM_MEMORY_POINTER, NULL);
+        if (base) {
+            total = (Uint64)SDL_GetNumberProperty(context->props, SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER, 0);
+        } else {
+            base = (const Uint8 *)SDL_GetPointerProperty(context->props, SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER, NULL);
+            if (base) {
+                const Sint64 dynamic_size = SDL_GetIOSize(context);
+                total = (dynamic_size > 0) ? (Uint64)dynamic_size : 0;
+            }
+        }
+    }
+
+    if (!base || offset > total) {
+        *size = 0;
+        return NULL;
+    }
+
+    if ((Uint64)*size > (total - offset)) {
+        *size = (size_t)(total - offset);
+    }
+    return base + offset;
+}
+
+const void *SDL_GetIOMemoryRange(SDL_IOStream *context, Uint64 offset, size_t *size)
+{
+    const void *range;
+
+    if (!context) {
+        SDL_InvalidParamError("context");
+        return NULL;
+    } else if (!size) {
+        SDL_InvalidParamError("size");
+        return NULL;
+    }
+
+    range = SDL_PeekIOMemoryRange(context, offset, size);
+    if (!range) {
+        if (!SDL_GetPointerProperty(context->props, SDL_PROP_IOSTREAM_MEMORY_POINTER, NULL) &&
+            !SDL_GetPointerProperty(context->props, SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER, NULL)) {
+            SDL_SetError("Stream isn't backed by memory");
+        } else {
+            SDL_SetError("Offset is past the end of the stream");
+        }
+    }
+    return range;
+}
+
 Sint64 SDL_SeekIO(SDL_IOStream *context, Sint64 offset, SDL_IOWhence whence)
 {
     if (!context) {
@@ -1394,6 +1952,46 @@ Sint64 SDL_SeekIO(SDL_IOStream *context, Sint64 offset, SDL_IOWhence whence)
         SDL_Unsupported();
         return -1;
     }
+
+    if (context->buffer_dirty) {
+        if (whence == SDL_IO_SEEK_CUR && offset == 0) {
+            // SDL_TellIO() shouldn't cost a flush
+            const Sint64 pos = InterfacePosition(context);
+            return (pos < 0) ? pos : pos + (Sint64)context->buffer_len;
+        }
+        if (!FlushBufferedWrites(context)) {
+            return -1;
+        }
+    } else if (context->buffer) {
+        // Seeks that land inside the read-ahead data (or stay put) don't need to touch the interface
+        const Sint64 end = InterfacePosition(context);
+        const Sint64 start = end - (Sint64)context->buffer_len;
+        const Sint64 pos = start + (Sint64)context->buffer_pos;
+        Sint64 target = -1;
+
+        if (end < 0) {
+            return -1;
+        }
+        if (whence == SDL_IO_SEEK_SET) {
+            target = offset;
+        } else if (whence == SDL_IO_SEEK_CUR) {
+            target = pos + offset;
+        }
+        if (target >= start && target <= end) {
+            context->buffer_pos = (size_t)(target - start);
+            return target;
+        }
+
+        context->buffer_pos = 0;
+        context->buffer_len = 0;
+        if (whence == SDL_IO_SEEK_CUR) {
+            whence = SDL_IO_SEEK_SET;
+            offset = target;
+        }
+    }
+    if (context->buffer) {
+        return InterfaceSeek(context, offset, whence);
+    }
     return context->iface.seek(context->userdata, offset, whence);
 }
 
@@ -1402,6 +2000,88 @@ Sint64 SDL_TellIO(SDL_IOStream *context)
     return SDL_SeekIO(context, 0, SDL_IO_SEEK_CUR);
 }
 
+static size_t ReadBuffered(SDL_IOStream *context, void *ptr, size_t size)
+{
+    Uint8 *dst = (Uint8 *)ptr;
+    size_t total = 0;
+
+    if (context->buffer_dirty && !FlushBufferedWrites(context)) {
+        return 0;
+    }
+
+    while (total < size) {
+        size_t amount;
+
+        if (context->buffer_pos == context->buffer_len) {
+            if (context->status != SDL_IO_STATUS_READY) {
+                break;  // EOF or an error while filling the buffer
+            }
+            context->buffer_pos = 0;
+            context->buffer_len = 0;
+            if ((size - total) >= context->buffer_size) {
+                // Large reads go straight to the caller's memory
+                total += InterfaceRead(context, dst + total, size - total);
+                break;
+            }
+            context->buffer_len = InterfaceRead(context, context->buffer, context->buffer_size);
+            if (context->buffer_len == 0) {
+                break;
+            }
+        }
+
+        amount = SDL_min(context->buffer_len - context->buffer_pos, size - total);
+        SDL_memcpy(dst + total, context->buffer + context->buffer_pos, amount);
+        context->buffer_pos += amount;
+        total += amount;
+    }
+    return total;
+}
+
+static size_t WriteBuffered(SDL_IOStream *context, const void *ptr, size_t size)
+{
+    if (!context->buffer_dirty && !DropReadAhead(context)) {
+        context->status = SDL_IO_STATUS_ERROR;
+        return 0;
+    }
+
+    if (context->buffer_len + size > context->buffer_size) {
+        if (context->buffer_len > 0 && !FlushBufferedWrites(context)) {
+            return 0;
+        }
+        if (size >= context->buffer_size) {
+            return InterfaceWrite(context, ptr, size);
+        }
+    }
+
+    SDL_memcpy(context->buffer + context->buffer_len, ptr, size);
+    context->buffer_len += size;
+    context->buffer_dirty = true;
+    return size;
+}
+
+// The value readers and writers copy straight to and from the buffer when they can
+static SDL_INLINE bool ReadValue(SDL_IOStream *src, void *value, size_t size)
+{
+    if (src && !src->buffer_dirty && (src->buffer_len - src->buffer_pos) >= size) {
+        SDL_memcpy(value, src->buffer + src->buffer_pos, size);
+        src->buffer_pos += size;
+        src->status = SDL_IO_STATUS_READY;
+        return true;
+    }
+    return SDL_ReadIO(src, value, size) == size;
+}
+
+static SDL_INLINE bool WriteValue(SDL_IOStream *dst, const void *value, size_t size)
+{
+    if (dst && dst->buffer_dirty && (dst->buffer_size - dst->buffer_len) >= size) {
+        SDL_memcpy(dst->buffer + dst->buffer_len, value, size);
+        dst->buffer_len += size;
+        dst->status = SDL_IO_STATUS_READY;
+        return true;
+    }
+    return SDL_WriteIO(dst, value, size) == size;
+}
+
 size_t SDL_ReadIO(SDL_IOStream *context, void *ptr, size_t size)
 {
     if (!context) {
@@ -1418,6 +2098,9 @@ size_t SDL_ReadIO(SDL_IOStream *context, void *ptr, size_t size)
     context->status = SDL_IO_STATUS_READY;
     SDL_ClearError();
 
+    if (context->buffer) {
+        return ReadBuffered(context, ptr, size);
+    }
     return context->iface.read(context->userdata, ptr, size, &context->status);
 }
 
@@ -1437,6 +2120,9 @@ size_t SDL_WriteIO(SDL_IOStream *context, const void *ptr, size_t size)
     context->status = SDL_IO_STATUS_READY;
     SDL_ClearError();
 
+    if (context->buffer) {
+        return WriteBuffered(context, ptr, size);
+    }
     return context->iface.write(context->userdata, ptr, size, &context->status);
 }
 
@@ -1475,6 +2161,69 @@ size_t SDL_IOvprintf(SDL_IOStream *context, SDL_PRINTF_FORMAT_STRING const char
     return bytes;
 }
 
+// Positional access goes around the stream buffer, so it's only offered for unbuffered streams
+bool SDL_IOHasPositionalRead(SDL_IOStream *context)
+{
+    return context && context->iface.read_at && !context->buffer;
+}
+
+bool SDL_IOHasPositionalWrite(SDL_IOStream *context)
+{
+    return context && context->iface.write_at && !context->buffer;
+}
+
+size_t SDL_ReadIOAt(SDL_IOStream *context, void *ptr, size_t size, Uint64 offset, SDL_IOStatus *status)
+{
+    SDL_IOStatus unused;
+    if (!status) {
+        status = &unused;
+    }
+    *status = SDL_IO_STATUS_READY;
+
+    if (!context) {
+        SDL_InvalidParamError("context");
+        *status = SDL_IO_STATUS_ERROR;
+        return 0;
+    } else if (!context->iface.read_at) {
+        SDL_Unsupported();
+        *status = SDL_IO_STATUS_ERROR;
+        return 0;
+    } else if (context->buffer) {
+        SDL_SetError("Positional read isn't available on buffered streams");
+        *status = SDL_IO_STATUS_ERROR;
+        return 0;
+    } else if (size == 0) {
+        return 0;
+    }
+    return context->iface.read_at(context->userdata, ptr, size, offset, status);
+}
+
+size_t SDL_WriteIOAt(SDL_IOStream *context, const void *ptr, size_t size, Uint64 offset, SDL_IOStatus *status)
+{
+    SDL_IOStatus unused;
+    if (!status) {
+        status = &unused;
+    }
+    *status = SDL_IO_STATUS_READY;
+
+    if (!context) {
+        SDL_InvalidParamError("context");
+        *status = SDL_IO_STATUS_ERROR;
+        return 0;
+    } else if (!context->iface.write_at) {
+        SDL_Unsupported();
+        *status = SDL_IO_STATUS_ERROR;
+        return 0;
+    } else if (context->buffer) {
+        SDL_SetError("Positional write isn't available on buffered streams");
+        *status = SDL_IO_STATUS_ERROR;
+        return 0;
+    } else if (size == 0) {
+        return 0;
+    }
+    return context->iface.write_at(context->userdata, ptr, size, offset, status);
+}
+
 bool SDL_FlushIO(SDL_IOStream *context)
 {
     bool result = true;
@@ -1486,6 +2235,9 @@ bool SDL_FlushIO(SDL_IOStream *context)
     context->status = SDL_IO_STATUS_READY;
     SDL_ClearError();
 
+    if (context->buffer_dirty && !FlushBufferedWrites(context)) {
+        return false;
+    }
     if (context->iface.flush) {
         result = context->iface.flush(context->userdata, &context->status);
     }
@@ -1502,7 +2254,7 @@ bool SDL_ReadU8(SDL_IOStream *src, Uint8 *value)
     Uint8 data = 0;
     bool result = false;
 
-    if (SDL_ReadIO(src, &data, sizeof(data)) == sizeof(data)) {
+    if (ReadValue(src, &data, sizeof(data))) {
         result = true;
     }
     if (value) {
@@ -1516,7 +2268,7 @@ bool SDL_ReadS8(SDL_IOStream *src, Sint8 *value)
     Sint8 data = 0;
     bool result = false;
 
-    if (SDL_ReadIO(src, &data, sizeof(data)) == sizeof(data)) {
+    if (ReadValue(src, &data, sizeof(data))) {
         result = true;
     }
     if (value) {
@@ -1530,7 +2282,7 @@ bool SDL_ReadU16LE(SDL_IOStream *src, Uint16 *value)
     Uint16 data = 0;
     bool result = false;
 
-    if (SDL_ReadIO(src, &data, sizeof(data)) == sizeof(data)) {
+    if (ReadValue(src, &data, sizeof(data))) {
         result = true;
     }
     if (value) {
@@ -1549,7 +2301,7 @@ bool SDL_ReadU16BE(SDL_IOStream *src, Uint16 *value)
     Uint16 data = 0;
     bool result = false;
 
-    if (SDL_ReadIO(src, &data, sizeof(data)) == sizeof(data)) {
+    if (ReadValue(src, &data, sizeof(data))) {
         result = true;
     }
     if (value) {
@@ -1568,7 +2320,7 @@ bool SDL_ReadU32LE(SDL_IOStream *src, Uint32 *value)
     Uint32 data = 0;
     bool result = false;
 
-    if (SDL_ReadIO(src, &data, sizeof(data)) == sizeof(data)) {
+    if (ReadValue(src, &data, sizeof(data))) {
         result = true;
     }
     if (value) {
@@ -1587,7 +2339,7 @@ bool SDL_ReadU32BE(SDL_IOStream *src, Uint32 *value)
     Uint32 data = 0;
     bool result = false;
 
-    if (SDL_ReadIO(src, &data, sizeof(data)) == sizeof(data)) {
+    if (ReadValue(src, &data, sizeof(data))) {
         result = true;
     }
     if (value) {
@@ -1606,7 +2358,7 @@ bool SDL_ReadU64LE(SDL_IOStream *src, Uint64 *value)
     Uint64 data = 0;
     bool result = false;
 
-    if (SDL_ReadIO(src, &data, sizeof(data)) == sizeof(data)) {
+    if (ReadValue(src, &data, sizeof(data))) {
         result = true;
     }
     if (value) {
@@ -1625,7 +2377,7 @@ bool SDL_ReadU64BE(SDL_IOStream *src, Uint64 *value)
     Uint64 data = 0;
     bool result = false;
 
-    if (SDL_ReadIO(src, &data, sizeof(data)) == sizeof(data)) {
+    if (ReadValue(src, &data, sizeof(data))) {
         result = true;
     }
     if (value) {
@@ -1641,18 +2393,18 @@ bool SDL_ReadS64BE(SDL_IOStream *src, Sint64 *value)
 
 bool SDL_WriteU8(SDL_IOStream *dst, Uint8 value)
 {
-    return (SDL_WriteIO(dst, &value, sizeof(value)) == sizeof(value));
+    return WriteValue(dst, &value, sizeof(value));
 }
 
 bool SDL_WriteS8(SDL_IOStream *dst, Sint8 value)
 {
-    return (SDL_WriteIO(dst, &value, sizeof(value)) == sizeof(value));
+    return WriteValue(dst, &value, sizeof(value));
 }
 
 bool SDL_WriteU16LE(SDL_IOStream *dst, Uint16 value)
 {
     const Uint16 swapped = SDL_Swap16LE(value);
-    return (SDL_WriteIO(dst, &swapped, sizeof(swapped)) == sizeof(swapped));
+    return WriteValue(dst, &swapped, sizeof(swapped));
 }
 
 bool SDL_WriteS16LE(SDL_IOStream *dst, Sint16 value)
@@ -1663,7 +2415,7 @@ bool SDL_WriteS16LE(SDL_IOStream *dst, Sint16 value)
 bool SDL_WriteU16BE(SDL_IOStream *dst, Uint16 value)
 {
     const Uint16 swapped = SDL_Swap16BE(value);
-    return (SDL_WriteIO(dst, &swapped, sizeof(swapped)) == sizeof(swapped));
+    return WriteValue(dst, &swapped, sizeof(swapped));
 }
 
 bool SDL_WriteS16BE(SDL_IOStream *dst, Sint16 value)
@@ -1674,7 +2426,7 @@ bool SDL_WriteS16BE(SDL_IOStream *dst, Sint16 value)
 bool SDL_WriteU32LE(SDL_IOStream *dst, Uint32 value)
 {
     const Uint32 swapped = SDL_Swap32LE(value);
-    return (SDL_WriteIO(dst, &swapped, sizeof(swapped)) == sizeof(swapped));
+    return WriteValue(dst, &swapped, sizeof(swapped));
 }
 
 bool SDL_WriteS32LE(SDL_IOStream *dst, Sint32 value)
@@ -1685,7 +2437,7 @@ bool SDL_WriteS32LE(SDL_IOStream *dst, Sint32 value)
 bool SDL_WriteU32BE(SDL_IOStream *dst, Uint32 value)
 {
     const Uint32 swapped = SDL_Swap32BE(value);
-    return (SDL_WriteIO(dst, &swapped, sizeof(swapped)) == sizeof(swapped));
+    return WriteValue(dst, &swapped, sizeof(swapped));
 }
 
 bool SDL_WriteS32BE(SDL_IOStream *dst, Sint32 value)
@@ -1696,7 +2448,7 @@ bool SDL_WriteS32BE(SDL_IOStream *dst, Sint32 value)
 bool SDL_WriteU64LE(SDL_IOStream *dst, Uint64 value)
 {
     const Uint64 swapped = SDL_Swap64LE(value);
-    return (SDL_WriteIO(dst, &swapped, sizeof(swapped)) == sizeof(swapped));
+    return WriteValue(dst, &swapped, sizeof(swapped));
 }
 
 bool SDL_WriteS64LE(SDL_IOStream *dst, Sint64 value)
@@ -1707,7 +2459,7 @@ bool SDL_WriteS64LE(SDL_IOStream *dst, Sint64 value)
 bool SDL_WriteU64BE(SDL_IOStream *dst, Uint64 value)
 {
     const Uint64 swapped = SDL_Swap64BE(value);
-    return (SDL_WriteIO(dst, &swapped, sizeof(swapped)) == sizeof(swapped));
+    return WriteValue(dst, &swapped, sizeof(swapped));
 }
 
 bool SDL_WriteS64BE(SDL_IOStream *dst, Sint64 value)
@@ -32,4 +32,7 @@ extern SDL_IOStream *SDL_IOFromFP(FILE *fp, bool autoclose);
 extern SDL_IOStream *SDL_IOFromFD(int fd, bool autoclose);
 #endif
 
+// Like SDL_GetIOMemoryRange(), but doesn't set an error for streams that aren't memory-backed
+extern const void *SDL_PeekIOMemoryRange(SDL_IOStream *context, Uint64 offset, size_t *size);
+
 #endif // SDL_iostream_c_h_
@@ -81,6 +81,10 @@ struct SDL_AsyncIOTask
     Uint64 requested_size;
     Uint64 result_size;
     void *app_userdata;
+    SDL_AsyncIORange *ranges;  // for SDL_ReadAsyncIORanges, NULL otherwise. Allocated with the task; requested_size is their total.
+    int num_ranges;
+    int ranges_pending;  // backends that complete a ranged task in several pieces count them down here, protected by asyncio->lock.
+    void *sys_data;  // backend-specific per-task allocation, SDL_free()'d along with the task.
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, asyncio);
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, queue);      // the generic backend uses this, so I've added it here to avoid the extra allocation.
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, threadpool); // the generic backend uses this, so I've added it here to avoid the extra allocation.
@@ -111,6 +115,7 @@ typedef struct SDL_AsyncIOInterface
 {
     Sint64 (*size)(void *userdata);
     bool (*read)(void *userdata, SDL_AsyncIOTask *task);
+    bool (*read_ranges)(void *userdata, SDL_AsyncIOTask *task);
     bool (*write)(void *userdata, SDL_AsyncIOTask *task);
     bool (*close)(void *userdata, SDL_AsyncIOTask *task);
     void (*destroy)(void *userdata);
@@ -126,6 +131,10 @@ struct SDL_AsyncIO
     bool oneshot;  // true if this is a SDL_LoadFileAsync open.
 };
 
+// Backends that split a ranged read into several requests call this as each one completes, with the number of bytes it
+//  read and whether it failed. Returns true when that was the last piece, and the task is ready to report.
+extern bool SDL_AsyncIORangePartComplete(SDL_AsyncIOTask *task, Uint64 transferred, bool failed);
+
 // This is implemented for various platforms; param validation is done before calling this. Open file, fill in iface and userdata.
 extern bool SDL_SYS_AsyncIOFromFile(const char *file, const char *mode, SDL_AsyncIO *asyncio);
 
@@ -25,6 +25,7 @@
 
 #include "SDL_internal.h"
 #include "../SDL_sysasyncio.h"
+#include "../SDL_iostream_c.h"
 
 // on Emscripten without threads, async i/o is synchronous. Sorry. Almost
 // everything is MEMFS, so it's just a memcpy anyhow, and the Emscripten
@@ -46,7 +47,7 @@ typedef struct GenericAsyncIOQueueData
 
 typedef struct GenericAsyncIOData
 {
-    SDL_Mutex *lock;  // !!! FIXME: we can skip this lock if we have an equivalent of pread/pwrite
+    SDL_Mutex *lock;  // only needed for streams without read_at/write_at, which have to seek first
     SDL_IOStream *io;
 } GenericAsyncIOData;
 
@@ -60,17 +61,85 @@ static void AsyncIOTaskComplete(SDL_AsyncIOTask *task)
     SDL_UnlockMutex(data->lock);
 }
 
+static void SetTaskResult(SDL_AsyncIOTask *task, bool writing, SDL_IOStatus status)
+{
+    if (task->result_size == task->requested_size) {
+        task->result = SDL_ASYNCIO_COMPLETE;
+    } else if (writing) {
+        task->result = SDL_ASYNCIO_FAILURE;  // it's always a failure on short writes.
+    } else {
+        SDL_assert(status != SDL_IO_STATUS_READY);  // this should have either failed or been EOF.
+        SDL_assert(status != SDL_IO_STATUS_NOT_READY);  // these should not be non-blocking reads!
+        task->result = (status == SDL_IO_STATUS_EOF) ? SDL_ASYNCIO_COMPLETE : SDL_ASYNCIO_FAILURE;
+    }
+}
+
+// a ranged read is a single task, so this worker thread just reads the ranges one after another.
+static void SynchronousReadRanges(SDL_AsyncIOTask *task)
+{
+    GenericAsyncIOData *data = (GenericAsyncIOData *) task->asyncio->userdata;
+    SDL_IOStream *io = data->io;
+    const bool positional = SDL_IOHasPositionalRead(io);
+    bool failed = false;
+
+    if (!positional) {
+        SDL_LockMutex(data->lock);  // see the comment about seeking in SynchronousIO.
+    }
+
+    for (int i = 0; !failed && (i < task->num_ranges); i++) {
+        const SDL_AsyncIORange *range = &task->ranges[i];
+        const size_t size = (size_t) range->size;
+        size_t br = 0;
+        if (positional) {
+            SDL_IOStatus status;
+            br = SDL_ReadIOAt(io, range->ptr, size, range->offset, &status);
+        } else if (SDL_SeekIO(io, (Sint64) range->offset, SDL_IO_SEEK_SET) >= 0) {
+            br = SDL_ReadIO(io, range->ptr, size);
+        }
+        task->result_size += (Uint64) br;
+        failed = (br != size);  // short reads are failures for ranged tasks.
+    }
+
+    if (!positional) {
+        SDL_UnlockMutex(data->lock);
+    }
+
+    task->result = failed ? SDL_ASYNCIO_FAILURE : SDL_ASYNCIO_COMPLETE;
+    AsyncIOTaskComplete(task);
+}
+
 // synchronous i/o is offloaded onto the threadpool. This function does the threaded work.
 // This is called directly, without a threadpool, if !SDL_ASYNCIO_USE_THREADPOOL.
 static void SynchronousIO(SDL_AsyncIOTask *task)
 {
     SDL_assert(task->result != SDL_ASYNCIO_CANCELED);  // shouldn't have gotten in here if canceled!
 
+    if (task->ranges) {
+        SynchronousReadRanges(task);
+        return;
+    }
+
     GenericAsyncIOData *data = (GenericAsyncIOData *) task->asyncio->userdata;
     SDL_IOStream *io = data->io;
     const size_t size = (size_t) task->requested_size;
+    const bool writing = (task->type == SDL_ASYNCIO_TASK_WRITE);
     void *ptr = task->buffer;
 
+    // positional i/o doesn't share a file position, so reads from one file run in parallel.
+    // Close is only queued once every other task on this file has finished.
+    if ((task->type != SDL_ASYNCIO_TASK_CLOSE) &&
+        (writing ? SDL_IOHasPositionalWrite(io) : SDL_IOHasPositionalRead(io))) {
+        SDL_IOStatus status;
+        if (writing) {
+            task->result_size = (Uint64) SDL_WriteIOAt(io, ptr, size, task->offset, &status);
+        } else {
+            task->result_size = (Uint64) SDL_ReadIOAt(io, ptr, size, task->offset, &status);
+        }
+        SetTaskResult(task, writing, status);
+        AsyncIOTaskComplete(task);
+        return;
+    }
+
     // this seek won't work if two tasks are reading from the same file at the same time,
     // so we lock here. This makes multiple reads from a single file serialize, but different
     // files will still run in parallel. An app can also open the same file twice to avoid this.
@@ -85,20 +154,8 @@ static void SynchronousIO(SDL_AsyncIOTask *task)
     } else if (SDL_SeekIO(io, (Sint64) task->offset, SDL_IO_SEEK_SET) < 0) {
         task->result = SDL_ASYNCIO_FAILURE;
     } else {
-        const bool writing = (task->type == SDL_ASYNCIO_TASK_WRITE);
         task->result_size = (Uint64) (writing ? SDL_WriteIO(io, ptr, size) : SDL_ReadIO(io, ptr, size));
-        if (task->result_size == task->requested_size) {
-            task->result = SDL_ASYNCIO_COMPLETE;
-        } else {
-            if (writing) {
-                task->result = SDL_ASYNCIO_FAILURE;  // it's always a failure on short writes.
-            } else {
-                const SDL_IOStatus status = SDL_GetIOStatus(io);
-                SDL_assert(status != SDL_IO_STATUS_READY);  // this should have either failed or been EOF.
-                SDL_assert(status != SDL_IO_STATUS_NOT_READY);  // these should not be non-blocking reads!
-                task->result = (status == SDL_IO_STATUS_EOF) ? SDL_ASYNCIO_COMPLETE : SDL_ASYNCIO_FAILURE;
-            }
-        }
+        SetTaskResult(task, writing, SDL_GetIOStatus(io));
     }
     SDL_UnlockMutex(data->lock);
 
@@ -425,11 +482,15 @@ bool SDL_SYS_AsyncIOFromFile_Generic(const char *file, const char *mode, SDL_Asy
         return false;
     }
 
+    // Requests are whole reads and writes at explicit offsets, a read-ahead buffer would only add copies
+    SDL_SetIOBufferSize(data->io, 0);
+
     static const SDL_AsyncIOInterface SDL_AsyncIOFile_Generic = {
         generic_asyncio_size,
         generic_asyncio_io,
         generic_asyncio_io,
         generic_asyncio_io,
+        generic_asyncio_io,
         generic_asyncio_destroy
     };
 
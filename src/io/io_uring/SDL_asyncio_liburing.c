@@ -62,6 +62,7 @@ SDL_ELF_NOTE_DLOPEN(
     SDL_LIBURING_FUNC(int, io_uring_opcode_supported, (const struct io_uring_probe *p, int op)) \
     SDL_LIBURING_FUNC(struct io_uring_sqe *, io_uring_get_sqe, (struct io_uring *ring)) \
     SDL_LIBURING_FUNC(void, io_uring_prep_read,(struct io_uring_sqe *sqe, int fd, void *buf, unsigned nbytes, __u64 offset)) \
+    SDL_LIBURING_FUNC(void, io_uring_prep_readv,(struct io_uring_sqe *sqe, int fd, const struct iovec *iovecs, unsigned nr_vecs, __u64 offset)) \
     SDL_LIBURING_FUNC(void, io_uring_prep_write,(struct io_uring_sqe *sqe, int fd, const void *buf, unsigned nbytes, __u64 offset)) \
     SDL_LIBURING_FUNC(void, io_uring_prep_close, (struct io_uring_sqe *sqe, int fd)) \
     SDL_LIBURING_FUNC(void, io_uring_prep_fsync, (struct io_uring_sqe *sqe, int fd, unsigned fsync_flags)) \
@@ -71,6 +72,7 @@ SDL_ELF_NOTE_DLOPEN(
     SDL_LIBURING_FUNC(void, io_uring_sqe_set_data, (struct io_uring_sqe *sqe, void *data)) \
     SDL_LIBURING_FUNC(void, io_uring_sqe_set_flags, (struct io_uring_sqe *sqe, unsigned flags)) \
     SDL_LIBURING_FUNC(int, io_uring_submit, (struct io_uring *ring)) \
+    SDL_LIBURING_FUNC(unsigned, io_uring_sq_space_left, (const struct io_uring *ring)) \
     SDL_LIBURING_FUNC(int, io_uring_peek_cqe, (struct io_uring *ring, struct io_uring_cqe **cqe_ptr)) \
     SDL_LIBURING_FUNC(int, io_uring_wait_cqe, (struct io_uring *ring, struct io_uring_cqe **cqe_ptr)) \
     SDL_LIBURING_FUNC(int, io_uring_wait_cqe_timeout, (struct io_uring *ring, struct io_uring_cqe **cqe_ptr, struct __kernel_timespec *ts)) \
@@ -92,12 +94,19 @@ typedef struct SDL_LibUringFunctions
 static SDL_LibUringFunctions liburing;
 
 
+// Requests are submitted to the kernel in batches of this many, or sooner if anyone looks for results.
+#define MAX_PENDING_SQES 32
+
+// Linux's UIO_MAXIOV; a READV with more iovecs than this fails.
+#define MAX_IOVECS_PER_READ 1024
+
 typedef struct LibUringAsyncIOQueueData
 {
     SDL_Mutex *sqe_lock;
     SDL_Mutex *cqe_lock;
     struct io_uring ring;
     SDL_AtomicInt num_waiting;
+    int num_pending;  // requests prepared but not submitted yet, protected by sqe_lock.
 } LibUringAsyncIOQueueData;
 
 
@@ -187,12 +196,48 @@ static Sint64 liburing_asyncio_size(void *userdata)
     return ((Sint64) statbuf.st_size);
 }
 
+// you must hold sqe_lock when calling this!
+static bool SubmitPendingSQEs(LibUringAsyncIOQueueData *queuedata)
+{
+    if (queuedata->num_pending > 0) {
+        const int rc = liburing.io_uring_submit(&queuedata->ring);
+        if (rc < 0) {
+            return liburing_SetError("io_uring_submit", rc);  // they stay in the ring, the next submit will try again.
+        }
+        queuedata->num_pending = SDL_max(queuedata->num_pending - rc, 0);
+    }
+    return true;
+}
+
+// you must hold sqe_lock when calling this!
+static struct io_uring_sqe *GetSQE(LibUringAsyncIOQueueData *queuedata)
+{
+    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+    if (!sqe && (queuedata->num_pending > 0) && SubmitPendingSQEs(queuedata)) {
+        sqe = liburing.io_uring_get_sqe(&queuedata->ring);  // the ring was full of batched requests, there should be room now.
+    }
+    return sqe;
+}
+
+static void FlushPendingSQEs(LibUringAsyncIOQueueData *queuedata)
+{
+    SDL_LockMutex(queuedata->sqe_lock);
+    SubmitPendingSQEs(queuedata);
+    SDL_UnlockMutex(queuedata->sqe_lock);
+}
+
 // you must hold sqe_lock when calling this!
 static bool liburing_asyncioqueue_queue_task(void *userdata, SDL_AsyncIOTask *task)
 {
     LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
-    const int rc = liburing.io_uring_submit(&queuedata->ring);
-    return (rc < 0) ? liburing_SetError("io_uring_submit", rc) : true;
+
+    // a submit per request costs more than small reads do, so collect them. But if a thread is already blocked
+    // waiting for completions, it won't come back to submit them, so send them right away in that case.
+    queuedata->num_pending++;
+    if ((queuedata->num_pending >= MAX_PENDING_SQES) || (SDL_GetAtomicInt(&queuedata->num_waiting) > 0)) {
+        return SubmitPendingSQEs(queuedata);
+    }
+    return true;
 }
 
 static void liburing_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *task)
@@ -206,7 +251,7 @@ static void liburing_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *t
 
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
-    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+    struct io_uring_sqe *sqe = GetSQE(queuedata);
     if (!sqe) {
         SDL_UnlockMutex(queuedata->sqe_lock);
         SDL_free(cancel_task);  // oh well, the task can just finish on its own.
@@ -237,6 +282,9 @@ static SDL_AsyncIOTask *ProcessCQE(LibUringAsyncIOQueueData *queuedata, struct i
             } else {
                 task = NULL; // it already finished or was too far along to cancel, so we'll pick up the actual results later.
             }
+        } else if (task->ranges) {  // one of the reads of a ranged task; only report it when they're all done.
+            const bool finished = SDL_AsyncIORangePartComplete(task, (cqe->res > 0) ? (Uint64) cqe->res : 0, (cqe->res < 0));
+            return finished ? task : NULL;
         } else if (cqe->res < 0) {
             task->result = SDL_ASYNCIO_FAILURE;
             // !!! FIXME: fill in task->error.
@@ -265,6 +313,9 @@ static SDL_AsyncIOTask *liburing_asyncioqueue_get_results(void *userdata)
 {
     LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
 
+    // anything still sitting in the batch can't complete until it's submitted.
+    FlushPendingSQEs(queuedata);
+
     // have to hold a lock because otherwise two threads will get the same cqe until we mark it "seen". Copy and mark it right away, then process further.
     SDL_LockMutex(queuedata->cqe_lock);
     struct io_uring_cqe *cqe = NULL;
@@ -289,6 +340,7 @@ static SDL_AsyncIOTask *liburing_asyncioqueue_wait_results(void *userdata, Sint3
     struct io_uring_cqe *cqe = NULL;
 
     SDL_AddAtomicInt(&queuedata->num_waiting, 1);
+    FlushPendingSQEs(queuedata);  // after num_waiting is bumped, so new requests get submitted immediately while we sleep.
     if (timeoutMS < 0) {
         liburing.io_uring_wait_cqe(&queuedata->ring, &cqe);
     } else {
@@ -311,14 +363,15 @@ static void liburing_asyncioqueue_signal(void *userdata)
 
     SDL_LockMutex(queuedata->sqe_lock);
     for (int i = 0; i < num_waiting; i++) {  // !!! FIXME: is there a better way to do this than pushing a zero-timeout request for everything waiting?
-        struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+        struct io_uring_sqe *sqe = GetSQE(queuedata);
         if (sqe) {
             static struct __kernel_timespec ts;   // no wait, just wake a thread as fast as this can land in the completion queue.
             liburing.io_uring_prep_timeout(sqe, &ts, 0, 0);
             liburing.io_uring_sqe_set_data(sqe, NULL);
+            queuedata->num_pending++;
         }
     }
-    liburing.io_uring_submit(&queuedata->ring);
+    SubmitPendingSQEs(queuedata);
 
     SDL_UnlockMutex(queuedata->sqe_lock);
 }
@@ -392,7 +445,7 @@ static bool liburing_asyncio_read(void *userdata, SDL_AsyncIOTask *task)
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
     bool retval;
-    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+    struct io_uring_sqe *sqe = GetSQE(queuedata);
     if (!sqe) {
         retval = SDL_SetError("io_uring: submission queue is full");
     } else {
@@ -404,6 +457,85 @@ static bool liburing_asyncio_read(void *userdata, SDL_AsyncIOTask *task)
     return retval;
 }
 
+// How many ranges, starting at `first`, can share one read request: they have to be back-to-back in the file,
+//  and their total has to fit in a CQE's (signed int) result.
+static int RangesInReadRequest(const SDL_AsyncIORange *ranges, int num_ranges, int first)
+{
+    Uint64 total = ranges[first].size;
+    int count = 1;
+    while (((first + count) < num_ranges) && (count < MAX_IOVECS_PER_READ)) {
+        const SDL_AsyncIORange *prev = &ranges[first + count - 1];
+        const SDL_AsyncIORange *range = &ranges[first + count];
+        if ((range->offset != (prev->offset + prev->size)) || ((total + range->size) > SDL_MAX_SINT32)) {
+            break;
+        }
+        total += range->size;
+        count++;
+    }
+    return count;
+}
+
+static bool liburing_asyncio_read_ranges(void *userdata, SDL_AsyncIOTask *task)
+{
+    LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) task->queue->userdata;
+    const int fd = (int) (intptr_t) userdata;
+    const SDL_AsyncIORange *ranges = task->ranges;
+    const int num_ranges = task->num_ranges;
+
+    int num_requests = 0;
+    for (int i = 0; i < num_ranges; i++) {
+        if (ranges[i].size > SDL_MAX_SINT32) {
+            return SDL_SetError("io_uring: i/o task is too large");
+        }
+    }
+    for (int i = 0; i < num_ranges; i += RangesInReadRequest(ranges, num_ranges, i)) {
+        num_requests++;
+    }
+
+    // READV needs the iovecs to stay put until the kernel picks up the request, so they live as long as the task.
+    struct iovec *iov = (struct iovec *) SDL_malloc(num_ranges * sizeof (struct iovec));
+    if (!iov) {
+        return false;
+    }
+    task->sys_data = iov;  // freed with the task, even if we fail here.
+    for (int i = 0; i < num_ranges; i++) {
+        iov[i].iov_base = ranges[i].ptr;
+        iov[i].iov_len = (size_t) ranges[i].size;
+    }
+
+    // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
+    SDL_LockMutex(queuedata->sqe_lock);
+
+    // a ranged task can't be half-queued, so make sure all its requests fit in the ring before taking any sqes.
+    if (liburing.io_uring_sq_space_left(&queuedata->ring) < (unsigned) num_requests) {
+        SubmitPendingSQEs(queuedata);
+        if (liburing.io_uring_sq_space_left(&queuedata->ring) < (unsigned) num_requests) {
+            SDL_UnlockMutex(queuedata->sqe_lock);
+            return SDL_SetError("io_uring: submission queue is full");
+        }
+    }
+
+    // nothing of ours gets submitted before queue_task, below, so no piece can complete before this is set.
+    task->ranges_pending = num_requests;
+
+    for (int i = 0; i < num_ranges;) {
+        const int count = RangesInReadRequest(ranges, num_ranges, i);
+        struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);  // can't fail, we checked for space.
+        if (count == 1) {
+            liburing.io_uring_prep_read(sqe, fd, ranges[i].ptr, (unsigned) ranges[i].size, ranges[i].offset);
+        } else {
+            liburing.io_uring_prep_readv(sqe, fd, &iov[i], (unsigned) count, ranges[i].offset);
+        }
+        liburing.io_uring_sqe_set_data(sqe, task);
+        i += count;
+    }
+
+    queuedata->num_pending += num_requests - 1;  // queue_task counts the last one.
+    const bool retval = task->queue->iface.queue_task(task->queue->userdata, task);
+    SDL_UnlockMutex(queuedata->sqe_lock);
+    return retval;
+}
+
 static bool liburing_asyncio_write(void *userdata, SDL_AsyncIOTask *task)
 {
     LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) task->queue->userdata;
@@ -418,7 +550,7 @@ static bool liburing_asyncio_write(void *userdata, SDL_AsyncIOTask *task)
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
     bool retval;
-    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+    struct io_uring_sqe *sqe = GetSQE(queuedata);
     if (!sqe) {
         retval = SDL_SetError("io_uring: submission queue is full");
     } else {
@@ -438,13 +570,13 @@ static bool liburing_asyncio_close(void *userdata, SDL_AsyncIOTask *task)
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
     bool retval;
-    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+    struct io_uring_sqe *sqe = GetSQE(queuedata);
     if (!sqe) {
         retval = SDL_SetError("io_uring: submission queue is full");
     } else {
         if (task->flush) {
             struct io_uring_sqe *flush_sqe = sqe;
-            sqe = liburing.io_uring_get_sqe(&queuedata->ring);  // this will be our actual close task.
+            sqe = liburing.io_uring_get_sqe(&queuedata->ring);  // this will be our actual close task. Not GetSQE: that could submit flush_sqe before it's filled in.
             if (!sqe) {
                 liburing.io_uring_prep_nop(flush_sqe);  // we already have the first sqe, just make it a NOP.
                 liburing.io_uring_sqe_set_data(flush_sqe, NULL);
@@ -455,6 +587,7 @@ static bool liburing_asyncio_close(void *userdata, SDL_AsyncIOTask *task)
             liburing.io_uring_prep_fsync(flush_sqe, fd, IORING_FSYNC_DATASYNC);
             liburing.io_uring_sqe_set_data(flush_sqe, task);
             liburing.io_uring_sqe_set_flags(flush_sqe, IOSQE_IO_HARDLINK);  // must complete before next sqe starts, and next sqe should run even if this fails.
+            queuedata->num_pending++;  // queue_task below only counts the close.
         }
 
         liburing.io_uring_prep_close(sqe, fd);
@@ -501,6 +634,7 @@ static bool SDL_SYS_AsyncIOFromFile_liburing(const char *file, const char *mode,
     static const SDL_AsyncIOInterface SDL_AsyncIOFile_liburing = {
         liburing_asyncio_size,
         liburing_asyncio_read,
+        liburing_asyncio_read_ranges,
         liburing_asyncio_write,
         liburing_asyncio_close,
         liburing_asyncio_destroy
@@ -519,7 +653,9 @@ static void SDL_SYS_QuitAsyncIO_liburing(void)
 static void MaybeInitializeLibUring(void)
 {
     if (SDL_ShouldInit(&liburing_init)) {
-        if (LoadLibUring()) {
+        const char *hint = SDL_GetHint(SDL_HINT_ASYNCIO_DRIVER);
+        const bool force_generic = (hint && SDL_strcasecmp(hint, "generic") == 0);
+        if (!force_generic && LoadLibUring()) {
             SDL_DebugLogBackend("asyncio", "liburing");
             CreateAsyncIOQueue = SDL_SYS_CreateAsyncIOQueue_liburing;
             QuitAsyncIO = SDL_SYS_QuitAsyncIO_liburing;
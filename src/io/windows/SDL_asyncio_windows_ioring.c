@@ -199,6 +199,10 @@ static SDL_AsyncIOTask *ProcessCQE(WinIoRingAsyncIOQueueData *queuedata, IORING_
             } else {
                 task = NULL; // it already finished or was too far along to cancel, so we'll pick up the actual results later.
             }
+        } else if (task->ranges) {  // one of the reads of a ranged task; only report it when they're all done.
+            const bool failed = FAILED(cqe->ResultCode);
+            const bool finished = SDL_AsyncIORangePartComplete(task, failed ? 0 : (Uint64) cqe->Information, failed);
+            return finished ? task : NULL;
         } else if (FAILED(cqe->ResultCode)) {
             task->result = SDL_ASYNCIO_FAILURE;
             // !!! FIXME: fill in task->error.
@@ -397,6 +401,49 @@ static bool ioring_asyncio_read(void *userdata, SDL_AsyncIOTask *task)
     return retval;
 }
 
+// IoRing has no vectored read, so each range is its own request and ProcessCQE counts them down.
+static bool ioring_asyncio_read_ranges(void *userdata, SDL_AsyncIOTask *task)
+{
+    for (int i = 0; i < task->num_ranges; i++) {
+        if (task->ranges[i].size > 0xFFFFFFFF) {
+            return SDL_SetError("ioring: i/o task is too large");
+        }
+    }
+
+    HANDLE handle = (HANDLE) userdata;
+    WinIoRingAsyncIOQueueData *queuedata = (WinIoRingAsyncIOQueueData *) task->queue->userdata;
+    IORING_HANDLE_REF href = IoRingHandleRefFromHandle(handle);
+
+    // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
+    // This also means nothing built here is submitted before queue_task, below, so no piece can complete early.
+    SDL_LockMutex(queuedata->sqe_lock);
+    HRESULT hr = S_OK;
+    int built = 0;
+    while (built < task->num_ranges) {
+        const SDL_AsyncIORange *range = &task->ranges[built];
+        IORING_BUFFER_REF bref = IoRingBufferRefFromPointer(range->ptr);
+        hr = ioring.BuildIoRingReadFile(queuedata->ring, href, bref, (UINT32) range->size, range->offset, (UINT_PTR) task, IOSQE_FLAGS_NONE);
+        if (FAILED(hr)) {
+            break;
+        }
+        built++;
+    }
+
+    bool retval;
+    if (built == 0) {
+        retval = WIN_SetErrorFromHRESULT("BuildIoRingReadFile", hr);
+    } else {
+        // the requests that were built can't be taken back, so if the ring filled up partway, let those run and report a failure.
+        if (built < task->num_ranges) {
+            task->result = SDL_ASYNCIO_FAILURE;
+        }
+        task->ranges_pending = built;
+        retval = task->queue->iface.queue_task(task->queue->userdata, task);
+    }
+    SDL_UnlockMutex(queuedata->sqe_lock);
+    return retval;
+}
+
 static bool ioring_asyncio_write(void *userdata, SDL_AsyncIOTask *task)
 {
     // !!! FIXME: UINT32 smaller than requested_size's Uint64. If we overflow it, we could try submitting multiple SQEs
@@ -491,6 +538,7 @@ static bool SDL_SYS_AsyncIOFromFile_ioring(const char *file, const char *mode, S
     static const SDL_AsyncIOInterface SDL_AsyncIOFile_ioring = {
         ioring_asyncio_size,
         ioring_asyncio_read,
+        ioring_asyncio_read_ranges,
         ioring_asyncio_write,
         ioring_asyncio_close,
         ioring_asyncio_destroy
@@ -510,7 +558,9 @@ static void SDL_SYS_QuitAsyncIO_ioring(void)
 static void MaybeInitializeWinIoRing(void)
 {
     if (SDL_ShouldInit(&ioring_init)) {
-        if (LoadWinIoRing()) {
+        const char *hint = SDL_GetHint(SDL_HINT_ASYNCIO_DRIVER);
+        const bool force_generic = (hint && SDL_strcasecmp(hint, "generic") == 0);
+        if (!force_generic && LoadWinIoRing()) {
             SDL_DebugLogBackend("asyncio", "ioring");
             CreateAsyncIOQueue = SDL_SYS_CreateAsyncIOQueue_ioring;
             QuitAsyncIO = SDL_SYS_QuitAsyncIO_ioring;
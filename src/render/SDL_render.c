@@ -48,6 +48,11 @@ this should probably be removed at some point in the future.  --ryan. */
 
 #define SDL_PROP_WINDOW_RENDERER_POINTER "SDL.internal.window.renderer"
 #define SDL_PROP_TEXTURE_PARENT_POINTER "SDL.internal.texture.parent"
+#define SDL_PROP_TEXTURE_CREATE_ATLAS_BOOLEAN "SDL.internal.texture.create.atlas"
+
+#define TEXTURE_ATLAS_PAGE_SIZE         1024
+#define TEXTURE_ATLAS_MAX_ENTRY_SIZE    128
+#define TEXTURE_ATLAS_PADDING           1
 
 #define CHECK_RENDERER_MAGIC_BUT_NOT_DESTROYED_FLAG(renderer, result)   \
     if (!SDL_ObjectValid(renderer, SDL_OBJECT_TYPE_RENDERER)) {         \
@@ -307,6 +312,196 @@ static SDL_INLINE void DebugLogRenderCommands(const SDL_RenderCommand *cmd)
 #endif
 }
 
+// A run of compatible draws that will be sent to the backend back to back.
+typedef struct SDL_RenderDrawBatch
+{
+    SDL_RenderCommand *head;
+    SDL_RenderCommand *tail;
+    SDL_FRect bounds;
+} SDL_RenderDrawBatch;
+
+// How many batches back a draw may be moved to join one with the same state.
+#define REORDER_DRAWS_LOOKBACK 32
+
+static bool IsReorderableDraw(const SDL_RenderCommand *cmd)
+{
+    return (cmd->command == SDL_RENDERCMD_GEOMETRY) && (cmd->data.draw.bounds.w >= 0.0f);
+}
+
+static bool IsSameDrawState(const SDL_RenderCommand *a, const SDL_RenderCommand *b)
+{
+    return a->command == b->command &&
+           a->data.draw.texture == b->data.draw.texture &&
+           a->data.draw.blend == b->data.draw.blend &&
+           a->data.draw.texture_scale_mode == b->data.draw.texture_scale_mode &&
+           a->data.draw.texture_address_mode_u == b->data.draw.texture_address_mode_u &&
+           a->data.draw.texture_address_mode_v == b->data.draw.texture_address_mode_v &&
+           a->data.draw.color_scale == b->data.draw.color_scale &&
+           a->data.draw.gpu_render_state == b->data.draw.gpu_render_state;
+}
+
+/* Rasterization doesn't fill pixels on the right and bottom edges of a
+   triangle, so draws whose bounds only share an edge don't touch the same
+   pixels. SDL_HasRectIntersectionFloat() counts a shared edge as an overlap,
+   which would keep neighboring tiles from being regrouped. */
+static bool DrawBoundsOverlap(const SDL_FRect *a, const SDL_FRect *b)
+{
+    return a->x < b->x + b->w && b->x < a->x + a->w &&
+           a->y < b->y + b->h && b->y < a->y + a->h;
+}
+
+/* Regroup a run of geometry commands, which are back to back in the command
+   queue and in vertex_data, so draws that share state end up adjacent and the
+   backend can merge them. A draw only moves ahead of draws it doesn't overlap,
+   so the result looks the same as drawing in the original order. The run's
+   vertices are written to `vertices` in the new order, which is either
+   vertex_data itself or backend memory that nothing is read back from. */
+static bool ReorderDrawRun(SDL_Renderer *renderer, SDL_RenderCommand *first, SDL_RenderCommand *last, int count, Uint8 *vertices, SDL_RenderCommand **head, SDL_RenderCommand **tail)
+{
+    if (renderer->reorder_batches_allocation < count) {
+        SDL_RenderDrawBatch *ptr = (SDL_RenderDrawBatch *)SDL_realloc(renderer->reorder_batches, count * sizeof(*ptr));
+        if (!ptr) {
+            return false;
+        }
+        renderer->reorder_batches = ptr;
+        renderer->reorder_batches_allocation = count;
+    }
+
+    const size_t span_start = first->data.draw.first;
+    const size_t span_bytes = (last->data.draw.first + last->data.draw.vertex_bytes) - span_start;
+    const bool in_place = (vertices == (Uint8 *)renderer->vertex_data);
+    if (in_place && renderer->reorder_vertex_data_allocation < span_bytes) {
+        void *ptr = SDL_realloc(renderer->reorder_vertex_data, span_bytes);
+        if (!ptr) {
+            return false;
+        }
+        renderer->reorder_vertex_data = ptr;
+        renderer->reorder_vertex_data_allocation = span_bytes;
+    }
+
+    SDL_RenderDrawBatch *batches = renderer->reorder_batches;
+    SDL_RenderCommand *end = last->next;
+    SDL_RenderCommand *cmd = first;
+    int num_batches = 0;
+    bool moved = false;
+
+    while (cmd != end) {
+        SDL_RenderCommand *next = cmd->next;
+        const int lookback_end = SDL_max(num_batches - REORDER_DRAWS_LOOKBACK, 0);
+        int i;
+
+        cmd->next = NULL;
+        for (i = num_batches - 1; i >= lookback_end; --i) {
+            SDL_RenderDrawBatch *batch = &batches[i];
+            if (IsSameDrawState(batch->head, cmd)) {
+                break;
+            } else if (DrawBoundsOverlap(&batch->bounds, &cmd->data.draw.bounds)) {
+                i = -1; // can't move in front of something we draw on top of.
+                break;
+            }
+        }
+
+        if (i >= lookback_end) {
+            SDL_RenderDrawBatch *batch = &batches[i];
+            batch->tail->next = cmd;
+            batch->tail = cmd;
+            SDL_GetRectUnionFloat(&batch->bounds, &cmd->data.draw.bounds, &batch->bounds);
+            if (i != num_batches - 1) {
+                moved = true;
+            }
+        } else {
+            SDL_RenderDrawBatch *batch = &batches[num_batches++];
+            batch->head = batch->tail = cmd;
+            batch->bounds = cmd->data.draw.bounds;
+        }
+        cmd = next;
+    }
+
+    // Link the batches back together, moving each draw's vertices to match the new order.
+    const Uint8 *source = (const Uint8 *)renderer->vertex_data;
+    size_t source_start = 0;
+    size_t offset = span_start;
+    if (moved && in_place) {
+        SDL_memcpy(renderer->reorder_vertex_data, source + span_start, span_bytes);
+        source = (const Uint8 *)renderer->reorder_vertex_data;
+        source_start = span_start;
+    } else if (!moved && !in_place) {
+        SDL_memcpy(vertices + span_start, source + span_start, span_bytes);
+    }
+    for (int i = 0; i < num_batches; ++i) {
+        if (i > 0) {
+            batches[i - 1].tail->next = batches[i].head;
+        }
+        if (moved) {
+            for (cmd = batches[i].head; cmd; cmd = cmd->next) {
+                SDL_memcpy(vertices + offset, source + (cmd->data.draw.first - source_start), cmd->data.draw.vertex_bytes);
+                cmd->data.draw.first = offset;
+                offset += cmd->data.draw.vertex_bytes;
+            }
+        }
+    }
+
+    *head = batches[0].head;
+    *tail = batches[num_batches - 1].tail;
+    return true;
+}
+
+// Reorders the command queue, writing the final vertex data to `vertices`
+static void ReorderRenderCommands(SDL_Renderer *renderer, Uint8 *vertices)
+{
+    const Uint8 *source = (const Uint8 *)renderer->vertex_data;
+    const bool in_place = (vertices == source);
+    SDL_RenderCommand *prev = NULL;
+    SDL_RenderCommand *cmd = renderer->render_commands;
+    size_t copied = 0;
+
+    while (cmd) {
+        if (!IsReorderableDraw(cmd)) {
+            prev = cmd;
+            cmd = cmd->next;
+            continue;
+        }
+
+        // find the end of this run of geometry; it stops at any state change or other draw type.
+        SDL_RenderCommand *last = cmd;
+        int count = 1;
+        while (last->next && IsReorderableDraw(last->next) &&
+               (last->next->data.draw.first == (last->data.draw.first + last->data.draw.vertex_bytes))) {
+            last = last->next;
+            ++count;
+        }
+
+        SDL_RenderCommand *end = last->next;
+        SDL_RenderCommand *head, *tail;
+        const size_t span_start = cmd->data.draw.first;
+        const size_t span_end = last->data.draw.first + last->data.draw.vertex_bytes;
+        if (!in_place && count > 2) {
+            // Copy everything up to this run, the run itself is copied as it's reordered
+            SDL_memcpy(vertices + copied, source + copied, span_start - copied);
+            copied = span_start;
+        }
+        if (count > 2 && ReorderDrawRun(renderer, cmd, last, count, vertices, &head, &tail)) {
+            copied = span_end;
+            if (prev) {
+                prev->next = head;
+            } else {
+                renderer->render_commands = head;
+            }
+            tail->next = end;
+            if (!end) {
+                renderer->render_commands_tail = tail;
+            }
+            last = tail;
+        }
+        prev = last;
+        cmd = end;
+    }
+
+    if (!in_place) {
+        SDL_memcpy(vertices + copied, source + copied, renderer->vertex_data_used - copied);
+    }
+}
+
 static bool FlushRenderCommands(SDL_Renderer *renderer)
 {
     bool result;
@@ -318,9 +513,26 @@ static bool FlushRenderCommands(SDL_Renderer *renderer)
         return true;
     }
 
+    /* Vertices are always queued in CPU memory. Backends that can draw from
+       mapped memory get the final vertex data written there directly, after
+       any reordering, so it isn't copied again before it's used. */
+    Uint8 *vertices = (Uint8 *)renderer->vertex_data;
+    if (renderer->AcquireVertexMemory && renderer->vertex_data_used > 0) {
+        void *ptr = renderer->AcquireVertexMemory(renderer, renderer->vertex_data_used);
+        if (ptr) {
+            vertices = (Uint8 *)ptr;
+        }
+    }
+
+    if (renderer->reorder_draws) {
+        ReorderRenderCommands(renderer, vertices);
+    } else if (vertices != renderer->vertex_data) {
+        SDL_memcpy(vertices, renderer->vertex_data, renderer->vertex_data_used);
+    }
+
     DebugLogRenderCommands(renderer->render_commands);
 
-    result = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
+    result = renderer->RunCommandQueue(renderer, renderer->render_commands, vertices, renderer->vertex_data_used);
 
     // Move the whole render command queue to the unused pool so we can reuse them next time.
     if (renderer->render_commands_tail) {
@@ -586,10 +798,17 @@ static SDL_RenderCommand *PrepQueueCmdDraw(SDL_Renderer *renderer, const SDL_Ren
             cmd->data.draw.texture = texture;
             if (texture) {
                 cmd->data.draw.texture_scale_mode = texture->scaleMode;
+                if (texture->atlas_page) {
+                    // Atlased textures draw from their page, with their own color, blend and scale mode
+                    cmd->data.draw.texture = texture->atlas_page->texture;
+                    cmd->data.draw.texture->last_command_generation = renderer->render_command_generation;
+                }
             }
             cmd->data.draw.texture_address_mode_u = SDL_TEXTURE_ADDRESS_CLAMP;
             cmd->data.draw.texture_address_mode_v = SDL_TEXTURE_ADDRESS_CLAMP;
             cmd->data.draw.gpu_render_state = renderer->gpu_render_state;
+            cmd->data.draw.bounds.w = -1.0f;  // set once the draw is queued, if the backend can reorder draws.
+            cmd->data.draw.vertex_bytes = 0;
             if (renderer->gpu_render_state) {
                 renderer->gpu_render_state->last_command_generation = renderer->render_command_generation;
             }
@@ -598,6 +817,37 @@ static SDL_RenderCommand *PrepQueueCmdDraw(SDL_Renderer *renderer, const SDL_Ren
     return cmd;
 }
 
+static void GetGeometryBounds(const float *xy, int xy_stride, int num_vertices, float scale_x, float scale_y, SDL_FRect *bounds)
+{
+    float minx, miny, maxx, maxy;
+    int i;
+
+    if (num_vertices <= 0) {
+        bounds->w = -1.0f;
+        return;
+    }
+
+    minx = maxx = xy[0] * scale_x;
+    miny = maxy = xy[1] * scale_y;
+    for (i = 1; i < num_vertices; ++i) {
+        const float *xy_ = (const float *)((const Uint8 *)xy + i * xy_stride);
+        const float x = xy_[0] * scale_x;
+        const float y = xy_[1] * scale_y;
+        minx = SDL_min(minx, x);
+        maxx = SDL_max(maxx, x);
+        miny = SDL_min(miny, y);
+        maxy = SDL_max(maxy, y);
+    }
+
+    bounds->x = minx;
+    bounds->y = miny;
+    bounds->w = maxx - minx;
+    bounds->h = maxy - miny;
+    if (!(bounds->w >= 0.0f && bounds->h >= 0.0f) || SDL_isinf(bounds->w) || SDL_isinf(bounds->h)) {
+        bounds->w = -1.0f; // NaN or infinity, don't try to reorder this one.
+    }
+}
+
 static bool QueueCmdDrawPoints(SDL_Renderer *renderer, const SDL_FPoint *points, const int count)
 {
     SDL_RenderCommand *cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_DRAW_POINTS, NULL);
@@ -682,6 +932,9 @@ static bool QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, co
 
                 if (!result) {
                     cmd->command = SDL_RENDERCMD_NO_OP;
+                } else if (renderer->reorder_draws) {
+                    cmd->data.draw.vertex_bytes = renderer->vertex_data_used - cmd->data.draw.first;
+                    GetGeometryBounds(xy, xy_stride, num_vertices, 1.0f, 1.0f, &cmd->data.draw.bounds);
                 }
             }
             SDL_small_free(xy, isstack1);
@@ -697,12 +950,27 @@ static bool QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, co
     return result;
 }
 
+// Offset a source rectangle of an atlased texture into its atlas page
+static const SDL_FRect *GetAtlasSrcRect(const SDL_Texture *texture, const SDL_FRect *srcrect, SDL_FRect *atlas_srcrect)
+{
+    if (!texture->atlas_page) {
+        return srcrect;
+    }
+    atlas_srcrect->x = srcrect->x + texture->atlas_rect.x;
+    atlas_srcrect->y = srcrect->y + texture->atlas_rect.y;
+    atlas_srcrect->w = srcrect->w;
+    atlas_srcrect->h = srcrect->h;
+    return atlas_srcrect;
+}
+
 static bool QueueCmdCopy(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_FRect *srcrect, const SDL_FRect *dstrect)
 {
     SDL_RenderCommand *cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_COPY, texture);
     bool result = false;
     if (cmd) {
-        result = renderer->QueueCopy(renderer, cmd, texture, srcrect, dstrect);
+        SDL_FRect atlas_srcrect;
+        srcrect = GetAtlasSrcRect(texture, srcrect, &atlas_srcrect);
+        result = renderer->QueueCopy(renderer, cmd, cmd->data.draw.texture, srcrect, dstrect);
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
         }
@@ -717,7 +985,9 @@ static bool QueueCmdCopyEx(SDL_Renderer *renderer, SDL_Texture *texture,
     SDL_RenderCommand *cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_COPY_EX, texture);
     bool result = false;
     if (cmd) {
-        result = renderer->QueueCopyEx(renderer, cmd, texture, srcquad, dstrect, angle, center, flip, scale_x, scale_y);
+        SDL_FRect atlas_srcquad;
+        srcquad = GetAtlasSrcRect(texture, srcquad, &atlas_srcquad);
+        result = renderer->QueueCopyEx(renderer, cmd, cmd->data.draw.texture, srcquad, dstrect, angle, center, flip, scale_x, scale_y);
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
         }
@@ -736,17 +1006,48 @@ static bool QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
 {
     SDL_RenderCommand *cmd;
     bool result = false;
+    float *atlas_uv = NULL;
+    bool atlas_uv_isstack = false;
     cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_GEOMETRY, texture);
     if (cmd) {
+        if (texture && texture->atlas_page) {
+            // Remap the texture coordinates into the atlas page, which can only be sampled clamped
+            const SDL_Rect *area = &texture->atlas_rect;
+            const SDL_Texture *page = cmd->data.draw.texture;
+            int i;
+
+            atlas_uv = SDL_small_alloc(float, num_vertices * 2, &atlas_uv_isstack);
+            if (!atlas_uv) {
+                cmd->command = SDL_RENDERCMD_NO_OP;
+                return false;
+            }
+            for (i = 0; i < num_vertices; ++i) {
+                const float *uv_ = (const float *)((const char *)uv + i * uv_stride);
+                const float u = SDL_clamp(uv_[0], 0.0f, 1.0f);
+                const float v = SDL_clamp(uv_[1], 0.0f, 1.0f);
+                atlas_uv[i * 2 + 0] = (area->x + u * area->w) / page->w;
+                atlas_uv[i * 2 + 1] = (area->y + v * area->h) / page->h;
+            }
+            uv = atlas_uv;
+            uv_stride = 2 * sizeof(float);
+            texture_address_mode_u = SDL_TEXTURE_ADDRESS_CLAMP;
+            texture_address_mode_v = SDL_TEXTURE_ADDRESS_CLAMP;
+        }
         cmd->data.draw.texture_address_mode_u = texture_address_mode_u;
         cmd->data.draw.texture_address_mode_v = texture_address_mode_v;
-        result = renderer->QueueGeometry(renderer, cmd, texture,
+        result = renderer->QueueGeometry(renderer, cmd, cmd->data.draw.texture,
                                          xy, xy_stride,
                                          color, color_stride, uv, uv_stride,
                                          num_vertices, indices, num_indices, size_indices,
                                          scale_x, scale_y);
+        if (atlas_uv) {
+            SDL_small_free(atlas_uv, atlas_uv_isstack);
+        }
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else if (renderer->reorder_draws) {
+            cmd->data.draw.vertex_bytes = renderer->vertex_data_used - cmd->data.draw.first;
+            GetGeometryBounds(xy, xy_stride, num_vertices, scale_x, scale_y, &cmd->data.draw.bounds);
         }
     }
     return result;
@@ -1018,6 +1319,11 @@ SDL_Renderer *SDL_CreateRendererWithProperties(SDL_PropertiesID props)
         SDL_SetNumberProperty(props, SDL_PROP_RENDERER_CREATE_PRESENT_VSYNC_NUMBER, SDL_GetHintBoolean(SDL_HINT_RENDER_VSYNC, true));
     }
 
+    hint = SDL_GetHint(SDL_HINT_RENDER_TEXTURE_ATLAS);
+    if (hint && *hint) {
+        SDL_SetBooleanProperty(props, SDL_PROP_RENDERER_CREATE_TEXTURE_ATLAS_BOOLEAN, SDL_GetHintBoolean(SDL_HINT_RENDER_TEXTURE_ATLAS, false));
+    }
+
     if (surface) {
 #ifdef SDL_VIDEO_RENDER_SW
         const bool rc = SW_CreateRendererForSurface(renderer, surface, props);
@@ -1108,6 +1414,11 @@ SDL_Renderer *SDL_CreateRendererWithProperties(SDL_PropertiesID props)
         renderer->line_method = SDL_GetRenderLineMethod();
     }
 
+    // Atlasing only pays off when the backend has to switch textures between draws
+    if (!renderer->software) {
+        renderer->texture_atlas = SDL_GetBooleanProperty(props, SDL_PROP_RENDERER_CREATE_TEXTURE_ATLAS_BOOLEAN, false);
+    }
+
     renderer->scale_mode = SDL_SCALEMODE_LINEAR;
 
     renderer->SDR_white_point = 1.0f;
@@ -1394,6 +1705,240 @@ static SDL_PixelFormat GetClosestSupportedFormat(SDL_Renderer *renderer, SDL_Pix
     return renderer->texture_formats[0];
 }
 
+// Returns the y position a w x h rectangle would rest at if placed at the start of skyline segment `index`, or -1 if it doesn't fit
+static int FitTextureAtlasSkyline(const SDL_TextureAtlasPage *page, int index, int w, int h)
+{
+    const SDL_TextureAtlasSkyline *skyline = page->skyline;
+    int y = skyline[index].y;
+    int width_left = w;
+
+    if (skyline[index].x + w > page->texture->w) {
+        return -1;
+    }
+
+    while (width_left > 0 && index < page->num_skyline) {
+        if (skyline[index].y > y) {
+            y = skyline[index].y;
+        }
+        if (y + h > page->texture->h) {
+            return -1;
+        }
+        width_left -= skyline[index].w;
+        ++index;
+    }
+    if (width_left > 0) {
+        return -1;
+    }
+    return y;
+}
+
+static bool AddTextureAtlasSkyline(SDL_TextureAtlasPage *page, int index, int x, int y, int w)
+{
+    SDL_TextureAtlasSkyline *skyline;
+    int i;
+
+    if (page->num_skyline == page->max_skyline) {
+        const int max_skyline = page->max_skyline * 2;
+        skyline = (SDL_TextureAtlasSkyline *)SDL_realloc(page->skyline, max_skyline * sizeof(*skyline));
+        if (!skyline) {
+            return false;
+        }
+        page->skyline = skyline;
+        page->max_skyline = max_skyline;
+    }
+
+    skyline = page->skyline;
+    SDL_memmove(&skyline[index + 1], &skyline[index], (page->num_skyline - index) * sizeof(*skyline));
+    skyline[index].x = x;
+    skyline[index].y = y;
+    skyline[index].w = w;
+    ++page->num_skyline;
+
+    // Trim or remove the segments now covered by the new one
+    i = index + 1;
+    while (i < page->num_skyline) {
+        const int covered = (skyline[i - 1].x + skyline[i - 1].w) - skyline[i].x;
+        if (covered <= 0) {
+            break;
+        }
+        skyline[i].x += covered;
+        skyline[i].w -= covered;
+        if (skyline[i].w > 0) {
+            break;
+        }
+        SDL_memmove(&skyline[i], &skyline[i + 1], (page->num_skyline - i - 1) * sizeof(*skyline));
+        --page->num_skyline;
+    }
+
+    // Merge neighbouring segments at the same height
+    i = 0;
+    while (i < page->num_skyline - 1) {
+        if (skyline[i].y == skyline[i + 1].y) {
+            skyline[i].w += skyline[i + 1].w;
+            SDL_memmove(&skyline[i + 1], &skyline[i + 2], (page->num_skyline - i - 2) * sizeof(*skyline));
+            --page->num_skyline;
+        } else {
+            ++i;
+        }
+    }
+    return true;
+}
+
+// Bottom-left skyline packing: place the rectangle where its far edge ends up lowest, preferring the tightest segment
+static bool PackTextureAtlasRect(SDL_TextureAtlasPage *page, int w, int h, SDL_Point *position)
+{
+    int best_index = -1;
+    int best_bottom = SDL_MAX_SINT32;
+    int best_width = SDL_MAX_SINT32;
+    int i;
+
+    for (i = 0; i < page->num_skyline; ++i) {
+        const int y = FitTextureAtlasSkyline(page, i, w, h);
+        if (y >= 0) {
+            const int bottom = y + h;
+            if (bottom < best_bottom || (bottom == best_bottom && page->skyline[i].w < best_width)) {
+                best_index = i;
+                best_bottom = bottom;
+                best_width = page->skyline[i].w;
+            }
+        }
+    }
+    if (best_index < 0) {
+        return false;
+    }
+
+    position->x = page->skyline[best_index].x;
+    position->y = best_bottom - h;
+    return AddTextureAtlasSkyline(page, best_index, position->x, best_bottom, w);
+}
+
+static SDL_TextureAtlasPage *CreateTextureAtlasPage(SDL_Renderer *renderer, SDL_PixelFormat format)
+{
+    SDL_TextureAtlasPage *page;
+    SDL_PropertiesID props;
+    int size = TEXTURE_ATLAS_PAGE_SIZE;
+    int max_texture_size = (int)SDL_GetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, 0);
+
+    if (max_texture_size && max_texture_size < size) {
+        size = max_texture_size;
+    }
+
+    page = (SDL_TextureAtlasPage *)SDL_calloc(1, sizeof(*page));
+    if (!page) {
+        return NULL;
+    }
+    page->max_skyline = 16;
+    page->skyline = (SDL_TextureAtlasSkyline *)SDL_malloc(page->max_skyline * sizeof(*page->skyline));
+    if (!page->skyline) {
+        SDL_free(page);
+        return NULL;
+    }
+    page->skyline[0].x = 0;
+    page->skyline[0].y = 0;
+    page->skyline[0].w = size;
+    page->num_skyline = 1;
+
+    props = SDL_CreateProperties();
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_COLORSPACE_NUMBER, SDL_COLORSPACE_SRGB);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_FORMAT_NUMBER, format);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_ACCESS_NUMBER, SDL_TEXTUREACCESS_STATIC);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_WIDTH_NUMBER, size);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_HEIGHT_NUMBER, size);
+    page->texture = SDL_CreateTextureWithProperties(renderer, props);
+    SDL_DestroyProperties(props);
+    if (!page->texture) {
+        SDL_free(page->skyline);
+        SDL_free(page);
+        return NULL;
+    }
+
+    page->next = renderer->atlas_pages;
+    renderer->atlas_pages = page;
+    return page;
+}
+
+static void DestroyTextureAtlasPage(SDL_Renderer *renderer, SDL_TextureAtlasPage *page)
+{
+    SDL_TextureAtlasPage *prev = NULL;
+    SDL_TextureAtlasPage *curr;
+
+    for (curr = renderer->atlas_pages; curr; prev = curr, curr = curr->next) {
+        if (curr == page) {
+            if (prev) {
+                prev->next = page->next;
+            } else {
+                renderer->atlas_pages = page->next;
+            }
+            break;
+        }
+    }
+
+    SDL_DestroyTexture(page->texture);
+    SDL_free(page->skyline);
+    SDL_free(page);
+}
+
+static bool IsTextureAtlasCandidate(SDL_Renderer *renderer, SDL_Texture *texture, SDL_PropertiesID props)
+{
+    if (!renderer->texture_atlas || !SDL_GetBooleanProperty(props, SDL_PROP_TEXTURE_CREATE_ATLAS_BOOLEAN, false)) {
+        return false;
+    }
+    if (texture->access != SDL_TEXTUREACCESS_STATIC ||
+        SDL_ISPIXELFORMAT_FOURCC(texture->format) ||
+        SDL_ISPIXELFORMAT_INDEXED(texture->format) ||
+        texture->colorspace != SDL_COLORSPACE_SRGB ||
+        texture->SDR_white_point != 1.0f) {
+        return false;
+    }
+    if (texture->w > TEXTURE_ATLAS_MAX_ENTRY_SIZE || texture->h > TEXTURE_ATLAS_MAX_ENTRY_SIZE) {
+        return false;
+    }
+    return true;
+}
+
+static bool AddTextureToAtlas(SDL_Renderer *renderer, SDL_Texture *texture)
+{
+    const int w = texture->w + 2 * TEXTURE_ATLAS_PADDING;
+    const int h = texture->h + 2 * TEXTURE_ATLAS_PADDING;
+    SDL_TextureAtlasPage *page;
+    SDL_Point position;
+
+    for (page = renderer->atlas_pages; page; page = page->next) {
+        if (page->texture->format == texture->format && PackTextureAtlasRect(page, w, h, &position)) {
+            break;
+        }
+    }
+    if (!page) {
+        page = CreateTextureAtlasPage(renderer, texture->format);
+        if (!page) {
+            return false;
+        }
+        if (!PackTextureAtlasRect(page, w, h, &position)) {
+            DestroyTextureAtlasPage(renderer, page);
+            return false;
+        }
+    }
+
+    texture->atlas_page = page;
+    texture->atlas_rect.x = position.x + TEXTURE_ATLAS_PADDING;
+    texture->atlas_rect.y = position.y + TEXTURE_ATLAS_PADDING;
+    texture->atlas_rect.w = texture->w;
+    texture->atlas_rect.h = texture->h;
+    ++page->num_entries;
+    return true;
+}
+
+static void RemoveTextureFromAtlas(SDL_Texture *texture)
+{
+    SDL_TextureAtlasPage *page = texture->atlas_page;
+
+    // Space isn't reclaimed until every texture in the page is gone
+    texture->atlas_page = NULL;
+    if (--page->num_entries == 0) {
+        DestroyTextureAtlasPage(texture->renderer, page);
+    }
+}
+
 SDL_Texture *SDL_CreateTextureWithProperties(SDL_Renderer *renderer, SDL_PropertiesID props)
 {
     SDL_Texture *texture;
@@ -1475,7 +2020,9 @@ SDL_Texture *SDL_CreateTextureWithProperties(SDL_Renderer *renderer, SDL_Propert
     texture_is_fourcc_and_target = (access == SDL_TEXTUREACCESS_TARGET && SDL_ISPIXELFORMAT_FOURCC(format));
 
     if (!texture_is_fourcc_and_target && IsSupportedFormat(renderer, format)) {
-        if (!renderer->CreateTexture(renderer, texture, props)) {
+        if (IsTextureAtlasCandidate(renderer, texture, props) && AddTextureToAtlas(renderer, texture)) {
+            // The pixels live in a shared atlas page, nothing for the backend to create
+        } else if (!renderer->CreateTexture(renderer, texture, props)) {
             SDL_DestroyTexture(texture);
             return NULL;
         }
@@ -1800,6 +2347,7 @@ SDL_Texture *SDL_CreateTextureFromSurface(SDL_Renderer *renderer, SDL_Surface *s
     SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_ACCESS_NUMBER, SDL_TEXTUREACCESS_STATIC);
     SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_WIDTH_NUMBER, surface->w);
     SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_HEIGHT_NUMBER, surface->h);
+    SDL_SetBooleanProperty(props, SDL_PROP_TEXTURE_CREATE_ATLAS_BOOLEAN, true);
     texture = SDL_CreateTextureWithProperties(renderer, props);
     SDL_DestroyProperties(props);
     if (!texture) {
@@ -2139,6 +2687,56 @@ static bool SDL_UpdateTextureNative(SDL_Texture *texture, const SDL_Rect *rect,
     return true;
 }
 
+static bool SDL_UpdateTextureAtlas(SDL_Texture *texture, const SDL_Rect *rect,
+                                   const void *pixels, int pitch)
+{
+    const int bpp = SDL_BYTESPERPIXEL(texture->format);
+    const bool pad_left = (rect->x == 0);
+    const bool pad_right = (rect->x + rect->w == texture->w);
+    const bool pad_top = (rect->y == 0);
+    const bool pad_bottom = (rect->y + rect->h == texture->h);
+    SDL_Rect atlas_rect;
+    int temp_pitch;
+    Uint8 *temp_pixels;
+    Uint8 *dst;
+    bool result;
+    int row;
+
+    /* Replicate the edge texels into the padding around the texture, so
+       linear filtering at the edges never picks up neighbouring textures */
+    atlas_rect.x = texture->atlas_rect.x + rect->x - (pad_left ? 1 : 0);
+    atlas_rect.y = texture->atlas_rect.y + rect->y - (pad_top ? 1 : 0);
+    atlas_rect.w = rect->w + (pad_left ? 1 : 0) + (pad_right ? 1 : 0);
+    atlas_rect.h = rect->h + (pad_top ? 1 : 0) + (pad_bottom ? 1 : 0);
+
+    temp_pitch = atlas_rect.w * bpp;
+    temp_pixels = (Uint8 *)SDL_malloc((size_t)atlas_rect.h * temp_pitch);
+    if (!temp_pixels) {
+        return false;
+    }
+
+    dst = temp_pixels;
+    for (row = 0; row < atlas_rect.h; ++row) {
+        const int src_row = SDL_clamp(row - (pad_top ? 1 : 0), 0, rect->h - 1);
+        const Uint8 *src = (const Uint8 *)pixels + (size_t)src_row * pitch;
+
+        if (pad_left) {
+            SDL_memcpy(dst, src, bpp);
+            dst += bpp;
+        }
+        SDL_memcpy(dst, src, (size_t)rect->w * bpp);
+        dst += (size_t)rect->w * bpp;
+        if (pad_right) {
+            SDL_memcpy(dst, src + (size_t)(rect->w - 1) * bpp, bpp);
+            dst += bpp;
+        }
+    }
+
+    result = SDL_UpdateTexture(texture->atlas_page->texture, &atlas_rect, temp_pixels, temp_pitch);
+    SDL_free(temp_pixels);
+    return result;
+}
+
 bool SDL_UpdateTexture(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch)
 {
     SDL_Rect real_rect;
@@ -2170,6 +2768,8 @@ bool SDL_UpdateTexture(SDL_Texture *texture, const SDL_Rect *rect, const void *p
 #endif
     } else if (texture->native) {
         return SDL_UpdateTextureNative(texture, &real_rect, pixels, pitch);
+    } else if (texture->atlas_page) {
+        return SDL_UpdateTextureAtlas(texture, &real_rect, pixels, pitch);
     } else {
         SDL_Renderer *renderer = texture->renderer;
         if (!FlushRenderCommandsIfTextureNeeded(texture)) {
@@ -4349,13 +4949,16 @@ bool SDL_RenderTextureTiled(SDL_Renderer *renderer, SDL_Texture *texture, const
         dstrect = &full_dstrect;
     }
 
+    // Atlased textures share their page, so they can't repeat using texture coordinates
+    const bool is_atlased = (texture->atlas_page != NULL);
+
     if (texture->native) {
         texture = texture->native;
     }
 
     texture->last_command_generation = renderer->render_command_generation;
 
-    bool do_wrapping = !renderer->software &&
+    bool do_wrapping = !renderer->software && !is_atlased &&
                         (!srcrect ||
                             (real_srcrect.x == 0.0f && real_srcrect.y == 0.0f &&
                              real_srcrect.w == (float)texture->w && real_srcrect.h == (float)texture->h));
@@ -5170,6 +5773,18 @@ bool SDL_RenderGeometryRaw(SDL_Renderer *renderer,
         }
     }
 
+    if (texture && texture->atlas_page) {
+        // Atlased textures share their page, so they can only be sampled inside their own area
+        for (i = 0; i < num_vertices; ++i) {
+            const float *uv_ = (const float *)((const char *)uv + i * uv_stride);
+            if (!(uv_[0] >= 0.0f && uv_[0] <= 1.0f && uv_[1] >= 0.0f && uv_[1] <= 1.0f)) {
+                return SDL_SetError("Texture coordinates must be between 0 and 1 for atlased textures");
+            }
+        }
+        texture_address_mode_u = SDL_TEXTURE_ADDRESS_CLAMP;
+        texture_address_mode_v = SDL_TEXTURE_ADDRESS_CLAMP;
+    }
+
     if (texture) {
         texture->last_command_generation = renderer->render_command_generation;
     }
@@ -5339,6 +5954,9 @@ bool SDL_RenderPresent(SDL_Renderer *renderer)
 
     FlushRenderCommands(renderer); // time to send everything to the GPU!
 
+    SDL_SetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_DRAW_CALLS_NUMBER, renderer->draw_calls);
+    renderer->draw_calls = 0;
+
 #if DONT_DRAW_WHILE_HIDDEN
     // Don't present while we're hidden
     if (renderer->hidden) {
@@ -5394,7 +6012,14 @@ static void SDL_DestroyTextureInternal(SDL_Texture *texture, bool is_destroying)
 #endif
     SDL_free(texture->pixels);
 
-    renderer->DestroyTexture(renderer, texture);
+    if (texture->atlas_page) {
+        // The backend never created anything for this texture, its pixels live in the atlas page
+        if (!is_destroying) {
+            RemoveTextureFromAtlas(texture);
+        }
+    } else {
+        renderer->DestroyTexture(renderer, texture);
+    }
 
     SDL_DestroySurface(texture->locked_surface);
     texture->locked_surface = NULL;
@@ -5471,6 +6096,14 @@ void SDL_DestroyRendererWithoutFreeing(SDL_Renderer *renderer)
         SDL_assert(tex != renderer->textures); // satisfy static analysis.
     }
 
+    // The page textures were freed along with the rest
+    while (renderer->atlas_pages) {
+        SDL_TextureAtlasPage *page = renderer->atlas_pages;
+        renderer->atlas_pages = page->next;
+        SDL_free(page->skyline);
+        SDL_free(page);
+    }
+
     // Clean up renderer-specific resources
     if (renderer->DestroyRenderer) {
         renderer->DestroyRenderer(renderer);
@@ -5484,6 +6117,14 @@ void SDL_DestroyRendererWithoutFreeing(SDL_Renderer *renderer)
         SDL_free(renderer->vertex_data);
         renderer->vertex_data = NULL;
     }
+    if (renderer->reorder_vertex_data) {
+        SDL_free(renderer->reorder_vertex_data);
+        renderer->reorder_vertex_data = NULL;
+    }
+    if (renderer->reorder_batches) {
+        SDL_free(renderer->reorder_batches);
+        renderer->reorder_batches = NULL;
+    }
     if (renderer->texture_formats) {
         SDL_free(renderer->texture_formats);
         renderer->texture_formats = NULL;
@@ -70,6 +70,23 @@ typedef struct SDL_RenderViewState
     SDL_FPoint current_scale;  // this is just `scale * logical_scale`, precalculated, since we use it a lot.
 } SDL_RenderViewState;
 
+// A free span along the top edge of the packed area of a texture atlas page
+typedef struct SDL_TextureAtlasSkyline
+{
+    int x, y, w;
+} SDL_TextureAtlasSkyline;
+
+// A shared texture that small static textures are packed into
+typedef struct SDL_TextureAtlasPage
+{
+    SDL_Texture *texture;
+    SDL_TextureAtlasSkyline *skyline;
+    int num_skyline;
+    int max_skyline;
+    int num_entries;    // textures currently packed into this page
+    struct SDL_TextureAtlasPage *next;
+} SDL_TextureAtlasPage;
+
 // Define the SDL texture structure
 struct SDL_Texture
 {
@@ -100,6 +117,10 @@ struct SDL_Texture
     SDL_Rect locked_rect;
     SDL_Surface *locked_surface; // Locked region exposed as a SDL surface
 
+    // Support for textures packed into a shared atlas page
+    SDL_TextureAtlasPage *atlas_page;
+    SDL_Rect atlas_rect;        // The area of the atlas page holding this texture
+
     Uint32 last_command_generation; // last command queue generation this texture was in.
 
     SDL_PropertiesID props;
@@ -182,6 +203,8 @@ typedef struct SDL_RenderCommand
             SDL_TextureAddressMode texture_address_mode_u;
             SDL_TextureAddressMode texture_address_mode_v;
             SDL_GPURenderState *gpu_render_state;
+            SDL_FRect bounds;    // area this draw covers, in viewport pixels. w < 0 if unknown. Only set if renderer->reorder_draws.
+            size_t vertex_bytes; // size of this draw's block in vertex_data. Only set if renderer->reorder_draws.
         } draw;
         struct
         {
@@ -233,6 +256,10 @@ struct SDL_Renderer
 
     void (*InvalidateCachedState)(SDL_Renderer *renderer);
     bool (*RunCommandQueue)(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize);
+    // Optional: returns mapped GPU memory of at least `size` bytes for the next RunCommandQueue call. It's called when
+    //  the queue is flushed, the final vertex data is written there and passed to RunCommandQueue as `vertices`.
+    //  If it fails, RunCommandQueue gets renderer->vertex_data instead.
+    void *(*AcquireVertexMemory)(SDL_Renderer *renderer, size_t size);
     bool (*UpdateTexture)(SDL_Renderer *renderer, SDL_Texture *texture,
                          const SDL_Rect *rect, const void *pixels,
                          int pitch);
@@ -327,6 +354,21 @@ struct SDL_Renderer
     size_t vertex_data_used;
     size_t vertex_data_allocation;
 
+    // true if the backend merges adjacent compatible geometry commands and addresses vertex_data by byte offset,
+    //  so non-overlapping geometry can be regrouped by texture and state before the queue is flushed.
+    bool reorder_draws;
+    struct SDL_RenderDrawBatch *reorder_batches;
+    int reorder_batches_allocation;
+    void *reorder_vertex_data;
+    size_t reorder_vertex_data_allocation;
+
+    // Draw calls issued since the last present, counted by each backend's RunCommandQueue.
+    Sint64 draw_calls;
+
+    // true if small static textures created from surfaces are packed into shared atlas pages.
+    bool texture_atlas;
+    SDL_TextureAtlasPage *atlas_pages;
+
     // Shaped window support
     bool transparent_window;
     SDL_Surface *shape_surface;
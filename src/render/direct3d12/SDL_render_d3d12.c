@@ -2834,6 +2834,7 @@ static void D3D12_DrawPrimitives(SDL_Renderer *renderer, D3D12_PRIMITIVE_TOPOLOG
     D3D12_RenderData *rendererData = (D3D12_RenderData *)renderer->internal;
     ID3D12GraphicsCommandList2_IASetPrimitiveTopology(rendererData->commandList, primitiveTopology);
     ID3D12GraphicsCommandList2_DrawInstanced(rendererData->commandList, (UINT)vertexCount, 1, (UINT)vertexStart, 0);
+    renderer->draw_calls++;
 }
 
 static void D3D12_InvalidateCachedState(SDL_Renderer *renderer)
@@ -65,9 +65,10 @@ typedef struct GPU_RenderData
 
     struct
     {
-        SDL_GPUTransferBuffer *transfer_buf;
         SDL_GPUBuffer *buffer;
         Uint32 buffer_size;
+        SDL_GPUTransferBufferLocation upload; // upload ring allocation backing mapped
+        void *mapped; // upload memory handed out for the next flush, or NULL
     } vertices;
 
     struct
@@ -520,11 +521,13 @@ static SDL_GPUSampler *GetSampler(GPU_RenderData *data, SDL_ScaleMode scale_mode
 }
 
 static void Draw(
-    GPU_RenderData *data, SDL_RenderCommand *cmd,
+    SDL_Renderer *renderer, SDL_RenderCommand *cmd,
     Uint32 num_verts,
     Uint32 offset,
     SDL_GPUPrimitiveType prim)
 {
+    GPU_RenderData *data = (GPU_RenderData *)renderer->internal;
+
     if (!data->state.render_pass || data->state.color_attachment.load_op == SDL_GPU_LOADOP_CLEAR) {
         RestartRenderPass(data);
     }
@@ -626,18 +629,18 @@ static void Draw(
     SetViewportAndScissor(data);
 
     SDL_DrawGPUPrimitives(pass, num_verts, 1, 0, 0);
+    renderer->draw_calls++;
 }
 
 static void ReleaseVertexBuffer(GPU_RenderData *data)
 {
     if (data->vertices.buffer) {
         SDL_ReleaseGPUBuffer(data->device, data->vertices.buffer);
+        data->vertices.buffer = NULL;
     }
 
-    if (data->vertices.transfer_buf) {
-        SDL_ReleaseGPUTransferBuffer(data->device, data->vertices.transfer_buf);
-    }
-
+    // Upload memory goes back to the device when the command buffer is submitted
+    data->vertices.mapped = NULL;
     data->vertices.buffer_size = 0;
 }
 
@@ -654,24 +657,41 @@ static bool InitVertexBuffer(GPU_RenderData *data, Uint32 size)
         return false;
     }
 
-    SDL_GPUTransferBufferCreateInfo tbci;
-    SDL_zero(tbci);
-    tbci.size = size;
-    tbci.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    data->vertices.buffer_size = size;
 
-    data->vertices.transfer_buf = SDL_CreateGPUTransferBuffer(data->device, &tbci);
+    return true;
+}
 
-    if (!data->vertices.transfer_buf) {
-        return false;
-    }
+static void *GPU_AcquireVertexMemory(SDL_Renderer *renderer, size_t size)
+{
+    GPU_RenderData *data = (GPU_RenderData *)renderer->internal;
 
-    data->vertices.buffer_size = size;
+    if (size > SDL_MAX_UINT32) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
 
-    return true;
+    /* Hand out the device's upload ring, it recycles the memory once the GPU
+     * is done with this frame's command buffer.
+     */
+    data->vertices.mapped = SDL_AllocateGPUUploadMemory(data->state.command_buffer, (Uint32)size, 0, &data->vertices.upload);
+    return data->vertices.mapped;
 }
 
 static bool UploadVertices(GPU_RenderData *data, void *vertices, size_t vertsize)
 {
+    if (data->vertices.mapped) {
+        // The vertices were written straight into upload memory, there's nothing to copy
+        SDL_assert(vertices == data->vertices.mapped);
+        data->vertices.mapped = NULL;
+    } else if (vertsize > 0) {
+        void *staging_buf = SDL_AllocateGPUUploadMemory(data->state.command_buffer, (Uint32)vertsize, 0, &data->vertices.upload);
+        if (!staging_buf) {
+            return false;
+        }
+        SDL_memcpy(staging_buf, vertices, vertsize);
+    }
+
     if (vertsize == 0) {
         return true;
     }
@@ -683,26 +703,18 @@ static bool UploadVertices(GPU_RenderData *data, void *vertices, size_t vertsize
         }
     }
 
-    void *staging_buf = SDL_MapGPUTransferBuffer(data->device, data->vertices.transfer_buf, true);
-    SDL_memcpy(staging_buf, vertices, vertsize);
-    SDL_UnmapGPUTransferBuffer(data->device, data->vertices.transfer_buf);
-
     SDL_GPUCopyPass *pass = SDL_BeginGPUCopyPass(data->state.command_buffer);
 
     if (!pass) {
         return false;
     }
 
-    SDL_GPUTransferBufferLocation src;
-    SDL_zero(src);
-    src.transfer_buffer = data->vertices.transfer_buf;
-
     SDL_GPUBufferRegion dst;
     SDL_zero(dst);
     dst.buffer = data->vertices.buffer;
     dst.size = (Uint32)vertsize;
 
-    SDL_UploadToGPUBuffer(pass, &src, &dst, true);
+    SDL_UploadToGPUBuffer(pass, &data->vertices.upload, &dst, true);
     SDL_EndGPUCopyPass(pass);
 
     return true;
@@ -790,7 +802,7 @@ static bool GPU_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
 
             if (count > 2) {
                 // joined lines cannot be grouped
-                Draw(data, cmd, count, offset, SDL_GPU_PRIMITIVETYPE_LINESTRIP);
+                Draw(renderer, cmd, count, offset, SDL_GPU_PRIMITIVETYPE_LINESTRIP);
             } else {
                 // let's group non joined lines
                 SDL_RenderCommand *finalcmd = cmd;
@@ -812,7 +824,7 @@ static bool GPU_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
                     nextcmd = nextcmd->next;
                 }
 
-                Draw(data, cmd, count, offset, SDL_GPU_PRIMITIVETYPE_LINELIST);
+                Draw(renderer, cmd, count, offset, SDL_GPU_PRIMITIVETYPE_LINELIST);
                 cmd = finalcmd; // skip any copy commands we just combined in here.
             }
             break;
@@ -857,7 +869,7 @@ static bool GPU_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
                 prim = SDL_GPU_PRIMITIVETYPE_POINTLIST;
             }
 
-            Draw(data, cmd, count, offset, prim);
+            Draw(renderer, cmd, count, offset, prim);
 
             cmd = finalcmd; // skip any copy commands we just combined in here.
             break;
@@ -1180,6 +1192,8 @@ static bool GPU_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL_P
     renderer->QueueGeometry = GPU_QueueGeometry;
     renderer->InvalidateCachedState = GPU_InvalidateCachedState;
     renderer->RunCommandQueue = GPU_RunCommandQueue;
+    renderer->AcquireVertexMemory = GPU_AcquireVertexMemory;
+    renderer->reorder_draws = true;
     renderer->RenderReadPixels = GPU_RenderReadPixels;
     renderer->RenderPresent = GPU_RenderPresent;
     renderer->DestroyTexture = GPU_DestroyTexture;
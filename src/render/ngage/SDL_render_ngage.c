@@ -368,6 +368,7 @@ static bool NGAGE_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
             }
 
             NGAGE_DrawPoints(verts, count);
+            renderer->draw_calls++;
             break;
         }
         case SDL_RENDERCMD_DRAW_LINES:
@@ -384,6 +385,7 @@ static bool NGAGE_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
             }
 
             NGAGE_DrawLines(verts, count);
+            renderer->draw_calls++;
             break;
         }
 
@@ -401,6 +403,7 @@ static bool NGAGE_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
             }
 
             NGAGE_FillRects(verts, count);
+            renderer->draw_calls++;
             break;
         }
 
@@ -418,6 +421,7 @@ static bool NGAGE_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
             }
 
             NGAGE_Copy(renderer, texture, srcrect, dstrect);
+            renderer->draw_calls++;
             break;
         }
 
@@ -433,6 +437,7 @@ static bool NGAGE_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
             }
 
             NGAGE_CopyEx(renderer, texture, copydata);
+            renderer->draw_calls++;
             break;
         }
 
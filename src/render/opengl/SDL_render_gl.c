@@ -1379,6 +1379,7 @@ static bool GL_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                 if (count > 2) {
                     // joined lines cannot be grouped
                     data->glDrawArrays(GL_LINE_STRIP, 0, (GLsizei)count);
+                    renderer->draw_calls++;
                 } else {
                     // let's group non joined lines
                     SDL_RenderCommand *finalcmd = cmd;
@@ -1401,6 +1402,7 @@ static bool GL_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                     }
 
                     data->glDrawArrays(GL_LINES, 0, (GLsizei)count);
+                    renderer->draw_calls++;
                     cmd = finalcmd; // skip any copy commands we just combined in here.
                 }
             }
@@ -1468,6 +1470,7 @@ static bool GL_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                 }
 
                 data->glDrawArrays(op, 0, (GLsizei)count);
+                renderer->draw_calls++;
 
                 // Restore previously set color when we're done.
                 if (thiscmdtype != SDL_RENDERCMD_DRAW_POINTS) {
@@ -1713,6 +1716,7 @@ static bool GL_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL_Pr
     renderer->QueueGeometry = GL_QueueGeometry;
     renderer->InvalidateCachedState = GL_InvalidateCachedState;
     renderer->RunCommandQueue = GL_RunCommandQueue;
+    renderer->reorder_draws = true;
     renderer->RenderReadPixels = GL_RenderReadPixels;
     renderer->RenderPresent = GL_RenderPresent;
     renderer->DestroyTexture = GL_DestroyTexture;
@@ -755,6 +755,7 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
             } else {
                 SDL_BlendPoints(surface, verts, count, blend, r, g, b, a);
             }
+            renderer->draw_calls++;
             break;
         }
 
@@ -783,6 +784,7 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
             } else {
                 SDL_BlendLines(surface, verts, count, blend, r, g, b, a);
             }
+            renderer->draw_calls++;
             break;
         }
 
@@ -811,6 +813,7 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
             } else {
                 SDL_BlendFillRects(surface, verts, count, blend, r, g, b, a);
             }
+            renderer->draw_calls++;
             break;
         }
 
@@ -876,6 +879,7 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                     SDL_BlitSurfaceScaled(src, srcrect, surface, dstrect, cmd->data.draw.texture_scale_mode);
                 }
             }
+            renderer->draw_calls++;
             break;
         }
 
@@ -894,6 +898,7 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
             SW_RenderCopyEx(renderer, surface, cmd->data.draw.texture, &copydata->srcrect,
                             &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip,
                             copydata->scale_x, copydata->scale_y, cmd->data.draw.texture_scale_mode);
+            renderer->draw_calls++;
             break;
         }
 
@@ -955,6 +960,7 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                     SDL_SW_FillTriangle(surface, &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst), blend, ptr[0].color, ptr[1].color, ptr[2].color);
                 }
             }
+            renderer->draw_calls++;
             break;
         }
 
@@ -374,6 +374,7 @@ typedef struct
     Float4X4 identity;
     VkComponentMapping identitySwizzle;
     int currentVertexBuffer;
+    int acquiredVertexBuffer;   // vertex buffer handed out for the next flush, or -1
     bool issueBatch;
 } VULKAN_RenderData;
 
@@ -558,6 +559,7 @@ static void VULKAN_DestroyAll(SDL_Renderer *renderer)
         VULKAN_DestroyBuffer(rendererData, &rendererData->vertexBuffers[i]);
     }
     SDL_memset(rendererData->vertexBuffers, 0, sizeof(rendererData->vertexBuffers));
+    rendererData->acquiredVertexBuffer = -1;
     for (uint32_t i = 0; i < VULKAN_RENDERPASS_COUNT; i++) {
         if (rendererData->renderPasses[i] != VK_NULL_HANDLE) {
             vkDestroyRenderPass(rendererData->device, rendererData->renderPasses[i], NULL);
@@ -1933,6 +1935,7 @@ static VkResult VULKAN_CreateDeviceResources(SDL_Renderer *renderer, SDL_Propert
     for (uint32_t i = 0; i < SDL_VULKAN_NUM_VERTEX_BUFFERS; ++i) {
         VULKAN_CreateVertexBuffer(rendererData, i, SDL_VULKAN_VERTEX_BUFFER_DEFAULT_SIZE);
     }
+    rendererData->acquiredVertexBuffer = -1;
 
     SDL_PropertiesID props = SDL_GetRendererProperties(renderer);
     SDL_SetPointerProperty(props, SDL_PROP_RENDERER_VULKAN_INSTANCE_POINTER, rendererData->instance);
@@ -3176,31 +3179,79 @@ static bool VULKAN_QueueGeometry(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
     return true;
 }
 
-static bool VULKAN_UpdateVertexBuffer(SDL_Renderer *renderer,
-                                    const void *vertexData, size_t dataSizeInBytes, VULKAN_DrawStateCache *stateCache)
+static VULKAN_Buffer *VULKAN_PrepareVertexBuffer(VULKAN_RenderData *rendererData, size_t size)
 {
-    VULKAN_RenderData *rendererData = (VULKAN_RenderData *)renderer->internal;
-    const int vbidx = rendererData->currentVertexBuffer;
-    VULKAN_Buffer *vertexBuffer;
-
-    if (dataSizeInBytes == 0) {
-        return true; // nothing to do.
-    }
+    int vbidx;
 
+    // Starting or issuing the command list resets the vertex buffer index, so do that before picking a buffer
+    VULKAN_EnsureCommandBuffer(rendererData);
     if (rendererData->issueBatch) {
         if (VULKAN_IssueBatch(rendererData) != VK_SUCCESS) {
-            return SDL_SetError("Failed to issue intermediate batch");
+            SDL_SetError("Failed to issue intermediate batch");
+            return NULL;
         }
     }
+    vbidx = rendererData->currentVertexBuffer;
+
     // If the existing vertex buffer isn't big enough, we need to recreate a big enough one
-    if (dataSizeInBytes > rendererData->vertexBuffers[vbidx].size) {
+    if (size > rendererData->vertexBuffers[vbidx].size) {
         VULKAN_IssueBatch(rendererData);
         VULKAN_WaitForGPU(rendererData);
-        VULKAN_CreateVertexBuffer(rendererData, vbidx, dataSizeInBytes);
+        vbidx = rendererData->currentVertexBuffer;
+        if (VULKAN_CreateVertexBuffer(rendererData, vbidx, size) != VK_SUCCESS) {
+            SDL_SetError("Couldn't create vertex buffer");
+            return NULL;
+        }
+    }
+    return &rendererData->vertexBuffers[vbidx];
+}
+
+static void *VULKAN_AcquireVertexMemory(SDL_Renderer *renderer, size_t size)
+{
+    VULKAN_RenderData *rendererData = (VULKAN_RenderData *)renderer->internal;
+    VULKAN_Buffer *vertexBuffer;
+
+    if (!rendererData->device) {
+        SDL_SetError("Device lost and couldn't be recovered");
+        return NULL;
+    }
+
+    vertexBuffer = VULKAN_PrepareVertexBuffer(rendererData, size);
+    if (!vertexBuffer) {
+        return NULL;
     }
+    // VULKAN_DestroyAll() resets this, so a buffer lost to device recreation is never drawn from
+    rendererData->acquiredVertexBuffer = rendererData->currentVertexBuffer;
+    return vertexBuffer->mappedBufferPtr;
+}
+
+static bool VULKAN_UpdateVertexBuffer(SDL_Renderer *renderer,
+                                    const void *vertexData, size_t dataSizeInBytes, int acquiredVertexBuffer, VULKAN_DrawStateCache *stateCache)
+{
+    VULKAN_RenderData *rendererData = (VULKAN_RenderData *)renderer->internal;
+    VULKAN_Buffer *vertexBuffer;
+    int vbidx;
+
+    if (acquiredVertexBuffer >= 0) {
+        vbidx = rendererData->currentVertexBuffer;
+        // The vertices were written straight into this buffer, there's nothing to copy
+        SDL_assert(acquiredVertexBuffer == vbidx);
+        if (vertexData != rendererData->vertexBuffers[vbidx].mappedBufferPtr) {
+            return SDL_SetError("Vertex buffer was lost before it was drawn from");
+        }
+        vertexBuffer = &rendererData->vertexBuffers[vbidx];
+    } else {
+        if (dataSizeInBytes == 0) {
+            return true; // nothing to do.
+        }
 
-    vertexBuffer = &rendererData->vertexBuffers[vbidx];
-    SDL_memcpy(vertexBuffer->mappedBufferPtr, vertexData, dataSizeInBytes);
+        vertexBuffer = VULKAN_PrepareVertexBuffer(rendererData, dataSizeInBytes);
+        if (!vertexBuffer) {
+            return false;
+        }
+        SDL_memcpy(vertexBuffer->mappedBufferPtr, vertexData, dataSizeInBytes);
+        vbidx = rendererData->currentVertexBuffer;
+    }
 
     stateCache->vertexBuffer = vertexBuffer->buffer;
 
@@ -3835,6 +3886,7 @@ static void VULKAN_DrawPrimitives(SDL_Renderer *renderer, VkPrimitiveTopology pr
 {
     VULKAN_RenderData *rendererData = (VULKAN_RenderData *)renderer->internal;
     vkCmdDraw(rendererData->currentCommandBuffer, (uint32_t)vertexCount, 1, (uint32_t)vertexStart, 0);
+    renderer->draw_calls++;
 }
 
 static void VULKAN_InvalidateCachedState(SDL_Renderer *renderer)
@@ -3851,6 +3903,10 @@ static bool VULKAN_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cm
     VULKAN_DrawStateCache stateCache;
     SDL_memset(&stateCache, 0, sizeof(stateCache));
 
+    // Release the vertex buffer handed out for this flush up front, so no way out of here leaves it acquired
+    const int acquiredVertexBuffer = rendererData->acquiredVertexBuffer;
+    rendererData->acquiredVertexBuffer = -1;
+
     if (!rendererData->device) {
         return SDL_SetError("Device lost and couldn't be recovered");
     }
@@ -3868,7 +3924,7 @@ static bool VULKAN_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cm
         rendererData->recreateSwapchain = false;
     }
 
-    if (!VULKAN_UpdateVertexBuffer(renderer, vertices, vertsize, &stateCache)) {
+    if (!VULKAN_UpdateVertexBuffer(renderer, vertices, vertsize, acquiredVertexBuffer, &stateCache)) {
         return false;
     }
 
@@ -3960,11 +4016,39 @@ static bool VULKAN_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cm
 
         case SDL_RENDERCMD_GEOMETRY:
         {
+            /* as long as we have the same geometry command in a row, with the
+               same texture and state, we can combine them all into a single draw call. */
             SDL_Texture *texture = cmd->data.draw.texture;
-            const size_t count = cmd->data.draw.count;
+            SDL_BlendMode thisblend = cmd->data.draw.blend;
+            SDL_ScaleMode thisscalemode = cmd->data.draw.texture_scale_mode;
+            SDL_TextureAddressMode thisaddressmode_u = cmd->data.draw.texture_address_mode_u;
+            SDL_TextureAddressMode thisaddressmode_v = cmd->data.draw.texture_address_mode_v;
+            float thiscolorscale = cmd->data.draw.color_scale;
+            SDL_RenderCommand *finalcmd = cmd;
+            SDL_RenderCommand *nextcmd = cmd->next;
+            size_t count = cmd->data.draw.count;
             const size_t first = cmd->data.draw.first;
             const size_t start = first / sizeof(VULKAN_VertexPositionColor);
 
+            while (nextcmd) {
+                if (nextcmd->command != SDL_RENDERCMD_GEOMETRY) {
+                    break; // can't go any further on this draw call, different render command up next.
+                } else if (nextcmd->data.draw.texture != texture ||
+                           nextcmd->data.draw.texture_scale_mode != thisscalemode ||
+                           nextcmd->data.draw.texture_address_mode_u != thisaddressmode_u ||
+                           nextcmd->data.draw.texture_address_mode_v != thisaddressmode_v ||
+                           nextcmd->data.draw.blend != thisblend ||
+                           nextcmd->data.draw.color_scale != thiscolorscale) {
+                    break; // can't go any further on this draw call, different texture/blendmode copy up next.
+                } else if (nextcmd->data.draw.first != first + count * sizeof(VULKAN_VertexPositionColor)) {
+                    break; // can't go any further on this draw call, vertices aren't contiguous.
+                } else {
+                    finalcmd = nextcmd; // we can combine copy operations here. Mark this one as the furthest okay command.
+                    count += nextcmd->data.draw.count;
+                }
+                nextcmd = nextcmd->next;
+            }
+
             if (texture) {
                 VULKAN_SetCopyState(renderer, cmd, NULL, &stateCache);
             } else {
@@ -3972,6 +4056,8 @@ static bool VULKAN_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cm
             }
 
             VULKAN_DrawPrimitives(renderer, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST, start, count);
+
+            cmd = finalcmd; // skip any copy commands we just combined in here.
             break;
         }
 
@@ -4300,6 +4386,8 @@ static bool VULKAN_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SD
     renderer->QueueGeometry = VULKAN_QueueGeometry;
     renderer->InvalidateCachedState = VULKAN_InvalidateCachedState;
     renderer->RunCommandQueue = VULKAN_RunCommandQueue;
+    renderer->AcquireVertexMemory = VULKAN_AcquireVertexMemory;
+    renderer->reorder_draws = true;
     renderer->RenderReadPixels = VULKAN_RenderReadPixels;
     renderer->AddVulkanRenderSemaphores = VULKAN_AddVulkanRenderSemaphores;
     renderer->RenderPresent = VULKAN_RenderPresent;
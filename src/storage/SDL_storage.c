@@ -45,6 +45,7 @@ static UserStorageBootStrap *userbootstrap[] = {
 struct SDL_Storage
 {
     SDL_StorageInterface iface;
+    SDL_StorageAsyncInterface async_iface;
     void *userdata;
 };
 
@@ -180,6 +181,11 @@ SDL_Storage *SDL_OpenFileStorage(const char *path)
 }
 
 SDL_Storage *SDL_OpenStorage(const SDL_StorageInterface *iface, void *userdata)
+{
+    return SDL_OpenStorageWithAsync(iface, NULL, userdata);
+}
+
+SDL_Storage *SDL_OpenStorageWithAsync(const SDL_StorageInterface *iface, const SDL_StorageAsyncInterface *async_iface, void *userdata)
 {
     SDL_Storage *storage;
 
@@ -196,6 +202,9 @@ SDL_Storage *SDL_OpenStorage(const SDL_StorageInterface *iface, void *userdata)
     storage = (SDL_Storage *)SDL_calloc(1, sizeof(*storage));
     if (storage) {
         SDL_copyp(&storage->iface, iface);
+        if (async_iface) {
+            SDL_copyp(&storage->async_iface, async_iface);
+        }
         storage->userdata = userdata;
     }
     return storage;
@@ -395,9 +404,22 @@ static bool GlobStorageDirectoryGetPathInfo(const char *path, SDL_PathInfo *info
     return SDL_GetStoragePathInfo((SDL_Storage *) userdata, path, info);
 }
 
-static bool GlobStorageDirectoryEnumerator(const char *path, SDL_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata)
+typedef struct GlobStorageEnumerateData
+{
+    SDL_EnumerateDirectoryTypedCallback cb;
+    void *cbuserdata;
+} GlobStorageEnumerateData;
+
+static SDL_EnumerationResult SDLCALL GlobStorageDirectoryCallback(void *userdata, const char *dirname, const char *fname)
+{
+    const GlobStorageEnumerateData *data = (const GlobStorageEnumerateData *) userdata;
+    return data->cb(data->cbuserdata, dirname, fname, SDL_PATHTYPE_NONE);  // storage doesn't report types while enumerating.
+}
+
+static bool GlobStorageDirectoryEnumerator(const char *path, SDL_EnumerateDirectoryTypedCallback cb, void *cbuserdata, void *userdata)
 {
-    return SDL_EnumerateStorageDirectory((SDL_Storage *) userdata, path, cb, cbuserdata);
+    GlobStorageEnumerateData data = { cb, cbuserdata };
+    return SDL_EnumerateStorageDirectory((SDL_Storage *) userdata, path, GlobStorageDirectoryCallback, &data);
 }
 
 char **SDL_GlobStorageDirectory(SDL_Storage *storage, const char *path, const char *pattern, SDL_GlobFlags flags, int *count)
@@ -412,6 +434,93 @@ char **SDL_GlobStorageDirectory(SDL_Storage *storage, const char *path, const ch
         return NULL;
     }
 
-    return SDL_InternalGlobDirectory(path, pattern, flags, count, GlobStorageDirectoryEnumerator, GlobStorageDirectoryGetPathInfo, storage);
+    return SDL_InternalGlobDirectory(path, pattern, flags, count, GlobStorageDirectoryEnumerator, GlobStorageDirectoryGetPathInfo, storage, false);  // storage implementations aren't required to be thread-safe.
 }
 
+
+bool SDL_ReadStorageFileAsync(SDL_Storage *storage, const char *path, SDL_AsyncIOQueue *queue, void *userdata)
+{
+    CHECK_STORAGE_MAGIC()
+
+    if (!path) {
+        return SDL_InvalidParamError("path");
+    } else if (!queue) {
+        return SDL_InvalidParamError("queue");
+    } else if (!ValidateStoragePath(path)) {
+        return false;
+    } else if (!storage->async_iface.read_file_async) {
+        return SDL_Unsupported();
+    }
+
+    return storage->async_iface.read_file_async(storage->userdata, path, queue, userdata);
+}
+
+char **SDL_ReadStorageFilesAsync(SDL_Storage *storage, const char *path, const char *pattern, SDL_GlobFlags flags, SDL_AsyncIOQueue *queue, int *count)
+{
+    int num_matches = 0;
+
+    if (count) {
+        *count = 0;
+    }
+
+    CHECK_STORAGE_MAGIC_RET(NULL)
+
+    if (!queue) {
+        SDL_InvalidParamError("queue");
+        return NULL;
+    } else if (!storage->async_iface.read_file_async) {
+        SDL_Unsupported();
+        return NULL;
+    }
+
+    if (!path) {
+        path = "";  // we allow NULL to mean "root of the storage tree".
+    }
+
+    char **matches = SDL_GlobStorageDirectory(storage, path, pattern, flags, &num_matches);
+    if (!matches) {
+        return NULL;
+    }
+
+    // the matches are relative to `path`, but storage paths are relative to the root.
+    const size_t pathlen = SDL_strlen(path);
+    const bool need_sep = (pathlen > 0) && (path[pathlen - 1] != '/');
+    bool failed = false;
+    int started = 0;
+
+    for (int i = 0; i < num_matches; i++) {
+        char *fullpath = NULL;
+        if (SDL_asprintf(&fullpath, "%s%s%s", path, need_sep ? "/" : "", matches[i]) < 0) {
+            failed = true;
+            break;
+        }
+
+        SDL_PathInfo info;
+        bool okay = SDL_GetStoragePathInfo(storage, fullpath, &info);
+        if (okay && (info.type != SDL_PATHTYPE_FILE)) {
+            SDL_free(fullpath);
+            continue;  // directories match the pattern too, but there's nothing to read.
+        }
+
+        // each result's userdata is the string in the array we return, so the app can tell them apart.
+        okay = okay && storage->async_iface.read_file_async(storage->userdata, fullpath, queue, matches[i]);
+        SDL_free(fullpath);
+        if (!okay) {
+            failed = true;
+            break;
+        }
+
+        matches[started++] = matches[i];  // the strings stay put, the list just shrinks to what's being read.
+    }
+
+    if (failed && (started == 0)) {
+        SDL_free(matches);
+        return NULL;
+    }
+
+    matches[started] = NULL;
+    if (count) {
+        *count = started;
+    }
+    return matches;
+}
@@ -38,6 +38,17 @@ typedef struct UserStorageBootStrap
     SDL_Storage *(*create)(const char *, const char *, SDL_PropertiesID);
 } UserStorageBootStrap;
 
+// Operations only SDL's own backends provide. SDL_StorageInterface is filled in by apps, so it can't grow
+//  these without breaking them; any of these may be NULL.
+typedef struct SDL_StorageAsyncInterface
+{
+    // Start loading a whole file into an SDL-allocated buffer, reporting it to `queue` like SDL_LoadFileAsync does.
+    bool (*read_file_async)(void *userdata, const char *path, SDL_AsyncIOQueue *queue, void *task_userdata);
+} SDL_StorageAsyncInterface;
+
+// SDL_OpenStorage, plus the async operations. `async_iface` is copied and can be NULL.
+extern SDL_Storage *SDL_OpenStorageWithAsync(const SDL_StorageInterface *iface, const SDL_StorageAsyncInterface *async_iface, void *userdata);
+
 // Not all of these are available in a given build. Use #ifdefs, etc.
 
 extern TitleStorageBootStrap GENERIC_titlebootstrap;
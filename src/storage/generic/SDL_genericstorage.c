@@ -128,6 +128,19 @@ static bool GENERIC_ReadStorageFile(void *userdata, const char *path, void *dest
     return result;
 }
 
+static bool GENERIC_ReadStorageFileAsync(void *userdata, const char *path, SDL_AsyncIOQueue *queue, void *task_userdata)
+{
+    bool result = false;
+
+    char *fullpath = GENERIC_INTERNAL_CreateFullPath((char *)userdata, path);
+    if (fullpath) {
+        result = SDL_LoadFileAsync(fullpath, queue, task_userdata);
+
+        SDL_free(fullpath);
+    }
+    return result;
+}
+
 static bool GENERIC_WriteStorageFile(void *userdata, const char *path, const void *source, Uint64 length)
 {
     // TODO: Recursively create subdirectories with SDL_CreateDirectory
@@ -218,6 +231,10 @@ static Uint64 GENERIC_GetStorageSpaceRemaining(void *userdata)
     return SDL_MAX_UINT64;
 }
 
+static const SDL_StorageAsyncInterface GENERIC_async_iface = {
+    GENERIC_ReadStorageFileAsync
+};
+
 static const SDL_StorageInterface GENERIC_title_iface = {
     sizeof(SDL_StorageInterface),
     GENERIC_CloseStorage,
@@ -251,7 +268,7 @@ static SDL_Storage *GENERIC_Title_Create(const char *override, SDL_PropertiesID
     }
 
     if (basepath != NULL) {
-        result = SDL_OpenStorage(&GENERIC_title_iface, basepath);
+        result = SDL_OpenStorageWithAsync(&GENERIC_title_iface, &GENERIC_async_iface, basepath);
         if (result == NULL) {
             SDL_free(basepath);  // otherwise CloseStorage will free it.
         }
@@ -289,7 +306,7 @@ static SDL_Storage *GENERIC_User_Create(const char *org, const char *app, SDL_Pr
         return NULL;
     }
 
-    result = SDL_OpenStorage(&GENERIC_user_iface, prefpath);
+    result = SDL_OpenStorageWithAsync(&GENERIC_user_iface, &GENERIC_async_iface, prefpath);
     if (result == NULL) {
         SDL_free(prefpath);  // otherwise CloseStorage will free it.
     }
@@ -343,7 +360,7 @@ SDL_Storage *GENERIC_OpenFileStorage(const char *path)
             }
         }
     }
-    result = SDL_OpenStorage(&GENERIC_file_iface, basepath);
+    result = SDL_OpenStorageWithAsync(&GENERIC_file_iface, &GENERIC_async_iface, basepath);
     if (result == NULL) {
         SDL_free(basepath);
     }
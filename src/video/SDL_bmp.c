@@ -34,6 +34,7 @@
 
 #include "SDL_pixels_c.h"
 #include "SDL_surface_c.h"
+#include "../io/SDL_iostream_c.h"
 
 #define SAVE_32BIT_BMP
 
@@ -63,7 +64,51 @@
 #define LCS_GM_GRAPHICS 0x00000002
 #endif
 
-static bool readRlePixels(SDL_Surface *surface, SDL_IOStream *src, int isRle8)
+// Pixel data is parsed in place when the stream is memory-backed, and read from the stream otherwise
+typedef struct BMPPixelSource
+{
+    SDL_IOStream *src;
+    Sint64 start;
+    const Uint8 *data;
+    const Uint8 *here;
+    size_t left;
+} BMPPixelSource;
+
+static void beginPixelData(BMPPixelSource *source, SDL_IOStream *src)
+{
+    source->src = src;
+    source->start = SDL_TellIO(src);
+    source->left = SDL_SIZE_MAX;
+    source->data = NULL;
+    if (source->start >= 0) {
+        source->data = (const Uint8 *)SDL_PeekIOMemoryRange(src, (Uint64)source->start, &source->left);
+    }
+    source->here = source->data;
+}
+
+static bool readPixelData(BMPPixelSource *source, void *dst, size_t size)
+{
+    if (!source->data) {
+        return SDL_ReadIO(source->src, dst, size) == size;
+    }
+    if (size > source->left) {
+        return false;
+    }
+    SDL_memcpy(dst, source->here, size);
+    source->here += size;
+    source->left -= size;
+    return true;
+}
+
+static void endPixelData(BMPPixelSource *source)
+{
+    // Leave the stream where the read path would have left it
+    if (source->data) {
+        SDL_SeekIO(source->src, source->start + (Sint64)(source->here - source->data), SDL_IO_SEEK_SET);
+    }
+}
+
+static bool readRlePixels(SDL_Surface *surface, BMPPixelSource *src, int isRle8)
 {
     /*
     | Sets the surface pixels from src.  A bmp image is upside down.
@@ -84,7 +129,7 @@ static bool readRlePixels(SDL_Surface *surface, SDL_IOStream *src, int isRle8)
         *spot = (x)
 
     for (;;) {
-        if (!SDL_ReadU8(src, &ch)) {
+        if (!readPixelData(src, &ch, 1)) {
             return false;
         }
         /*
@@ -93,7 +138,7 @@ static bool readRlePixels(SDL_Surface *surface, SDL_IOStream *src, int isRle8)
         */
         if (ch) {
             Uint8 pixelvalue;
-            if (!SDL_ReadU8(src, &pixelvalue)) {
+            if (!readPixelData(src, &pixelvalue, 1)) {
                 return false;
             }
             ch /= pixels_per_byte;
@@ -106,7 +151,7 @@ static bool readRlePixels(SDL_Surface *surface, SDL_IOStream *src, int isRle8)
             | a cursor move, or some absolute data.
             | zero tag may be absolute mode or an escape
             */
-            if (!SDL_ReadU8(src, &ch)) {
+            if (!readPixelData(src, &ch, 1)) {
                 return false;
             }
             switch (ch) {
@@ -115,14 +160,15 @@ static bool readRlePixels(SDL_Surface *surface, SDL_IOStream *src, int isRle8)
                 bits -= pitch; // go to previous
                 break;
             case 1:               // end of bitmap
+                endPixelData(src);
                 return true; // success!
             case 2:               // delta
-                if (!SDL_ReadU8(src, &ch)) {
+                if (!readPixelData(src, &ch, 1)) {
                     return false;
                 }
                 ofs += ch / pixels_per_byte;
 
-                if (!SDL_ReadU8(src, &ch)) {
+                if (!readPixelData(src, &ch, 1)) {
                     return false;
                 }
                 bits -= ((ch / pixels_per_byte) * pitch);
@@ -132,14 +178,14 @@ static bool readRlePixels(SDL_Surface *surface, SDL_IOStream *src, int isRle8)
                 needsPad = (ch & 1);
                 do {
                     Uint8 pixelvalue;
-                    if (!SDL_ReadU8(src, &pixelvalue)) {
+                    if (!readPixelData(src, &pixelvalue, 1)) {
                         return false;
                     }
                     COPY_PIXEL(pixelvalue);
                 } while (--ch);
 
                 // pad at even boundary
-                if (needsPad && !SDL_ReadU8(src, &ch)) {
+                if (needsPad && !readPixelData(src, &ch, 1)) {
                     return false;
                 }
                 break;
@@ -193,6 +239,7 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, bool closeio)
     bool haveRGBMasks = false;
     bool haveAlphaMask = false;
     bool correctAlpha = false;
+    BMPPixelSource pixels;
 
     // The Win32 BMP file header (14 bytes)
     char magic[2];
@@ -483,8 +530,9 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, bool closeio)
         SDL_SetError("Error seeking in datastream");
         goto done;
     }
+    beginPixelData(&pixels, src);
     if ((biCompression == BI_RLE4) || (biCompression == BI_RLE8)) {
-        if (!readRlePixels(surface, src, biCompression == BI_RLE8)) {
+        if (!readRlePixels(surface, &pixels, biCompression == BI_RLE8)) {
             SDL_SetError("Error reading from datastream");
             goto done;
         }
@@ -502,7 +550,7 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, bool closeio)
         bits = end - surface->pitch;
     }
     while (bits >= top && bits < end) {
-        if (SDL_ReadIO(src, bits, surface->pitch) != (size_t)surface->pitch) {
+        if (!readPixelData(&pixels, bits, surface->pitch)) {
             goto done;
         }
         if (biBitCount == 8 && surface->palette && biClrUsed < (1u << biBitCount)) {
@@ -540,11 +588,9 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, bool closeio)
 
         // Skip padding bytes, ugh
         if (pad) {
-            Uint8 padbyte;
-            for (i = 0; i < pad; ++i) {
-                if (!SDL_ReadU8(src, &padbyte)) {
-                    goto done;
-                }
+            Uint8 padbytes[3];
+            if (!readPixelData(&pixels, padbytes, pad)) {
+                goto done;
             }
         }
         if (topDown) {
@@ -553,6 +599,7 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, bool closeio)
             bits -= surface->pitch;
         }
     }
+    endPixelData(&pixels);
     if (correctAlpha) {
         CorrectAlphaChannel(surface);
     }
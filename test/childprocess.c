@@ -19,6 +19,7 @@ int main(int argc, char *argv[]) {
     bool read_stdin = false;
     bool stdin_to_stderr = false;
     SDL_IOStream *log_stdin = NULL;
+    Sint64 stdout_bytes = 0;
     int exit_code = 0;
 
     state = SDLTest_CommonCreateState(argv, 0);
@@ -60,6 +61,14 @@ int main(int argc, char *argv[]) {
                     }
                     consumed = 2;
                 }
+            } else if (SDL_strcmp(argv[i], "--stdout-bytes") == 0) {
+                if (i + 1 < argc) {
+                    char *endptr = NULL;
+                    stdout_bytes = SDL_strtoll(argv[i + 1], &endptr, 0);
+                    if (endptr && *endptr == '\0' && stdout_bytes >= 0) {
+                        consumed = 2;
+                    }
+                }
             } else if (SDL_strcmp(argv[i], "--exit-code") == 0) {
                 if (i + 1 < argc) {
                     char *endptr = NULL;
@@ -95,6 +104,7 @@ int main(int argc, char *argv[]) {
                 "[--stdout TEXT]",
                 "[--stdin-to-stderr]",
                 "[--stderr TEXT]",
+                "[--stdout-bytes COUNT]",
                 "[--exit-code EXIT_CODE]",
                 "[--] [ARG [ARG ...]]",
                 NULL
@@ -118,6 +128,27 @@ int main(int argc, char *argv[]) {
         fflush(stdout);
     }
 
+    if (stdout_bytes > 0) {
+        /* byte n of the output is (Uint8)n, so the reader can verify it */
+        Uint8 buffer[4096];
+        Sint64 written = 0;
+#ifdef SDL_PLATFORM_WINDOWS
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        while (written < stdout_bytes) {
+            size_t count = (size_t)SDL_min(stdout_bytes - written, (Sint64)sizeof(buffer));
+            size_t j;
+            for (j = 0; j < count; j++) {
+                buffer[j] = (Uint8)(written + j);
+            }
+            if (fwrite(buffer, 1, count, stdout) != count) {
+                break;
+            }
+            written += count;
+        }
+        fflush(stdout);
+    }
+
     if (print_environment) {
         char **env = SDL_GetEnvironmentVariables(SDL_GetEnvironment());
         if (env) {
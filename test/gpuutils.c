@@ -0,0 +1,83 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+#include "gpuutils.h"
+
+#include "testgpu/testgpu_spirv.h"
+#include "testgpu/testgpu_dxil.h"
+#include "testgpu/testgpu_metallib.h"
+
+SDL_GPUDevice *CreateHeadlessGPUDevice(SDL_GPUShaderFormat format_flags, SDL_PropertiesID extra_props)
+{
+    SDL_PropertiesID props;
+    SDL_GPUDevice *device;
+
+    if (!SDL_Init(0)) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return NULL;
+    }
+
+    props = SDL_CreateProperties();
+    if (extra_props) {
+        SDL_CopyProperties(extra_props, props);
+    }
+    SDL_SetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_SHADERS_SPIRV_BOOLEAN, (format_flags & SDL_GPU_SHADERFORMAT_SPIRV) != 0);
+    SDL_SetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_SHADERS_DXIL_BOOLEAN, (format_flags & SDL_GPU_SHADERFORMAT_DXIL) != 0);
+    SDL_SetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_SHADERS_MSL_BOOLEAN, (format_flags & SDL_GPU_SHADERFORMAT_MSL) != 0);
+    SDL_SetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_SHADERS_METALLIB_BOOLEAN, (format_flags & SDL_GPU_SHADERFORMAT_METALLIB) != 0);
+    SDL_SetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_HEADLESS_BOOLEAN, true);
+    device = SDL_CreateGPUDeviceWithProperties(props);
+    SDL_DestroyProperties(props);
+    if (!device) {
+        SDL_Log("Couldn't create headless GPU device: %s", SDL_GetError());
+        SDL_Quit();
+        return NULL;
+    }
+
+    SDL_Log("Headless GPU device: %s (%s)",
+            SDL_GetGPUDeviceDriver(device),
+            SDL_GetStringProperty(SDL_GetGPUDeviceProperties(device), SDL_PROP_GPU_DEVICE_NAME_STRING, "unknown"));
+    return device;
+}
+
+void DestroyHeadlessGPUDevice(SDL_GPUDevice *device)
+{
+    SDL_DestroyGPUDevice(device);
+    SDL_Quit();
+}
+
+SDL_GPUShader *LoadCubeShader(SDL_GPUDevice *device, bool is_vertex)
+{
+    SDL_GPUShaderCreateInfo createinfo;
+    SDL_GPUShaderFormat format = SDL_GetGPUShaderFormats(device);
+
+    SDL_zero(createinfo);
+    createinfo.num_uniform_buffers = is_vertex ? 1 : 0;
+    createinfo.stage = is_vertex ? SDL_GPU_SHADERSTAGE_VERTEX : SDL_GPU_SHADERSTAGE_FRAGMENT;
+    if (format & SDL_GPU_SHADERFORMAT_DXIL) {
+        createinfo.format = SDL_GPU_SHADERFORMAT_DXIL;
+        createinfo.code = is_vertex ? D3D12_CubeVert : D3D12_CubeFrag;
+        createinfo.code_size = is_vertex ? SDL_arraysize(D3D12_CubeVert) : SDL_arraysize(D3D12_CubeFrag);
+        createinfo.entrypoint = is_vertex ? "VSMain" : "PSMain";
+    } else if (format & SDL_GPU_SHADERFORMAT_METALLIB) {
+        createinfo.format = SDL_GPU_SHADERFORMAT_METALLIB;
+        createinfo.code = is_vertex ? cube_vert_metallib : cube_frag_metallib;
+        createinfo.code_size = is_vertex ? cube_vert_metallib_len : cube_frag_metallib_len;
+        createinfo.entrypoint = is_vertex ? "vs_main" : "fs_main";
+    } else {
+        createinfo.format = SDL_GPU_SHADERFORMAT_SPIRV;
+        createinfo.code = is_vertex ? cube_vert_spv : cube_frag_spv;
+        createinfo.code_size = is_vertex ? cube_vert_spv_len : cube_frag_spv_len;
+        createinfo.entrypoint = "main";
+    }
+    return SDL_CreateGPUShader(device, &createinfo);
+}
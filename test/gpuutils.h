@@ -0,0 +1,35 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Shared setup for the GPU test programs */
+
+#ifndef gpuutils_h_
+#define gpuutils_h_
+
+#include <SDL3/SDL.h>
+
+/* Initializes SDL and creates a GPU device with no window, accepting any of
+ * the given shader formats. Other creation properties can be passed in
+ * extra_props, or 0. Logs the device that was picked, or why there wasn't
+ * one, in which case SDL is shut down again and NULL is returned.
+ */
+extern SDL_GPUDevice *CreateHeadlessGPUDevice(SDL_GPUShaderFormat format_flags, SDL_PropertiesID extra_props);
+
+/* Destroys a device from CreateHeadlessGPUDevice() and shuts SDL down. */
+extern void DestroyHeadlessGPUDevice(SDL_GPUDevice *device);
+
+/* Creates the vertex or fragment shader from testgpu/cube.glsl in a format
+ * the device accepts. The vertex shader takes one uniform buffer.
+ */
+extern SDL_GPUShader *LoadCubeShader(SDL_GPUDevice *device, bool is_vertex);
+
+#endif /* gpuutils_h_ */
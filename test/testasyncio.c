@@ -20,12 +20,181 @@ static SDL_Texture *texture = NULL;
 static SDL_AsyncIOQueue *queue = NULL;
 static SDLTest_CommonState *state = NULL;
 
+#define BENCHMARK_FILE_SIZE (64 * 1024 * 1024)
+#define BENCHMARK_BLOCK_SIZE 4096
+#define BENCHMARK_MAX_IN_FLIGHT 64
+#define BENCHMARK_RANGES_PER_TASK 16
+
+/* Every block of the benchmark file starts with its own index, so misplaced reads are caught. */
+static bool VerifyBlock(const Uint8 *ptr, Uint64 block)
+{
+    Uint64 stored;
+    SDL_memcpy(&stored, ptr, sizeof (stored));
+    if (stored != block) {
+        SDL_Log("Block %" SDL_PRIu64 " has the contents of block %" SDL_PRIu64, block, stored);
+        return false;
+    }
+    return true;
+}
+
+/* Reads the whole file in small blocks with the given backend and logs the throughput.
+   With ranges_per_task > 1, each task is an SDL_ReadAsyncIORanges of that many blocks. */
+static bool RunBenchmark(const char *path, const char *driver, int ranges_per_task)  /* driver==NULL for the platform's default. */
+{
+    const Uint64 num_blocks = BENCHMARK_FILE_SIZE / BENCHMARK_BLOCK_SIZE;
+    const Uint64 num_tasks = num_blocks / ranges_per_task;
+    SDL_AsyncIOQueue *benchqueue = NULL;
+    SDL_AsyncIO *asyncio = NULL;
+    Uint8 *buffers = NULL;
+    Uint8 *free_slots[BENCHMARK_MAX_IN_FLIGHT];  /* tasks finish out of order, so track which buffers are free. */
+    Uint64 next_task = 0;
+    Uint64 completed = 0;
+    Uint64 start, elapsed;
+    int in_flight = 0;
+    bool retval = false;
+
+    SDL_SetHint(SDL_HINT_ASYNCIO_DRIVER, driver);
+
+    buffers = (Uint8 *) SDL_malloc(BENCHMARK_MAX_IN_FLIGHT * ranges_per_task * BENCHMARK_BLOCK_SIZE);
+    benchqueue = SDL_CreateAsyncIOQueue();
+    asyncio = benchqueue ? SDL_AsyncIOFromFile(path, "r") : NULL;
+    if (!buffers || !asyncio) {
+        SDL_Log("Benchmark setup failed: %s", SDL_GetError());
+        goto done;
+    }
+    for (in_flight = 0; in_flight < BENCHMARK_MAX_IN_FLIGHT; in_flight++) {
+        free_slots[in_flight] = buffers + (in_flight * ranges_per_task * BENCHMARK_BLOCK_SIZE);
+    }
+    in_flight = 0;
+
+    start = SDL_GetTicksNS();
+    while (completed < num_tasks) {
+        SDL_AsyncIOOutcome outcome;
+        Uint64 first_block;
+        int j;
+
+        while ((in_flight < BENCHMARK_MAX_IN_FLIGHT) && (next_task < num_tasks)) {
+            Uint8 *slot = free_slots[BENCHMARK_MAX_IN_FLIGHT - 1 - in_flight];
+            bool queued;
+            first_block = next_task * ranges_per_task;
+            if (ranges_per_task == 1) {
+                queued = SDL_ReadAsyncIO(asyncio, slot, first_block * BENCHMARK_BLOCK_SIZE, BENCHMARK_BLOCK_SIZE, benchqueue, slot);
+            } else {
+                /* every other task lists its blocks backwards, so they aren't all one contiguous run. */
+                SDL_AsyncIORange ranges[BENCHMARK_RANGES_PER_TASK];
+                for (j = 0; j < ranges_per_task; j++) {
+                    const int index = (next_task & 1) ? (ranges_per_task - 1 - j) : j;
+                    ranges[j].ptr = slot + (index * BENCHMARK_BLOCK_SIZE);
+                    ranges[j].offset = (first_block + index) * BENCHMARK_BLOCK_SIZE;
+                    ranges[j].size = BENCHMARK_BLOCK_SIZE;
+                }
+                queued = SDL_ReadAsyncIORanges(asyncio, ranges, ranges_per_task, benchqueue, slot);
+            }
+            if (!queued) {
+                SDL_Log("Couldn't start read: %s", SDL_GetError());
+                goto done;
+            }
+            next_task++;
+            in_flight++;
+        }
+
+        if (!SDL_WaitAsyncIOResult(benchqueue, &outcome, -1)) {
+            continue;
+        }
+        in_flight--;
+        if ((outcome.result != SDL_ASYNCIO_COMPLETE) || (outcome.bytes_transferred != (Uint64) ranges_per_task * BENCHMARK_BLOCK_SIZE)) {
+            SDL_Log("Read at offset %" SDL_PRIu64 " failed: %s", outcome.offset, SDL_GetError());
+            goto done;
+        }
+        /* the outcome reports the first range, which is wherever that task put it in its slot. */
+        first_block = (outcome.offset - (Uint64) ((Uint8 *) outcome.buffer - (Uint8 *) outcome.userdata)) / BENCHMARK_BLOCK_SIZE;
+        for (j = 0; j < ranges_per_task; j++) {
+            if (!VerifyBlock((const Uint8 *) outcome.userdata + (j * BENCHMARK_BLOCK_SIZE), first_block + j)) {
+                goto done;
+            }
+        }
+        free_slots[BENCHMARK_MAX_IN_FLIGHT - 1 - in_flight] = (Uint8 *) outcome.userdata;
+        completed++;
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    SDL_Log("%s, %d block(s) per task: %" SDL_PRIu64 " reads of %d bytes in %.3f ms (%.1f MiB/s, %.0f tasks/s)",
+            driver ? driver : "default", ranges_per_task, num_blocks, BENCHMARK_BLOCK_SIZE, (double) elapsed / SDL_NS_PER_MS,
+            ((double) BENCHMARK_FILE_SIZE / (1024.0 * 1024.0)) / ((double) elapsed / SDL_NS_PER_SECOND),
+            (double) num_tasks / ((double) elapsed / SDL_NS_PER_SECOND));
+    retval = true;
+
+done:
+    if (asyncio) {
+        SDL_AsyncIOOutcome outcome;
+        SDL_CloseAsyncIO(asyncio, false, benchqueue, NULL);
+        in_flight++;
+        while (in_flight > 0) {
+            if (SDL_WaitAsyncIOResult(benchqueue, &outcome, -1)) {
+                in_flight--;
+            }
+        }
+    }
+    SDL_DestroyAsyncIOQueue(benchqueue);
+    SDL_free(buffers);
+    SDL_Quit();  /* so the next run picks its backend from the hint again. */
+    return retval;
+}
+
+static bool Benchmark(void)
+{
+    const char *path = "asyncio-benchmark.tmp";
+    static const char *drivers[] = { NULL, "generic" };
+    bool retval = true;
+    SDL_IOStream *io;
+    Uint8 *block;
+    int i;
+
+    SDL_Log("Creating %d byte benchmark file...", BENCHMARK_FILE_SIZE);
+    block = (Uint8 *) SDL_malloc(BENCHMARK_BLOCK_SIZE);
+    io = SDL_IOFromFile(path, "wb");
+    if (!block || !io) {
+        SDL_Log("Couldn't create %s: %s", path, SDL_GetError());
+        SDL_CloseIO(io);
+        SDL_free(block);
+        return false;
+    }
+    for (i = 0; i < BENCHMARK_BLOCK_SIZE; i++) {
+        block[i] = (Uint8) i;
+    }
+    for (i = 0; i < BENCHMARK_FILE_SIZE / BENCHMARK_BLOCK_SIZE; i++) {
+        const Uint64 index = (Uint64) i;
+        SDL_memcpy(block, &index, sizeof (index));
+        if (SDL_WriteIO(io, block, BENCHMARK_BLOCK_SIZE) != BENCHMARK_BLOCK_SIZE) {
+            retval = false;
+            break;
+        }
+    }
+    if (!SDL_CloseIO(io) || !retval) {
+        SDL_Log("Couldn't write %s: %s", path, SDL_GetError());
+        SDL_RemovePath(path);
+        SDL_free(block);
+        return false;
+    }
+    SDL_free(block);
+
+    for (i = 0; i < (int) SDL_arraysize(drivers); i++) {
+        if (!RunBenchmark(path, drivers[i], 1) || !RunBenchmark(path, drivers[i], BENCHMARK_RANGES_PER_TASK)) {
+            retval = false;
+        }
+    }
+
+    SDL_RemovePath(path);
+    return retval;
+}
+
 SDL_AppResult SDL_AppInit(void **appstate, int argc, char *argv[])
 {
     const char *base = NULL;
     SDL_AsyncIO *asyncio = NULL;
     char **bmps = NULL;
     int bmpcount = 0;
+    bool benchmark = false;
     int i;
 
     SDL_srand(0);
@@ -42,8 +211,15 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char *argv[])
     /* Parse commandline */
     for (i = 1; i < argc;) {
         int consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            if (SDL_strcmp(argv[i], "--benchmark") == 0) {
+                benchmark = true;
+                consumed = 1;
+            }
+        }
         if (consumed <= 0) {
             static const char *options[] = {
+                "[--benchmark]",
                 NULL,
             };
             SDLTest_CommonLogUsage(state, argv[0], options);
@@ -54,6 +230,10 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char *argv[])
         i += consumed;
     }
 
+    if (benchmark) {
+        return Benchmark() ? SDL_APP_SUCCESS : SDL_APP_FAILURE;
+    }
+
     state->num_windows = 1;
 
     /* Load the SDL library */
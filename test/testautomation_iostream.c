@@ -14,6 +14,7 @@
 #define _CRT_SECURE_NO_WARNINGS
 #endif
 
+#include <stddef.h>
 #include <stdio.h>
 
 #include <SDL3/SDL.h>
@@ -471,6 +472,374 @@ static int SDLCALL iostrm_testFileWrite(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests reading from a memory-mapped file and accessing it in place.
+ *
+ * \sa SDL_IOFromFile
+ * \sa SDL_GetIOMemoryRange
+ */
+static int SDLCALL iostrm_testMappedFileRead(void *arg)
+{
+    SDL_IOStream *rw;
+    const char *data;
+    size_t size;
+    int result;
+
+    rw = SDL_IOFromFile(IOStreamReadTestFilename, "rbm");
+    SDLTest_AssertPass("Call to SDL_IOFromFile(..,\"rbm\") succeeded");
+    SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_IOFromFile in mapped read mode does not return NULL");
+    if (rw == NULL) {
+        return TEST_ABORTED;
+    }
+
+    testGenericIOStreamValidations(rw, false);
+
+    /* Mapping is optional, the stream only has to behave like a file */
+    if (SDL_GetPointerProperty(SDL_GetIOProperties(rw), SDL_PROP_IOSTREAM_MEMORY_POINTER, NULL)) {
+        size = 5;
+        data = (const char *)SDL_GetIOMemoryRange(rw, 6, &size);
+        SDLTest_AssertPass("Call to SDL_GetIOMemoryRange(rw, 6, 5) succeeded");
+        SDLTest_AssertCheck(data != NULL && size == 5 && SDL_memcmp(data, "World", 5) == 0, "Verify the range points at the file contents");
+
+        size = 100;
+        data = (const char *)SDL_GetIOMemoryRange(rw, 6, &size);
+        SDLTest_AssertCheck(data != NULL && size == 6, "Verify a range past the end is clipped; expected 6, got %d", (int)size);
+
+        size = 1;
+        data = (const char *)SDL_GetIOMemoryRange(rw, 100, &size);
+        SDLTest_AssertCheck(data == NULL, "Verify an offset past the end fails");
+    } else {
+        SDLTest_Log("File wasn't mapped, skipping SDL_GetIOMemoryRange() checks");
+    }
+
+    result = SDL_CloseIO(rw);
+    SDLTest_AssertPass("Call to SDL_CloseIO() succeeded");
+    SDLTest_AssertCheck(result == true, "Verify result value is true; got: %d", result);
+
+    /* Mapping is ignored for writable modes */
+    rw = SDL_IOFromFile(IOStreamWriteTestFilename, "w+m");
+    SDLTest_AssertPass("Call to SDL_IOFromFile(..,\"w+m\") succeeded");
+    SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_IOFromFile in write mode with 'm' does not return NULL");
+    if (rw == NULL) {
+        return TEST_ABORTED;
+    }
+    testGenericIOStreamValidations(rw, true);
+    SDL_CloseIO(rw);
+
+    /* Streams that aren't memory-backed can't be accessed in place */
+    rw = SDL_IOFromFile(IOStreamReadTestFilename, "rb");
+    if (rw != NULL) {
+        size = 1;
+        data = (const char *)SDL_GetIOMemoryRange(rw, 0, &size);
+        SDLTest_AssertCheck(data == NULL && size == 0, "Verify SDL_GetIOMemoryRange() fails on a regular file");
+        SDL_CloseIO(rw);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that a buffered stream behaves exactly like an unbuffered one.
+ *
+ * \sa SDL_SetIOBufferSize
+ */
+static int SDLCALL iostrm_testBuffered(void *arg)
+{
+    SDL_IOStream *plain;
+    SDL_IOStream *buffered;
+    Uint8 data[64];
+    Uint8 plain_data[64];
+    Uint8 buffered_data[64];
+    Uint32 plain_value, buffered_value;
+    bool plain_ok, buffered_ok;
+    int i, j;
+
+    plain = SDL_IOFromDynamicMem();
+    buffered = SDL_IOFromDynamicMem();
+    SDLTest_AssertCheck(plain != NULL && buffered != NULL, "Verify opening dynamic memory streams");
+    if (plain == NULL || buffered == NULL) {
+        SDL_CloseIO(plain);
+        SDL_CloseIO(buffered);
+        return TEST_ABORTED;
+    }
+
+    buffered_ok = SDL_SetIOBufferSize(buffered, SDLTest_RandomIntegerInRange(1, 48));
+    SDLTest_AssertCheck(buffered_ok, "Verify SDL_SetIOBufferSize() succeeded");
+
+    /* Run the same random operations on both streams */
+    for (i = 0; i < 2000; ++i) {
+        const int op = SDLTest_RandomIntegerInRange(0, 5);
+        const size_t len = (size_t)SDLTest_RandomIntegerInRange(1, (int)sizeof(data));
+        Sint64 plain_pos, buffered_pos;
+        size_t plain_len, buffered_len;
+
+        switch (op) {
+        case 0:
+            for (j = 0; j < (int)len; ++j) {
+                data[j] = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+            }
+            plain_len = SDL_WriteIO(plain, data, len);
+            buffered_len = SDL_WriteIO(buffered, data, len);
+            SDLTest_AssertCheck(plain_len == buffered_len, "Verify SDL_WriteIO() results match in step %d", i);
+            break;
+        case 1:
+            plain_len = SDL_ReadIO(plain, plain_data, len);
+            buffered_len = SDL_ReadIO(buffered, buffered_data, len);
+            SDLTest_AssertCheck(plain_len == buffered_len && SDL_memcmp(plain_data, buffered_data, plain_len) == 0, "Verify SDL_ReadIO() results match in step %d", i);
+            break;
+        case 2:
+            plain_value = buffered_value = (Uint32)SDLTest_RandomUint32();
+            plain_ok = SDL_WriteU32LE(plain, plain_value);
+            buffered_ok = SDL_WriteU32LE(buffered, buffered_value);
+            SDLTest_AssertCheck(plain_ok == buffered_ok, "Verify SDL_WriteU32LE() results match in step %d", i);
+            break;
+        case 3:
+            plain_value = buffered_value = 0;
+            plain_ok = SDL_ReadU32LE(plain, &plain_value);
+            buffered_ok = SDL_ReadU32LE(buffered, &buffered_value);
+            SDLTest_AssertCheck(plain_ok == buffered_ok && plain_value == buffered_value, "Verify SDL_ReadU32LE() results match in step %d", i);
+            break;
+        case 4:
+            plain_pos = SDL_GetIOSize(plain);
+            plain_pos = SDLTest_RandomIntegerInRange(0, (Sint32)plain_pos);
+            plain_pos = SDL_SeekIO(plain, plain_pos, SDL_IO_SEEK_SET);
+            buffered_pos = SDL_SeekIO(buffered, plain_pos, SDL_IO_SEEK_SET);
+            SDLTest_AssertCheck(plain_pos == buffered_pos, "Verify SDL_SeekIO(SDL_IO_SEEK_SET) results match in step %d", i);
+            break;
+        default:
+            j = SDLTest_RandomIntegerInRange(-20, 20);
+            plain_pos = SDL_SeekIO(plain, j, SDL_IO_SEEK_CUR);
+            buffered_pos = SDL_SeekIO(buffered, j, SDL_IO_SEEK_CUR);
+            SDLTest_AssertCheck(plain_pos == buffered_pos, "Verify SDL_SeekIO(SDL_IO_SEEK_CUR) results match in step %d", i);
+            break;
+        }
+
+        plain_pos = SDL_TellIO(plain);
+        buffered_pos = SDL_TellIO(buffered);
+        if (plain_pos != buffered_pos) {
+            SDLTest_AssertCheck(false, "Verify positions match in step %d, expected %" SDL_PRIs64 ", got %" SDL_PRIs64, i, plain_pos, buffered_pos);
+            break;
+        }
+    }
+
+    /* Unbuffering flushes, after which the contents have to be identical */
+    buffered_ok = SDL_SetIOBufferSize(buffered, 0);
+    SDLTest_AssertCheck(buffered_ok, "Verify SDL_SetIOBufferSize(0) succeeded");
+    SDLTest_AssertCheck(SDL_GetIOSize(plain) == SDL_GetIOSize(buffered), "Verify stream sizes match");
+    {
+        const void *plain_mem = SDL_GetPointerProperty(SDL_GetIOProperties(plain), SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER, NULL);
+        const void *buffered_mem = SDL_GetPointerProperty(SDL_GetIOProperties(buffered), SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER, NULL);
+        SDLTest_AssertCheck(plain_mem && buffered_mem && SDL_memcmp(plain_mem, buffered_mem, (size_t)SDL_GetIOSize(plain)) == 0, "Verify stream contents match");
+    }
+
+    SDL_CloseIO(plain);
+    SDL_CloseIO(buffered);
+
+    return TEST_COMPLETED;
+}
+
+/* Forwards to a memory stream, counting how often the interface gets asked to seek */
+typedef struct CountingStream
+{
+    SDL_IOStream *inner;
+    int seeks;
+} CountingStream;
+
+static Sint64 SDLCALL counting_seek(void *userdata, Sint64 offset, SDL_IOWhence whence)
+{
+    CountingStream *stream = (CountingStream *)userdata;
+    stream->seeks++;
+    return SDL_SeekIO(stream->inner, offset, whence);
+}
+
+static size_t SDLCALL counting_read(void *userdata, void *ptr, size_t size, SDL_IOStatus *status)
+{
+    CountingStream *stream = (CountingStream *)userdata;
+    const size_t result = SDL_ReadIO(stream->inner, ptr, size);
+    *status = SDL_GetIOStatus(stream->inner);
+    return result;
+}
+
+static size_t SDLCALL counting_write(void *userdata, const void *ptr, size_t size, SDL_IOStatus *status)
+{
+    CountingStream *stream = (CountingStream *)userdata;
+    const size_t result = SDL_WriteIO(stream->inner, ptr, size);
+    *status = SDL_GetIOStatus(stream->inner);
+    return result;
+}
+
+static SDL_IOStream *OpenCountingStream(CountingStream *stream, void *mem, size_t size)
+{
+    SDL_IOStreamInterface iface;
+
+    SDL_zerop(stream);
+    stream->inner = SDL_IOFromMem(mem, size);
+    if (!stream->inner) {
+        return NULL;
+    }
+    SDL_INIT_INTERFACE(&iface);
+    iface.seek = counting_seek;
+    iface.read = counting_read;
+    iface.write = counting_write;
+    return SDL_OpenIO(&iface, stream);
+}
+
+/**
+ * Tests that seeks and tells inside the buffer don't reach the interface.
+ *
+ * \sa SDL_SetIOBufferSize
+ * \sa SDL_SeekIO
+ */
+static int SDLCALL iostrm_testBufferedSeekCount(void *arg)
+{
+    CountingStream counting;
+    SDL_IOStream *rw;
+    char mem[256];
+    char data[16];
+    Sint64 pos;
+    int seeks;
+    int i;
+
+    for (i = 0; i < (int)sizeof(mem); ++i) {
+        mem[i] = (char)i;
+    }
+    rw = OpenCountingStream(&counting, mem, sizeof(mem));
+    SDLTest_AssertCheck(rw != NULL, "Verify opening a counting stream");
+    if (rw == NULL) {
+        SDL_CloseIO(counting.inner);
+        return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(SDL_SetIOBufferSize(rw, 64), "Verify SDL_SetIOBufferSize() succeeded");
+
+    SDLTest_AssertCheck(SDL_ReadIO(rw, data, 4) == 4, "Verify first read");
+    SDL_TellIO(rw);  /* the first one may have to ask the interface where it is */
+    seeks = counting.seeks;
+
+    /* Tells and seeks inside the read-ahead data are free */
+    for (i = 0; i < 10; ++i) {
+        pos = SDL_TellIO(rw);
+        SDLTest_AssertCheck(pos == 4, "Verify SDL_TellIO() returns 4, got %" SDL_PRIs64, pos);
+    }
+    pos = SDL_SeekIO(rw, 40, SDL_IO_SEEK_SET);
+    SDLTest_AssertCheck(pos == 40, "Verify SDL_SeekIO(40, SDL_IO_SEEK_SET) returns 40, got %" SDL_PRIs64, pos);
+    pos = SDL_SeekIO(rw, -30, SDL_IO_SEEK_CUR);
+    SDLTest_AssertCheck(pos == 10, "Verify SDL_SeekIO(-30, SDL_IO_SEEK_CUR) returns 10, got %" SDL_PRIs64, pos);
+    SDLTest_AssertCheck(SDL_ReadIO(rw, data, 4) == 4 && data[0] == 10, "Verify reading after seeking inside the buffer");
+    SDLTest_AssertCheck(counting.seeks == seeks, "Verify no interface seeks inside the buffer, got %d", counting.seeks - seeks);
+
+    /* Leaving the buffer takes exactly one */
+    pos = SDL_SeekIO(rw, 200, SDL_IO_SEEK_SET);
+    SDLTest_AssertCheck(pos == 200, "Verify SDL_SeekIO(200, SDL_IO_SEEK_SET) returns 200, got %" SDL_PRIs64, pos);
+    SDLTest_AssertCheck(counting.seeks == seeks + 1, "Verify one interface seek outside the buffer, got %d", counting.seeks - seeks);
+    SDLTest_AssertCheck(SDL_ReadIO(rw, data, 4) == 4 && data[0] == (char)200, "Verify reading after seeking outside the buffer");
+
+    /* Telling with pending writes doesn't flush or seek */
+    SDLTest_AssertCheck(SDL_WriteIO(rw, "abcd", 4) == 4, "Verify buffered write");
+    seeks = counting.seeks;  /* dropping the read-ahead may seek once */
+    pos = SDL_TellIO(rw);
+    SDLTest_AssertCheck(pos == 208, "Verify SDL_TellIO() with pending writes returns 208, got %" SDL_PRIs64, pos);
+    SDLTest_AssertCheck(counting.seeks == seeks, "Verify no interface seeks when telling with pending writes, got %d", counting.seeks - seeks);
+
+    SDLTest_AssertCheck(SDL_CloseIO(rw), "Verify SDL_CloseIO() succeeded");
+    SDLTest_AssertCheck(SDL_memcmp(mem + 204, "abcd", 4) == 0, "Verify the buffered write reached memory");
+    SDL_CloseIO(counting.inner);
+
+    return TEST_COMPLETED;
+}
+
+/* Runs positional reads and writes on a stream holding the alphabet */
+static void TestPositionalIO(SDL_IOStream *rw, const char *what)
+{
+    char buf[8];
+    SDL_IOStatus status;
+    size_t len;
+
+    SDLTest_AssertCheck(SDL_IOHasPositionalRead(rw), "Verify %s has positional reads", what);
+    SDLTest_AssertCheck(SDL_IOHasPositionalWrite(rw), "Verify %s has positional writes", what);
+
+    SDL_zeroa(buf);
+    len = SDL_ReadIOAt(rw, buf, 5, 10, &status);
+    SDLTest_AssertCheck(len == 5 && SDL_strcmp(buf, "KLMNO") == 0, "Verify SDL_ReadIOAt() on %s, got %d bytes '%s'", what, (int)len, buf);
+    SDLTest_AssertCheck(SDL_TellIO(rw) == 0, "Verify SDL_ReadIOAt() didn't move the position of %s", what);
+
+    SDL_zeroa(buf);
+    len = SDL_ReadIOAt(rw, buf, 5, 24, NULL);
+    SDLTest_AssertCheck(len == 2 && SDL_strcmp(buf, "YZ") == 0, "Verify SDL_ReadIOAt() at the end of %s, got %d bytes '%s'", what, (int)len, buf);
+
+    len = SDL_WriteIOAt(rw, "abc", 3, 3, &status);
+    SDLTest_AssertCheck(len == 3, "Verify SDL_WriteIOAt() on %s, got %d", what, (int)len);
+    SDLTest_AssertCheck(SDL_TellIO(rw) == 0, "Verify SDL_WriteIOAt() didn't move the position of %s", what);
+
+    SDL_zeroa(buf);
+    len = SDL_ReadIO(rw, buf, 7);
+    SDLTest_AssertCheck(len == 7 && SDL_strcmp(buf, "ABCabcG") == 0, "Verify SDL_ReadIO() sees the positional write on %s, got '%s'", what, buf);
+
+    /* Positional access goes around the buffer, so buffering turns it off */
+    SDLTest_AssertCheck(SDL_SetIOBufferSize(rw, 16), "Verify SDL_SetIOBufferSize(16) on %s", what);
+    SDLTest_AssertCheck(!SDL_IOHasPositionalRead(rw), "Verify buffered %s has no positional reads", what);
+    SDLTest_AssertCheck(!SDL_IOHasPositionalWrite(rw), "Verify buffered %s has no positional writes", what);
+    len = SDL_ReadIOAt(rw, buf, 5, 0, &status);
+    SDLTest_AssertCheck(len == 0 && status == SDL_IO_STATUS_ERROR, "Verify SDL_ReadIOAt() fails on buffered %s", what);
+    len = SDL_WriteIOAt(rw, "xyz", 3, 0, &status);
+    SDLTest_AssertCheck(len == 0 && status == SDL_IO_STATUS_ERROR, "Verify SDL_WriteIOAt() fails on buffered %s", what);
+
+    SDLTest_AssertCheck(SDL_SetIOBufferSize(rw, 0), "Verify SDL_SetIOBufferSize(0) on %s", what);
+    SDLTest_AssertCheck(SDL_IOHasPositionalRead(rw) && SDL_IOHasPositionalWrite(rw), "Verify unbuffered %s has positional i/o again", what);
+}
+
+/**
+ * Tests reading and writing at explicit offsets.
+ *
+ * \sa SDL_IOHasPositionalRead
+ * \sa SDL_IOHasPositionalWrite
+ * \sa SDL_ReadIOAt
+ * \sa SDL_WriteIOAt
+ */
+static int SDLCALL iostrm_testPositional(void *arg)
+{
+    char mem[sizeof(IOStreamAlphabetString)];
+    CountingStream counting;
+    SDL_IOStatus status;
+    SDL_IOStream *rw;
+    char buf[4];
+
+    /* Memory streams always support it */
+    SDL_memcpy(mem, IOStreamAlphabetString, sizeof(mem));
+    rw = SDL_IOFromMem(mem, SDL_strlen(IOStreamAlphabetString));
+    SDLTest_AssertCheck(rw != NULL, "Verify opening a memory stream");
+    if (rw) {
+        TestPositionalIO(rw, "memory stream");
+        SDL_CloseIO(rw);
+    }
+
+    /* File streams do where the platform has pread()/pwrite() */
+    rw = SDL_IOFromFile(IOStreamAlphabetFilename, "r+b");
+    SDLTest_AssertCheck(rw != NULL, "Verify opening '%s'", IOStreamAlphabetFilename);
+    if (rw) {
+        SDLTest_AssertCheck(SDL_SetIOBufferSize(rw, 0), "Verify unbuffering the file stream");
+        if (SDL_IOHasPositionalRead(rw)) {
+            TestPositionalIO(rw, "file stream");
+        } else {
+            SDLTest_Log("File streams don't have positional i/o on this platform");
+        }
+        SDL_CloseIO(rw);
+    }
+
+    /* Custom interfaces without read_at and write_at don't */
+    rw = OpenCountingStream(&counting, mem, sizeof(mem));
+    SDLTest_AssertCheck(rw != NULL, "Verify opening a counting stream");
+    if (rw) {
+        SDLTest_AssertCheck(!SDL_IOHasPositionalRead(rw) && !SDL_IOHasPositionalWrite(rw), "Verify a custom stream without read_at has no positional i/o");
+        SDLTest_AssertCheck(SDL_ReadIOAt(rw, buf, sizeof(buf), 0, &status) == 0 && status == SDL_IO_STATUS_ERROR, "Verify SDL_ReadIOAt() fails on it");
+        SDL_CloseIO(rw);
+    }
+    SDL_CloseIO(counting.inner);
+
+    SDLTest_AssertCheck(!SDL_IOHasPositionalRead(NULL), "Verify SDL_IOHasPositionalRead(NULL) is false");
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Tests alloc and free RW context.
  *
@@ -498,6 +867,34 @@ static int SDLCALL iostrm_testAllocFree(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests that interfaces from before the positional members were added still open.
+ *
+ * \sa SDL_OpenIO
+ */
+static int SDLCALL iostrm_testOldInterfaceVersion(void *arg)
+{
+    SDL_IOStreamInterface iface;
+    SDL_IOStream *rw;
+
+    SDL_INIT_INTERFACE(&iface);
+    iface.version = (Uint32)offsetof(SDL_IOStreamInterface, read_at);
+    rw = SDL_OpenIO(&iface, NULL);
+    SDLTest_AssertPass("Call to SDL_OpenIO() with an SDL 3.2 sized interface");
+    SDLTest_AssertCheck(rw != NULL, "Validate result from SDL_OpenIO() is not NULL");
+    if (rw == NULL) {
+        return TEST_ABORTED;
+    }
+    SDL_CloseIO(rw);
+
+    iface.version = 0;
+    rw = SDL_OpenIO(&iface, NULL);
+    SDLTest_AssertPass("Call to SDL_OpenIO() with an uninitialized interface");
+    SDLTest_AssertCheck(rw == NULL, "Validate result from SDL_OpenIO() is NULL");
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Compare memory and file reads
  *
@@ -736,10 +1133,31 @@ static const SDLTest_TestCaseReference iostrmTest10 = {
     iostrm_testMemWithFree, "iostrm_testMemWithFree", "Tests opening from memory with free on close", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference iostrmTest11 = {
+    iostrm_testOldInterfaceVersion, "iostrm_testOldInterfaceVersion", "Test opening an interface from an older SDL version", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference iostrmTest12 = {
+    iostrm_testMappedFileRead, "iostrm_testMappedFileRead", "Tests reading from a memory-mapped file", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference iostrmTest13 = {
+    iostrm_testBuffered, "iostrm_testBuffered", "Compare buffered and unbuffered streams", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference iostrmTest14 = {
+    iostrm_testBufferedSeekCount, "iostrm_testBufferedSeekCount", "Tests that seeks inside the buffer don't reach the interface", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference iostrmTest15 = {
+    iostrm_testPositional, "iostrm_testPositional", "Tests reading and writing at explicit offsets", TEST_ENABLED
+};
+
 /* Sequence of IOStream test cases */
 static const SDLTest_TestCaseReference *iostrmTests[] = {
     &iostrmTest1, &iostrmTest2, &iostrmTest3, &iostrmTest4, &iostrmTest5, &iostrmTest6,
-    &iostrmTest7, &iostrmTest8, &iostrmTest9, &iostrmTest10, NULL
+    &iostrmTest7, &iostrmTest8, &iostrmTest9, &iostrmTest10, &iostrmTest11, &iostrmTest12,
+    &iostrmTest13, &iostrmTest14, &iostrmTest15, NULL
 };
 
 /* IOStream test suite (global) */
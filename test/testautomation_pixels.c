@@ -1001,6 +1001,17 @@ static int SDLCALL pixels_saveLoadBMP(void *arg)
         surface = SDL_LoadBMP("test.bmp");
         SDLTest_AssertCheck(surface != NULL, "Verify SDL_LoadBMP() succeeded");
 
+        /* Load BMP from a stream that isn't memory-backed */
+        if (surface) {
+            SDL_Surface *streamed;
+
+            SDL_ClearError();
+            streamed = SDL_LoadBMP_IO(SDL_IOFromFile("test.bmp", "r+b"), true);
+            SDLTest_AssertCheck(streamed != NULL, "Verify SDL_LoadBMP_IO() succeeded");
+            SDLTest_AssertCheck(*SDL_GetError() == '\0', "Verify SDL_LoadBMP_IO() didn't set an error, got: '%s'", SDL_GetError());
+            SDL_DestroySurface(streamed);
+        }
+
         /* Remove BMP */
         result = SDL_RemovePath("test.bmp");
         SDLTest_AssertCheck(result, "Verify SDL_RemovePath() succeeded");
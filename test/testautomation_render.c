@@ -2095,6 +2095,327 @@ static int SDLCALL render_testTextureState(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests that geometry queued across buffer growth, regrouping and a mid-frame
+ * flush draws the same as it was submitted.
+ *
+ * \sa SDL_RenderTexture
+ * \sa SDL_FlushRenderer
+ */
+static int SDLCALL render_testQueuedGeometry(void *arg)
+{
+    const Uint32 colors[3] = { 0xFFFF0000, 0xFF00FF00, 0xFF0000FF };
+    const int cell = 2;
+    const int columns = TESTRENDER_SCREEN_W / cell;
+    const int rows = TESTRENDER_SCREEN_H / cell;
+    SDL_Texture *textures[3];
+    SDL_Surface *referenceSurface;
+    SDL_Rect rect;
+    SDL_FRect dst;
+    int i, x, y;
+
+    /* Clear surface. */
+    clearScreen();
+
+    referenceSurface = SDL_CreateSurface(TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, RENDER_COMPARE_FORMAT);
+    SDLTest_AssertCheck(referenceSurface != NULL, "Verify reference surface is not NULL");
+    if (referenceSurface == NULL) {
+        return TEST_ABORTED;
+    }
+    SDL_FillSurfaceRect(referenceSurface, NULL, RENDER_COLOR_CLEAR);
+
+    for (i = 0; i < SDL_arraysize(textures); ++i) {
+        textures[i] = SDL_CreateTexture(renderer, RENDER_COMPARE_FORMAT, SDL_TEXTUREACCESS_STATIC, 1, 1);
+        SDLTest_AssertCheck(textures[i] != NULL, "Verify SDL_CreateTexture() result");
+        if (textures[i] == NULL) {
+            return TEST_ABORTED;
+        }
+        CHECK_FUNC(SDL_UpdateTexture, (textures[i], NULL, &colors[i], sizeof(colors[i])));
+    }
+
+    /* Non-overlapping cells cycling through the textures, so the draws can be regrouped,
+       with enough vertices to grow the vertex buffer and a flush half way through. */
+    dst.w = (float)cell;
+    dst.h = (float)cell;
+    for (y = 0; y < rows; ++y) {
+        if (y == rows / 2) {
+            CHECK_FUNC(SDL_FlushRenderer, (renderer));
+        }
+        for (x = 0; x < columns; ++x) {
+            i = (x + y) % SDL_arraysize(textures);
+            dst.x = (float)(x * cell);
+            dst.y = (float)(y * cell);
+            CHECK_FUNC(SDL_RenderTexture, (renderer, textures[i], NULL, &dst));
+
+            rect.x = x * cell;
+            rect.y = y * cell;
+            rect.w = cell;
+            rect.h = cell;
+            SDL_FillSurfaceRect(referenceSurface, &rect, colors[i]);
+        }
+    }
+
+    /* This overlaps earlier draws with the same texture and has to stay on top. */
+    dst.x = 10.0f;
+    dst.y = 10.0f;
+    dst.w = 20.0f;
+    dst.h = 20.0f;
+    CHECK_FUNC(SDL_RenderTexture, (renderer, textures[0], NULL, &dst));
+    rect.x = 10;
+    rect.y = 10;
+    rect.w = 20;
+    rect.h = 20;
+    SDL_FillSurfaceRect(referenceSurface, &rect, colors[0]);
+
+    /* See if it's the same. */
+    compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE);
+
+    /* Make current */
+    SDL_RenderPresent(renderer);
+
+    /* Clean up. */
+    for (i = 0; i < SDL_arraysize(textures); ++i) {
+        SDL_DestroyTexture(textures[i]);
+    }
+    SDL_DestroySurface(referenceSurface);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Draws a grid of non-overlapping cells cycling through the textures,
+ * optionally flushing after every draw so nothing can be regrouped.
+ */
+static bool drawReorderScene(SDL_Texture **textures, int num_textures, bool flush, SDL_Surface **surface, Sint64 *draw_calls)
+{
+    const int cell = 8;
+    SDL_FRect dst;
+    int x, y;
+
+    clearScreen();
+    dst.w = (float)cell;
+    dst.h = (float)cell;
+    for (y = 0; y < TESTRENDER_SCREEN_H / cell; ++y) {
+        for (x = 0; x < TESTRENDER_SCREEN_W / cell; ++x) {
+            dst.x = (float)(x * cell);
+            dst.y = (float)(y * cell);
+            if (!SDL_RenderTexture(renderer, textures[(x + y) % num_textures], NULL, &dst)) {
+                return false;
+            }
+            if (flush && !SDL_FlushRenderer(renderer)) {
+                return false;
+            }
+        }
+    }
+    *surface = SDL_RenderReadPixels(renderer, NULL);
+    SDL_RenderPresent(renderer);
+    *draw_calls = SDL_GetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_DRAW_CALLS_NUMBER, 0);
+    return (*surface != NULL);
+}
+
+/**
+ * Tests that regrouping draws by texture keeps the output identical and
+ * reduces the number of draw calls.
+ *
+ * \sa SDL_RenderTexture
+ * \sa SDL_PROP_RENDERER_DRAW_CALLS_NUMBER
+ */
+static int SDLCALL render_testReorderedDraws(void *arg)
+{
+    const Uint32 colors[3] = { 0xFFFF0000, 0xFF00FF00, 0xFF0000FF };
+    const char *name = SDL_GetRendererName(renderer);
+    SDL_Texture *textures[3];
+    SDL_Surface *flushed = NULL;
+    SDL_Surface *reordered = NULL;
+    Sint64 flushed_draw_calls = 0;
+    Sint64 reordered_draw_calls = 0;
+    bool reorders;
+    int i, ret;
+
+    for (i = 0; i < SDL_arraysize(textures); ++i) {
+        textures[i] = SDL_CreateTexture(renderer, RENDER_COMPARE_FORMAT, SDL_TEXTUREACCESS_STATIC, 1, 1);
+        SDLTest_AssertCheck(textures[i] != NULL, "Verify SDL_CreateTexture() result");
+        if (textures[i] == NULL) {
+            return TEST_ABORTED;
+        }
+        CHECK_FUNC(SDL_UpdateTexture, (textures[i], NULL, &colors[i], sizeof(colors[i])));
+    }
+
+    /* Draw the scene in submission order, then let the renderer regroup it */
+    SDLTest_AssertCheck(drawReorderScene(textures, SDL_arraysize(textures), true, &flushed, &flushed_draw_calls),
+                        "Draw the scene flushing after every draw: %s", flushed ? "success" : SDL_GetError());
+    SDLTest_AssertCheck(drawReorderScene(textures, SDL_arraysize(textures), false, &reordered, &reordered_draw_calls),
+                        "Draw the scene in one batch: %s", reordered ? "success" : SDL_GetError());
+
+    if (flushed && reordered) {
+        ret = SDLTest_CompareSurfaces(reordered, flushed, 0);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+    }
+
+    /* Only the renderers that regroup draws are expected to save anything */
+    reorders = (SDL_strcmp(name, "opengl") == 0 ||
+                SDL_strcmp(name, "opengles2") == 0 ||
+                SDL_strcmp(name, "gpu") == 0 ||
+                SDL_strcmp(name, "vulkan") == 0);
+    SDLTest_Log("Draw calls for renderer %s: %" SDL_PRIs64 " flushing every draw, %" SDL_PRIs64 " batched",
+                name, flushed_draw_calls, reordered_draw_calls);
+    SDLTest_AssertCheck(reordered_draw_calls <= flushed_draw_calls,
+                        "Validate batched draw calls don't exceed flushed draw calls: %" SDL_PRIs64 " <= %" SDL_PRIs64,
+                        reordered_draw_calls, flushed_draw_calls);
+    if (reorders) {
+        SDLTest_AssertCheck(reordered_draw_calls * 2 < flushed_draw_calls,
+                            "Validate regrouping at least halves the draw calls: %" SDL_PRIs64 " vs %" SDL_PRIs64,
+                            reordered_draw_calls, flushed_draw_calls);
+    }
+
+    /* Clean up. */
+    SDL_DestroySurface(flushed);
+    SDL_DestroySurface(reordered);
+    for (i = 0; i < SDL_arraysize(textures); ++i) {
+        SDL_DestroyTexture(textures[i]);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests drawing textures packed into a shared atlas
+ *
+ * \sa SDL_HINT_RENDER_TEXTURE_ATLAS
+ * \sa SDL_CreateTextureFromSurface
+ */
+static int SDLCALL render_testTextureAtlas(void *arg)
+{
+    const Uint32 colors[3] = { 0xFFFFFFFF, 0xFF00FF00, 0xFF0000FF };
+    const SDL_Color expected[] = {
+        { 0x00, 0x00, 0xFF, 0xFF }, /* white with the color mod to blue */
+        { 0x00, 0xFF, 0x00, 0xFF }, /* green, unaffected by the first draw */
+        { 0x00, 0x00, 0x80, 0xFF }, /* blue at half alpha over the black clear color */
+    };
+    SDL_Window *atlas_window;
+    SDL_Renderer *atlas_renderer;
+    SDL_PropertiesID props;
+    SDL_Texture *textures[3];
+    SDL_Surface *surface;
+    SDL_Vertex verts[3];
+    SDL_FRect dst;
+    bool atlased;
+    bool result;
+    int i;
+
+    atlas_window = SDL_CreateWindow("render_testTextureAtlas", TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 0);
+    SDLTest_AssertCheck(atlas_window != NULL, "Check SDL_CreateWindow result");
+    if (atlas_window == NULL) {
+        return TEST_ABORTED;
+    }
+    props = SDL_CreateProperties();
+    SDL_SetPointerProperty(props, SDL_PROP_RENDERER_CREATE_WINDOW_POINTER, atlas_window);
+    SDL_SetStringProperty(props, SDL_PROP_RENDERER_CREATE_NAME_STRING, SDL_GetRendererName(renderer));
+    SDL_SetBooleanProperty(props, SDL_PROP_RENDERER_CREATE_TEXTURE_ATLAS_BOOLEAN, true);
+    atlas_renderer = SDL_CreateRendererWithProperties(props);
+    SDL_DestroyProperties(props);
+    SDLTest_AssertCheck(atlas_renderer != NULL, "Check SDL_CreateRendererWithProperties result: %s", atlas_renderer != NULL ? "success" : SDL_GetError());
+    if (atlas_renderer == NULL) {
+        SDL_DestroyWindow(atlas_window);
+        return TEST_ABORTED;
+    }
+    /* The software renderer doesn't pack textures into atlases */
+    atlased = (SDL_strcmp(SDL_GetRendererName(atlas_renderer), SDL_SOFTWARE_RENDERER) != 0);
+
+    for (i = 0; i < SDL_arraysize(textures); ++i) {
+        surface = SDL_CreateSurface(4, 4, SDL_PIXELFORMAT_ARGB8888);
+        SDLTest_AssertCheck(surface != NULL, "Verify SDL_CreateSurface() result");
+        if (surface == NULL) {
+            return TEST_ABORTED;
+        }
+        SDL_FillSurfaceRect(surface, NULL, colors[i]);
+        textures[i] = SDL_CreateTextureFromSurface(atlas_renderer, surface);
+        SDL_DestroySurface(surface);
+        SDLTest_AssertCheck(textures[i] != NULL, "Verify SDL_CreateTextureFromSurface() result");
+        if (textures[i] == NULL) {
+            return TEST_ABORTED;
+        }
+    }
+
+    /* Clear to black */
+    SDL_SetRenderDrawColor(atlas_renderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(atlas_renderer);
+
+    /* Each draw uses the color, alpha and blend mode of its own texture */
+    dst.x = 0.0f;
+    dst.y = 0.0f;
+    dst.w = 4.0f;
+    dst.h = 4.0f;
+    CHECK_FUNC(SDL_SetTextureColorMod, (textures[0], 0x00, 0x00, 0xFF));
+    CHECK_FUNC(SDL_RenderTexture, (atlas_renderer, textures[0], NULL, &dst));
+    dst.x += 4.0f;
+    CHECK_FUNC(SDL_RenderTexture, (atlas_renderer, textures[1], NULL, &dst));
+    dst.x += 4.0f;
+    CHECK_FUNC(SDL_SetTextureBlendMode, (textures[2], SDL_BLENDMODE_BLEND));
+    CHECK_FUNC(SDL_SetTextureAlphaMod, (textures[2], 0x80));
+    CHECK_FUNC(SDL_RenderTexture, (atlas_renderer, textures[2], NULL, &dst));
+
+    /* Texture coordinates inside the texture work, ones outside it can't be sampled from an atlas */
+    verts[0].position.x = 0.0f;
+    verts[0].position.y = 8.0f;
+    verts[1].position.x = 8.0f;
+    verts[1].position.y = 8.0f;
+    verts[2].position.x = 0.0f;
+    verts[2].position.y = 16.0f;
+    for (i = 0; i < SDL_arraysize(verts); ++i) {
+        verts[i].color.r = verts[i].color.g = verts[i].color.b = verts[i].color.a = 1.0f;
+    }
+    verts[0].tex_coord.x = 0.0f;
+    verts[0].tex_coord.y = 0.0f;
+    verts[1].tex_coord.x = 1.0f;
+    verts[1].tex_coord.y = 0.0f;
+    verts[2].tex_coord.x = 0.0f;
+    verts[2].tex_coord.y = 1.0f;
+    CHECK_FUNC(SDL_RenderGeometry, (atlas_renderer, textures[1], verts, SDL_arraysize(verts), NULL, 0));
+    verts[1].tex_coord.x = 2.0f;
+    result = SDL_RenderGeometry(atlas_renderer, textures[1], verts, SDL_arraysize(verts), NULL, 0);
+    SDLTest_AssertCheck(result == !atlased, "Verify SDL_RenderGeometry() with texture coordinates past 1, expected: %s, got: %s",
+                        !atlased ? "true" : "false", result ? "true" : "false");
+
+    /* Verify results */
+    for (i = 0; i < SDL_arraysize(expected); ++i) {
+        const int MAX_DELTA = 1;
+        SDL_Rect rect;
+        SDL_Color actual;
+
+        rect.x = i * 4 + 1;
+        rect.y = 1;
+        rect.w = 1;
+        rect.h = 1;
+        surface = SDL_RenderReadPixels(atlas_renderer, &rect);
+        SDLTest_AssertCheck(surface != NULL, "Validate result from SDL_RenderReadPixels, got %s", surface ? "surface" : SDL_GetError());
+        if (surface == NULL) {
+            continue;
+        }
+        SDL_ReadSurfacePixel(surface, 0, 0, &actual.r, &actual.g, &actual.b, &actual.a);
+        SDL_DestroySurface(surface);
+        SDLTest_AssertCheck(SDL_abs(actual.r - expected[i].r) <= MAX_DELTA &&
+                            SDL_abs(actual.g - expected[i].g) <= MAX_DELTA &&
+                            SDL_abs(actual.b - expected[i].b) <= MAX_DELTA &&
+                            SDL_abs(actual.a - expected[i].a) <= MAX_DELTA,
+                            "Validate texture %d, expected %d,%d,%d,%d, got %d,%d,%d,%d", i,
+                            expected[i].r, expected[i].g, expected[i].b, expected[i].a,
+                            actual.r, actual.g, actual.b, actual.a);
+    }
+
+    /* Textures still in the atlas keep drawing after others are destroyed */
+    SDL_DestroyTexture(textures[0]);
+    SDL_DestroyTexture(textures[2]);
+    CHECK_FUNC(SDL_RenderTexture, (atlas_renderer, textures[1], NULL, NULL));
+    SDL_RenderPresent(atlas_renderer);
+
+    /* The last texture goes away with the renderer */
+    SDL_DestroyRenderer(atlas_renderer);
+    SDL_DestroyWindow(atlas_window);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Render test cases */
@@ -2158,6 +2479,18 @@ static const SDLTest_TestCaseReference renderTestTextureState = {
     render_testTextureState, "render_testTextureState", "Tests texture state changes", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference renderTestQueuedGeometry = {
+    render_testQueuedGeometry, "render_testQueuedGeometry", "Tests queueing, regrouping and flushing geometry", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestReorderedDraws = {
+    render_testReorderedDraws, "render_testReorderedDraws", "Tests that regrouping draws keeps the output and saves draw calls", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestTextureAtlas = {
+    render_testTextureAtlas, "render_testTextureAtlas", "Tests drawing textures packed into an atlas", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference renderTestGetSetTextureScaleMode = {
     render_testGetSetTextureScaleMode, "render_testGetSetTextureScaleMode", "Tests setting/getting texture scale mode", TEST_ENABLED
 };
@@ -2183,6 +2516,9 @@ static const SDLTest_TestCaseReference *renderTests[] = {
     &renderTestUVClamping,
     &renderTestUVWrapping,
     &renderTestTextureState,
+    &renderTestQueuedGeometry,
+    &renderTestReorderedDraws,
+    &renderTestTextureAtlas,
     &renderTestGetSetTextureScaleMode,
     &renderTestRGBSurfaceNoAlpha,
     NULL
@@ -87,12 +87,406 @@ static SDL_EnumerationResult SDLCALL enum_storage_callback(void *userdata, const
     return SDL_ENUM_CONTINUE;  /* keep going */
 }
 
+/* Changes seen by the directory watch test, one "action path [oldpath]" line each. */
+static SDL_Mutex *watch_lock;
+static char watch_log[1024];
+
+static void SDLCALL watch_callback(void *userdata, SDL_FileWatchAction action, const char *path, const char *oldpath)
+{
+    static const char *actions[] = { "created", "modified", "removed", "renamed" };
+    size_t len;
+
+    SDL_LockMutex(watch_lock);
+    len = SDL_strlen(watch_log);
+    if (oldpath) {
+        SDL_snprintf(watch_log + len, sizeof(watch_log) - len, "%s %s %s\n", actions[action], path, oldpath);
+    } else {
+        SDL_snprintf(watch_log + len, sizeof(watch_log) - len, "%s %s\n", actions[action], path);
+    }
+    SDL_UnlockMutex(watch_lock);
+}
+
+static int SDLCALL compare_strings(const void *a, const void *b)
+{
+    return SDL_strcmp(*(const char **)a, *(const char **)b);
+}
+
+/* Delivery order across different paths isn't something to rely on, so compare sorted lines. */
+static void SortLines(char *text)
+{
+    char *lines[32];
+    char sorted[sizeof(watch_log)];
+    char *line = text;
+    size_t count = 0;
+    size_t i;
+
+    while (*line && count < SDL_arraysize(lines)) {
+        char *end = SDL_strchr(line, '\n');
+        if (!end) {
+            break;
+        }
+        *end = '\0';
+        lines[count++] = line;
+        line = end + 1;
+    }
+    SDL_qsort(lines, count, sizeof(char *), compare_strings);
+
+    sorted[0] = '\0';
+    for (i = 0; i < count; i++) {
+        SDL_strlcat(sorted, lines[i], sizeof(sorted));
+        SDL_strlcat(sorted, "\n", sizeof(sorted));
+    }
+    SDL_strlcpy(text, sorted, sizeof(sorted));
+}
+
+/* `polled` is what the step looks like when the platform can only poll, which doesn't see renames, or NULL if it's the same. */
+static bool CheckWatch(const char *step, const char *expected, const char *polled)
+{
+    char expect[sizeof(watch_log)];
+    char expect_polled[sizeof(watch_log)];
+    bool ok;
+
+    /* long enough for the watch to go quiet, even when it has to poll. */
+    SDL_Delay(750);
+
+    SDL_strlcpy(expect, expected, sizeof(expect));
+    SortLines(expect);
+    SDL_strlcpy(expect_polled, polled ? polled : expected, sizeof(expect_polled));
+    SortLines(expect_polled);
+
+    SDL_LockMutex(watch_lock);
+    SortLines(watch_log);
+    ok = (SDL_strcmp(watch_log, expect) == 0) || (SDL_strcmp(watch_log, expect_polled) == 0);
+    if (!ok) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Directory watch after %s: expected\n%sgot\n%s", step, expected, watch_log);
+    }
+    watch_log[0] = '\0';
+    SDL_UnlockMutex(watch_lock);
+    return ok;
+}
+
+static void TestFileWatch(void)
+{
+    SDL_FileWatch *watch;
+    int i;
+
+    SDL_RemovePath("testfilesystem-watch");
+    if (!SDL_CreateDirectory("testfilesystem-watch")) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateDirectory('testfilesystem-watch') failed: %s", SDL_GetError());
+        return;
+    }
+
+    watch_lock = SDL_CreateMutex();
+    watch = SDL_WatchDirectory("testfilesystem-watch", SDL_FILEWATCH_RECURSIVE, watch_callback, NULL);
+    if (!watch) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_WatchDirectory('testfilesystem-watch') failed: %s", SDL_GetError());
+    } else {
+        /* a burst of writes to a new file is one creation... */
+        for (i = 0; i < 10; i++) {
+            SDL_SaveFile("testfilesystem-watch/a.txt", "hello", 5 + (i & 1));
+        }
+        if (CheckWatch("creating a file", "created a.txt\n", NULL)) {
+            /* ...and to an existing file, one modification. */
+            for (i = 0; i < 10; i++) {
+                SDL_SaveFile("testfilesystem-watch/a.txt", "goodbye", 7);
+            }
+        }
+        if (CheckWatch("modifying a file", "modified a.txt\n", NULL)) {
+            /* something that comes and goes before delivery was never there. */
+            SDL_SaveFile("testfilesystem-watch/temp.txt", "x", 1);
+            SDL_RemovePath("testfilesystem-watch/temp.txt");
+            SDL_CreateDirectory("testfilesystem-watch/sub");
+            SDL_SaveFile("testfilesystem-watch/sub/x.txt", "x", 1);
+        }
+        if (CheckWatch("creating a subdirectory", "created sub\ncreated sub/x.txt\n", NULL)) {
+            SDL_RenamePath("testfilesystem-watch/sub/x.txt", "testfilesystem-watch/sub/y.txt");
+        }
+        if (CheckWatch("renaming a file", "renamed sub/y.txt sub/x.txt\n", "created sub/y.txt\nremoved sub/x.txt\n")) {
+            SDL_RemovePath("testfilesystem-watch/sub/y.txt");
+            SDL_RemovePath("testfilesystem-watch/sub");
+        }
+        CheckWatch("removing a subdirectory", "removed sub/y.txt\nremoved sub\n", NULL);
+
+        SDL_UnwatchDirectory(watch);
+    }
+    SDL_DestroyMutex(watch_lock);
+
+    SDL_RemovePath("testfilesystem-watch/a.txt");
+    SDL_RemovePath("testfilesystem-watch");
+}
+
+/* The glob benchmark builds a tree of GLOB_FANOUT directories per level, GLOB_DEPTH levels deep, with GLOB_FILES files in each. */
+#define GLOB_ROOT   "glob-benchmark.tmp"
+#define GLOB_FANOUT 8
+#define GLOB_DEPTH  3
+#define GLOB_FILES  16
+
+static bool CreateGlobTree(const char *path, int depth)
+{
+    char *child;
+    int i;
+
+    if (!SDL_CreateDirectory(path)) {
+        return false;
+    }
+
+    for (i = 0; i < GLOB_FILES; i++) {
+        bool ok;
+        SDL_asprintf(&child, "%s/file%d.%s", path, i, (i & 1) ? "dat" : "txt");
+        ok = child && SDL_SaveFile(child, "x", 1);
+        SDL_free(child);
+        if (!ok) {
+            return false;
+        }
+    }
+
+    if (depth < GLOB_DEPTH) {
+        for (i = 0; i < GLOB_FANOUT; i++) {
+            bool ok;
+            SDL_asprintf(&child, "%s/dir%d", path, i);
+            ok = child && CreateGlobTree(child, depth + 1);
+            SDL_free(child);
+            if (!ok) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static int SDLCALL compare_longest_first(const void *a, const void *b)
+{
+    return (int)SDL_strlen(*(const char **)b) - (int)SDL_strlen(*(const char **)a);
+}
+
+static void RemoveGlobTree(void)
+{
+    int count = 0;
+    char **entries = SDL_GlobDirectory(GLOB_ROOT, NULL, 0, &count);
+    int i;
+
+    if (entries) {
+        /* children sort ahead of their parents, so directories are empty by the time they're removed. */
+        SDL_qsort(entries, count, sizeof(char *), compare_longest_first);
+        for (i = 0; i < count; i++) {
+            char *path = NULL;
+            SDL_asprintf(&path, "%s/%s", GLOB_ROOT, entries[i]);
+            if (path) {
+                SDL_RemovePath(path);
+                SDL_free(path);
+            }
+        }
+        SDL_free(entries);
+    }
+    SDL_RemovePath(GLOB_ROOT);
+}
+
+static bool TimeGlob(SDL_Storage *storage, const char *pattern, SDL_GlobFlags flags, int expected)
+{
+    const Uint64 start = SDL_GetTicksNS();
+    int count = 0;
+    char **entries = storage ? SDL_GlobStorageDirectory(storage, NULL, pattern, flags, &count) : SDL_GlobDirectory(GLOB_ROOT, pattern, flags, &count);
+    const Uint64 elapsed = SDL_GetTicksNS() - start;
+
+    if (!entries) {
+        SDL_Log("Glob '%s' failed: %s", pattern ? pattern : "(null)", SDL_GetError());
+        return false;
+    }
+    SDL_free(entries);
+
+    SDL_Log("%-9s %-22s %6d matches in %8.3f ms", storage ? "storage" : "directory", pattern ? pattern : "(null)", count, (double)elapsed / SDL_NS_PER_MS);
+    if (count != expected) {
+        SDL_Log("Expected %d matches!", expected);
+        return false;
+    }
+    return true;
+}
+
+/* The copy benchmark copies one large file; run it from a directory on the filesystem you want to measure (tmpfs, ext4, btrfs...). */
+#define COPY_SOURCE   "copy-benchmark-src.tmp"
+#define COPY_DEST     "copy-benchmark-dst.tmp"
+#define COPY_SIZE_MB  256
+
+typedef struct CopyProgress
+{
+    int calls;
+    Uint64 copied;
+    Uint64 total;
+    Uint64 cancel_after;
+} CopyProgress;
+
+static bool SDLCALL copy_progress_callback(void *userdata, Uint64 copied, Uint64 total)
+{
+    CopyProgress *progress = (CopyProgress *)userdata;
+    progress->calls++;
+    progress->copied = copied;
+    progress->total = total;
+    return copied < progress->cancel_after;
+}
+
+static bool CreateCopySource(Uint64 size)
+{
+    const size_t chunk_size = 1024 * 1024;
+    Uint32 *chunk = (Uint32 *)SDL_malloc(chunk_size);
+    SDL_IOStream *io = SDL_IOFromFile(COPY_SOURCE, "wb");
+    Uint32 value = 0;
+    Uint64 written;
+    bool ok = (chunk && io);
+    size_t i;
+
+    for (written = 0; ok && written < size; written += chunk_size) {
+        for (i = 0; i < chunk_size / sizeof(*chunk); i++) {
+            chunk[i] = value++;
+        }
+        ok = (SDL_WriteIO(io, chunk, chunk_size) == chunk_size);
+    }
+    if (io && !SDL_CloseIO(io)) {
+        ok = false;
+    }
+    SDL_free(chunk);
+    return ok;
+}
+
+static bool FilesMatch(const char *a, const char *b)
+{
+    const size_t chunk_size = 1024 * 1024;
+    Uint8 *chunk_a = (Uint8 *)SDL_malloc(chunk_size);
+    Uint8 *chunk_b = (Uint8 *)SDL_malloc(chunk_size);
+    SDL_IOStream *io_a = SDL_IOFromFile(a, "rb");
+    SDL_IOStream *io_b = SDL_IOFromFile(b, "rb");
+    bool ok = (chunk_a && chunk_b && io_a && io_b);
+
+    while (ok) {
+        const size_t len_a = SDL_ReadIO(io_a, chunk_a, chunk_size);
+        const size_t len_b = SDL_ReadIO(io_b, chunk_b, chunk_size);
+        if (len_a != len_b || SDL_memcmp(chunk_a, chunk_b, len_a) != 0) {
+            ok = false;
+        } else if (len_a == 0) {
+            break;
+        }
+    }
+    SDL_CloseIO(io_a);
+    SDL_CloseIO(io_b);
+    SDL_free(chunk_a);
+    SDL_free(chunk_b);
+    return ok;
+}
+
+static bool TimeCopy(const char *label, bool with_progress)
+{
+    CopyProgress progress;
+    Uint64 start, elapsed;
+    bool ok;
+
+    SDL_zero(progress);
+    progress.cancel_after = SDL_MAX_UINT64;
+    SDL_RemovePath(COPY_DEST);
+
+    start = SDL_GetTicksNS();
+    if (with_progress) {
+        ok = SDL_CopyFileWithProgress(COPY_SOURCE, COPY_DEST, copy_progress_callback, &progress);
+    } else {
+        ok = SDL_CopyFile(COPY_SOURCE, COPY_DEST);
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    if (!ok) {
+        SDL_Log("Copy failed: %s", SDL_GetError());
+        return false;
+    }
+    SDL_Log("%-22s %d MB in %8.3f ms (%.0f MB/s), %d progress callbacks", label, COPY_SIZE_MB,
+            (double)elapsed / SDL_NS_PER_MS, COPY_SIZE_MB / ((double)elapsed / SDL_NS_PER_SECOND), progress.calls);
+    if (with_progress && (progress.calls == 0 || progress.copied != progress.total || progress.total != (Uint64)COPY_SIZE_MB * 1024 * 1024)) {
+        SDL_Log("Progress ended at %" SDL_PRIu64 " of %" SDL_PRIu64 " bytes!", progress.copied, progress.total);
+        return false;
+    }
+    if (!FilesMatch(COPY_SOURCE, COPY_DEST)) {
+        SDL_Log("Copied file doesn't match the original!");
+        return false;
+    }
+    return true;
+}
+
+static bool BenchmarkCopy(void)
+{
+    CopyProgress progress;
+    bool ok;
+
+    SDL_Log("Creating a %d MB file...", COPY_SIZE_MB);
+    if (!CreateCopySource((Uint64)COPY_SIZE_MB * 1024 * 1024)) {
+        SDL_Log("Couldn't create copy source: %s", SDL_GetError());
+        SDL_RemovePath(COPY_SOURCE);
+        return false;
+    }
+
+    ok = TimeCopy("SDL_CopyFile", false) &&
+         TimeCopy("with progress", true);
+
+    /* Canceling partway through has to fail the copy. */
+    if (ok) {
+        SDL_zero(progress);
+        progress.cancel_after = 1;
+        if (SDL_CopyFileWithProgress(COPY_SOURCE, COPY_DEST, copy_progress_callback, &progress)) {
+            SDL_Log("Canceled copy succeeded anyway!");
+            ok = false;
+        }
+    }
+
+    SDL_RemovePath(COPY_DEST);
+    SDL_RemovePath(COPY_SOURCE);
+    return ok;
+}
+
+static bool Benchmark(void)
+{
+    int dirs_per_level[GLOB_DEPTH + 1];
+    int total_dirs = 0;
+    int deepest_files;
+    SDL_Storage *storage;
+    bool ok = true;
+    int i;
+
+    dirs_per_level[0] = 1;
+    for (i = 1; i <= GLOB_DEPTH; i++) {
+        dirs_per_level[i] = dirs_per_level[i - 1] * GLOB_FANOUT;
+        total_dirs += dirs_per_level[i];
+    }
+    deepest_files = dirs_per_level[GLOB_DEPTH] * GLOB_FILES;
+
+    RemoveGlobTree();
+    SDL_Log("Creating %d directories and %d files...", total_dirs + 1, (total_dirs + 1) * GLOB_FILES);
+    if (!CreateGlobTree(GLOB_ROOT, 0)) {
+        SDL_Log("Couldn't create benchmark tree: %s", SDL_GetError());
+        RemoveGlobTree();
+        return false;
+    }
+
+    /* SDL_GlobDirectory may spread the walk over several threads; storage globs always stay on the calling thread. */
+    storage = SDL_OpenFileStorage(GLOB_ROOT);
+    for (i = 0; ok && i < 2; i++) {
+        SDL_Storage *s = (i == 0) ? NULL : storage;
+        if (i == 1 && !storage) {
+            break;
+        }
+        ok = TimeGlob(s, NULL, 0, total_dirs + (total_dirs + 1) * GLOB_FILES) &&
+             TimeGlob(s, "*/*/*/*.txt", 0, deepest_files / 2) &&
+             TimeGlob(s, "DIR3/*/DIR?/*.TXT", SDL_GLOB_CASEINSENSITIVE, deepest_files / 2 / GLOB_FANOUT) &&
+             TimeGlob(s, "dir3/dir4/dir5/file?.*", 0, SDL_min(GLOB_FILES, 10));
+    }
+    SDL_CloseStorage(storage);
+
+    RemoveGlobTree();
+    return ok && BenchmarkCopy();
+}
+
 int main(int argc, char *argv[])
 {
     SDLTest_CommonState *state;
     char *pref_path;
     char *curdir;
     const char *base_path;
+    bool benchmark = false;
+    int i;
 
     /* Initialize test framework */
     state = SDLTest_CommonCreateState(argv, 0);
@@ -101,8 +495,24 @@ int main(int argc, char *argv[])
     }
 
     /* Parse commandline */
-    if (!SDLTest_CommonDefaultArgs(state, argc, argv)) {
-        return 1;
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            if (SDL_strcmp(argv[i], "--benchmark") == 0) {
+                benchmark = true;
+                consumed = 1;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = {
+                "[--benchmark]",
+                NULL,
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            SDLTest_CommonDestroyState(state);
+            return 1;
+        }
+        i += consumed;
     }
 
     if (!SDL_Init(0)) {
@@ -110,6 +520,13 @@ int main(int argc, char *argv[])
         return 1;
     }
 
+    if (benchmark) {
+        const bool ok = Benchmark();
+        SDL_Quit();
+        SDLTest_CommonDestroyState(state);
+        return ok ? 0 : 1;
+    }
+
     base_path = SDL_GetBasePath();
     if (!base_path) {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't find base path: %s",
@@ -230,6 +647,8 @@ int main(int argc, char *argv[])
             SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_IOFromFile('testfilesystem-A', 'w') failed: %s", SDL_GetError());
         }
 
+        TestFileWatch();
+
         storage = SDL_OpenFileStorage(base_path);
         if (!storage) {
             SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to open base path storage object: %s", SDL_GetError());
@@ -249,6 +668,31 @@ int main(int argc, char *argv[])
                 SDL_free(globlist);
             }
 
+            {
+                SDL_AsyncIOQueue *queue = SDL_CreateAsyncIOQueue();
+                int count = 0;
+                globlist = queue ? SDL_ReadStorageFilesAsync(storage, "", "C*/test*/T?st*", SDL_GLOB_CASEINSENSITIVE, queue, &count) : NULL;
+                if (!globlist) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Base path async bulk read failed: %s", SDL_GetError());
+                } else {
+                    int received = 0;
+                    while (received < count) {
+                        SDL_AsyncIOOutcome outcome;
+                        if (SDL_WaitAsyncIOResult(queue, &outcome, -1)) {
+                            if (outcome.result == SDL_ASYNCIO_COMPLETE) {
+                                SDL_Log("STORAGE ASYNC READ: '%s' (%" SDL_PRIu64 " bytes)", (const char *) outcome.userdata, outcome.bytes_transferred);
+                            } else {
+                                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Async read of '%s' failed", (const char *) outcome.userdata);
+                            }
+                            SDL_free(outcome.buffer);
+                            received++;
+                        }
+                    }
+                    SDL_free(globlist);
+                }
+                SDL_DestroyAsyncIOQueue(queue);
+            }
+
             /* these should fail: */
             if (!SDL_GetStoragePathInfo(storage, "CMakeFiles/../testsprite.c", &pathinfo)) {
                 SDL_Log("Storage access on path with internal '..' refused correctly.");
@@ -0,0 +1,28 @@
+#version 450
+
+layout (local_size_x = 1, local_size_y = 1, local_size_z = 1) in;
+
+layout (set = 1, binding = 0) buffer Output
+{
+    vec4 color;
+    uint value;
+} result;
+
+layout (set = 2, binding = 0) uniform Indices
+{
+    uint texture_index;
+    uint buffer_index;
+};
+
+// The bindless table
+layout (set = 3, binding = 0) uniform sampler2D textures[16];
+layout (set = 3, binding = 1) readonly buffer Values
+{
+    uint value;
+} values[16];
+
+void main()
+{
+    result.color = textureLod(textures[texture_index], vec2(0.5), 0.0);
+    result.value = values[buffer_index].value;
+}
@@ -1,4 +1,4 @@
-# Rebuilds the shaders needed for the GPU cube test.
+# Rebuilds the shaders needed for the GPU cube test and the bindless table test.
 # For SPIR-V: requires glslangValidator and spirv-cross, which can be obtained from the LunarG Vulkan SDK.
 # For DXBC compilation: requires FXC, which is part of the Windows SDK.
 # For DXIL compilation, requires DXC, which can be obtained via the Windows SDK or via here: https://github.com/microsoft/DirectXShaderCompiler/releases
@@ -17,6 +17,9 @@ xxd -i cube.vert.spv | perl -w -p -e 's/\Aunsigned /const unsigned /;' > cube.ve
 xxd -i cube.frag.spv | perl -w -p -e 's/\Aunsigned /const unsigned /;' > cube.frag.h
 cat cube.vert.h cube.frag.h > testgpu_spirv.h
 rm -f cube.vert.h cube.frag.h cube.vert.spv cube.frag.spv
+glslangValidator bindless.glsl -V -S comp -o bindless.comp.spv --quiet
+xxd -i bindless.comp.spv | perl -w -p -e 's/\Aunsigned /const unsigned /;' > testgpu_bindless_spirv.h
+rm -f bindless.comp.spv
 
 # Platform-specific compilation
 if [[ "$OSTYPE" == "darwin"* ]]; then
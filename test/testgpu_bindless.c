@@ -0,0 +1,297 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Registers textures and storage buffers in the bindless table and reads
+ * them back by index from a compute shader on a headless device.
+ *
+ * Runs without a window, so a software Vulkan implementation is enough, e.g.
+ *   VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json ./testgpu_bindless
+ *
+ * Devices without a bindless table are reported and skipped.
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+
+#include "gpuutils.h"
+
+/* Regenerate the shader with testgpu/build-shaders.sh */
+#include "testgpu/testgpu_bindless_spirv.h"
+
+#define NUM_RESOURCES 2
+
+typedef struct Indices
+{
+    Uint32 texture_index;
+    Uint32 buffer_index;
+} Indices;
+
+typedef struct Output
+{
+    float color[4];
+    Uint32 value;
+    Uint32 padding[3];
+} Output;
+
+static const Uint8 texture_colors[NUM_RESOURCES][4] = {
+    { 255, 0, 0, 255 },
+    { 0, 0, 255, 255 }
+};
+
+static const Uint32 buffer_values[NUM_RESOURCES] = { 111, 222 };
+
+int main(int argc, char *argv[])
+{
+    SDL_PropertiesID props;
+    SDL_GPUDevice *device;
+    SDL_GPUComputePipelineCreateInfo pipeline_info;
+    SDL_GPUTextureCreateInfo texture_info;
+    SDL_GPUSamplerCreateInfo sampler_info;
+    SDL_GPUBufferCreateInfo buffer_info;
+    SDL_GPUTransferBufferCreateInfo transfer_info;
+    SDL_GPUComputePipeline *pipeline = NULL;
+    SDL_GPUSampler *sampler = NULL;
+    SDL_GPUTexture *textures[NUM_RESOURCES] = { NULL, NULL };
+    SDL_GPUBuffer *buffers[NUM_RESOURCES] = { NULL, NULL };
+    SDL_GPUBuffer *output = NULL;
+    SDL_GPUTransferBuffer *upload = NULL;
+    SDL_GPUTransferBuffer *download = NULL;
+    Uint32 texture_slots[NUM_RESOURCES];
+    Uint32 buffer_slots[NUM_RESOURCES];
+    int registered_textures = 0;
+    int registered_buffers = 0;
+    SDL_GPUCommandBuffer *cmdbuf;
+    SDL_GPUCopyPass *copy_pass;
+    SDL_GPUComputePass *compute_pass;
+    SDL_GPUStorageBufferReadWriteBinding output_binding;
+    SDL_GPUTransferBufferLocation location;
+    SDL_GPUBufferRegion buffer_region;
+    SDL_GPUTextureTransferInfo texture_source;
+    SDL_GPUTextureRegion texture_region;
+    SDL_GPUFence *fence;
+    Indices indices;
+    Output *result;
+    Uint8 *mapped;
+    int status = 1;
+    int i;
+
+    props = SDL_CreateProperties();
+    SDL_SetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_BINDLESS_BOOLEAN, true);
+    device = CreateHeadlessGPUDevice(SDL_GPU_SHADERFORMAT_SPIRV, props);
+    SDL_DestroyProperties(props);
+    if (!device) {
+        return 1;
+    }
+
+    props = SDL_GetGPUDeviceProperties(device);
+    if (SDL_GetNumberProperty(props, SDL_PROP_GPU_DEVICE_BINDLESS_TEXTURES_NUMBER, 0) < NUM_RESOURCES ||
+        SDL_GetNumberProperty(props, SDL_PROP_GPU_DEVICE_BINDLESS_BUFFERS_NUMBER, 0) < NUM_RESOURCES) {
+        SDL_Log("The device has no bindless table, skipping");
+        status = 0;
+        goto done;
+    }
+
+    SDL_zero(pipeline_info);
+    pipeline_info.code = bindless_comp_spv;
+    pipeline_info.code_size = bindless_comp_spv_len;
+    pipeline_info.entrypoint = "main";
+    pipeline_info.format = SDL_GPU_SHADERFORMAT_SPIRV;
+    pipeline_info.num_readwrite_storage_buffers = 1;
+    pipeline_info.num_uniform_buffers = 1;
+    pipeline_info.threadcount_x = 1;
+    pipeline_info.threadcount_y = 1;
+    pipeline_info.threadcount_z = 1;
+    pipeline = SDL_CreateGPUComputePipeline(device, &pipeline_info);
+
+    SDL_zero(sampler_info);
+    sampler_info.min_filter = SDL_GPU_FILTER_NEAREST;
+    sampler_info.mag_filter = SDL_GPU_FILTER_NEAREST;
+    sampler_info.mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST;
+    sampler_info.address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+    sampler_info.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+    sampler_info.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+    sampler = SDL_CreateGPUSampler(device, &sampler_info);
+
+    SDL_zero(texture_info);
+    texture_info.type = SDL_GPU_TEXTURETYPE_2D;
+    texture_info.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+    texture_info.usage = SDL_GPU_TEXTUREUSAGE_SAMPLER;
+    texture_info.width = 1;
+    texture_info.height = 1;
+    texture_info.layer_count_or_depth = 1;
+    texture_info.num_levels = 1;
+
+    SDL_zero(buffer_info);
+    buffer_info.usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ;
+    buffer_info.size = sizeof(Uint32);
+
+    for (i = 0; i < NUM_RESOURCES; i += 1) {
+        textures[i] = SDL_CreateGPUTexture(device, &texture_info);
+        buffers[i] = SDL_CreateGPUBuffer(device, &buffer_info);
+    }
+
+    buffer_info.usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE;
+    buffer_info.size = sizeof(Output);
+    output = SDL_CreateGPUBuffer(device, &buffer_info);
+
+    SDL_zero(transfer_info);
+    transfer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    transfer_info.size = sizeof(texture_colors) + sizeof(buffer_values);
+    upload = SDL_CreateGPUTransferBuffer(device, &transfer_info);
+
+    transfer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_DOWNLOAD;
+    transfer_info.size = sizeof(Output);
+    download = SDL_CreateGPUTransferBuffer(device, &transfer_info);
+
+    if (!pipeline || !sampler || !textures[0] || !textures[1] || !buffers[0] || !buffers[1] ||
+        !output || !upload || !download) {
+        SDL_Log("Couldn't create resources: %s", SDL_GetError());
+        goto done;
+    }
+
+    /* Fill the resources, then put them in the table */
+    mapped = (Uint8 *)SDL_MapGPUTransferBuffer(device, upload, false);
+    if (!mapped) {
+        SDL_Log("Couldn't map upload buffer: %s", SDL_GetError());
+        goto done;
+    }
+    SDL_memcpy(mapped, texture_colors, sizeof(texture_colors));
+    SDL_memcpy(mapped + sizeof(texture_colors), buffer_values, sizeof(buffer_values));
+    SDL_UnmapGPUTransferBuffer(device, upload);
+
+    cmdbuf = SDL_AcquireGPUCommandBuffer(device);
+    if (!cmdbuf) {
+        SDL_Log("Couldn't acquire command buffer: %s", SDL_GetError());
+        goto done;
+    }
+    copy_pass = SDL_BeginGPUCopyPass(cmdbuf);
+    for (i = 0; i < NUM_RESOURCES; i += 1) {
+        SDL_zero(texture_source);
+        texture_source.transfer_buffer = upload;
+        texture_source.offset = i * sizeof(texture_colors[0]);
+        SDL_zero(texture_region);
+        texture_region.texture = textures[i];
+        texture_region.w = 1;
+        texture_region.h = 1;
+        texture_region.d = 1;
+        SDL_UploadToGPUTexture(copy_pass, &texture_source, &texture_region, false);
+
+        SDL_zero(location);
+        location.transfer_buffer = upload;
+        location.offset = sizeof(texture_colors) + i * sizeof(buffer_values[0]);
+        SDL_zero(buffer_region);
+        buffer_region.buffer = buffers[i];
+        buffer_region.size = sizeof(buffer_values[0]);
+        SDL_UploadToGPUBuffer(copy_pass, &location, &buffer_region, false);
+    }
+    SDL_EndGPUCopyPass(copy_pass);
+    if (!SDL_SubmitGPUCommandBuffer(cmdbuf)) {
+        SDL_Log("Couldn't submit: %s", SDL_GetError());
+        goto done;
+    }
+
+    for (i = 0; i < NUM_RESOURCES; i += 1) {
+        if (!SDL_RegisterGPUBindlessTexture(device, textures[i], sampler, &texture_slots[i])) {
+            SDL_Log("Couldn't register texture %d: %s", i, SDL_GetError());
+            goto done;
+        }
+        registered_textures += 1;
+        if (!SDL_RegisterGPUBindlessBuffer(device, buffers[i], &buffer_slots[i])) {
+            SDL_Log("Couldn't register buffer %d: %s", i, SDL_GetError());
+            goto done;
+        }
+        registered_buffers += 1;
+        SDL_Log("Texture %d is in slot %" SDL_PRIu32 ", buffer %d in slot %" SDL_PRIu32, i, texture_slots[i], i, buffer_slots[i]);
+    }
+
+    /* Pair each texture with the other buffer, so swapped indices can't pass */
+    for (i = 0; i < NUM_RESOURCES; i += 1) {
+        const int texture = i;
+        const int buffer = NUM_RESOURCES - 1 - i;
+
+        cmdbuf = SDL_AcquireGPUCommandBuffer(device);
+        if (!cmdbuf) {
+            SDL_Log("Couldn't acquire command buffer: %s", SDL_GetError());
+            goto done;
+        }
+
+        SDL_zero(output_binding);
+        output_binding.buffer = output;
+        compute_pass = SDL_BeginGPUComputePass(cmdbuf, NULL, 0, &output_binding, 1);
+        SDL_BindGPUComputePipeline(compute_pass, pipeline);
+        indices.texture_index = texture_slots[texture];
+        indices.buffer_index = buffer_slots[buffer];
+        SDL_PushGPUComputeUniformData(cmdbuf, 0, &indices, sizeof(indices));
+        SDL_DispatchGPUCompute(compute_pass, 1, 1, 1);
+        SDL_EndGPUComputePass(compute_pass);
+
+        SDL_zero(buffer_region);
+        buffer_region.buffer = output;
+        buffer_region.size = sizeof(Output);
+        SDL_zero(location);
+        location.transfer_buffer = download;
+        copy_pass = SDL_BeginGPUCopyPass(cmdbuf);
+        SDL_DownloadFromGPUBuffer(copy_pass, &buffer_region, &location);
+        SDL_EndGPUCopyPass(copy_pass);
+
+        fence = SDL_SubmitGPUCommandBufferAndAcquireFence(cmdbuf);
+        if (!fence) {
+            SDL_Log("Couldn't submit: %s", SDL_GetError());
+            goto done;
+        }
+        if (!SDL_WaitForGPUFences(device, true, &fence, 1)) {
+            SDL_Log("Couldn't wait for the fence: %s", SDL_GetError());
+            SDL_ReleaseGPUFence(device, fence);
+            goto done;
+        }
+        SDL_ReleaseGPUFence(device, fence);
+
+        result = (Output *)SDL_MapGPUTransferBuffer(device, download, false);
+        if (!result) {
+            SDL_Log("Couldn't map download buffer: %s", SDL_GetError());
+            goto done;
+        }
+        SDL_Log("Texture slot %" SDL_PRIu32 ": %g,%g,%g,%g, buffer slot %" SDL_PRIu32 ": %" SDL_PRIu32,
+                indices.texture_index, result->color[0], result->color[1], result->color[2], result->color[3],
+                indices.buffer_index, result->value);
+        if (result->color[0] * 255.0f != texture_colors[texture][0] ||
+            result->color[1] * 255.0f != texture_colors[texture][1] ||
+            result->color[2] * 255.0f != texture_colors[texture][2] ||
+            result->color[3] * 255.0f != texture_colors[texture][3] ||
+            result->value != buffer_values[buffer]) {
+            SDL_Log("Expected the color of texture %d and the value of buffer %d", texture, buffer);
+            SDL_UnmapGPUTransferBuffer(device, download);
+            goto done;
+        }
+        SDL_UnmapGPUTransferBuffer(device, download);
+    }
+    status = 0;
+
+done:
+    for (i = 0; i < registered_textures; i += 1) {
+        SDL_UnregisterGPUBindlessTexture(device, texture_slots[i]);
+    }
+    for (i = 0; i < registered_buffers; i += 1) {
+        SDL_UnregisterGPUBindlessBuffer(device, buffer_slots[i]);
+    }
+    SDL_ReleaseGPUTransferBuffer(device, download);
+    SDL_ReleaseGPUTransferBuffer(device, upload);
+    SDL_ReleaseGPUBuffer(device, output);
+    for (i = 0; i < NUM_RESOURCES; i += 1) {
+        SDL_ReleaseGPUBuffer(device, buffers[i]);
+        SDL_ReleaseGPUTexture(device, textures[i]);
+    }
+    SDL_ReleaseGPUSampler(device, sampler);
+    SDL_ReleaseGPUComputePipeline(device, pipeline);
+    DestroyHeadlessGPUDevice(device);
+    return status;
+}
@@ -0,0 +1,387 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Exercises the compute path of SDL_BlitGPUTexture() and
+ * SDL_GenerateMipmapsForGPUTexture() on a headless device.
+ *
+ * Both are only taken for destinations with COMPUTE_STORAGE_WRITE usage and
+ * no COLOR_TARGET usage, so that's how the textures here are created. Runs on
+ * a software Vulkan implementation, e.g.
+ *   VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json ./testgpu_compute_blit
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+
+#include "gpuutils.h"
+
+#define SOURCE_SIZE 64
+#define BLIT_SIZE   32
+
+static SDL_GPUDevice *device;
+
+static SDL_GPUTexture *CreateTexture(SDL_GPUTextureType type, Uint32 w, Uint32 h, Uint32 layers_or_depth, Uint32 levels, SDL_GPUTextureUsageFlags usage)
+{
+    SDL_GPUTextureCreateInfo info;
+    SDL_zero(info);
+    info.type = type;
+    info.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+    info.usage = usage;
+    info.width = w;
+    info.height = h;
+    info.layer_count_or_depth = layers_or_depth;
+    info.num_levels = levels;
+    return SDL_CreateGPUTexture(device, &info);
+}
+
+/* Uploads a w*h*d block to level 0 of a layer, d is the depth of 3D textures */
+static bool Upload(SDL_GPUTexture *texture, Uint32 layer, Uint32 w, Uint32 h, Uint32 d, const Uint8 *pixels)
+{
+    SDL_GPUTransferBufferCreateInfo info;
+    SDL_GPUTransferBuffer *transfer;
+    SDL_GPUTextureTransferInfo source;
+    SDL_GPUTextureRegion region;
+    SDL_GPUCommandBuffer *cmdbuf;
+    SDL_GPUCopyPass *copy_pass;
+    void *mapped;
+
+    SDL_zero(info);
+    info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    info.size = w * h * d * 4;
+    transfer = SDL_CreateGPUTransferBuffer(device, &info);
+    if (!transfer) {
+        return false;
+    }
+    mapped = SDL_MapGPUTransferBuffer(device, transfer, false);
+    if (!mapped) {
+        SDL_ReleaseGPUTransferBuffer(device, transfer);
+        return false;
+    }
+    SDL_memcpy(mapped, pixels, info.size);
+    SDL_UnmapGPUTransferBuffer(device, transfer);
+
+    SDL_zero(source);
+    source.transfer_buffer = transfer;
+    SDL_zero(region);
+    region.texture = texture;
+    region.layer = layer;
+    region.w = w;
+    region.h = h;
+    region.d = d;
+
+    cmdbuf = SDL_AcquireGPUCommandBuffer(device);
+    if (!cmdbuf) {
+        SDL_ReleaseGPUTransferBuffer(device, transfer);
+        return false;
+    }
+    copy_pass = SDL_BeginGPUCopyPass(cmdbuf);
+    SDL_UploadToGPUTexture(copy_pass, &source, &region, false);
+    SDL_EndGPUCopyPass(copy_pass);
+    SDL_ReleaseGPUTransferBuffer(device, transfer);
+    return SDL_SubmitGPUCommandBuffer(cmdbuf);
+}
+
+/* Records the download after whatever the command buffer already holds, submits it and waits */
+static Uint8 *DownloadAfter(SDL_GPUCommandBuffer *cmdbuf, SDL_GPUTexture *texture, Uint32 mip_level, Uint32 layer, Uint32 w, Uint32 h, Uint32 d)
+{
+    SDL_GPUTransferBufferCreateInfo info;
+    SDL_GPUTransferBuffer *transfer;
+    SDL_GPUTextureTransferInfo destination;
+    SDL_GPUTextureRegion region;
+    SDL_GPUCopyPass *copy_pass;
+    SDL_GPUFence *fence;
+    Uint8 *result = NULL;
+
+    SDL_zero(info);
+    info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_DOWNLOAD;
+    info.size = w * h * d * 4;
+    transfer = SDL_CreateGPUTransferBuffer(device, &info);
+    if (!transfer) {
+        SDL_CancelGPUCommandBuffer(cmdbuf);
+        return NULL;
+    }
+
+    SDL_zero(region);
+    region.texture = texture;
+    region.mip_level = mip_level;
+    region.layer = layer;
+    region.w = w;
+    region.h = h;
+    region.d = d;
+    SDL_zero(destination);
+    destination.transfer_buffer = transfer;
+    copy_pass = SDL_BeginGPUCopyPass(cmdbuf);
+    SDL_DownloadFromGPUTexture(copy_pass, &region, &destination);
+    SDL_EndGPUCopyPass(copy_pass);
+
+    fence = SDL_SubmitGPUCommandBufferAndAcquireFence(cmdbuf);
+    if (fence) {
+        if (SDL_WaitForGPUFences(device, true, &fence, 1)) {
+            const void *mapped = SDL_MapGPUTransferBuffer(device, transfer, false);
+            if (mapped) {
+                result = (Uint8 *)SDL_malloc(info.size);
+                if (result) {
+                    SDL_memcpy(result, mapped, info.size);
+                }
+                SDL_UnmapGPUTransferBuffer(device, transfer);
+            }
+        }
+        SDL_ReleaseGPUFence(device, fence);
+    }
+    SDL_ReleaseGPUTransferBuffer(device, transfer);
+    return result;
+}
+
+static bool Near(int a, int b, int tolerance)
+{
+    return SDL_abs(a - b) <= tolerance;
+}
+
+static bool TestBlit(void)
+{
+    Uint8 pixels[SOURCE_SIZE * SOURCE_SIZE * 4];
+    SDL_GPUTexture *source = CreateTexture(SDL_GPU_TEXTURETYPE_2D, SOURCE_SIZE, SOURCE_SIZE, 1, 1, SDL_GPU_TEXTUREUSAGE_SAMPLER);
+    SDL_GPUTexture *destination = CreateTexture(SDL_GPU_TEXTURETYPE_2D, BLIT_SIZE, BLIT_SIZE, 1, 1, SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE);
+    SDL_GPUCommandBuffer *cmdbuf;
+    SDL_GPUBlitInfo blit;
+    Uint8 *result = NULL;
+    bool ok = false;
+    int x, y;
+
+    if (!source || !destination) {
+        SDL_Log("Couldn't create blit textures: %s", SDL_GetError());
+        goto done;
+    }
+
+    for (y = 0; y < SOURCE_SIZE; y += 1) {
+        for (x = 0; x < SOURCE_SIZE; x += 1) {
+            Uint8 *pixel = &pixels[(y * SOURCE_SIZE + x) * 4];
+            pixel[0] = (Uint8)(x * 4);
+            pixel[1] = (Uint8)(y * 4);
+            pixel[2] = 0;
+            pixel[3] = 255;
+        }
+    }
+    if (!Upload(source, 0, SOURCE_SIZE, SOURCE_SIZE, 1, pixels)) {
+        SDL_Log("Couldn't upload the blit source: %s", SDL_GetError());
+        goto done;
+    }
+
+    cmdbuf = SDL_AcquireGPUCommandBuffer(device);
+    if (!cmdbuf) {
+        goto done;
+    }
+    SDL_zero(blit);
+    blit.source.texture = source;
+    blit.source.w = SOURCE_SIZE;
+    blit.source.h = SOURCE_SIZE;
+    blit.destination.texture = destination;
+    blit.destination.w = BLIT_SIZE;
+    blit.destination.h = BLIT_SIZE;
+    blit.load_op = SDL_GPU_LOADOP_DONT_CARE;
+    blit.filter = SDL_GPU_FILTER_NEAREST;
+    SDL_BlitGPUTexture(cmdbuf, &blit);
+
+    result = DownloadAfter(cmdbuf, destination, 0, 0, BLIT_SIZE, BLIT_SIZE, 1);
+    if (!result) {
+        SDL_Log("Couldn't download the blit result: %s", SDL_GetError());
+        goto done;
+    }
+
+    /* Each destination texel samples the source at its center, which is source texel 2n+1 */
+    for (y = 0; y < BLIT_SIZE; y += 1) {
+        for (x = 0; x < BLIT_SIZE; x += 1) {
+            const Uint8 *pixel = &result[(y * BLIT_SIZE + x) * 4];
+            if (!Near(pixel[0], (2 * x + 1) * 4, 1) || !Near(pixel[1], (2 * y + 1) * 4, 1) || pixel[3] != 255) {
+                SDL_Log("Blit pixel %d,%d is %d,%d,%d,%d, expected %d,%d,0,255", x, y,
+                        pixel[0], pixel[1], pixel[2], pixel[3], (2 * x + 1) * 4, (2 * y + 1) * 4);
+                goto done;
+            }
+        }
+    }
+    SDL_Log("Compute blit: OK");
+    ok = true;
+
+done:
+    SDL_free(result);
+    SDL_ReleaseGPUTexture(device, destination);
+    SDL_ReleaseGPUTexture(device, source);
+    return ok;
+}
+
+static Uint32 LevelSize(Uint32 size, Uint32 level)
+{
+    return SDL_max(size >> level, 1);
+}
+
+/* Box filters level into the next one, dropping the odd texel at the end of a
+ * row, column or depth like the GPU does. d stays 1 for 2D levels.
+ */
+static float *Reduce(const float *level, Uint32 w, Uint32 h, Uint32 d, bool is_3d)
+{
+    Uint32 nw = SDL_max(w / 2, 1), nh = SDL_max(h / 2, 1), nd = is_3d ? SDL_max(d / 2, 1) : 1;
+    float *result = (float *)SDL_calloc(nw * nh * nd * 4, sizeof(float));
+    Uint32 x, y, z, i, c;
+
+    if (!result) {
+        return NULL;
+    }
+    for (z = 0; z < nd; z += 1) {
+        for (y = 0; y < nh; y += 1) {
+            for (x = 0; x < nw; x += 1) {
+                Uint32 samples = is_3d ? 8 : 4;
+                for (i = 0; i < samples; i += 1) {
+                    Uint32 sx = SDL_min(2 * x + (i & 1), w - 1);
+                    Uint32 sy = SDL_min(2 * y + ((i >> 1) & 1), h - 1);
+                    Uint32 sz = is_3d ? SDL_min(2 * z + (i >> 2), d - 1) : 0;
+                    for (c = 0; c < 4; c += 1) {
+                        result[((z * nh + y) * nw + x) * 4 + c] += level[((sz * h + sy) * w + sx) * 4 + c] / samples;
+                    }
+                }
+            }
+        }
+    }
+    return result;
+}
+
+/* Generates the mip chain of random texels and compares every level of every
+ * layer with a reference computed here.
+ */
+static bool TestMipmaps(const char *name, SDL_GPUTextureType type, Uint32 w, Uint32 h, Uint32 layers_or_depth)
+{
+    bool is_3d = (type == SDL_GPU_TEXTURETYPE_3D);
+    Uint32 layers = is_3d ? 1 : layers_or_depth;
+    Uint32 depth = is_3d ? layers_or_depth : 1;
+    Uint32 texels = w * h * depth;
+    Uint32 levels = 1;
+    SDL_GPUTexture *texture;
+    SDL_GPUCommandBuffer *cmdbuf;
+    Uint8 *pixels;
+    float *reference = NULL;
+    Uint8 *result = NULL;
+    bool ok = false;
+    Uint32 layer, level, i;
+
+    while ((SDL_max(SDL_max(w, h), depth) >> levels) > 0) {
+        levels += 1;
+    }
+
+    texture = CreateTexture(type, w, h, layers_or_depth, levels, SDL_GPU_TEXTUREUSAGE_SAMPLER | SDL_GPU_TEXTUREUSAGE_COMPUTE_STORAGE_WRITE);
+    pixels = (Uint8 *)SDL_malloc(texels * layers * 4);
+    if (!texture || !pixels) {
+        SDL_Log("Couldn't create the %s texture: %s", name, SDL_GetError());
+        goto done;
+    }
+
+    for (i = 0; i < texels * layers * 4; i += 1) {
+        pixels[i] = (Uint8)SDL_rand(256);
+    }
+    for (layer = 0; layer < layers; layer += 1) {
+        if (!Upload(texture, layer, w, h, depth, &pixels[texels * layer * 4])) {
+            SDL_Log("Couldn't upload the %s texture: %s", name, SDL_GetError());
+            goto done;
+        }
+    }
+
+    cmdbuf = SDL_AcquireGPUCommandBuffer(device);
+    if (!cmdbuf) {
+        goto done;
+    }
+    SDL_GenerateMipmapsForGPUTexture(cmdbuf, texture);
+    if (!SDL_SubmitGPUCommandBuffer(cmdbuf)) {
+        goto done;
+    }
+
+    for (layer = 0; layer < layers; layer += 1) {
+        Uint32 lw = w, lh = h, ld = depth;
+
+        SDL_free(reference);
+        reference = (float *)SDL_malloc(texels * 4 * sizeof(float));
+        if (!reference) {
+            goto done;
+        }
+        for (i = 0; i < texels * 4; i += 1) {
+            reference[i] = pixels[texels * layer * 4 + i];
+        }
+
+        for (level = 1; level < levels; level += 1) {
+            float *next = Reduce(reference, lw, lh, ld, is_3d);
+            SDL_free(reference);
+            reference = next;
+            if (!reference) {
+                goto done;
+            }
+            lw = LevelSize(w, level);
+            lh = LevelSize(h, level);
+            ld = is_3d ? LevelSize(depth, level) : 1;
+
+            cmdbuf = SDL_AcquireGPUCommandBuffer(device);
+            if (!cmdbuf) {
+                goto done;
+            }
+            SDL_free(result);
+            result = DownloadAfter(cmdbuf, texture, level, layer, lw, lh, ld);
+            if (!result) {
+                SDL_Log("Couldn't download %s level %u: %s", name, (unsigned int)level, SDL_GetError());
+                goto done;
+            }
+
+            /* Levels past the first dispatch start from a level rounded to 8 bits */
+            for (i = 0; i < lw * lh * ld * 4; i += 1) {
+                if (!Near(result[i], (int)(reference[i] + 0.5f), 2)) {
+                    SDL_Log("%s layer %u level %u texel %u channel %u is %d, expected %d", name,
+                            (unsigned int)layer, (unsigned int)level, (unsigned int)(i / 4), (unsigned int)(i % 4),
+                            result[i], (int)(reference[i] + 0.5f));
+                    goto done;
+                }
+            }
+        }
+    }
+    SDL_Log("Compute mipmaps, %s %ux%ux%u: OK", name, (unsigned int)w, (unsigned int)h, (unsigned int)layers_or_depth);
+    ok = true;
+
+done:
+    SDL_free(result);
+    SDL_free(reference);
+    SDL_free(pixels);
+    SDL_ReleaseGPUTexture(device, texture);
+    return ok;
+}
+
+int main(int argc, char *argv[])
+{
+    SDL_PropertiesID props;
+    int result = 1;
+
+    props = SDL_CreateProperties();
+    SDL_SetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_DEBUGMODE_BOOLEAN, true);
+    device = CreateHeadlessGPUDevice(SDL_GPU_SHADERFORMAT_SPIRV, props);
+    SDL_DestroyProperties(props);
+    if (!device) {
+        return 1;
+    }
+
+    /* 1024x768 leaves 16x12 texels at level 6 for the last workgroup and
+     * needs a second dispatch for the last two levels. 2048 is too big for
+     * the last workgroup, 333x100 has odd sizes on the way down.
+     */
+    if (TestBlit() &&
+        TestMipmaps("2D", SDL_GPU_TEXTURETYPE_2D, 1024, 768, 1) &&
+        TestMipmaps("2D", SDL_GPU_TEXTURETYPE_2D, 2048, 64, 1) &&
+        TestMipmaps("2D array", SDL_GPU_TEXTURETYPE_2D_ARRAY, 333, 100, 3) &&
+        TestMipmaps("3D", SDL_GPU_TEXTURETYPE_3D, 16, 16, 16)) {
+        result = 0;
+    }
+
+    DestroyHeadlessGPUDevice(device);
+    return result;
+}
@@ -0,0 +1,180 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Renders offscreen on a headless GPU device and streams the result back.
+ *
+ * No window or video subsystem is involved, so this runs on CI machines with
+ * only a software Vulkan implementation, e.g.
+ *   VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json ./testgpu_headless
+ *
+ * Every frame clears the target to a different color and downloads it into a
+ * double-buffered readback; the frame that completed earlier is verified while
+ * the GPU works on the next one.
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+
+#include "gpuutils.h"
+
+#define TARGET_SIZE 64
+#define NUM_FRAMES  16
+
+static SDL_FColor FrameColor(int frame)
+{
+    SDL_FColor color;
+    color.r = (float)(frame % 4) / 3.0f;
+    color.g = (float)((frame / 4) % 4) / 3.0f;
+    color.b = (frame & 1) ? 1.0f : 0.0f;
+    color.a = 1.0f;
+    return color;
+}
+
+static bool VerifyFrame(const Uint8 *pixels, int frame)
+{
+    SDL_FColor color = FrameColor(frame);
+    Uint8 expected[4];
+    int i;
+
+    expected[0] = (Uint8)SDL_lroundf(color.r * 255.0f);
+    expected[1] = (Uint8)SDL_lroundf(color.g * 255.0f);
+    expected[2] = (Uint8)SDL_lroundf(color.b * 255.0f);
+    expected[3] = 255;
+
+    for (i = 0; i < TARGET_SIZE * TARGET_SIZE; i += 1) {
+        const Uint8 *pixel = &pixels[i * 4];
+        if (SDL_abs(pixel[0] - expected[0]) > 1 ||
+            SDL_abs(pixel[1] - expected[1]) > 1 ||
+            SDL_abs(pixel[2] - expected[2]) > 1 ||
+            pixel[3] != expected[3]) {
+            SDL_Log("Frame %d, pixel %d: got %d,%d,%d,%d expected %d,%d,%d,%d",
+                    frame, i, pixel[0], pixel[1], pixel[2], pixel[3],
+                    expected[0], expected[1], expected[2], expected[3]);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    SDL_GPUDevice *device;
+    SDL_GPUTextureCreateInfo texture_info;
+    SDL_GPUTexture *target;
+    SDL_GPUTextureReadback *readback;
+    int verified = 0;
+    int result = 1;
+    int frame;
+
+    device = CreateHeadlessGPUDevice(SDL_GPU_SHADERFORMAT_SPIRV | SDL_GPU_SHADERFORMAT_DXIL | SDL_GPU_SHADERFORMAT_MSL, 0);
+    if (!device) {
+        return 1;
+    }
+
+    SDL_zero(texture_info);
+    texture_info.type = SDL_GPU_TEXTURETYPE_2D;
+    texture_info.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+    texture_info.usage = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET;
+    texture_info.width = TARGET_SIZE;
+    texture_info.height = TARGET_SIZE;
+    texture_info.layer_count_or_depth = 1;
+    texture_info.num_levels = 1;
+    target = SDL_CreateGPUTexture(device, &texture_info);
+    if (!target) {
+        SDL_Log("Couldn't create target texture: %s", SDL_GetError());
+        goto done;
+    }
+
+    readback = SDL_CreateGPUTextureReadback(device, TARGET_SIZE * TARGET_SIZE * 4, 2);
+    if (!readback) {
+        SDL_Log("Couldn't create readback: %s", SDL_GetError());
+        goto done;
+    }
+
+    for (frame = 0; frame < NUM_FRAMES; frame += 1) {
+        SDL_GPUCommandBuffer *cmdbuf = SDL_AcquireGPUCommandBuffer(device);
+        SDL_GPUColorTargetInfo color_target;
+        SDL_GPUTextureRegion region;
+        SDL_GPURenderPass *render_pass;
+        SDL_GPUCopyPass *copy_pass;
+        const void *pixels;
+
+        if (!cmdbuf) {
+            SDL_Log("Couldn't acquire command buffer: %s", SDL_GetError());
+            goto release;
+        }
+
+        SDL_zero(color_target);
+        color_target.texture = target;
+        color_target.clear_color = FrameColor(frame);
+        color_target.load_op = SDL_GPU_LOADOP_CLEAR;
+        color_target.store_op = SDL_GPU_STOREOP_STORE;
+        render_pass = SDL_BeginGPURenderPass(cmdbuf, &color_target, 1, NULL);
+        SDL_EndGPURenderPass(render_pass);
+
+        SDL_zero(region);
+        region.texture = target;
+        region.w = TARGET_SIZE;
+        region.h = TARGET_SIZE;
+        region.d = 1;
+        copy_pass = SDL_BeginGPUCopyPass(cmdbuf);
+        if (!SDL_DownloadToGPUTextureReadback(copy_pass, &region, readback)) {
+            SDL_Log("Couldn't download frame %d: %s", frame, SDL_GetError());
+            SDL_EndGPUCopyPass(copy_pass);
+            SDL_CancelGPUCommandBuffer(cmdbuf);
+            goto release;
+        }
+        SDL_EndGPUCopyPass(copy_pass);
+
+        if (!SDL_SubmitGPUCommandBuffer(cmdbuf)) {
+            SDL_Log("Couldn't submit frame %d: %s", frame, SDL_GetError());
+            goto release;
+        }
+
+        // Read the previous frame while this one is in flight
+        if (frame > 0) {
+            pixels = SDL_MapGPUTextureReadback(device, readback, true);
+            if (!pixels) {
+                SDL_Log("Couldn't map frame %d: %s", frame - 1, SDL_GetError());
+                goto release;
+            }
+            if (!VerifyFrame(pixels, frame - 1)) {
+                SDL_UnmapGPUTextureReadback(device, readback);
+                goto release;
+            }
+            SDL_UnmapGPUTextureReadback(device, readback);
+            verified += 1;
+        }
+    }
+
+    {
+        const void *pixels = SDL_MapGPUTextureReadback(device, readback, true);
+        if (pixels && VerifyFrame(pixels, NUM_FRAMES - 1)) {
+            verified += 1;
+        }
+        if (pixels) {
+            SDL_UnmapGPUTextureReadback(device, readback);
+        }
+    }
+
+    SDL_Log("Verified %d of %d frames", verified, NUM_FRAMES);
+    if (verified == NUM_FRAMES) {
+        result = 0;
+    }
+
+release:
+    SDL_ReleaseGPUTextureReadback(device, readback);
+done:
+    SDL_ReleaseGPUTexture(device, target);
+    DestroyHeadlessGPUDevice(device);
+    return result;
+}
@@ -0,0 +1,315 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Draws a grid of quads with SDL_DrawGPUPrimitivesIndirectCount() on a
+ * headless GPU device and checks that only the surviving draws were made.
+ *
+ * In a real renderer a compute pass would cull the instances and write the
+ * compacted draw commands and the draw count. Here the "culling" happens
+ * once on the CPU and both are uploaded, but the render pass never learns
+ * the count on the CPU side: the draw buffer is filled to max_draw_count
+ * with commands for the culled quads too, so drawing more than the count
+ * in the buffer shows up as a failure.
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+
+#include "gpuutils.h"
+
+#define TARGET_SIZE    64
+#define GRID_SIZE      4
+#define NUM_QUADS      (GRID_SIZE * GRID_SIZE)
+#define CELL_SIZE      (TARGET_SIZE / GRID_SIZE)
+#define QUAD_VERTICES  6
+
+typedef struct VertexData
+{
+    float x, y, z; /* 3D data. Vertex range -0.5..0.5 in all axes. Z -0.5 is near, 0.5 is far. */
+    float red, green, blue;  /* intensity 0 to 1 (alpha is always 1). */
+} VertexData;
+
+static bool IsCulled(int quad)
+{
+    return (quad % 3) == 0;
+}
+
+/* Fills the vertices for one quad, inset into its grid cell */
+static void MakeQuad(VertexData *vertices, int quad)
+{
+    static const float corners[QUAD_VERTICES][2] = {
+        { 0.25f, 0.25f }, { 0.75f, 0.25f }, { 0.25f, 0.75f },
+        { 0.75f, 0.25f }, { 0.75f, 0.75f }, { 0.25f, 0.75f }
+    };
+    const float cell = 2.0f / GRID_SIZE;
+    int i;
+
+    for (i = 0; i < QUAD_VERTICES; i += 1) {
+        vertices[i].x = -1.0f + ((quad % GRID_SIZE) + corners[i][0]) * cell;
+        vertices[i].y = 1.0f - ((quad / GRID_SIZE) + corners[i][1]) * cell;
+        vertices[i].z = 0.0f;
+        vertices[i].red = 1.0f;
+        vertices[i].green = 1.0f;
+        vertices[i].blue = 1.0f;
+    }
+}
+
+static bool VerifyGrid(const Uint8 *pixels)
+{
+    int quad;
+
+    for (quad = 0; quad < NUM_QUADS; quad += 1) {
+        int x = (quad % GRID_SIZE) * CELL_SIZE + CELL_SIZE / 2;
+        int y = (quad / GRID_SIZE) * CELL_SIZE + CELL_SIZE / 2;
+        Uint8 expected = IsCulled(quad) ? 0 : 255;
+        const Uint8 *pixel = &pixels[(y * TARGET_SIZE + x) * 4];
+
+        if (pixel[0] != expected || pixel[1] != expected || pixel[2] != expected) {
+            SDL_Log("Quad %d should be %s, got %d,%d,%d", quad,
+                    IsCulled(quad) ? "culled" : "drawn", pixel[0], pixel[1], pixel[2]);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    SDL_GPUDevice *device;
+    SDL_GPUShader *vertex_shader = NULL;
+    SDL_GPUShader *fragment_shader = NULL;
+    SDL_GPUGraphicsPipeline *pipeline = NULL;
+    SDL_GPUTexture *target = NULL;
+    SDL_GPUBuffer *vertex_buffer = NULL;
+    SDL_GPUBuffer *draw_buffer = NULL;
+    SDL_GPUBuffer *count_buffer = NULL;
+    SDL_GPUTransferBuffer *transfer_buffer = NULL;
+    SDL_GPUTextureReadback *readback = NULL;
+    SDL_GPUGraphicsPipelineCreateInfo pipeline_info;
+    SDL_GPUColorTargetDescription color_target_desc;
+    SDL_GPUVertexBufferDescription vertex_buffer_desc;
+    SDL_GPUVertexAttribute vertex_attributes[2];
+    SDL_GPUTextureCreateInfo texture_info;
+    SDL_GPUBufferCreateInfo buffer_info;
+    SDL_GPUTransferBufferCreateInfo transfer_info;
+    SDL_GPUCommandBuffer *cmdbuf;
+    SDL_GPUCopyPass *copy_pass;
+    SDL_GPURenderPass *render_pass;
+    SDL_GPUColorTargetInfo color_target;
+    SDL_GPUBufferBinding vertex_binding;
+    SDL_GPUTransferBufferLocation source;
+    SDL_GPUBufferRegion destination;
+    SDL_GPUTextureRegion region;
+    SDL_GPUIndirectDrawCommand *commands;
+    VertexData *vertices;
+    Uint32 *draw_count;
+    Uint8 *map;
+    const void *pixels;
+    const Uint32 vertices_size = sizeof(VertexData) * QUAD_VERTICES * NUM_QUADS;
+    const Uint32 commands_size = sizeof(SDL_GPUIndirectDrawCommand) * NUM_QUADS;
+    const float identity[16] = {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+    int result = 1;
+    int quad;
+    Uint32 survivors = 0;
+    Uint32 culled = 0;
+
+    device = CreateHeadlessGPUDevice(SDL_GPU_SHADERFORMAT_SPIRV | SDL_GPU_SHADERFORMAT_DXIL, 0);
+    if (!device) {
+        return 1;
+    }
+
+    if (!SDL_GetBooleanProperty(SDL_GetGPUDeviceProperties(device), SDL_PROP_GPU_DEVICE_INDIRECT_DRAW_COUNT_BOOLEAN, false)) {
+        SDL_Log("The %s driver can't read draw counts from a buffer, skipping", SDL_GetGPUDeviceDriver(device));
+        result = 0;
+        goto done;
+    }
+
+    vertex_shader = LoadCubeShader(device, true);
+    fragment_shader = LoadCubeShader(device, false);
+    if (!vertex_shader || !fragment_shader) {
+        SDL_Log("Couldn't create shaders: %s", SDL_GetError());
+        goto done;
+    }
+
+    SDL_zero(color_target_desc);
+    color_target_desc.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+
+    SDL_zero(vertex_buffer_desc);
+    vertex_buffer_desc.slot = 0;
+    vertex_buffer_desc.input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX;
+    vertex_buffer_desc.pitch = sizeof(VertexData);
+
+    SDL_zeroa(vertex_attributes);
+    vertex_attributes[0].format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3;
+    vertex_attributes[0].location = 0;
+    vertex_attributes[0].offset = 0;
+    vertex_attributes[1].format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3;
+    vertex_attributes[1].location = 1;
+    vertex_attributes[1].offset = sizeof(float) * 3;
+
+    SDL_zero(pipeline_info);
+    pipeline_info.target_info.num_color_targets = 1;
+    pipeline_info.target_info.color_target_descriptions = &color_target_desc;
+    pipeline_info.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+    pipeline_info.vertex_shader = vertex_shader;
+    pipeline_info.fragment_shader = fragment_shader;
+    pipeline_info.vertex_input_state.num_vertex_buffers = 1;
+    pipeline_info.vertex_input_state.vertex_buffer_descriptions = &vertex_buffer_desc;
+    pipeline_info.vertex_input_state.num_vertex_attributes = 2;
+    pipeline_info.vertex_input_state.vertex_attributes = vertex_attributes;
+    pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipeline_info);
+    if (!pipeline) {
+        SDL_Log("Couldn't create pipeline: %s", SDL_GetError());
+        goto done;
+    }
+
+    SDL_zero(texture_info);
+    texture_info.type = SDL_GPU_TEXTURETYPE_2D;
+    texture_info.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+    texture_info.usage = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET;
+    texture_info.width = TARGET_SIZE;
+    texture_info.height = TARGET_SIZE;
+    texture_info.layer_count_or_depth = 1;
+    texture_info.num_levels = 1;
+    target = SDL_CreateGPUTexture(device, &texture_info);
+
+    SDL_zero(buffer_info);
+    buffer_info.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
+    buffer_info.size = vertices_size;
+    vertex_buffer = SDL_CreateGPUBuffer(device, &buffer_info);
+
+    /* A culling shader would also need SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE */
+    buffer_info.usage = SDL_GPU_BUFFERUSAGE_INDIRECT;
+    buffer_info.size = commands_size;
+    draw_buffer = SDL_CreateGPUBuffer(device, &buffer_info);
+    buffer_info.size = sizeof(Uint32);
+    count_buffer = SDL_CreateGPUBuffer(device, &buffer_info);
+
+    SDL_zero(transfer_info);
+    transfer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    transfer_info.size = vertices_size + commands_size + sizeof(Uint32);
+    transfer_buffer = SDL_CreateGPUTransferBuffer(device, &transfer_info);
+
+    readback = SDL_CreateGPUTextureReadback(device, TARGET_SIZE * TARGET_SIZE * 4, 1);
+
+    if (!target || !vertex_buffer || !draw_buffer || !count_buffer || !transfer_buffer || !readback) {
+        SDL_Log("Couldn't create resources: %s", SDL_GetError());
+        goto done;
+    }
+
+    map = (Uint8 *)SDL_MapGPUTransferBuffer(device, transfer_buffer, false);
+    if (!map) {
+        SDL_Log("Couldn't map transfer buffer: %s", SDL_GetError());
+        goto done;
+    }
+    vertices = (VertexData *)map;
+    commands = (SDL_GPUIndirectDrawCommand *)(map + vertices_size);
+    draw_count = (Uint32 *)(map + vertices_size + commands_size);
+
+    /* Survivors are compacted to the front, culled quads fill up the rest */
+    for (quad = 0; quad < NUM_QUADS; quad += 1) {
+        Uint32 slot = IsCulled(quad) ? (NUM_QUADS - 1 - culled++) : survivors++;
+
+        MakeQuad(&vertices[quad * QUAD_VERTICES], quad);
+        commands[slot].num_vertices = QUAD_VERTICES;
+        commands[slot].num_instances = 1;
+        commands[slot].first_vertex = quad * QUAD_VERTICES;
+        commands[slot].first_instance = 0;
+    }
+    *draw_count = survivors;
+    SDL_UnmapGPUTransferBuffer(device, transfer_buffer);
+
+    cmdbuf = SDL_AcquireGPUCommandBuffer(device);
+    if (!cmdbuf) {
+        SDL_Log("Couldn't acquire command buffer: %s", SDL_GetError());
+        goto done;
+    }
+
+    copy_pass = SDL_BeginGPUCopyPass(cmdbuf);
+    source.transfer_buffer = transfer_buffer;
+    source.offset = 0;
+    destination.buffer = vertex_buffer;
+    destination.offset = 0;
+    destination.size = vertices_size;
+    SDL_UploadToGPUBuffer(copy_pass, &source, &destination, false);
+    source.offset = vertices_size;
+    destination.buffer = draw_buffer;
+    destination.size = commands_size;
+    SDL_UploadToGPUBuffer(copy_pass, &source, &destination, false);
+    source.offset = vertices_size + commands_size;
+    destination.buffer = count_buffer;
+    destination.size = sizeof(Uint32);
+    SDL_UploadToGPUBuffer(copy_pass, &source, &destination, false);
+    SDL_EndGPUCopyPass(copy_pass);
+
+    SDL_zero(color_target);
+    color_target.texture = target;
+    color_target.clear_color.a = 1.0f;
+    color_target.load_op = SDL_GPU_LOADOP_CLEAR;
+    color_target.store_op = SDL_GPU_STOREOP_STORE;
+    render_pass = SDL_BeginGPURenderPass(cmdbuf, &color_target, 1, NULL);
+    SDL_BindGPUGraphicsPipeline(render_pass, pipeline);
+    vertex_binding.buffer = vertex_buffer;
+    vertex_binding.offset = 0;
+    SDL_BindGPUVertexBuffers(render_pass, 0, &vertex_binding, 1);
+    SDL_PushGPUVertexUniformData(cmdbuf, 0, identity, sizeof(identity));
+    SDL_DrawGPUPrimitivesIndirectCount(render_pass, draw_buffer, 0, count_buffer, 0, NUM_QUADS);
+    SDL_EndGPURenderPass(render_pass);
+
+    SDL_zero(region);
+    region.texture = target;
+    region.w = TARGET_SIZE;
+    region.h = TARGET_SIZE;
+    region.d = 1;
+    copy_pass = SDL_BeginGPUCopyPass(cmdbuf);
+    if (!SDL_DownloadToGPUTextureReadback(copy_pass, &region, readback)) {
+        SDL_Log("Couldn't download target: %s", SDL_GetError());
+        SDL_EndGPUCopyPass(copy_pass);
+        SDL_CancelGPUCommandBuffer(cmdbuf);
+        goto done;
+    }
+    SDL_EndGPUCopyPass(copy_pass);
+
+    if (!SDL_SubmitGPUCommandBuffer(cmdbuf)) {
+        SDL_Log("Couldn't submit: %s", SDL_GetError());
+        goto done;
+    }
+
+    pixels = SDL_MapGPUTextureReadback(device, readback, true);
+    if (!pixels) {
+        SDL_Log("Couldn't map readback: %s", SDL_GetError());
+        goto done;
+    }
+    if (VerifyGrid(pixels)) {
+        SDL_Log("Drew %" SDL_PRIu32 " of %d quads from a GPU draw count", survivors, NUM_QUADS);
+        result = 0;
+    }
+    SDL_UnmapGPUTextureReadback(device, readback);
+
+done:
+    SDL_ReleaseGPUTextureReadback(device, readback);
+    SDL_ReleaseGPUTransferBuffer(device, transfer_buffer);
+    SDL_ReleaseGPUBuffer(device, count_buffer);
+    SDL_ReleaseGPUBuffer(device, draw_buffer);
+    SDL_ReleaseGPUBuffer(device, vertex_buffer);
+    SDL_ReleaseGPUTexture(device, target);
+    SDL_ReleaseGPUGraphicsPipeline(device, pipeline);
+    SDL_ReleaseGPUShader(device, fragment_shader);
+    SDL_ReleaseGPUShader(device, vertex_shader);
+    DestroyHeadlessGPUDevice(device);
+    return result;
+}
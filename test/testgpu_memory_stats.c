@@ -0,0 +1,295 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Fragments GPU memory on a headless device and checks that
+ * SDL_GetGPUMemoryStats() follows along, and that defragmentation with a
+ * small per-submission budget is spread over several submissions without
+ * losing buffer contents.
+ *
+ * Runs without a window, so a software Vulkan implementation is enough, e.g.
+ *   VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json ./testgpu_memory_stats
+ *
+ * Devices that don't report memory statistics are reported and skipped.
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+
+#include "gpuutils.h"
+
+#define NUM_BUFFERS     32
+#define BUFFER_SIZE     (256 * 1024)
+#define BUFFER_VALUES   (BUFFER_SIZE / sizeof(Uint32))
+#define TRIGGER_SIZE    (20 * 1024 * 1024) /* Bigger than any small allocation block */
+#define MAX_SUBMITS     (NUM_BUFFERS * 2)
+
+typedef struct MemoryTotals
+{
+    Uint32 block_count;
+    Uint32 free_region_count;
+    Uint32 defrag_pending_count;
+    Uint64 used_bytes;
+} MemoryTotals;
+
+static bool GetMemoryTotals(SDL_GPUDevice *device, MemoryTotals *totals)
+{
+    SDL_GPUMemoryStats *stats;
+    int count = 0;
+    int i;
+
+    stats = SDL_GetGPUMemoryStats(device, &count);
+    if (!stats) {
+        return false;
+    }
+
+    SDL_zerop(totals);
+    for (i = 0; i < count; i += 1) {
+        totals->block_count += stats[i].block_count;
+        totals->free_region_count += stats[i].free_region_count;
+        totals->defrag_pending_count += stats[i].defrag_pending_count;
+        totals->used_bytes += stats[i].used_bytes;
+    }
+    SDL_free(stats);
+
+    SDL_Log("%u blocks, %u free regions, %u waiting for defrag, %" SDL_PRIu64 " bytes used",
+            totals->block_count, totals->free_region_count, totals->defrag_pending_count, totals->used_bytes);
+    return true;
+}
+
+static bool SubmitAndWait(SDL_GPUDevice *device, SDL_GPUCommandBuffer *cmdbuf)
+{
+    if (!cmdbuf) {
+        cmdbuf = SDL_AcquireGPUCommandBuffer(device);
+        if (!cmdbuf) {
+            SDL_Log("Couldn't acquire command buffer: %s", SDL_GetError());
+            return false;
+        }
+    }
+    if (!SDL_SubmitGPUCommandBuffer(cmdbuf)) {
+        SDL_Log("Couldn't submit: %s", SDL_GetError());
+        return false;
+    }
+    if (!SDL_WaitForGPUIdle(device)) {
+        SDL_Log("Couldn't wait for the GPU: %s", SDL_GetError());
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    SDL_PropertiesID props;
+    SDL_GPUDevice *device;
+    SDL_GPUBufferCreateInfo buffer_info;
+    SDL_GPUTransferBufferCreateInfo transfer_info;
+    SDL_GPUBuffer *buffers[NUM_BUFFERS];
+    SDL_GPUBuffer *trigger = NULL;
+    SDL_GPUTransferBuffer *upload = NULL;
+    SDL_GPUTransferBuffer *download = NULL;
+    SDL_GPUCommandBuffer *cmdbuf;
+    SDL_GPUCopyPass *copy_pass;
+    SDL_GPUTransferBufferLocation location;
+    SDL_GPUBufferRegion region;
+    MemoryTotals before, filled, fragmented, marked, current;
+    Uint32 *values;
+    int submits = 0;
+    int result = 1;
+    int i, j;
+
+    SDL_zeroa(buffers);
+
+    /* Let every submission move a single buffer */
+    props = SDL_CreateProperties();
+    SDL_SetNumberProperty(props, SDL_PROP_GPU_DEVICE_CREATE_VULKAN_DEFRAG_BUDGET_BYTES_NUMBER, BUFFER_SIZE);
+    SDL_SetNumberProperty(props, SDL_PROP_GPU_DEVICE_CREATE_VULKAN_DEFRAG_BUDGET_NS_NUMBER, 0);
+    device = CreateHeadlessGPUDevice(SDL_GPU_SHADERFORMAT_SPIRV | SDL_GPU_SHADERFORMAT_DXIL | SDL_GPU_SHADERFORMAT_MSL, props);
+    SDL_DestroyProperties(props);
+    if (!device) {
+        return 1;
+    }
+
+    if (!GetMemoryTotals(device, &before)) {
+        SDL_Log("Memory statistics aren't supported, skipping: %s", SDL_GetError());
+        result = 0;
+        goto done;
+    }
+
+    /* Fill every buffer with its own index */
+    SDL_zero(transfer_info);
+    transfer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    transfer_info.size = NUM_BUFFERS * BUFFER_SIZE;
+    upload = SDL_CreateGPUTransferBuffer(device, &transfer_info);
+    transfer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_DOWNLOAD;
+    download = SDL_CreateGPUTransferBuffer(device, &transfer_info);
+    if (!upload || !download) {
+        SDL_Log("Couldn't create transfer buffers: %s", SDL_GetError());
+        goto done;
+    }
+
+    SDL_zero(buffer_info);
+    buffer_info.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
+    buffer_info.size = BUFFER_SIZE;
+    for (i = 0; i < NUM_BUFFERS; i += 1) {
+        buffers[i] = SDL_CreateGPUBuffer(device, &buffer_info);
+        if (!buffers[i]) {
+            SDL_Log("Couldn't create buffer %d: %s", i, SDL_GetError());
+            goto done;
+        }
+    }
+
+    values = (Uint32 *)SDL_MapGPUTransferBuffer(device, upload, false);
+    if (!values) {
+        SDL_Log("Couldn't map the upload buffer: %s", SDL_GetError());
+        goto done;
+    }
+    for (i = 0; i < NUM_BUFFERS; i += 1) {
+        for (j = 0; j < (int)BUFFER_VALUES; j += 1) {
+            values[i * BUFFER_VALUES + j] = (Uint32)i;
+        }
+    }
+    SDL_UnmapGPUTransferBuffer(device, upload);
+
+    cmdbuf = SDL_AcquireGPUCommandBuffer(device);
+    if (!cmdbuf) {
+        SDL_Log("Couldn't acquire command buffer: %s", SDL_GetError());
+        goto done;
+    }
+    copy_pass = SDL_BeginGPUCopyPass(cmdbuf);
+    for (i = 0; i < NUM_BUFFERS; i += 1) {
+        location.transfer_buffer = upload;
+        location.offset = i * BUFFER_SIZE;
+        region.buffer = buffers[i];
+        region.offset = 0;
+        region.size = BUFFER_SIZE;
+        SDL_UploadToGPUBuffer(copy_pass, &location, &region, false);
+    }
+    SDL_EndGPUCopyPass(copy_pass);
+    if (!SubmitAndWait(device, cmdbuf)) {
+        goto done;
+    }
+
+    if (!GetMemoryTotals(device, &filled)) {
+        goto done;
+    }
+    if (filled.used_bytes < before.used_bytes + NUM_BUFFERS * BUFFER_SIZE) {
+        SDL_Log("Creating %d bytes of buffers should show up in the used bytes", NUM_BUFFERS * BUFFER_SIZE);
+        goto done;
+    }
+
+    /* Punch holes into the block the buffers share */
+    for (i = 0; i < NUM_BUFFERS; i += 2) {
+        SDL_ReleaseGPUBuffer(device, buffers[i]);
+        buffers[i] = NULL;
+    }
+    if (!SubmitAndWait(device, NULL)) {
+        goto done;
+    }
+
+    if (!GetMemoryTotals(device, &fragmented)) {
+        goto done;
+    }
+    if (fragmented.used_bytes + (NUM_BUFFERS / 2) * BUFFER_SIZE > filled.used_bytes) {
+        SDL_Log("Releasing buffers should reduce the used bytes");
+        goto done;
+    }
+    if (fragmented.free_region_count < filled.free_region_count + NUM_BUFFERS / 2 - 1) {
+        SDL_Log("Releasing every other buffer should leave a free region for each of them");
+        goto done;
+    }
+
+    /* Nothing that big fits into the holes, so the fragmented block gets marked */
+    buffer_info.size = TRIGGER_SIZE;
+    trigger = SDL_CreateGPUBuffer(device, &buffer_info);
+    if (!trigger) {
+        SDL_Log("Couldn't create the large buffer: %s", SDL_GetError());
+        goto done;
+    }
+    if (!GetMemoryTotals(device, &marked)) {
+        goto done;
+    }
+    if (marked.defrag_pending_count == 0) {
+        SDL_Log("The fragmented block should be waiting for defragmentation");
+        goto done;
+    }
+
+    /* One buffer moves per submission */
+    current = marked;
+    while (current.defrag_pending_count > 0) {
+        if (submits == MAX_SUBMITS) {
+            SDL_Log("Defragmentation didn't finish after %d submissions", submits);
+            goto done;
+        }
+        if (!SubmitAndWait(device, NULL) || !GetMemoryTotals(device, &current)) {
+            goto done;
+        }
+        submits += 1;
+    }
+    SDL_Log("Defragmentation finished after %d submissions", submits);
+    if (submits < NUM_BUFFERS / 2) {
+        SDL_Log("Defragmentation should have taken a submission for each of the %d buffers left", NUM_BUFFERS / 2);
+        goto done;
+    }
+
+    /* The moved buffers have to keep their contents */
+    cmdbuf = SDL_AcquireGPUCommandBuffer(device);
+    if (!cmdbuf) {
+        SDL_Log("Couldn't acquire command buffer: %s", SDL_GetError());
+        goto done;
+    }
+    copy_pass = SDL_BeginGPUCopyPass(cmdbuf);
+    for (i = 1; i < NUM_BUFFERS; i += 2) {
+        region.buffer = buffers[i];
+        region.offset = 0;
+        region.size = BUFFER_SIZE;
+        location.transfer_buffer = download;
+        location.offset = i * BUFFER_SIZE;
+        SDL_DownloadFromGPUBuffer(copy_pass, &region, &location);
+    }
+    SDL_EndGPUCopyPass(copy_pass);
+    if (!SubmitAndWait(device, cmdbuf)) {
+        goto done;
+    }
+
+    values = (Uint32 *)SDL_MapGPUTransferBuffer(device, download, false);
+    if (!values) {
+        SDL_Log("Couldn't map the download buffer: %s", SDL_GetError());
+        goto done;
+    }
+    for (i = 1; i < NUM_BUFFERS; i += 2) {
+        for (j = 0; j < (int)BUFFER_VALUES; j += 1) {
+            if (values[i * BUFFER_VALUES + j] != (Uint32)i) {
+                SDL_Log("Buffer %d has %u at value %d after defragmentation", i, values[i * BUFFER_VALUES + j], j);
+                break;
+            }
+        }
+        if (j < (int)BUFFER_VALUES) {
+            break;
+        }
+    }
+    SDL_UnmapGPUTransferBuffer(device, download);
+    if (i < NUM_BUFFERS) {
+        goto done;
+    }
+
+    SDL_Log("Memory statistics and defragmentation: OK");
+    result = 0;
+
+done:
+    SDL_ReleaseGPUBuffer(device, trigger);
+    for (i = 0; i < NUM_BUFFERS; i += 1) {
+        SDL_ReleaseGPUBuffer(device, buffers[i]);
+    }
+    SDL_ReleaseGPUTransferBuffer(device, download);
+    SDL_ReleaseGPUTransferBuffer(device, upload);
+    DestroyHeadlessGPUDevice(device);
+    return result;
+}
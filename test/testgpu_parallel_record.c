@@ -0,0 +1,357 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Stress test for recording GPU command buffers from many threads at once.
+ *
+ * Every thread acquires its own command buffer, records a render pass with
+ * a large number of small draws into an offscreen target, and submits it.
+ * The time spent recording is reported so that contention in the backend's
+ * command buffer, uniform buffer and descriptor pools shows up directly.
+ */
+
+#include <stdlib.h>
+
+#include <SDL3/SDL_test_common.h>
+#include <SDL3/SDL_gpu.h>
+#include <SDL3/SDL_main.h>
+
+#include "gpuutils.h"
+
+#define TESTGPU_SUPPORTED_FORMATS (SDL_GPU_SHADERFORMAT_SPIRV | SDL_GPU_SHADERFORMAT_DXBC | SDL_GPU_SHADERFORMAT_DXIL | SDL_GPU_SHADERFORMAT_METALLIB)
+
+#define CHECK_CREATE(var, thing) { if (!(var)) { SDL_Log("Failed to create %s: %s", thing, SDL_GetError()); quit(2); } }
+
+#define TARGET_SIZE 256
+
+typedef struct VertexData
+{
+    float x, y, z;
+    float red, green, blue;
+} VertexData;
+
+static const VertexData vertex_data[] = {
+    { -0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0.0f },
+    {  0.5f, -0.5f, 0.0f, 0.0f, 1.0f, 0.0f },
+    {  0.0f,  0.5f, 0.0f, 0.0f, 0.0f, 1.0f },
+};
+
+typedef struct ThreadState
+{
+    int index;
+    SDL_Thread *thread;
+    SDL_GPUTexture *target;
+    Uint64 record_ns;
+    bool failed;
+} ThreadState;
+
+static SDLTest_CommonState *state = NULL;
+static SDL_GPUDevice *gpu_device = NULL;
+static SDL_GPUBuffer *buf_vertex = NULL;
+static SDL_GPUGraphicsPipeline *pipeline = NULL;
+static ThreadState *threads = NULL;
+static int num_threads = 8;
+static int num_draws = 10000;
+static int num_frames = 10;
+
+static void shutdownGPU(void)
+{
+    if (threads) {
+        int i;
+        for (i = 0; i < num_threads; i++) {
+            SDL_ReleaseGPUTexture(gpu_device, threads[i].target);
+        }
+        SDL_free(threads);
+        threads = NULL;
+    }
+
+    SDL_ReleaseGPUBuffer(gpu_device, buf_vertex);
+    SDL_ReleaseGPUGraphicsPipeline(gpu_device, pipeline);
+    SDL_DestroyGPUDevice(gpu_device);
+}
+
+/* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
+static void
+quit(int rc)
+{
+    shutdownGPU();
+    SDLTest_CommonQuit(state);
+    exit(rc);
+}
+
+static void
+init_render_state(void)
+{
+    SDL_GPUCommandBuffer *cmd;
+    SDL_GPUTransferBuffer *buf_transfer;
+    void *map;
+    SDL_GPUTransferBufferLocation buf_location;
+    SDL_GPUBufferRegion dst_region;
+    SDL_GPUCopyPass *copy_pass;
+    SDL_GPUBufferCreateInfo buffer_desc;
+    SDL_GPUTransferBufferCreateInfo transfer_buffer_desc;
+    SDL_GPUTextureCreateInfo texture_desc;
+    SDL_GPUGraphicsPipelineCreateInfo pipelinedesc;
+    SDL_GPUColorTargetDescription color_target_desc;
+    SDL_GPUVertexAttribute vertex_attributes[2];
+    SDL_GPUVertexBufferDescription vertex_buffer_desc;
+    SDL_GPUShader *vertex_shader;
+    SDL_GPUShader *fragment_shader;
+    int i;
+
+    gpu_device = SDL_CreateGPUDevice(
+        TESTGPU_SUPPORTED_FORMATS,
+        true,
+        state->gpudriver
+    );
+    CHECK_CREATE(gpu_device, "GPU device");
+
+    vertex_shader = LoadCubeShader(gpu_device, true);
+    CHECK_CREATE(vertex_shader, "Vertex Shader")
+    fragment_shader = LoadCubeShader(gpu_device, false);
+    CHECK_CREATE(fragment_shader, "Fragment Shader")
+
+    /* Create and upload the vertex buffer */
+
+    SDL_zero(buffer_desc);
+    buffer_desc.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
+    buffer_desc.size = sizeof(vertex_data);
+    buf_vertex = SDL_CreateGPUBuffer(gpu_device, &buffer_desc);
+    CHECK_CREATE(buf_vertex, "Static vertex buffer")
+
+    SDL_zero(transfer_buffer_desc);
+    transfer_buffer_desc.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    transfer_buffer_desc.size = sizeof(vertex_data);
+    buf_transfer = SDL_CreateGPUTransferBuffer(gpu_device, &transfer_buffer_desc);
+    CHECK_CREATE(buf_transfer, "Vertex transfer buffer")
+
+    map = SDL_MapGPUTransferBuffer(gpu_device, buf_transfer, false);
+    SDL_memcpy(map, vertex_data, sizeof(vertex_data));
+    SDL_UnmapGPUTransferBuffer(gpu_device, buf_transfer);
+
+    cmd = SDL_AcquireGPUCommandBuffer(gpu_device);
+    copy_pass = SDL_BeginGPUCopyPass(cmd);
+    buf_location.transfer_buffer = buf_transfer;
+    buf_location.offset = 0;
+    dst_region.buffer = buf_vertex;
+    dst_region.offset = 0;
+    dst_region.size = sizeof(vertex_data);
+    SDL_UploadToGPUBuffer(copy_pass, &buf_location, &dst_region, false);
+    SDL_EndGPUCopyPass(copy_pass);
+    SDL_SubmitGPUCommandBuffer(cmd);
+
+    SDL_ReleaseGPUTransferBuffer(gpu_device, buf_transfer);
+
+    /* Set up the graphics pipeline */
+
+    SDL_zero(pipelinedesc);
+    SDL_zero(color_target_desc);
+
+    color_target_desc.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+
+    pipelinedesc.target_info.num_color_targets = 1;
+    pipelinedesc.target_info.color_target_descriptions = &color_target_desc;
+    pipelinedesc.multisample_state.sample_count = SDL_GPU_SAMPLECOUNT_1;
+    pipelinedesc.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+    pipelinedesc.vertex_shader = vertex_shader;
+    pipelinedesc.fragment_shader = fragment_shader;
+
+    vertex_buffer_desc.slot = 0;
+    vertex_buffer_desc.input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX;
+    vertex_buffer_desc.instance_step_rate = 0;
+    vertex_buffer_desc.pitch = sizeof(VertexData);
+
+    vertex_attributes[0].buffer_slot = 0;
+    vertex_attributes[0].format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3;
+    vertex_attributes[0].location = 0;
+    vertex_attributes[0].offset = 0;
+
+    vertex_attributes[1].buffer_slot = 0;
+    vertex_attributes[1].format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3;
+    vertex_attributes[1].location = 1;
+    vertex_attributes[1].offset = sizeof(float) * 3;
+
+    pipelinedesc.vertex_input_state.num_vertex_buffers = 1;
+    pipelinedesc.vertex_input_state.vertex_buffer_descriptions = &vertex_buffer_desc;
+    pipelinedesc.vertex_input_state.num_vertex_attributes = 2;
+    pipelinedesc.vertex_input_state.vertex_attributes = vertex_attributes;
+
+    pipeline = SDL_CreateGPUGraphicsPipeline(gpu_device, &pipelinedesc);
+    CHECK_CREATE(pipeline, "Render Pipeline")
+
+    SDL_ReleaseGPUShader(gpu_device, vertex_shader);
+    SDL_ReleaseGPUShader(gpu_device, fragment_shader);
+
+    /* Every thread renders into its own target so passes never share a texture */
+
+    threads = (ThreadState *) SDL_calloc(num_threads, sizeof (ThreadState));
+    if (!threads) {
+        SDL_Log("Out of memory!");
+        quit(2);
+    }
+
+    SDL_zero(texture_desc);
+    texture_desc.type = SDL_GPU_TEXTURETYPE_2D;
+    texture_desc.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+    texture_desc.usage = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET;
+    texture_desc.width = TARGET_SIZE;
+    texture_desc.height = TARGET_SIZE;
+    texture_desc.layer_count_or_depth = 1;
+    texture_desc.num_levels = 1;
+    texture_desc.sample_count = SDL_GPU_SAMPLECOUNT_1;
+
+    for (i = 0; i < num_threads; i++) {
+        threads[i].index = i;
+        threads[i].target = SDL_CreateGPUTexture(gpu_device, &texture_desc);
+        CHECK_CREATE(threads[i].target, "Render target")
+    }
+}
+
+static int SDLCALL
+RecordThread(void *data)
+{
+    ThreadState *thread = (ThreadState *)data;
+    SDL_GPUCommandBuffer *cmd;
+    SDL_GPURenderPass *pass;
+    SDL_GPUColorTargetInfo color_target;
+    SDL_GPUBufferBinding vertex_binding;
+    float matrix[16];
+    Uint64 start;
+    int i;
+
+    start = SDL_GetTicksNS();
+
+    cmd = SDL_AcquireGPUCommandBuffer(gpu_device);
+    if (!cmd) {
+        SDL_Log("Thread %d failed to acquire a command buffer: %s", thread->index, SDL_GetError());
+        thread->failed = true;
+        return 1;
+    }
+
+    SDL_zero(color_target);
+    color_target.texture = thread->target;
+    color_target.load_op = SDL_GPU_LOADOP_CLEAR;
+    color_target.store_op = SDL_GPU_STOREOP_STORE;
+
+    pass = SDL_BeginGPURenderPass(cmd, &color_target, 1, NULL);
+    SDL_BindGPUGraphicsPipeline(pass, pipeline);
+    vertex_binding.buffer = buf_vertex;
+    vertex_binding.offset = 0;
+    SDL_BindGPUVertexBuffers(pass, 0, &vertex_binding, 1);
+
+    SDL_zeroa(matrix);
+    matrix[0] = matrix[5] = matrix[10] = matrix[15] = 0.05f;
+
+    for (i = 0; i < num_draws; i++) {
+        /* Scatter the triangles so every draw pushes distinct uniform data */
+        matrix[12] = (float)((i * 37) % 200) / 100.0f - 1.0f;
+        matrix[13] = (float)((i * 61 + thread->index * 13) % 200) / 100.0f - 1.0f;
+        SDL_PushGPUVertexUniformData(cmd, 0, matrix, sizeof(matrix));
+        SDL_DrawGPUPrimitives(pass, 3, 1, 0, 0);
+    }
+
+    SDL_EndGPURenderPass(pass);
+
+    thread->record_ns += SDL_GetTicksNS() - start;
+
+    if (!SDL_SubmitGPUCommandBuffer(cmd)) {
+        SDL_Log("Thread %d failed to submit: %s", thread->index, SDL_GetError());
+        thread->failed = true;
+        return 1;
+    }
+
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    Uint64 frame_start, total_ns = 0, record_ns = 0;
+    int i, frame;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            if (argv[i + 1]) {
+                char *endptr;
+                long value = SDL_strtol(argv[i + 1], &endptr, 0);
+                if (*endptr == '\0' && value > 0) {
+                    if (SDL_strcasecmp(argv[i], "--threads") == 0) {
+                        num_threads = (int)value;
+                        consumed = 2;
+                    } else if (SDL_strcasecmp(argv[i], "--draws") == 0) {
+                        num_draws = (int)value;
+                        consumed = 2;
+                    } else if (SDL_strcasecmp(argv[i], "--frames") == 0) {
+                        num_frames = (int)value;
+                        consumed = 2;
+                    }
+                }
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--threads N]", "[--draws N]", "[--frames N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            quit(1);
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(SDL_INIT_VIDEO)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        quit(2);
+    }
+
+    init_render_state();
+
+    SDL_Log("Recording %d draws on each of %d threads for %d frames", num_draws, num_threads, num_frames);
+
+    for (frame = 0; frame < num_frames; frame++) {
+        frame_start = SDL_GetTicksNS();
+
+        for (i = 0; i < num_threads; i++) {
+            threads[i].thread = SDL_CreateThread(RecordThread, "GPURecord", &threads[i]);
+            if (!threads[i].thread) {
+                SDL_Log("Couldn't create thread: %s", SDL_GetError());
+                quit(2);
+            }
+        }
+        for (i = 0; i < num_threads; i++) {
+            SDL_WaitThread(threads[i].thread, NULL);
+            threads[i].thread = NULL;
+            if (threads[i].failed) {
+                quit(2);
+            }
+        }
+
+        SDL_WaitForGPUIdle(gpu_device);
+        total_ns += SDL_GetTicksNS() - frame_start;
+    }
+
+    for (i = 0; i < num_threads; i++) {
+        record_ns += threads[i].record_ns;
+    }
+
+    SDL_Log("Average frame time: %.3f ms", (double)total_ns / num_frames / SDL_NS_PER_MS);
+    SDL_Log("Average per-thread record time: %.3f ms", (double)record_ns / num_threads / num_frames / SDL_NS_PER_MS);
+    SDL_Log("Draws per second: %.0f", (double)num_draws * num_threads * num_frames / ((double)total_ns / SDL_NS_PER_SECOND));
+
+    quit(0);
+    return 0;
+}
@@ -0,0 +1,289 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Compiles pipelines on the device's worker threads and draws with them into
+ * a cycled target that was prepared with SDL_PrepareGPURenderPass().
+ *
+ * One job is waited on, one is abandoned while it may still be compiling and
+ * one is left for SDL_DestroyGPUDevice() to clean up.
+ *
+ * Runs without a window, so a software Vulkan implementation is enough, e.g.
+ *   VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json ./testgpu_pipeline_jobs
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+
+#include "gpuutils.h"
+
+#define TARGET_SIZE 64
+#define NUM_FRAMES  3
+
+typedef struct VertexData
+{
+    float x, y, z;
+    float r, g, b;
+} VertexData;
+
+/* A single triangle covering the whole target */
+static const VertexData vertex_data[3] = {
+    { -1.0f, -1.0f, 0.0f, 0.0f, 1.0f, 0.0f },
+    { 3.0f, -1.0f, 0.0f, 0.0f, 1.0f, 0.0f },
+    { -1.0f, 3.0f, 0.0f, 0.0f, 1.0f, 0.0f }
+};
+
+static const float identity[16] = {
+    1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f
+};
+
+int main(int argc, char *argv[])
+{
+    SDL_GPUDevice *device;
+    SDL_GPUShader *vertex_shader = NULL;
+    SDL_GPUShader *fragment_shader = NULL;
+    SDL_GPUGraphicsPipelineCreateInfo pipeline_info;
+    SDL_GPUColorTargetDescription color_target_desc;
+    SDL_GPUVertexBufferDescription vertex_buffer_desc;
+    SDL_GPUVertexAttribute vertex_attributes[2];
+    SDL_GPUPipelineJob *job;
+    SDL_GPUPipelineJob *abandoned_job;
+    SDL_GPUPipelineJob *uncollected_job = NULL;
+    SDL_GPUGraphicsPipeline *pipeline = NULL;
+    SDL_GPUTextureCreateInfo texture_info;
+    SDL_GPUBufferCreateInfo buffer_info;
+    SDL_GPUTransferBufferCreateInfo transfer_info;
+    SDL_GPUTexture *target = NULL;
+    SDL_GPUBuffer *vertex_buffer = NULL;
+    SDL_GPUTransferBuffer *upload = NULL;
+    SDL_GPUTransferBuffer *download = NULL;
+    SDL_GPUCommandBuffer *cmdbuf;
+    SDL_GPUColorTargetInfo color_target;
+    SDL_GPUTransferBufferLocation source;
+    SDL_GPUBufferRegion buffer_region;
+    SDL_GPUBufferBinding vertex_binding;
+    SDL_GPUTextureRegion texture_region;
+    SDL_GPUTextureTransferInfo destination;
+    SDL_GPURenderPass *render_pass;
+    SDL_GPUCopyPass *copy_pass;
+    SDL_GPUFence *fence = NULL;
+    Uint8 *pixels;
+    void *mapped;
+    int result = 1;
+    int frame;
+
+    device = CreateHeadlessGPUDevice(SDL_GPU_SHADERFORMAT_SPIRV | SDL_GPU_SHADERFORMAT_DXIL | SDL_GPU_SHADERFORMAT_METALLIB, 0);
+    if (!device) {
+        return 1;
+    }
+
+    vertex_shader = LoadCubeShader(device, true);
+    fragment_shader = LoadCubeShader(device, false);
+    if (!vertex_shader || !fragment_shader) {
+        SDL_Log("Couldn't create shaders: %s", SDL_GetError());
+        goto done;
+    }
+
+    SDL_zero(color_target_desc);
+    color_target_desc.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+
+    SDL_zero(vertex_buffer_desc);
+    vertex_buffer_desc.slot = 0;
+    vertex_buffer_desc.input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX;
+    vertex_buffer_desc.pitch = sizeof(VertexData);
+
+    SDL_zero(vertex_attributes);
+    vertex_attributes[0].format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3;
+    vertex_attributes[0].location = 0;
+    vertex_attributes[0].offset = 0;
+    vertex_attributes[1].format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3;
+    vertex_attributes[1].location = 1;
+    vertex_attributes[1].offset = sizeof(float) * 3;
+
+    SDL_zero(pipeline_info);
+    pipeline_info.vertex_shader = vertex_shader;
+    pipeline_info.fragment_shader = fragment_shader;
+    pipeline_info.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+    pipeline_info.target_info.num_color_targets = 1;
+    pipeline_info.target_info.color_target_descriptions = &color_target_desc;
+    pipeline_info.vertex_input_state.num_vertex_buffers = 1;
+    pipeline_info.vertex_input_state.vertex_buffer_descriptions = &vertex_buffer_desc;
+    pipeline_info.vertex_input_state.num_vertex_attributes = SDL_arraysize(vertex_attributes);
+    pipeline_info.vertex_input_state.vertex_attributes = vertex_attributes;
+
+    job = SDL_CreateGPUGraphicsPipelineAsync(device, &pipeline_info);
+    abandoned_job = SDL_CreateGPUGraphicsPipelineAsync(device, &pipeline_info);
+    uncollected_job = SDL_CreateGPUGraphicsPipelineAsync(device, &pipeline_info);
+    if (!job || !abandoned_job || !uncollected_job) {
+        SDL_Log("Couldn't start pipeline jobs: %s", SDL_GetError());
+        SDL_ReleaseGPUPipelineJob(device, job);
+        SDL_ReleaseGPUPipelineJob(device, abandoned_job);
+        SDL_ReleaseGPUPipelineJob(device, uncollected_job);
+        uncollected_job = NULL;
+        goto done;
+    }
+    SDL_ReleaseGPUPipelineJob(device, abandoned_job);
+
+    /* Polling must settle without the app blocking on the job */
+    while (!SDL_QueryGPUPipelineJob(device, job)) {
+        SDL_Delay(1);
+    }
+    pipeline = SDL_WaitForGPUGraphicsPipeline(device, job);
+    if (!pipeline) {
+        SDL_Log("Couldn't create pipeline: %s", SDL_GetError());
+        goto done;
+    }
+
+    SDL_zero(texture_info);
+    texture_info.type = SDL_GPU_TEXTURETYPE_2D;
+    texture_info.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+    texture_info.usage = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET;
+    texture_info.width = TARGET_SIZE;
+    texture_info.height = TARGET_SIZE;
+    texture_info.layer_count_or_depth = 1;
+    texture_info.num_levels = 1;
+    target = SDL_CreateGPUTexture(device, &texture_info);
+
+    SDL_zero(buffer_info);
+    buffer_info.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
+    buffer_info.size = sizeof(vertex_data);
+    vertex_buffer = SDL_CreateGPUBuffer(device, &buffer_info);
+
+    SDL_zero(transfer_info);
+    transfer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    transfer_info.size = sizeof(vertex_data);
+    upload = SDL_CreateGPUTransferBuffer(device, &transfer_info);
+
+    transfer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_DOWNLOAD;
+    transfer_info.size = TARGET_SIZE * TARGET_SIZE * 4;
+    download = SDL_CreateGPUTransferBuffer(device, &transfer_info);
+    if (!target || !vertex_buffer || !upload || !download) {
+        SDL_Log("Couldn't create resources: %s", SDL_GetError());
+        goto done;
+    }
+
+    mapped = SDL_MapGPUTransferBuffer(device, upload, false);
+    if (!mapped) {
+        SDL_Log("Couldn't map upload buffer: %s", SDL_GetError());
+        goto done;
+    }
+    SDL_memcpy(mapped, vertex_data, sizeof(vertex_data));
+    SDL_UnmapGPUTransferBuffer(device, upload);
+
+    SDL_zero(color_target);
+    color_target.texture = target;
+    color_target.clear_color.r = 1.0f;
+    color_target.clear_color.a = 1.0f;
+    color_target.load_op = SDL_GPU_LOADOP_CLEAR;
+    color_target.store_op = SDL_GPU_STOREOP_STORE;
+    color_target.cycle = true;
+
+    /* Frames aren't waited on, so the target is still busy and cycles every time */
+    for (frame = 0; frame < NUM_FRAMES; frame += 1) {
+        if (!SDL_PrepareGPURenderPass(device, &color_target, 1, NULL)) {
+            SDL_Log("Couldn't prepare render pass: %s", SDL_GetError());
+            goto done;
+        }
+
+        cmdbuf = SDL_AcquireGPUCommandBuffer(device);
+        if (!cmdbuf) {
+            SDL_Log("Couldn't acquire command buffer: %s", SDL_GetError());
+            goto done;
+        }
+
+        if (frame == 0) {
+            SDL_zero(source);
+            source.transfer_buffer = upload;
+            SDL_zero(buffer_region);
+            buffer_region.buffer = vertex_buffer;
+            buffer_region.size = sizeof(vertex_data);
+            copy_pass = SDL_BeginGPUCopyPass(cmdbuf);
+            SDL_UploadToGPUBuffer(copy_pass, &source, &buffer_region, false);
+            SDL_EndGPUCopyPass(copy_pass);
+        }
+
+        render_pass = SDL_BeginGPURenderPass(cmdbuf, &color_target, 1, NULL);
+        SDL_BindGPUGraphicsPipeline(render_pass, pipeline);
+        SDL_zero(vertex_binding);
+        vertex_binding.buffer = vertex_buffer;
+        SDL_BindGPUVertexBuffers(render_pass, 0, &vertex_binding, 1);
+        SDL_PushGPUVertexUniformData(cmdbuf, 0, identity, sizeof(identity));
+        SDL_DrawGPUPrimitives(render_pass, 3, 1, 0, 0);
+        SDL_EndGPURenderPass(render_pass);
+
+        if (frame < NUM_FRAMES - 1) {
+            if (!SDL_SubmitGPUCommandBuffer(cmdbuf)) {
+                SDL_Log("Couldn't submit: %s", SDL_GetError());
+                goto done;
+            }
+            continue;
+        }
+
+        SDL_zero(texture_region);
+        texture_region.texture = target;
+        texture_region.w = TARGET_SIZE;
+        texture_region.h = TARGET_SIZE;
+        texture_region.d = 1;
+        SDL_zero(destination);
+        destination.transfer_buffer = download;
+        copy_pass = SDL_BeginGPUCopyPass(cmdbuf);
+        SDL_DownloadFromGPUTexture(copy_pass, &texture_region, &destination);
+        SDL_EndGPUCopyPass(copy_pass);
+
+        fence = SDL_SubmitGPUCommandBufferAndAcquireFence(cmdbuf);
+        if (!fence) {
+            SDL_Log("Couldn't submit: %s", SDL_GetError());
+            goto done;
+        }
+    }
+
+    if (!SDL_WaitForGPUFences(device, true, &fence, 1)) {
+        SDL_Log("Couldn't wait for the fence: %s", SDL_GetError());
+        goto done;
+    }
+
+    pixels = (Uint8 *)SDL_MapGPUTransferBuffer(device, download, false);
+    if (!pixels) {
+        SDL_Log("Couldn't map download buffer: %s", SDL_GetError());
+        goto done;
+    }
+    pixels += ((TARGET_SIZE / 2) * TARGET_SIZE + TARGET_SIZE / 2) * 4;
+    SDL_Log("Center pixel: %d,%d,%d,%d", pixels[0], pixels[1], pixels[2], pixels[3]);
+    if (pixels[0] == 0 && pixels[1] == 255 && pixels[2] == 0 && pixels[3] == 255) {
+        result = 0;
+    } else {
+        SDL_Log("Expected the triangle color 0,255,0,255");
+    }
+    SDL_UnmapGPUTransferBuffer(device, download);
+
+done:
+    /* The shaders have to outlive the compile, but the finished job stays uncollected */
+    if (uncollected_job) {
+        while (!SDL_QueryGPUPipelineJob(device, uncollected_job)) {
+            SDL_Delay(1);
+        }
+    }
+    if (fence) {
+        SDL_ReleaseGPUFence(device, fence);
+    }
+    SDL_ReleaseGPUTransferBuffer(device, download);
+    SDL_ReleaseGPUTransferBuffer(device, upload);
+    SDL_ReleaseGPUBuffer(device, vertex_buffer);
+    SDL_ReleaseGPUTexture(device, target);
+    SDL_ReleaseGPUGraphicsPipeline(device, pipeline);
+    SDL_ReleaseGPUShader(device, vertex_shader);
+    SDL_ReleaseGPUShader(device, fragment_shader);
+    DestroyHeadlessGPUDevice(device);
+    return result;
+}
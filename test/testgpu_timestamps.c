@@ -0,0 +1,176 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Times a render, compute and copy pass with GPU timestamps on a headless device.
+ *
+ * Runs without a window, so a software Vulkan implementation is enough, e.g.
+ *   VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json ./testgpu_timestamps
+ *
+ * Devices that can't record timestamps (Metal, or Vulkan queues without
+ * timestamp bits) are reported and skipped.
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+
+#include "gpuutils.h"
+
+#define TARGET_SIZE 256
+#define NUM_PASSES  3
+
+static const char *PassTypeName(SDL_GPUPassType type)
+{
+    switch (type) {
+    case SDL_GPU_PASSTYPE_RENDER:
+        return "render";
+    case SDL_GPU_PASSTYPE_COMPUTE:
+        return "compute";
+    case SDL_GPU_PASSTYPE_COPY:
+        return "copy";
+    }
+    return "unknown";
+}
+
+int main(int argc, char *argv[])
+{
+    static const SDL_GPUPassType expected[NUM_PASSES] = {
+        SDL_GPU_PASSTYPE_RENDER, SDL_GPU_PASSTYPE_COMPUTE, SDL_GPU_PASSTYPE_COPY
+    };
+    SDL_GPUDevice *device;
+    SDL_GPUTextureCreateInfo texture_info;
+    SDL_GPUTransferBufferCreateInfo transfer_info;
+    SDL_GPUTexture *target = NULL;
+    SDL_GPUTransferBuffer *transfer = NULL;
+    SDL_GPUCommandBuffer *cmdbuf;
+    SDL_GPUColorTargetInfo color_target;
+    SDL_GPUTextureRegion region;
+    SDL_GPUTextureTransferInfo destination;
+    SDL_GPURenderPass *render_pass;
+    SDL_GPUComputePass *compute_pass;
+    SDL_GPUCopyPass *copy_pass;
+    SDL_GPUFence *fence;
+    SDL_GPUPassTiming *timings = NULL;
+    int count = 0;
+    int result = 1;
+    int i;
+
+    device = CreateHeadlessGPUDevice(SDL_GPU_SHADERFORMAT_SPIRV | SDL_GPU_SHADERFORMAT_DXIL | SDL_GPU_SHADERFORMAT_MSL, 0);
+    if (!device) {
+        return 1;
+    }
+
+    SDL_zero(texture_info);
+    texture_info.type = SDL_GPU_TEXTURETYPE_2D;
+    texture_info.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+    texture_info.usage = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET;
+    texture_info.width = TARGET_SIZE;
+    texture_info.height = TARGET_SIZE;
+    texture_info.layer_count_or_depth = 1;
+    texture_info.num_levels = 1;
+    target = SDL_CreateGPUTexture(device, &texture_info);
+
+    SDL_zero(transfer_info);
+    transfer_info.usage = SDL_GPU_TRANSFERBUFFERUSAGE_DOWNLOAD;
+    transfer_info.size = TARGET_SIZE * TARGET_SIZE * 4;
+    transfer = SDL_CreateGPUTransferBuffer(device, &transfer_info);
+    if (!target || !transfer) {
+        SDL_Log("Couldn't create resources: %s", SDL_GetError());
+        goto done;
+    }
+
+    cmdbuf = SDL_AcquireGPUCommandBuffer(device);
+    if (!cmdbuf) {
+        SDL_Log("Couldn't acquire command buffer: %s", SDL_GetError());
+        goto done;
+    }
+    if (!SDL_EnableGPUTimestamps(cmdbuf)) {
+        SDL_Log("Timestamps aren't supported, skipping: %s", SDL_GetError());
+        SDL_CancelGPUCommandBuffer(cmdbuf);
+        result = 0;
+        goto done;
+    }
+
+    SDL_zero(color_target);
+    color_target.texture = target;
+    color_target.clear_color.r = 1.0f;
+    color_target.clear_color.a = 1.0f;
+    color_target.load_op = SDL_GPU_LOADOP_CLEAR;
+    color_target.store_op = SDL_GPU_STOREOP_STORE;
+    render_pass = SDL_BeginGPURenderPass(cmdbuf, &color_target, 1, NULL);
+    SDL_EndGPURenderPass(render_pass);
+
+    compute_pass = SDL_BeginGPUComputePass(cmdbuf, NULL, 0, NULL, 0);
+    SDL_EndGPUComputePass(compute_pass);
+
+    SDL_zero(region);
+    region.texture = target;
+    region.w = TARGET_SIZE;
+    region.h = TARGET_SIZE;
+    region.d = 1;
+    SDL_zero(destination);
+    destination.transfer_buffer = transfer;
+    copy_pass = SDL_BeginGPUCopyPass(cmdbuf);
+    SDL_DownloadFromGPUTexture(copy_pass, &region, &destination);
+    SDL_EndGPUCopyPass(copy_pass);
+
+    fence = SDL_SubmitGPUCommandBufferAndAcquireFence(cmdbuf);
+    if (!fence) {
+        SDL_Log("Couldn't submit: %s", SDL_GetError());
+        goto done;
+    }
+    if (SDL_WaitForGPUFences(device, true, &fence, 1)) {
+        timings = SDL_GetGPUPassTimings(device, fence, &count);
+        if (!timings) {
+            SDL_Log("Couldn't get pass timings: %s", SDL_GetError());
+        }
+    } else {
+        SDL_Log("Couldn't wait for the fence: %s", SDL_GetError());
+    }
+    SDL_ReleaseGPUFence(device, fence);
+    if (!timings) {
+        goto done;
+    }
+
+    if (count != NUM_PASSES) {
+        SDL_Log("Expected %d timings, got %d", NUM_PASSES, count);
+        goto done;
+    }
+    for (i = 0; i < count; i += 1) {
+        SDL_Log("%-8s pass: start %10.3f us, duration %10.3f us", PassTypeName(timings[i].type),
+                timings[i].start_ns / 1000.0, timings[i].duration_ns / 1000.0);
+        if (timings[i].type != expected[i]) {
+            SDL_Log("Pass %d should be a %s pass", i, PassTypeName(expected[i]));
+            goto done;
+        }
+        /* Passes are timed in recording order, and nothing here takes anywhere near a second */
+        if (i > 0 && timings[i].start_ns < timings[i - 1].start_ns) {
+            SDL_Log("Pass %d started before the pass recorded ahead of it", i);
+            goto done;
+        }
+        if (timings[i].duration_ns > SDL_NS_PER_SECOND) {
+            SDL_Log("Pass %d took implausibly long", i);
+            goto done;
+        }
+    }
+    if (timings[0].start_ns != 0) {
+        SDL_Log("The first pass should start at 0");
+        goto done;
+    }
+    result = 0;
+
+done:
+    SDL_free(timings);
+    SDL_ReleaseGPUTransferBuffer(device, transfer);
+    SDL_ReleaseGPUTexture(device, target);
+    DestroyHeadlessGPUDevice(device);
+    return result;
+}
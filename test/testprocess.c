@@ -1127,6 +1127,61 @@ failed:
     return TEST_ABORTED;
 }
 
+static int SDLCALL process_testLargeOutput(void *arg)
+{
+    TestProcessData *data = (TestProcessData *)arg;
+    const size_t expected_size = 64 * 1024 * 1024;
+    char count[32];
+    const char *process_args[] = {
+        data->childprocess_path,
+        "--stdout-bytes",
+        count,
+        NULL
+    };
+    SDL_Process *process = NULL;
+    Uint8 *buffer;
+    int exit_code;
+    size_t total_read = 0;
+    size_t i;
+    Uint64 start;
+
+    SDL_snprintf(count, sizeof(count), "%" SDL_PRIu64, (Uint64)expected_size);
+
+    process = SDL_CreateProcess(process_args, true);
+    SDLTest_AssertCheck(process != NULL, "SDL_CreateProcess()");
+    if (!process) {
+        goto failed;
+    }
+
+    /* SDL_ReadProcess() loads the stdout pipe with SDL_LoadFile_IO(), which can't know the size up front */
+    start = SDL_GetTicksNS();
+    exit_code = 0xdeadbeef;
+    buffer = (Uint8 *)SDL_ReadProcess(process, &total_read, &exit_code);
+    SDLTest_Log("Read %" SDL_PRIu64 " bytes from a pipe in %" SDL_PRIu64 " ms",
+                (Uint64)total_read, SDL_NS_TO_MS(SDL_GetTicksNS() - start));
+    SDLTest_AssertCheck(buffer != NULL, "SDL_ReadProcess()");
+    SDLTest_AssertCheck(exit_code == 0, "Exit code should be 0, is %d", exit_code);
+    if (!buffer) {
+        goto failed;
+    }
+    SDLTest_AssertCheck(total_read == expected_size, "Expected %" SDL_PRIu64 " bytes, got %" SDL_PRIu64,
+                        (Uint64)expected_size, (Uint64)total_read);
+    for (i = 0; i < total_read; i++) {
+        if (buffer[i] != (Uint8)i) {
+            break;
+        }
+    }
+    SDLTest_AssertCheck(i == total_read, "Output should match the pattern, first mismatch at %" SDL_PRIu64, (Uint64)i);
+    SDLTest_AssertCheck(buffer[total_read] == '\0', "Output should be null terminated");
+    SDL_free(buffer);
+
+    SDL_DestroyProcess(process);
+    return TEST_COMPLETED;
+failed:
+    SDL_DestroyProcess(process);
+    return TEST_ABORTED;
+}
+
 static const SDLTest_TestCaseReference processTestArguments = {
     process_testArguments, "process_testArguments", "Test passing arguments to child process", TEST_ENABLED
 };
@@ -1187,6 +1242,10 @@ static const SDLTest_TestCaseReference processTestWindowsCmdlinePrecedence = {
     process_testWindowsCmdlinePrecedence, "process_testWindowsCmdlinePrecedence", "Test SDL_PROP_PROCESS_CREATE_CMDLINE_STRING precedence over SDL_PROP_PROCESS_CREATE_ARGS_POINTER", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference processTestLargeOutput = {
+    process_testLargeOutput, "process_testLargeOutput", "Test reading a large amount of output through a pipe", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference *processTests[] = {
     &processTestArguments,
     &processTestExitCode,
@@ -1203,6 +1262,7 @@ static const SDLTest_TestCaseReference *processTests[] = {
     &processTestFileRedirection,
     &processTestWindowsCmdline,
     &processTestWindowsCmdlinePrecedence,
+    &processTestLargeOutput,
     NULL
 };
 